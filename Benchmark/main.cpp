@@ -0,0 +1,93 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <ctime>
+#include <thread>
+
+namespace
+{
+	void PrintResults(const char* InTitle, const TArray<FBenchmarkResult>& InResults)
+	{
+		printf("%s (baseline / engine, ms)\n", InTitle);
+		for (const FString& Line : FBenchmark::FormatResults(InResults))
+		{
+			printf("  %s\n", Line.c_str());
+		}
+	}
+
+	/**
+	 * @brief 검증 결과를 출력하고 통과 여부를 반환하는 함수
+	 */
+	bool PrintMismatches(const char* InTitle, const TArray<FString>& InMismatches)
+	{
+		for (const FString& Mismatch : InMismatches)
+		{
+			printf("  [FAIL] %s mismatch - %s\n", InTitle, Mismatch.c_str());
+		}
+		return InMismatches.IsEmpty();
+	}
+}
+
+/**
+ * @brief D3D11 / Win32 없이 코어 타입, 할당자, Global 수학 벤치마크를 실행하는 콘솔 진입점
+ * 사용법: Benchmark [원소 수 (기본 1024)] [결과 폴더 (기본 Saved/Benchmark)]
+ * 결과는 에디터의 BENCH CORE와 같은 JSON / CSV 형식으로 저장되며, 검증 실패가 있으면 1을 반환한다
+ */
+int main(int argc, char* argv[])
+{
+	int32 NumElements = 1024;
+	if (argc > 1)
+	{
+		NumElements = max(atoi(argv[1]), 2);
+	}
+	const path OutputDirectory = argc > 2 ? path(argv[2]) : path("Saved") / "Benchmark";
+
+	TArray<FBenchmarkResult> AllResults;
+	bool bAllPassed = true;
+
+	TArray<FBenchmarkResult> Results = FBenchmark::RunHashContainerBenchmarks(NumElements);
+	Results.Append(FBenchmark::RunCoreBenchmarks(NumElements));
+	PrintResults("Core Benchmark", Results);
+	AllResults.Append(Results);
+
+	const int32 NumThreads = static_cast<int32>(max(std::thread::hardware_concurrency(), 1u));
+	Results = FBenchmark::RunAllocatorBenchmarks(NumThreads, 1000000);
+	PrintResults("Allocator Benchmark", Results);
+	AllResults.Append(Results);
+
+	TArray<FString> Mismatches;
+	Results = FBenchmark::RunMatrixBenchmarks(NumElements, Mismatches);
+	PrintResults("Matrix Benchmark", Results);
+	bAllPassed &= PrintMismatches("Matrix kernel", Mismatches);
+	AllResults.Append(Results);
+
+	// 변환 / 컬링은 에디터 명령의 기본값과 같은 씬 규모로 측정
+	Mismatches.Reset();
+	Results = FBenchmark::RunTransformBenchmarks(100000, Mismatches);
+	PrintResults("Transform Benchmark", Results);
+	bAllPassed &= PrintMismatches("Transform batch", Mismatches);
+	AllResults.Append(Results);
+
+	Mismatches.Reset();
+	Results = FBenchmark::RunCullingBenchmarks(100000, Mismatches);
+	PrintResults("Culling Benchmark", Results);
+	bAllPassed &= PrintMismatches("Culling", Mismatches);
+	AllResults.Append(Results);
+
+	std::error_code ErrorCode;
+	create_directories(OutputDirectory, ErrorCode);
+
+	const FString BaseName = "HeadlessBenchmark_" + std::to_string(time(nullptr));
+	const FString JsonPath = (OutputDirectory / (BaseName + ".json")).string();
+	const FString CsvPath = (OutputDirectory / (BaseName + ".csv")).string();
+	if (FBenchmark::SaveResultsToJson(AllResults, JsonPath) && FBenchmark::SaveResultsToCsv(AllResults, CsvPath))
+	{
+		printf("Benchmark results saved: %s (.csv)\n", JsonPath.c_str());
+	}
+	else
+	{
+		printf("Failed to save benchmark results: %s\n", OutputDirectory.string().c_str());
+	}
+
+	return bAllPassed ? 0 : 1;
+}
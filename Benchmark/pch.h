@@ -0,0 +1,71 @@
+#pragma once
+
+// 헤드리스 Benchmark 프로젝트 전용 pch
+// 프로젝트 폴더가 포함 경로 맨 앞에 있으므로 엔진 소스의 #include "pch.h"는 엔진 pch 대신 이 파일을 찾는다
+// windows.h / d3d11.h / 에디터 헤더 없이 표준 라이브러리, 헤더 전용 코어 템플릿, Global 수학 타입만 포함한다
+
+// Standard Library
+#include <cmath>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <functional>
+#include <filesystem>
+#include <iterator>
+#include <sstream>
+#include <queue>
+#include <mutex>
+#include <atomic>
+
+// Global 헤더가 사용하는 Win32 타입 / 매크로 (windows.h 대신 같은 정의를 직접 둔다)
+using INT = int;
+using LONG = long;
+using SIZE_T = size_t;
+
+#ifndef FORCEINLINE
+#if defined(_MSC_VER)
+#define FORCEINLINE __forceinline
+#else
+#define FORCEINLINE inline __attribute__((always_inline))
+#endif
+#endif
+
+// Global Included
+#include "Global/Types.h"
+#include "Global/Memory.h"
+#include "Global/Constant.h"
+#include "Global/Enum.h"
+#include "Global/Matrix.h"
+#include "Global/Quaternion.h"
+#include "Global/Vector.h"
+#include "Global/CoreTypes.h"
+#include "Global/Transform.h"
+
+// Pointer
+#include "Source/Runtime/Core/Public/Templates/SharedPtr.h"
+#include "Source/Runtime/Core/Public/Templates/UniquePtr.h"
+
+using std::clamp;
+using std::unordered_map;
+using std::to_string;
+using std::function;
+using std::min;
+using std::max;
+using std::sort;
+using std::mutex;
+using std::lock_guard;
+using std::atomic;
+using std::streamsize;
+using std::ofstream;
+using std::ifstream;
+
+// File System
+namespace filesystem = std::filesystem;
+using filesystem::path;
+using filesystem::exists;
+using filesystem::create_directories;
@@ -95,7 +95,7 @@ bool FObjImporter::ParseMaterialLibrary(const FString& InMTLFilePath,
 			continue; // 빈 줄과 주석은 건너뜀
 		}
 
-		TArray<FString> Tokens;
+		FTokenArray Tokens;
 		SplitString(MTLLine, ' ', Tokens);
 
 		if (Tokens.IsEmpty())
@@ -105,9 +105,8 @@ bool FObjImporter::ParseMaterialLibrary(const FString& InMTLFilePath,
 
 		if (Tokens[0] == "newmtl" && Tokens.Num() > 1)
 		{
-			// 새 재질
-			OutMaterialLibrary[Tokens[1]] = FObjMaterialInfo(Tokens[1]);
-			CurrentMaterial = &OutMaterialLibrary[Tokens[1]];
+			// 새 재질 (맵 포인터는 다음 삽입 전까지만 유효하므로 newmtl마다 다시 받음)
+			CurrentMaterial = &OutMaterialLibrary.Add(Tokens[1], FObjMaterialInfo(Tokens[1]));
 		}
 		else if (CurrentMaterial != nullptr)
 		{
@@ -267,7 +266,7 @@ void FObjImporter::ParseOBJLine(const FString& Line,
 		return; // 빈 줄과 주석은 건너뜀
 	}
 
-	TArray<FString> Tokens;
+	FTokenArray Tokens;
 	SplitString(TrimmedLine, ' ', Tokens);
 	if (Tokens.IsEmpty())
 	{
@@ -380,7 +379,7 @@ void FObjImporter::ParseOBJLine(const FString& Line,
 
 int32 FObjImporter::ParseFaceData(const FString& FaceData, FObjInfo& CurrentObject)
 {
-	TArray<FString> FaceVertices;
+	FTokenArray FaceVertices;
 	SplitString(FaceData, ' ', FaceVertices);
 
 	size_t VertexCountBefore = CurrentObject.VertexIndexList.Num();
@@ -389,7 +388,7 @@ int32 FObjImporter::ParseFaceData(const FString& FaceData, FObjInfo& CurrentObje
 	for (int32 i = 1; i < FaceVertices.Num() - 1; ++i)
 	{
 		// 삼각형의 각 정점을 파싱
-		TArray<FString> VertexComponents[3];
+		FTokenArray VertexComponents[3];
 		SplitString(FaceVertices[0], '/', VertexComponents[0]);
 		SplitString(FaceVertices[i], '/', VertexComponents[1]);
 		SplitString(FaceVertices[i + 1], '/', VertexComponents[2]);
@@ -563,19 +562,27 @@ FString FObjImporter::TrimString(const FString& String)
 	return String.substr(Start, End - Start + 1);
 }
 
-void FObjImporter::SplitString(const FString& String, char Delimiter, TArray<FString>& OutTokens)
+void FObjImporter::SplitString(const FString& String, char Delimiter, FTokenArray& OutTokens)
 {
 	OutTokens.Empty();
-	std::stringstream StringStream(String);
-	std::string Token;
 
-	while (std::getline(StringStream, Token, Delimiter))
+	// stringstream 생성 비용을 피하기 위해 구분자를 직접 탐색
+	size_t Start = 0;
+	while (Start <= String.size())
 	{
-		FString TrimmedToken = TrimString(FString(Token));
+		size_t End = String.find(Delimiter, Start);
+		if (End == FString::npos)
+		{
+			End = String.size();
+		}
+
+		FString TrimmedToken = TrimString(FString(String.substr(Start, End - Start)));
 		if (!TrimmedToken.empty())
 		{
-			OutTokens.Add(TrimmedToken);
+			OutTokens.Add(std::move(TrimmedToken));
 		}
+
+		Start = End + 1;
 	}
 }
 
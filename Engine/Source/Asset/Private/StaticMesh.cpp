@@ -9,6 +9,25 @@
 
 IMPLEMENT_CLASS(UStaticMesh, UObject)
 
+BEGIN_PROPERTY_TABLE(FStaticMeshSection)
+	PROPERTY(StartIndex)
+	PROPERTY(IndexCount)
+	PROPERTY(MaterialSlotIndex)
+	PROPERTY(MaterialName)
+END_PROPERTY_TABLE()
+
+BEGIN_PROPERTY_TABLE(FObjMaterialInfo)
+	PROPERTY(MaterialName)
+	PROPERTY(DiffuseTexturePath)
+	PROPERTY(NormalTexturePath)
+	PROPERTY(SpecularTexturePath)
+	PROPERTY(AmbientColorScalar)
+	PROPERTY(DiffuseColorScalar)
+	PROPERTY(SpecularColorScalar)
+	PROPERTY(ShininessScalar)
+	PROPERTY(TransparencyScalar)
+END_PROPERTY_TABLE()
+
 UStaticMesh::UStaticMesh()
 {
 }
@@ -22,6 +41,7 @@ void UStaticMesh::SetStaticMeshData(const FStaticMesh& InStaticMeshData)
 {
 	ReleaseRenderBuffers();
 	StaticMeshData = InStaticMeshData;
+	LocalBounds = CalculateAABB();
 	CreateRenderBuffers();
 }
 
@@ -134,8 +154,9 @@ bool UStaticMesh::SaveToBinary(const FString& FilePath) const
 	try
 	{
 		// 헤더 정보
+		// Version 2: Sections 뒤에 로컬 AABB 추가
 		FString MagicNumber = "MESH";
-		uint32 Version = 1;
+		uint32 Version = 2;
 		Writer << MagicNumber;
 		Writer << Version;
 
@@ -143,35 +164,16 @@ bool UStaticMesh::SaveToBinary(const FString& FilePath) const
 		FString PathFileName = StaticMeshData.PathFileName;
 		Writer << PathFileName;
 
-		// StaticMeshData -> Vertices 저장
-		uint32 VertexCount = static_cast<uint32>(StaticMeshData.Vertices.Num());
-		Writer << VertexCount;
-		for (FVertex Vertex : StaticMeshData.Vertices)
-		{
-			Writer << Vertex.Position;
-			Writer << Vertex.Color;
-			Writer << Vertex.TextureCoord;
-			Writer << Vertex.Normal;
-		}
-
-		// StaticMeshData -> Indices 저장
-		uint32 IndexCount = static_cast<uint32>(StaticMeshData.Indices.Num());
-		Writer << IndexCount;
-		for (uint32 Index : StaticMeshData.Indices)
-		{
-			Writer << Index;
-		}
+		// StaticMeshData -> Vertices / Indices / Sections 저장
+		// FVertex와 인덱스는 패딩 없는 POD이므로 배열 전체가 한 번에 기록된다
+		FStaticMesh& MeshData = const_cast<FStaticMesh&>(StaticMeshData);
+		SerializeArray(Writer, MeshData.Vertices);
+		SerializeArray(Writer, MeshData.Indices);
+		SerializeArray(Writer, MeshData.Sections);
 
-		// StaticMeshData -> Sections 저장
-		uint32 SectionCount = static_cast<uint32>(StaticMeshData.Sections.Num());
-		Writer << SectionCount;
-		for (const FStaticMeshSection& Section : StaticMeshData.Sections)
-		{
-			Writer << (int32&)Section.StartIndex;
-			Writer << (int32&)Section.IndexCount;
-			Writer << (int32&)Section.MaterialSlotIndex;
-			Writer << (FString&)Section.MaterialName;
-		}
+		// 로컬 AABB 저장
+		FAABB Bounds = LocalBounds;
+		Writer << Bounds.Min << Bounds.Max;
 
 		// MaterialSlots 저장
 		uint32 MaterialSlotCount = static_cast<uint32>(MaterialSlots.Num());
@@ -179,16 +181,8 @@ bool UStaticMesh::SaveToBinary(const FString& FilePath) const
 		for (UMaterialInterface* MaterialInterface : MaterialSlots)
 		{
 			UMaterial* Material = Cast<UMaterial>(MaterialInterface);
-			const FObjMaterialInfo& MaterialInfo = Material ? Material->GetMaterialInfo() : FObjMaterialInfo();
-			Writer << (FString&)MaterialInfo.MaterialName;
-			Writer << (FString&)MaterialInfo.DiffuseTexturePath;
-			Writer << (FString&)MaterialInfo.NormalTexturePath;
-			Writer << (FString&)MaterialInfo.SpecularTexturePath;
-			Writer << (FVector&)MaterialInfo.AmbientColorScalar;
-			Writer << (FVector&)MaterialInfo.DiffuseColorScalar;
-			Writer << (FVector&)MaterialInfo.SpecularColorScalar;
-			Writer << (float&)MaterialInfo.ShininessScalar;
-			Writer << (float&)MaterialInfo.TransparencyScalar;
+			FObjMaterialInfo MaterialInfo = Material ? Material->GetMaterialInfo() : FObjMaterialInfo();
+			SerializeProperties(Writer, MaterialInfo);
 		}
 
 		Writer.Close();
@@ -223,7 +217,7 @@ bool UStaticMesh::LoadFromBinary(const FString& FilePath)
 		Reader << MagicNumber;
 		Reader << Version;
 
-		if (MagicNumber != "MESH" || Version != 1)
+		if (MagicNumber != "MESH" || (Version != 1 && Version != 2))
 		{
 			UE_LOG("UStaticMesh: Invalid binary format or version: %s", FilePath.c_str());
 			return false;
@@ -235,38 +229,19 @@ bool UStaticMesh::LoadFromBinary(const FString& FilePath)
 		// StaticMeshData -> PathFileName 로드
 		Reader << StaticMeshData.PathFileName;
 
-		// StaticMeshData -> Vertices 로드
-		uint32 VertexCount;
-		Reader << VertexCount;
-		StaticMeshData.Vertices.SetNum(VertexCount);
-		for (uint32 i = 0; i < VertexCount; ++i)
-		{
-			Reader << StaticMeshData.Vertices[i].Position;
-			Reader << StaticMeshData.Vertices[i].Color;
-			Reader << StaticMeshData.Vertices[i].TextureCoord;
-			Reader << StaticMeshData.Vertices[i].Normal;
-		}
+		// StaticMeshData -> Vertices / Indices / Sections 로드
+		SerializeArray(Reader, StaticMeshData.Vertices);
+		SerializeArray(Reader, StaticMeshData.Indices);
+		SerializeArray(Reader, StaticMeshData.Sections);
 
-		// StaticMeshData -> Indices 로드
-		uint32 IndexCount;
-		Reader << IndexCount;
-		StaticMeshData.Indices.SetNum(IndexCount);
-		for (uint32 i = 0; i < IndexCount; ++i)
+		// 로컬 AABB 로드 (Version 1 캐시에는 없으므로 정점으로부터 계산)
+		if (Version >= 2)
 		{
-			Reader << StaticMeshData.Indices[i];
+			Reader << LocalBounds.Min << LocalBounds.Max;
 		}
-
-		// StaticMeshData -> Sections 로드
-		uint32 SectionCount;
-		Reader << SectionCount;
-		StaticMeshData.Sections.SetNum(SectionCount);
-		for (uint32 i = 0; i < SectionCount; ++i)
+		else
 		{
-			FStaticMeshSection& Section = StaticMeshData.Sections[i];
-			Reader << (int32&)Section.StartIndex;
-			Reader << (int32&)Section.IndexCount;
-			Reader << (int32&)Section.MaterialSlotIndex;
-			Reader << (FString&)Section.MaterialName;
+			LocalBounds = CalculateAABB();
 		}
 
 		// MaterialSlots 로드
@@ -276,15 +251,7 @@ bool UStaticMesh::LoadFromBinary(const FString& FilePath)
 		for (uint32 i = 0; i < MaterialSlotCount; ++i)
 		{
 			FObjMaterialInfo MaterialInfo;
-			Reader << (FString&)MaterialInfo.MaterialName;
-			Reader << (FString&)MaterialInfo.DiffuseTexturePath;
-			Reader << (FString&)MaterialInfo.NormalTexturePath;
-			Reader << (FString&)MaterialInfo.SpecularTexturePath;
-			Reader << (FVector&)MaterialInfo.AmbientColorScalar;
-			Reader << (FVector&)MaterialInfo.DiffuseColorScalar;
-			Reader << (FVector&)MaterialInfo.SpecularColorScalar;
-			Reader << (float&)MaterialInfo.ShininessScalar;
-			Reader << (float&)MaterialInfo.TransparencyScalar;
+			SerializeProperties(Reader, MaterialInfo);
 
 			// 먼저 기존 머티리얼 중에서 이름이 같은 것이 있는지 확인
 			bool bFound = false;
@@ -10,6 +10,9 @@
 struct FObjImporter
 {
 public:
+	// 한 줄을 분할한 토큰 배열 (OBJ/MTL 한 줄의 토큰 수는 대부분 인라인 용량 이하)
+	using FTokenArray = TArray<FString, TInlineAllocator<8>>;
+
 	FObjImporter() = default;
 	~FObjImporter() = default;
 
@@ -100,7 +103,7 @@ private:
 	 * @param Delimiter 구분자 문자
 	 * @param OutTokens 결과 토큰 배열
 	 */
-	static void SplitString(const FString& String, char Delimiter, TArray<FString>& OutTokens);
+	static void SplitString(const FString& String, char Delimiter, FTokenArray& OutTokens);
 
 	/**
 	 * @brief OBJ 위치를 UE 좌표계로 변환
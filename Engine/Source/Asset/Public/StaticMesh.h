@@ -84,11 +84,17 @@ public:
 	void ReleaseRenderBuffers();
 
 	/**
-	 * @brief 메시의 AABB를 계산
+	 * @brief 메시의 AABB를 정점 전체를 순회해 계산
+	 * 메시 데이터가 바뀔 때 LocalBounds를 갱신하는 용도이며, 조회에는 GetLocalBounds를 사용한다
 	 * @return 계산된 AABB
 	 */
 	FAABB CalculateAABB() const;
 
+	/**
+	 * @brief 메시 데이터 설정 / 로드 시점에 한 번 계산해 둔 로컬 AABB를 가져옴
+	 */
+	const FAABB& GetLocalBounds() const { return LocalBounds; }
+
 	/**
 	 * @brief 메시 데이터를 바이너리 파일로 저장
 	 * @param FilePath 저장할 파일 경로
@@ -134,6 +140,9 @@ protected:
 
 	TArray<UMaterialInterface*> MaterialSlots;
 
+	/** 로컬 공간 AABB (바이너리 캐시에 함께 저장) */
+	FAABB LocalBounds;
+
 	/** 정점 버퍼 */
 	ID3D11Buffer* VertexBuffer = nullptr;
 
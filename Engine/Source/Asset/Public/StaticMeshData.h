@@ -50,6 +50,9 @@ struct FObjMaterialInfo
 		: MaterialName(InMaterialName)
 	{
 	}
+
+	// 바이너리 캐시에 저장되는 프로퍼티 (텍스쳐 경로 및 Scalar 값)
+	DECLARE_PROPERTY_TABLE()
 };
 
 /**
@@ -127,6 +130,8 @@ struct FStaticMeshSection
 	
 	// 파싱 단계 전용 (런타임에서는 MaterialSlotIndex 사용 권장)
 	bool HasMaterialName() const { return !MaterialName.IsEmpty(); }
+
+	DECLARE_PROPERTY_TABLE()
 };
 
 /**
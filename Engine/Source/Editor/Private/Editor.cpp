@@ -15,6 +15,12 @@
 
 IMPLEMENT_CLASS(UEditor, UObject)
 
+namespace
+{
+	// 피킹 후보를 찾을 때 쓰는 광선 길이 (카메라 Far 평면보다 충분히 길게)
+	constexpr float PickingRayLength = 100000.0f;
+}
+
 UEditor::UEditor()
 {
 }
@@ -366,7 +372,7 @@ void UEditor::HandleNewInteraction(const FRay& InWorldRay)
 			TObjectPtr<AActor> PickedActor = nullptr;
 			if (CurrentLevel->GetShowFlags() & EEngineShowFlags::SF_Primitives)
 			{
-				TArray<UPrimitiveComponent*> Candidate = FindCandidateActors(CurrentLevel);
+				TArray<UPrimitiveComponent*> Candidate = FindCandidateActors(CurrentLevel, InWorldRay);
 
 				float ActorDistance = -1.0f;
 
@@ -386,24 +392,15 @@ void UEditor::HandleNewInteraction(const FRay& InWorldRay)
 
 /**
  * @brief 충돌할만한 Actor들을 탐색하는 과정
+ * 레벨의 공간 인덱스로 광선과 월드 AABB가 겹치는 프리미티브만 가까운 순으로 가져온다
  * @param InLevel 현재 Level
+ * @param InWorldRay 마우스 커서에서 월드 공간으로 쏜 Ray
  * @return 충돌이 예측되는 Primitive 모음
  */
-TArray<UPrimitiveComponent*> UEditor::FindCandidateActors(const ULevel* InLevel)
+TArray<UPrimitiveComponent*> UEditor::FindCandidateActors(const ULevel* InLevel, const FRay& InWorldRay)
 {
 	TArray<UPrimitiveComponent*> Candidate;
-
-	for (AActor* Actor : InLevel->GetLevelActors())
-	{
-		for (auto& ActorComponent : Actor->GetOwnedComponents())
-		{
-			TObjectPtr<UPrimitiveComponent> Primitive = Cast<UPrimitiveComponent>(ActorComponent);
-			if (Primitive)
-			{
-				Candidate.Add(Primitive);
-			}
-		}
-	}
+	InLevel->QueryPrimitivesAlongRay(InWorldRay, PickingRayLength, Candidate);
 
 	// TODO(KHJ): Actor 단위로 바꿔줘야 할 듯?
 	return Candidate;
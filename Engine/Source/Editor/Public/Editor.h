@@ -1,5 +1,6 @@
 #pragma once
 #include "Runtime/Core/Public/Object.h"
+#include "Runtime/Core/Public/WeakObjectPtr.h"
 #include "Runtime/Actor/Public/CameraActor.h"
 #include "Editor/Public/ObjectPicker.h"
 #include "Editor/Public/Gizmo.h"
@@ -39,9 +40,9 @@ public:
 	ACameraActor* GetCamera() const { return Camera.Get(); }
 
 	// Selection Management
-	TObjectPtr<AActor> GetSelectedActor() const { return SelectedActor; }
+	TObjectPtr<AActor> GetSelectedActor() const { return TObjectPtr<AActor>(SelectedActor.Get()); }
 	void SetSelectedActor(AActor* InActor) { SelectedActor = InActor; }
-	bool HasSelectedActor() const { return SelectedActor != nullptr; }
+	bool HasSelectedActor() const { return SelectedActor.IsValid(); }
 
 	// Gizmo Management
 	UGizmo* GetGizmo() const { return Gizmo.Get(); }
@@ -54,7 +55,8 @@ private:
 	TObjectPtr<UGizmo> Gizmo = nullptr;
 
 	// Selection Management
-	TObjectPtr<AActor> SelectedActor = nullptr;
+	// 레벨 전환 등으로 Actor가 먼저 소멸될 수 있으므로 약참조로 보관
+	TWeakObjectPtr<AActor> SelectedActor;
 
 	const float MinScale = 0.01f;
 	// Editor rendering resources moved to FRendererModule::GetEditorResources()
@@ -74,7 +76,7 @@ private:
 	static FRay CreateWorldRayFromMouse(const FViewportClient* InViewportClient, int32 InViewportIndex);
 	void UpdateGizmoDrag(const FRay& InWorldRay, ACameraActor& InPickingCamera);
 	void HandleNewInteraction(const FRay& InWorldRay);
-	static TArray<UPrimitiveComponent*> FindCandidateActors(const ULevel* InLevel);
+	static TArray<UPrimitiveComponent*> FindCandidateActors(const ULevel* InLevel, const FRay& InWorldRay);
 
 	FVector GetGizmoDragLocation(const FRay& InWorldRay, const FViewportClient* InViewportClient, const FViewport* InViewport, int32 InViewportIndex);
 	FVector GetGizmoDragLocationForPerspective(const FRay& InWorldRay, const FViewportClient* InViewportClient, int32 InViewportIndex);
@@ -1,6 +1,7 @@
 #pragma once
 #include "Editor/Public/EditorPrimitive.h"
 #include "Runtime/Core/Public/Object.h"
+#include "Runtime/Core/Public/WeakObjectPtr.h"
 #include "Runtime/Actor/Public/Actor.h"
 
 class ACameraActor;
@@ -72,7 +73,7 @@ public:
 	float GetTranslateHeight() const { return TranslateCollisionConfig.Height * GetCurrentRenderScale(); }
 	float GetRotateOuterRadius() const { return RotateCollisionConfig.OuterRadius * GetCurrentRenderScale(); }
 	float GetRotateInnerRadius() const { return RotateCollisionConfig.InnerRadius * GetCurrentRenderScale(); }
-	AActor* GetSelectedActor() const { return TargetActor; }
+	AActor* GetSelectedActor() const { return TargetActor.Get(); }
 	void SetSelectedActor(TObjectPtr<AActor> InActor) { TargetActor = InActor; }
 	bool IsInRadius(float InRadius) const;
 
@@ -135,7 +136,7 @@ private:
 	FVector4 ColorFor(EGizmoDirection InAxis, int32 ViewportIndex) const;
 
 	TArray<FEditorPrimitive> Primitives;
-	AActor* TargetActor = nullptr;
+	TWeakObjectPtr<AActor> TargetActor;
 
 	TArray<FVector4> GizmoColor;
 	FVector DragStartActorLocation;
@@ -22,6 +22,8 @@ TObjectPtr<T> NewObject(TObjectPtr<UObject> InOuter = nullptr, TObjectPtr<UClass
 {
 	static_assert(is_base_of_v<UObject, T>, "생성할 클래스는 UObject를 반드시 상속 받아야 합니다");
 
+	FMemoryTagScope MemoryTagScope(EMemoryTag::Object);
+
 	TObjectPtr<UClass> ClassToUse = InClass ? InClass : T::StaticClass();
 
 	// Factory를 사용하여 생성 시도
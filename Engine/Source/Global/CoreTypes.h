@@ -1,6 +1,7 @@
 #pragma once
 #include "Global/Vector.h"
 #include "Global/Matrix.h"
+#include "Runtime/Core/Public/Property.h"
 
 //struct BatchLineContants
 //{
@@ -47,6 +48,8 @@ struct FVertex
 		  TextureCoord(FVector2(0.0f, 0.0f))
 	{
 	}
+
+	DECLARE_PROPERTY_TABLE()
 };
 
 struct FRay
@@ -1,4 +1,5 @@
 #include "pch.h"
+#include "Global/MatrixMath.h"
 
 /**
 * @brief float 타입의 배열을 사용한 FMatrix의 기본 생성자
@@ -56,27 +57,16 @@ FMatrix FMatrix::Identity()
 /**
 * @brief 두 행렬곱을 진행한 행렬을 반환하는 연산자 함수
 */
-FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix)
+FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix) const
 {
 	FMatrix Result;
-
-	for (int32 i = 0; i < 4; ++i)
-	{
-		for (int32 j = 0; j < 4; ++j)
-		{
-			for (int32 k = 0; k < 4; ++k)
-			{
-				Result.Data[i][j] += Data[i][k] * InOtherMatrix.Data[k][j];
-			}
-		}
-	}
-
+	MatrixMath::Multiply(Result, *this, InOtherMatrix);
 	return Result;
 }
 
 void FMatrix::operator*=(const FMatrix& InOtherMatrix)
 {
-	*this =  (*this)*InOtherMatrix;
+	MatrixMath::Multiply(*this, *this, InOtherMatrix);
 }
 
 /**
@@ -128,18 +118,49 @@ FMatrix FMatrix::ScaleMatrixInverse(const FVector& InOtherVector)
 	return Result;
 }
 
+namespace
+{
+	/**
+	 * @brief RotX(Pitch) * RotY(Yaw) * RotZ(Roll)의 3x3 부분을 행렬 곱 없이 전개하는 함수
+	 * @param InRotation (Pitch, Yaw, Roll) 라디안
+	 */
+	void GetEulerRotation(const FVector& InRotation, float OutRotation[3][3])
+	{
+		const float SX = std::sin(InRotation.X);
+		const float CX = std::cos(InRotation.X);
+		const float SY = std::sin(InRotation.Y);
+		const float CY = std::cos(InRotation.Y);
+		const float SZ = std::sin(InRotation.Z);
+		const float CZ = std::cos(InRotation.Z);
+
+		OutRotation[0][0] = CY * CZ;
+		OutRotation[0][1] = CY * SZ;
+		OutRotation[0][2] = -SY;
+
+		OutRotation[1][0] = SX * SY * CZ - CX * SZ;
+		OutRotation[1][1] = SX * SY * SZ + CX * CZ;
+		OutRotation[1][2] = SX * CY;
+
+		OutRotation[2][0] = CX * SY * CZ + SX * SZ;
+		OutRotation[2][1] = CX * SY * SZ - SX * CZ;
+		OutRotation[2][2] = CX * CY;
+	}
+}
+
 /**
 * @brief Rotation의 정보를 행렬로 변환하여 제공하는 함수
-* 좌표계 변환 제거 후에도 기존 회전 방식 유지
+* 기존 회전 순서(RotX(Pitch) * RotY(Yaw) * RotZ(Roll))를 닫힌 식으로 계산한다
 */
 FMatrix FMatrix::RotationMatrix(const FVector& InOtherVector)
 {
-	// 기존 회전 순서 유지 (작동하던 방식)
-	const float yaw = InOtherVector.Y;
-	const float pitch = InOtherVector.X;
-	const float roll = InOtherVector.Z;
+	float R[3][3];
+	GetEulerRotation(InOtherVector, R);
 
-	return RotationX(pitch) * RotationY(yaw) * RotationZ(roll);
+	return FMatrix(
+		R[0][0], R[0][1], R[0][2], 0,
+		R[1][0], R[1][1], R[1][2], 0,
+		R[2][0], R[2][1], R[2][2], 0,
+		0, 0, 0, 1);
 }
 
 FMatrix FMatrix::CreateFromYawPitchRoll(const float yaw, const float pitch, const float roll)
@@ -150,14 +171,19 @@ FMatrix FMatrix::CreateFromYawPitchRoll(const float yaw, const float pitch, cons
 	return RotationX(roll) * RotationY(pitch) * RotationZ(yaw);
 }
 
+/**
+* @brief RotationMatrix의 역행렬 (회전 행렬이므로 전치)
+*/
 FMatrix FMatrix::RotationMatrixInverse(const FVector& InOtherVector)
 {
-	const float yaw = InOtherVector.Y;
-	const float pitch = InOtherVector.X;
-	const float roll = InOtherVector.Z;
+	float R[3][3];
+	GetEulerRotation(InOtherVector, R);
 
-	// 기존 역회전 순서 유지
-	return RotationX(-pitch) * RotationY(-yaw) * RotationZ(-roll);
+	return FMatrix(
+		R[0][0], R[1][0], R[2][0], 0,
+		R[0][1], R[1][1], R[2][1], 0,
+		R[0][2], R[1][2], R[2][2], 0,
+		0, 0, 0, 1);
 }
 
 /**
@@ -166,8 +192,8 @@ FMatrix FMatrix::RotationMatrixInverse(const FVector& InOtherVector)
 FMatrix FMatrix::RotationX(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[1][1] = C;
 	Result.Data[1][2] = S;
@@ -183,8 +209,8 @@ FMatrix FMatrix::RotationX(float Radian)
 FMatrix FMatrix::RotationY(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[0][0] = C;
 	Result.Data[0][2] = -S;
@@ -200,8 +226,8 @@ FMatrix FMatrix::RotationY(float Radian)
 FMatrix FMatrix::RotationZ(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[0][0] = C;
 	Result.Data[0][1] = S;
@@ -211,64 +237,73 @@ FMatrix FMatrix::RotationZ(float Radian)
 	return Result;
 }
 
-//
+/**
+* @brief S * R * T 모델 행렬을 행렬 곱 없이 계산하는 함수
+* 3x3 부분은 각 행에 스케일을 곱한 회전, 이동 열은 (S * R) * Location이다
+*/
 FMatrix FMatrix::GetModelMatrix(const FVector& Location, const FVector& Rotation, const FVector& Scale)
 {
-	FMatrix T = TranslationMatrix(Location);
-	FMatrix R = RotationMatrix(Rotation);
-	FMatrix S = ScaleMatrix(Scale);
-	FMatrix modelMatrix = S * R * T;
+	float R[3][3];
+	GetEulerRotation(Rotation, R);
+
+	const float ScaleValues[3] = {Scale.X, Scale.Y, Scale.Z};
 
 	// 좌표계 변환 제거: 정점 데이터와 Transform 모두 UE 좌표계로 통일
 	// 임포터에서 이미 UE 좌표계로 변환 완료됨
-	return modelMatrix;
+	FMatrix Result;
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		Result.Data[Row][0] = ScaleValues[Row] * R[Row][0];
+		Result.Data[Row][1] = ScaleValues[Row] * R[Row][1];
+		Result.Data[Row][2] = ScaleValues[Row] * R[Row][2];
+		Result.Data[Row][3] = Result.Data[Row][0] * Location.X + Result.Data[Row][1] * Location.Y +
+			Result.Data[Row][2] * Location.Z;
+	}
+	Result.Data[3][3] = 1.0f;
+
+	return Result;
 }
 
+/**
+* @brief GetModelMatrix의 역행렬 (T^-1 * R^T * S^-1)을 행렬 곱 없이 계산하는 함수
+*/
 FMatrix FMatrix::GetModelMatrixInverse(const FVector& Location, const FVector& Rotation, const FVector& Scale)
 {
-	FMatrix T = TranslationMatrixInverse(Location);
-	FMatrix R = RotationMatrixInverse(Rotation);
-	FMatrix S = ScaleMatrixInverse(Scale);
-	FMatrix modelMatrixInverse = T * R * S;
+	float R[3][3];
+	GetEulerRotation(Rotation, R);
+
+	const float InvScale[3] = {1 / Scale.X, 1 / Scale.Y, 1 / Scale.Z};
+
+	FMatrix Result;
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		Result.Data[Row][0] = R[0][Row] * InvScale[0];
+		Result.Data[Row][1] = R[1][Row] * InvScale[1];
+		Result.Data[Row][2] = R[2][Row] * InvScale[2];
+	}
+	Result.Data[0][3] = -Location.X;
+	Result.Data[1][3] = -Location.Y;
+	Result.Data[2][3] = -Location.Z;
+	Result.Data[3][3] = 1.0f;
 
-	// 좌표계 변환 제거: 일관된 UE 좌표계 사용
-	return modelMatrixInverse;
+	return Result;
 }
 
 FVector4 FMatrix::VectorMultiply(const FVector4& v, const FMatrix& m)
 {
-	FVector4 result = {};
-	result.X = (v.X * m.Data[0][0]) + (v.Y * m.Data[1][0]) + (v.Z * m.Data[2][0]) + (v.W * m.Data[3][0]);
-	result.Y = (v.X * m.Data[0][1]) + (v.Y * m.Data[1][1]) + (v.Z * m.Data[2][1]) + (v.W * m.Data[3][1]);
-	result.Z = (v.X * m.Data[0][2]) + (v.Y * m.Data[1][2]) + (v.Z * m.Data[2][2]) + (v.W * m.Data[3][2]);
-	result.W = (v.X * m.Data[0][3]) + (v.Y * m.Data[1][3]) + (v.Z * m.Data[2][3]) + (v.W * m.Data[3][3]);
-
-
-	return result;
+	return MatrixMath::TransformVector4(v, m);
 }
 
 FVector FMatrix::VectorMultiply(const FVector& v, const FMatrix& m)
 {
-	FVector result = {};
-	result.X = (v.X * m.Data[0][0]) + (v.Y * m.Data[1][0]) + (v.Z * m.Data[2][0]) + m.Data[3][0];
-	result.Y = (v.X * m.Data[0][1]) + (v.Y * m.Data[1][1]) + (v.Z * m.Data[2][1]) + m.Data[3][1];
-	result.Z = (v.X * m.Data[0][2]) + (v.Y * m.Data[1][2]) + (v.Z * m.Data[2][2]) + m.Data[3][2];
-
-	return result;
+	return MatrixMath::TransformPosition(v, m);
 }
 
 FMatrix FMatrix::Transpose() const
 {
-	FMatrix result = {};
-	for (int i = 0; i < 4; i++)
-	{
-		for (int j = 0;j < 4;j++)
-		{
-			result.Data[i][j] = Data[j][i];
-		}
-	}
-
-	return result;
+	FMatrix Result;
+	MatrixMath::Transpose(Result, *this);
+	return Result;
 }
 
 FMatrix FMatrix::MatrixLookAtLH(const FVector& EyePosition, const FVector& FocusPosition, const FVector& UpDirection)
@@ -342,69 +377,20 @@ FMatrix FMatrix::MatrixPerspectiveFovLH(float FovAngleY, float AspectRatio, floa
 }
 
 /**
- * @brief 4x4 행렬의 역행렬을 계산합니다 (Gauss-Jordan 소거법)
+ * @brief 4x4 행렬의 역행렬을 계산합니다
  */
 FMatrix FMatrix::Inverse() const
 {
-    FMatrix result = *this;
-    FMatrix inverse = Identity();
-
-    // Gauss-Jordan 소거법
-    for (int32 i = 0; i < 4; i++)
-    {
-        // Pivot 찾기
-        int32 pivot = i;
-        float pivotValue = std::abs(result.Data[i][i]);
-        for (int32 j = i + 1; j < 4; j++)
-        {
-            float val = std::abs(result.Data[j][i]);
-            if (val > pivotValue)
-            {
-                pivot = j;
-                pivotValue = val;
-            }
-        }
-
-        // 행 교환
-        if (pivot != i)
-        {
-            for (int32 j = 0; j < 4; j++)
-            {
-                std::swap(result.Data[i][j], result.Data[pivot][j]);
-                std::swap(inverse.Data[i][j], inverse.Data[pivot][j]);
-            }
-        }
-
-        // Pivot이 0에 가까우면 역행렬이 존재하지 않음
-        if (std::abs(result.Data[i][i]) < 1e-10f)
-        {
-            return Identity(); // 역행렬이 없으면 항등행렬 반환
-        }
-
-        // Pivot으로 나누기
-        float pivotDiv = result.Data[i][i];
-        for (int32 j = 0; j < 4; j++)
-        {
-            result.Data[i][j] /= pivotDiv;
-            inverse.Data[i][j] /= pivotDiv;
-        }
-
-        // 다른 행 소거
-        for (int32 j = 0; j < 4; j++)
-        {
-            if (j != i)
-            {
-                float factor = result.Data[j][i];
-                for (int32 k = 0; k < 4; k++)
-                {
-                    result.Data[j][k] -= factor * result.Data[i][k];
-                    inverse.Data[j][k] -= factor * inverse.Data[i][k];
-                }
-            }
-        }
-    }
+	FMatrix Result;
+	MatrixMath::Inverse(Result, *this);
+	return Result;
+}
 
-    return inverse;
+FMatrix FMatrix::InverseAffine() const
+{
+	FMatrix Result;
+	MatrixMath::InverseAffine(Result, *this);
+	return Result;
 }
 
 /**
@@ -40,7 +40,7 @@ struct FMatrix
 	/**
 	* @brief 두 행렬곱을 진행한 행렬을 반환하는 연산자 함수
 	*/
-	FMatrix operator*(const FMatrix& InOtherMatrix);
+	FMatrix operator*(const FMatrix& InOtherMatrix) const;
 	void operator*=(const FMatrix& InOtherMatrix);
 
 	/**
@@ -94,7 +94,17 @@ struct FMatrix
 	static FVector VectorMultiply(const FVector& v, const FMatrix& m);
 
 	FMatrix Transpose() const;
+
+	/**
+	* @brief 일반 4x4 역행렬 (역행렬이 없으면 항등행렬)
+	*/
 	FMatrix Inverse() const;
+
+	/**
+	* @brief 마지막 행이 (0, 0, 0, 1)인 아핀 행렬(S * R * T 형태의 모델 / 뷰 행렬) 전용 역행렬
+	* 3x3 부분만 뒤집으므로 Inverse보다 빠르다
+	*/
+	FMatrix InverseAffine() const;
 	
 	// Get row vectors
 	FVector GetRow(int32 RowIndex) const;
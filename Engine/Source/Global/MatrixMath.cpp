@@ -0,0 +1,450 @@
+#include "pch.h"
+#include "Global/MatrixMath.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	/**
+	 * @brief 역행렬이 존재하지 않는다고 판단하는 행렬식 크기
+	 */
+	constexpr float SmallDeterminant = 1e-30f;
+}
+
+/**
+ * Scalar
+ */
+void MatrixMath::Scalar::Multiply(FMatrix& OutResult, const FMatrix& InA, const FMatrix& InB)
+{
+	FMatrix Result;
+
+	for (int32 i = 0; i < 4; ++i)
+	{
+		for (int32 j = 0; j < 4; ++j)
+		{
+			for (int32 k = 0; k < 4; ++k)
+			{
+				Result.Data[i][j] += InA.Data[i][k] * InB.Data[k][j];
+			}
+		}
+	}
+
+	OutResult = Result;
+}
+
+void MatrixMath::Scalar::Transpose(FMatrix& OutResult, const FMatrix& InMatrix)
+{
+	FMatrix Result;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		for (int32 j = 0; j < 4; ++j)
+		{
+			Result.Data[i][j] = InMatrix.Data[j][i];
+		}
+	}
+
+	OutResult = Result;
+}
+
+/**
+ * @brief 부분 피벗 Gauss-Jordan 소거법으로 역행렬을 구하는 함수
+ * 피벗이 0에 가까우면 역행렬이 없다고 보고 항등행렬을 돌려준다
+ */
+bool MatrixMath::Scalar::Inverse(FMatrix& OutResult, const FMatrix& InMatrix)
+{
+	FMatrix Work = InMatrix;
+	FMatrix Result = FMatrix::Identity();
+
+	for (int32 i = 0; i < 4; ++i)
+	{
+		// Pivot 찾기
+		int32 Pivot = i;
+		float PivotValue = std::abs(Work.Data[i][i]);
+		for (int32 j = i + 1; j < 4; ++j)
+		{
+			const float Value = std::abs(Work.Data[j][i]);
+			if (Value > PivotValue)
+			{
+				Pivot = j;
+				PivotValue = Value;
+			}
+		}
+
+		// 행 교환
+		if (Pivot != i)
+		{
+			for (int32 j = 0; j < 4; ++j)
+			{
+				std::swap(Work.Data[i][j], Work.Data[Pivot][j]);
+				std::swap(Result.Data[i][j], Result.Data[Pivot][j]);
+			}
+		}
+
+		if (std::abs(Work.Data[i][i]) < 1e-10f)
+		{
+			OutResult = FMatrix::Identity();
+			return false;
+		}
+
+		// Pivot으로 나누기
+		const float PivotDiv = Work.Data[i][i];
+		for (int32 j = 0; j < 4; ++j)
+		{
+			Work.Data[i][j] /= PivotDiv;
+			Result.Data[i][j] /= PivotDiv;
+		}
+
+		// 다른 행 소거
+		for (int32 j = 0; j < 4; ++j)
+		{
+			if (j != i)
+			{
+				const float Factor = Work.Data[j][i];
+				for (int32 k = 0; k < 4; ++k)
+				{
+					Work.Data[j][k] -= Factor * Work.Data[i][k];
+					Result.Data[j][k] -= Factor * Result.Data[i][k];
+				}
+			}
+		}
+	}
+
+	OutResult = Result;
+	return true;
+}
+
+/**
+ * @brief 마지막 행이 (0, 0, 0, 1)인 아핀 행렬의 역행렬을 구하는 함수
+ * [A t; 0 1]의 역행렬은 [A^-1, -A^-1 * t; 0 1]이며, A^-1은 행 벡터 외적으로 구한 여인수 행렬이다
+ */
+bool MatrixMath::Scalar::InverseAffine(FMatrix& OutResult, const FMatrix& InMatrix)
+{
+	const FVector Row0(InMatrix.Data[0][0], InMatrix.Data[0][1], InMatrix.Data[0][2]);
+	const FVector Row1(InMatrix.Data[1][0], InMatrix.Data[1][1], InMatrix.Data[1][2]);
+	const FVector Row2(InMatrix.Data[2][0], InMatrix.Data[2][1], InMatrix.Data[2][2]);
+	const FVector Translation(InMatrix.Data[0][3], InMatrix.Data[1][3], InMatrix.Data[2][3]);
+
+	// 여인수 행렬의 열 = 두 행의 외적
+	const FVector Column0 = Row1.Cross(Row2);
+	const FVector Column1 = Row2.Cross(Row0);
+	const FVector Column2 = Row0.Cross(Row1);
+
+	const float Determinant = Row0.Dot(Column0);
+	if (std::abs(Determinant) < SmallDeterminant)
+	{
+		OutResult = FMatrix::Identity();
+		return false;
+	}
+
+	const float InvDeterminant = 1.0f / Determinant;
+	FMatrix Result = FMatrix::Identity();
+	const FVector Columns[3] = {Column0, Column1, Column2};
+	for (int32 Column = 0; Column < 3; ++Column)
+	{
+		Result.Data[0][Column] = Columns[Column].X * InvDeterminant;
+		Result.Data[1][Column] = Columns[Column].Y * InvDeterminant;
+		Result.Data[2][Column] = Columns[Column].Z * InvDeterminant;
+	}
+
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		Result.Data[Row][3] = -(Result.Data[Row][0] * Translation.X + Result.Data[Row][1] * Translation.Y +
+			Result.Data[Row][2] * Translation.Z);
+	}
+
+	OutResult = Result;
+	return true;
+}
+
+FVector4 MatrixMath::Scalar::TransformVector4(const FVector4& InVector, const FMatrix& InMatrix)
+{
+	const FVector4& v = InVector;
+	const FMatrix& m = InMatrix;
+
+	FVector4 Result = {};
+	Result.X = (v.X * m.Data[0][0]) + (v.Y * m.Data[1][0]) + (v.Z * m.Data[2][0]) + (v.W * m.Data[3][0]);
+	Result.Y = (v.X * m.Data[0][1]) + (v.Y * m.Data[1][1]) + (v.Z * m.Data[2][1]) + (v.W * m.Data[3][1]);
+	Result.Z = (v.X * m.Data[0][2]) + (v.Y * m.Data[1][2]) + (v.Z * m.Data[2][2]) + (v.W * m.Data[3][2]);
+	Result.W = (v.X * m.Data[0][3]) + (v.Y * m.Data[1][3]) + (v.Z * m.Data[2][3]) + (v.W * m.Data[3][3]);
+
+	return Result;
+}
+
+FVector MatrixMath::Scalar::TransformPosition(const FVector& InVector, const FMatrix& InMatrix)
+{
+	const FVector& v = InVector;
+	const FMatrix& m = InMatrix;
+
+	FVector Result = {};
+	Result.X = (v.X * m.Data[0][0]) + (v.Y * m.Data[1][0]) + (v.Z * m.Data[2][0]) + m.Data[3][0];
+	Result.Y = (v.X * m.Data[0][1]) + (v.Y * m.Data[1][1]) + (v.Z * m.Data[2][1]) + m.Data[3][1];
+	Result.Z = (v.X * m.Data[0][2]) + (v.Y * m.Data[1][2]) + (v.Z * m.Data[2][2]) + m.Data[3][2];
+
+	return Result;
+}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+
+/**
+ * Simd
+ */
+namespace
+{
+	FORCEINLINE __m128 LoadRow(const FMatrix& InMatrix, int32 InRow)
+	{
+		return _mm_loadu_ps(InMatrix.Data[InRow]);
+	}
+
+	FORCEINLINE void StoreRow(FMatrix& OutMatrix, int32 InRow, __m128 InValue)
+	{
+		_mm_storeu_ps(OutMatrix.Data[InRow], InValue);
+	}
+
+	template <int X, int Y, int Z, int W>
+	FORCEINLINE __m128 Swizzle(__m128 InVector)
+	{
+		return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(InVector), _MM_SHUFFLE(W, Z, Y, X)));
+	}
+
+	template <int X, int Y, int Z, int W>
+	FORCEINLINE __m128 Shuffle(__m128 InA, __m128 InB)
+	{
+		return _mm_shuffle_ps(InA, InB, _MM_SHUFFLE(W, Z, Y, X));
+	}
+
+	template <int Index>
+	FORCEINLINE __m128 Replicate(__m128 InVector)
+	{
+		return Swizzle<Index, Index, Index, Index>(InVector);
+	}
+
+	/**
+	 * @brief 행 벡터 하나와 행렬의 곱 (InRow * InMatrix)
+	 * 스칼라 구현과 같은 순서로 누적해 결과를 일치시킨다
+	 */
+	FORCEINLINE __m128 RowMultiply(__m128 InRow, __m128 InM0, __m128 InM1, __m128 InM2, __m128 InM3)
+	{
+		__m128 Result = _mm_mul_ps(Replicate<0>(InRow), InM0);
+		Result = _mm_add_ps(Result, _mm_mul_ps(Replicate<1>(InRow), InM1));
+		Result = _mm_add_ps(Result, _mm_mul_ps(Replicate<2>(InRow), InM2));
+		Result = _mm_add_ps(Result, _mm_mul_ps(Replicate<3>(InRow), InM3));
+		return Result;
+	}
+
+	/**
+	 * @brief 2x2 행렬을 (m00, m01, m10, m11) 한 레지스터로 다루는 보조 연산
+	 * Mat2Mul은 A * B, Mat2AdjMul은 adj(A) * B, Mat2MulAdj는 A * adj(B)이다
+	 */
+	FORCEINLINE __m128 Mat2Mul(__m128 InA, __m128 InB)
+	{
+		return _mm_add_ps(_mm_mul_ps(InA, Swizzle<0, 3, 0, 3>(InB)),
+		                  _mm_mul_ps(Swizzle<1, 0, 3, 2>(InA), Swizzle<2, 1, 2, 1>(InB)));
+	}
+
+	FORCEINLINE __m128 Mat2AdjMul(__m128 InA, __m128 InB)
+	{
+		return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(InA), InB),
+		                  _mm_mul_ps(Swizzle<1, 1, 2, 2>(InA), Swizzle<2, 3, 0, 1>(InB)));
+	}
+
+	FORCEINLINE __m128 Mat2MulAdj(__m128 InA, __m128 InB)
+	{
+		return _mm_sub_ps(_mm_mul_ps(InA, Swizzle<3, 0, 3, 0>(InB)),
+		                  _mm_mul_ps(Swizzle<1, 0, 3, 2>(InA), Swizzle<2, 1, 2, 1>(InB)));
+	}
+
+	/**
+	 * @brief 세 성분 외적 (W 성분은 0)
+	 */
+	FORCEINLINE __m128 Cross3(__m128 InA, __m128 InB)
+	{
+		const __m128 Result = _mm_sub_ps(_mm_mul_ps(InA, Swizzle<1, 2, 0, 3>(InB)),
+		                                 _mm_mul_ps(Swizzle<1, 2, 0, 3>(InA), InB));
+		return Swizzle<1, 2, 0, 3>(Result);
+	}
+
+	FORCEINLINE float Dot3(__m128 InA, __m128 InB)
+	{
+		const __m128 Product = _mm_mul_ps(InA, InB);
+		return _mm_cvtss_f32(Product) + _mm_cvtss_f32(Replicate<1>(Product)) + _mm_cvtss_f32(Replicate<2>(Product));
+	}
+
+	void StoreIdentity(FMatrix& OutMatrix)
+	{
+		StoreRow(OutMatrix, 0, _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f));
+		StoreRow(OutMatrix, 1, _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f));
+		StoreRow(OutMatrix, 2, _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f));
+		StoreRow(OutMatrix, 3, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+	}
+}
+
+void MatrixMath::Simd::Multiply(FMatrix& OutResult, const FMatrix& InA, const FMatrix& InB)
+{
+	const __m128 B0 = LoadRow(InB, 0);
+	const __m128 B1 = LoadRow(InB, 1);
+	const __m128 B2 = LoadRow(InB, 2);
+	const __m128 B3 = LoadRow(InB, 3);
+
+	// OutResult가 입력과 같은 행렬일 수 있으므로 모두 계산한 뒤 저장
+	const __m128 R0 = RowMultiply(LoadRow(InA, 0), B0, B1, B2, B3);
+	const __m128 R1 = RowMultiply(LoadRow(InA, 1), B0, B1, B2, B3);
+	const __m128 R2 = RowMultiply(LoadRow(InA, 2), B0, B1, B2, B3);
+	const __m128 R3 = RowMultiply(LoadRow(InA, 3), B0, B1, B2, B3);
+
+	StoreRow(OutResult, 0, R0);
+	StoreRow(OutResult, 1, R1);
+	StoreRow(OutResult, 2, R2);
+	StoreRow(OutResult, 3, R3);
+}
+
+void MatrixMath::Simd::Transpose(FMatrix& OutResult, const FMatrix& InMatrix)
+{
+	__m128 R0 = LoadRow(InMatrix, 0);
+	__m128 R1 = LoadRow(InMatrix, 1);
+	__m128 R2 = LoadRow(InMatrix, 2);
+	__m128 R3 = LoadRow(InMatrix, 3);
+
+	_MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+
+	StoreRow(OutResult, 0, R0);
+	StoreRow(OutResult, 1, R1);
+	StoreRow(OutResult, 2, R2);
+	StoreRow(OutResult, 3, R3);
+}
+
+/**
+ * @brief 2x2 블록 분할로 역행렬을 구하는 함수
+ * M = [A B; C D]로 나누고 각 블록의 수반 행렬로 여인수를 계산하므로 분기 없이 처리된다
+ * 행렬식이 0에 가까우면 스칼라 구현과 마찬가지로 항등행렬을 돌려준다
+ */
+bool MatrixMath::Simd::Inverse(FMatrix& OutResult, const FMatrix& InMatrix)
+{
+	const __m128 Row0 = LoadRow(InMatrix, 0);
+	const __m128 Row1 = LoadRow(InMatrix, 1);
+	const __m128 Row2 = LoadRow(InMatrix, 2);
+	const __m128 Row3 = LoadRow(InMatrix, 3);
+
+	// 2x2 블록
+	const __m128 A = _mm_movelh_ps(Row0, Row1);
+	const __m128 B = _mm_movehl_ps(Row1, Row0);
+	const __m128 C = _mm_movelh_ps(Row2, Row3);
+	const __m128 D = _mm_movehl_ps(Row3, Row2);
+
+	// 각 블록의 행렬식 (|A|, |B|, |C|, |D|)
+	const __m128 DetSub = _mm_sub_ps(
+		_mm_mul_ps(Shuffle<0, 2, 0, 2>(Row0, Row2), Shuffle<1, 3, 1, 3>(Row1, Row3)),
+		_mm_mul_ps(Shuffle<1, 3, 1, 3>(Row0, Row2), Shuffle<0, 2, 0, 2>(Row1, Row3)));
+	const __m128 DetA = Replicate<0>(DetSub);
+	const __m128 DetB = Replicate<1>(DetSub);
+	const __m128 DetC = Replicate<2>(DetSub);
+	const __m128 DetD = Replicate<3>(DetSub);
+
+	const __m128 AdjDMulC = Mat2AdjMul(D, C);
+	const __m128 AdjAMulB = Mat2AdjMul(A, B);
+
+	// 역행렬 블록의 수반 행렬 (행렬식으로 나누기 전)
+	__m128 X = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, AdjDMulC));
+	__m128 W = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, AdjAMulB));
+	__m128 Y = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, AdjAMulB));
+	__m128 Z = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, AdjDMulC));
+
+	// |M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+	__m128 Trace = _mm_mul_ps(AdjAMulB, Swizzle<0, 2, 1, 3>(AdjDMulC));
+	Trace = _mm_add_ps(Trace, _mm_movehl_ps(Trace, Trace));
+	Trace = _mm_add_ss(Trace, Replicate<1>(Trace));
+
+	const float Determinant = _mm_cvtss_f32(DetA) * _mm_cvtss_f32(DetD) + _mm_cvtss_f32(DetB) * _mm_cvtss_f32(DetC) -
+		_mm_cvtss_f32(Trace);
+	if (std::abs(Determinant) < SmallDeterminant)
+	{
+		StoreIdentity(OutResult);
+		return false;
+	}
+
+	const __m128 InvDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), _mm_set1_ps(Determinant));
+	X = _mm_mul_ps(X, InvDeterminant);
+	Y = _mm_mul_ps(Y, InvDeterminant);
+	Z = _mm_mul_ps(Z, InvDeterminant);
+	W = _mm_mul_ps(W, InvDeterminant);
+
+	// 수반 행렬 전치와 블록 배치를 한 번의 셔플로 처리
+	StoreRow(OutResult, 0, Shuffle<3, 1, 3, 1>(X, Y));
+	StoreRow(OutResult, 1, Shuffle<2, 0, 2, 0>(X, Y));
+	StoreRow(OutResult, 2, Shuffle<3, 1, 3, 1>(Z, W));
+	StoreRow(OutResult, 3, Shuffle<2, 0, 2, 0>(Z, W));
+	return true;
+}
+
+bool MatrixMath::Simd::InverseAffine(FMatrix& OutResult, const FMatrix& InMatrix)
+{
+	const __m128 Row0 = LoadRow(InMatrix, 0);
+	const __m128 Row1 = LoadRow(InMatrix, 1);
+	const __m128 Row2 = LoadRow(InMatrix, 2);
+
+	// W 성분(이동)은 외적 결과에 섞이지 않도록 0으로 지운다
+	const __m128 Mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+	const __m128 Linear0 = _mm_and_ps(Row0, Mask);
+	const __m128 Linear1 = _mm_and_ps(Row1, Mask);
+	const __m128 Linear2 = _mm_and_ps(Row2, Mask);
+
+	__m128 Column0 = Cross3(Linear1, Linear2);
+	__m128 Column1 = Cross3(Linear2, Linear0);
+	__m128 Column2 = Cross3(Linear0, Linear1);
+
+	const float Determinant = Dot3(Linear0, Column0);
+	if (std::abs(Determinant) < SmallDeterminant)
+	{
+		StoreIdentity(OutResult);
+		return false;
+	}
+
+	const __m128 InvDeterminant = _mm_set1_ps(1.0f / Determinant);
+	Column0 = _mm_mul_ps(Column0, InvDeterminant);
+	Column1 = _mm_mul_ps(Column1, InvDeterminant);
+	Column2 = _mm_mul_ps(Column2, InvDeterminant);
+
+	// 열로 구한 A^-1을 행으로 전치 (네 번째 행은 (0, 0, 0, 0)이 된다)
+	__m128 Inverse0 = Column0;
+	__m128 Inverse1 = Column1;
+	__m128 Inverse2 = Column2;
+	__m128 Inverse3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(Inverse0, Inverse1, Inverse2, Inverse3);
+
+	// -A^-1 * t를 네 번째 열에 배치
+	const __m128 Translation = _mm_setr_ps(InMatrix.Data[0][3], InMatrix.Data[1][3], InMatrix.Data[2][3], 0.0f);
+	const float Translation0 = -Dot3(Inverse0, Translation);
+	const float Translation1 = -Dot3(Inverse1, Translation);
+	const float Translation2 = -Dot3(Inverse2, Translation);
+
+	StoreRow(OutResult, 0, _mm_or_ps(_mm_and_ps(Inverse0, Mask), _mm_setr_ps(0.0f, 0.0f, 0.0f, Translation0)));
+	StoreRow(OutResult, 1, _mm_or_ps(_mm_and_ps(Inverse1, Mask), _mm_setr_ps(0.0f, 0.0f, 0.0f, Translation1)));
+	StoreRow(OutResult, 2, _mm_or_ps(_mm_and_ps(Inverse2, Mask), _mm_setr_ps(0.0f, 0.0f, 0.0f, Translation2)));
+	StoreRow(OutResult, 3, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+	return true;
+}
+
+FVector4 MatrixMath::Simd::TransformVector4(const FVector4& InVector, const FMatrix& InMatrix)
+{
+	const __m128 Vector = _mm_loadu_ps(&InVector.X);
+	const __m128 Result = RowMultiply(Vector, LoadRow(InMatrix, 0), LoadRow(InMatrix, 1), LoadRow(InMatrix, 2),
+	                                  LoadRow(InMatrix, 3));
+
+	FVector4 Output;
+	_mm_storeu_ps(&Output.X, Result);
+	return Output;
+}
+
+FVector MatrixMath::Simd::TransformPosition(const FVector& InVector, const FMatrix& InMatrix)
+{
+	const __m128 Vector = _mm_setr_ps(InVector.X, InVector.Y, InVector.Z, 1.0f);
+	const __m128 Result = RowMultiply(Vector, LoadRow(InMatrix, 0), LoadRow(InMatrix, 1), LoadRow(InMatrix, 2),
+	                                  LoadRow(InMatrix, 3));
+
+	alignas(16) float Output[4];
+	_mm_store_ps(Output, Result);
+	return FVector(Output[0], Output[1], Output[2]);
+}
+
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+
+struct FMatrix;
+struct FVector;
+struct FVector4;
+
+/**
+ * @brief SSE 벡터 연산 사용 여부
+ * x64 / SSE2 이상 타겟에서는 기본으로 활성화되며, 빌드 옵션으로 0을 지정하면 스칼라 구현으로 대체된다
+ */
+#ifndef PLATFORM_ENABLE_VECTORINTRINSICS
+	#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define PLATFORM_ENABLE_VECTORINTRINSICS 1
+	#else
+		#define PLATFORM_ENABLE_VECTORINTRINSICS 0
+	#endif
+#endif
+
+/**
+ * @brief FMatrix의 핵심 연산 커널 모음
+ * FMatrix 멤버 함수는 컴파일 시점에 선택된 구현(MatrixMath::Multiply 등)을 호출하며,
+ * 두 구현을 모두 노출해 벤치마크와 검증에서 같은 입력으로 직접 비교할 수 있게 한다
+ *
+ * 모든 행렬은 float Data[4][4] 행 우선 배열이며, 정렬을 가정하지 않는다 (상수 버퍼 구조체 배치 유지)
+ * 출력 인자는 입력과 같은 행렬이어도 된다
+ */
+namespace MatrixMath
+{
+	/**
+	 * @brief 기존 FMatrix 구현과 동일한 스칼라 커널
+	 * Inverse는 부분 피벗 Gauss-Jordan 소거법이다
+	 */
+	namespace Scalar
+	{
+		void Multiply(FMatrix& OutResult, const FMatrix& InA, const FMatrix& InB);
+		void Transpose(FMatrix& OutResult, const FMatrix& InMatrix);
+		bool Inverse(FMatrix& OutResult, const FMatrix& InMatrix);
+		bool InverseAffine(FMatrix& OutResult, const FMatrix& InMatrix);
+		FVector4 TransformVector4(const FVector4& InVector, const FMatrix& InMatrix);
+		FVector TransformPosition(const FVector& InVector, const FMatrix& InMatrix);
+	}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	/**
+	 * @brief SSE2 커널
+	 * Multiply / Transpose / Transform은 스칼라 구현과 같은 순서로 누적하므로 결과가 비트 단위로 같고,
+	 * Inverse는 2x2 블록 여인수 전개를 사용하므로 반올림 오차 수준의 차이가 있다
+	 */
+	namespace Simd
+	{
+		void Multiply(FMatrix& OutResult, const FMatrix& InA, const FMatrix& InB);
+		void Transpose(FMatrix& OutResult, const FMatrix& InMatrix);
+		bool Inverse(FMatrix& OutResult, const FMatrix& InMatrix);
+		bool InverseAffine(FMatrix& OutResult, const FMatrix& InMatrix);
+		FVector4 TransformVector4(const FVector4& InVector, const FMatrix& InMatrix);
+		FVector TransformPosition(const FVector& InVector, const FMatrix& InMatrix);
+	}
+
+	using namespace Simd;
+#else
+	using namespace Scalar;
+#endif
+}
@@ -1,79 +1,929 @@
 #include "pch.h"
 #include "Global/Memory.h"
 
+#include <atomic>
 #include <new>
+#include <thread>
+
+// 청크 예약 / 커밋용 OS API (헤드리스 빌드의 pch에는 windows.h가 없으므로 직접 포함)
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
 
 using std::align_val_t;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+namespace
+{
+	// 작은 할당용 주소 공간 (예약만 해두고 청크 단위로 커밋)
+	constexpr size_t ChunkSize = 64 * 1024;
+	constexpr size_t ChunkShift = 16;
+	constexpr size_t PoolReserveSize = 16ull * 1024 * 1024 * 1024;
+	constexpr size_t NumPoolChunks = PoolReserveSize / ChunkSize;
 
-/**
- * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
- * @param InSize 할당 size
- * @return 할당한 공간에서 할당 공간 정보를 저장한 헤더를 제외한 나머지 공간의 첫 메모리 주소
- */
-void* operator new(size_t InSize)
+	static_assert((static_cast<size_t>(1) << ChunkShift) == ChunkSize);
+
+	// 크기 등급 (모두 16의 배수이므로 블록은 최소 16바이트 정렬을 보장)
+	constexpr uint32 SizeClasses[] = {
+		16, 32, 48, 64, 80, 96, 112, 128,
+		160, 192, 224, 256, 320, 384, 448, 512,
+		640, 768, 896, 1024
+	};
+	constexpr uint32 NumSizeClasses = sizeof(SizeClasses) / sizeof(SizeClasses[0]);
+	constexpr uint8 InvalidSizeClass = 0xFF;
+
+	static_assert(SizeClasses[NumSizeClasses - 1] == FMemory::MaxSmallSize);
+
+	/**
+	 * @brief 16바이트 단위 크기에서 크기 등급으로의 조회 테이블
+	 */
+	struct FSizeClassTable
+	{
+		uint8 ClassIndices[FMemory::MaxSmallSize / 16 + 1];
+
+		constexpr FSizeClassTable()
+			: ClassIndices{}
+		{
+			uint32 ClassIndex = 0;
+			for (uint32 Slot = 0; Slot <= FMemory::MaxSmallSize / 16; ++Slot)
+			{
+				while (SizeClasses[ClassIndex] < Slot * 16)
+				{
+					++ClassIndex;
+				}
+				ClassIndices[Slot] = static_cast<uint8>(ClassIndex);
+			}
+		}
+	};
+
+	constexpr FSizeClassTable GSizeClassTable;
+
+	/**
+	 * @brief 스레드 캐시와 전역 목록이 한 번에 주고받는 블록 수 (큰 등급일수록 적게)
+	 */
+	constexpr uint32 GetBatchCount(uint32 InClassIndex)
+	{
+		const uint32 Count = 4096 / SizeClasses[InClassIndex];
+		return Count < 8 ? 8 : (Count > 64 ? 64 : Count);
+	}
+
+	/**
+	 * @brief 정적 초기화 이전에도 사용할 수 있는 스핀 락
+	 * operator new는 CRT 초기화 도중에도 호출되므로 상수 초기화가 가능한 타입만 사용한다
+	 */
+	class FSpinLock
+	{
+	public:
+		void Lock()
+		{
+			while (bIsLocked.exchange(true, std::memory_order_acquire))
+			{
+				while (bIsLocked.load(std::memory_order_relaxed))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		void Unlock()
+		{
+			bIsLocked.store(false, std::memory_order_release);
+		}
+
+	private:
+		std::atomic<bool> bIsLocked{false};
+	};
+
+	class FScopedSpinLock
+	{
+	public:
+		explicit FScopedSpinLock(FSpinLock& InLock) : Lock(InLock) { Lock.Lock(); }
+		~FScopedSpinLock() { Lock.Unlock(); }
+
+	private:
+		FSpinLock& Lock;
+	};
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	/**
+	 * @brief 등급별 전역 Free List
+	 * 스레드 캐시 간 false sharing을 피하도록 캐시 라인 단위로 정렬
+	 */
+	struct alignas(64) FGlobalSizeClass
+	{
+		FSpinLock Lock;
+		FFreeBlock* FreeList = nullptr;
+	};
+
+	/**
+	 * @brief 큰 할당의 반환 주소 바로 앞에 기록되는 헤더
+	 * @param BaseAddress 시스템 할당자가 반환한 실제 주소
+	 * @param Size 요청 크기
+	 * @param Tag 할당 시점의 메모리 태그
+	 */
+	struct FLargeAllocHeader
+	{
+		void* BaseAddress;
+		size_t Size;
+		EMemoryTag Tag;
+	};
+
+	/**
+	 * @brief 스레드별 할당 캐시
+	 * 태그 / 등급별 Free List와 태그별 통계 카운터를 가지며, 통계는 소유 스레드만 쓰고 다른 스레드는 읽기만 한다
+	 */
+	struct FThreadCache
+	{
+		FFreeBlock* FreeLists[NumMemoryTags][NumSizeClasses] = {};
+		uint32 NumFree[NumMemoryTags][NumSizeClasses] = {};
+
+		std::atomic<int64> AllocatedBytes[NumMemoryTags] = {};
+		std::atomic<int64> AllocationCount[NumMemoryTags] = {};
+
+		FThreadCache* PrevRegistered = nullptr;
+		FThreadCache* NextRegistered = nullptr;
+		bool bIsRegistered = false;
+
+		~FThreadCache();
+	};
+
+	std::atomic<uint8*> GPoolBase{nullptr};
+	std::atomic<bool> GbPoolInitialized{false};
+	FSpinLock GPoolInitLock;
+	std::atomic<size_t> GNextPoolChunk{0};
+	std::atomic<size_t> GNumCommittedChunks{0};
+
+	// Trim으로 디커밋된 청크 번호 (태그 / 등급과 무관하게 CarveNewChunk가 먼저 재사용)
+	FSpinLock GFreeChunkLock;
+	uint32 GFreeChunkIndices[NumPoolChunks];
+	size_t GNumFreeChunks = 0;
+
+	// Trim이 청크별 대기 블록 수를 세는 공간 (Trim끼리는 GTrimLock으로 직렬화)
+	FSpinLock GTrimLock;
+	uint16 GChunkFreeCounts[NumPoolChunks];
+	uint32 GTrimmedChunkIndices[NumPoolChunks];
+
+	static_assert(ChunkSize / 16 <= UINT16_MAX, "GChunkFreeCounts must hold a chunk's block count");
+
+	// 커밋된 청크가 담당하는 크기 등급과 태그 (블록 주소로부터 크기와 태그를 찾을 때 사용)
+	uint8 GChunkSizeClasses[NumPoolChunks];
+	EMemoryTag GChunkTags[NumPoolChunks];
+
+	FGlobalSizeClass GGlobalSizeClasses[NumMemoryTags][NumSizeClasses];
+
+	// 살아있는 스레드 캐시 목록과 종료된 스레드의 통계 누적값
+	FSpinLock GRegistryLock;
+	FThreadCache* GRegistryHead = nullptr;
+	std::atomic<int64> GRetiredAllocatedBytes[NumMemoryTags] = {};
+	std::atomic<int64> GRetiredAllocationCount[NumMemoryTags] = {};
+
+	thread_local FThreadCache GThreadCache;
+	thread_local bool GbIsThreadCacheDestroyed = false;
+	thread_local EMemoryTag GCurrentMemoryTag = EMemoryTag::Untagged;
+
+	const char* const MemoryTagNames[] = {
+		"Untagged", "Object", "Asset", "StaticMesh", "Texture", "Renderer", "UI", "Logger"
+	};
+
+	static_assert(sizeof(MemoryTagNames) / sizeof(MemoryTagNames[0]) == NumMemoryTags);
+
+	// Platform
+#ifdef _WIN32
+	uint8* ReserveAddressSpace(size_t InSize)
+	{
+		return static_cast<uint8*>(VirtualAlloc(nullptr, InSize, MEM_RESERVE, PAGE_NOACCESS));
+	}
+
+	bool CommitChunk(uint8* InAddress)
+	{
+		return VirtualAlloc(InAddress, ChunkSize, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+	}
+
+	void DecommitChunk(uint8* InAddress)
+	{
+		VirtualFree(InAddress, ChunkSize, MEM_DECOMMIT);
+	}
+
+	void* SystemAlignedMalloc(size_t InSize, size_t InAlignment)
+	{
+		return _aligned_malloc(InSize, InAlignment);
+	}
+
+	void SystemAlignedFree(void* InMemory)
+	{
+		_aligned_free(InMemory);
+	}
+#else
+	uint8* ReserveAddressSpace(size_t InSize)
+	{
+		void* Address = mmap(nullptr, InSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		return Address == MAP_FAILED ? nullptr : static_cast<uint8*>(Address);
+	}
+
+	bool CommitChunk(uint8* InAddress)
+	{
+		return mprotect(InAddress, ChunkSize, PROT_READ | PROT_WRITE) == 0;
+	}
+
+	void DecommitChunk(uint8* InAddress)
+	{
+		madvise(InAddress, ChunkSize, MADV_DONTNEED);
+		mprotect(InAddress, ChunkSize, PROT_NONE);
+	}
+
+	void* SystemAlignedMalloc(size_t InSize, size_t InAlignment)
+	{
+		return aligned_alloc(InAlignment, (InSize + InAlignment - 1) & ~(InAlignment - 1));
+	}
+
+	void SystemAlignedFree(void* InMemory)
+	{
+		free(InMemory);
+	}
+#endif
+
+	uint8* GetPoolBase()
+	{
+		if (!GbPoolInitialized.load(std::memory_order_acquire))
+		{
+			FScopedSpinLock ScopedLock(GPoolInitLock);
+			if (!GbPoolInitialized.load(std::memory_order_relaxed))
+			{
+				// 예약에 실패하면 모든 할당이 큰 할당 경로로 처리됨
+				GPoolBase.store(ReserveAddressSpace(PoolReserveSize), std::memory_order_relaxed);
+				GbPoolInitialized.store(true, std::memory_order_release);
+			}
+		}
+
+		return GPoolBase.load(std::memory_order_relaxed);
+	}
+
+	bool IsPoolPointer(const void* InMemory)
+	{
+		const uint8* Base = GPoolBase.load(std::memory_order_relaxed);
+		const uint8* Memory = static_cast<const uint8*>(InMemory);
+		return Base && Memory >= Base && Memory < Base + PoolReserveSize;
+	}
+
+	size_t GetPoolChunkIndex(const void* InMemory)
+	{
+		const size_t Offset = static_cast<const uint8*>(InMemory) - GPoolBase.load(std::memory_order_relaxed);
+		return Offset >> ChunkShift;
+	}
+
+	/**
+	 * @brief 요청 크기와 정렬로부터 크기 등급을 결정하는 함수
+	 * 16바이트를 넘는 정렬은 블록 크기가 정렬의 배수인 등급을 선택해 보장한다 (청크 시작 주소는 64KB 정렬)
+	 * @return 크기 등급 인덱스 (큰 할당이면 InvalidSizeClass)
+	 */
+	uint32 GetSizeClass(size_t InSize, size_t InAlignment)
+	{
+		if (InAlignment > FMemory::DefaultAlignment)
+		{
+			InSize = (InSize + InAlignment - 1) & ~(InAlignment - 1);
+		}
+
+		if (InSize > FMemory::MaxSmallSize)
+		{
+			return InvalidSizeClass;
+		}
+
+		uint32 ClassIndex = GSizeClassTable.ClassIndices[(InSize + 15) / 16];
+		while (ClassIndex < NumSizeClasses && SizeClasses[ClassIndex] % InAlignment != 0)
+		{
+			++ClassIndex;
+		}
+
+		return ClassIndex < NumSizeClasses ? ClassIndex : InvalidSizeClass;
+	}
+
+	void AddStat(FThreadCache* InCache, EMemoryTag InTag, int64 InBytes, int64 InCount)
+	{
+		const uint32 TagIndex = static_cast<uint32>(InTag);
+		if (InCache)
+		{
+			// 소유 스레드만 쓰므로 원자적 RMW 없이 갱신
+			std::atomic<int64>& AllocatedBytes = InCache->AllocatedBytes[TagIndex];
+			std::atomic<int64>& AllocationCount = InCache->AllocationCount[TagIndex];
+			AllocatedBytes.store(AllocatedBytes.load(std::memory_order_relaxed) + InBytes, std::memory_order_relaxed);
+			AllocationCount.store(AllocationCount.load(std::memory_order_relaxed) + InCount, std::memory_order_relaxed);
+		}
+		else
+		{
+			GRetiredAllocatedBytes[TagIndex].fetch_add(InBytes, std::memory_order_relaxed);
+			GRetiredAllocationCount[TagIndex].fetch_add(InCount, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief 현재 스레드의 캐시를 반환하는 함수
+	 * 스레드 종료 과정에서 캐시가 이미 파괴되었다면 nullptr을 반환하고, 호출자는 전역 목록을 직접 사용한다
+	 */
+	FThreadCache* GetThreadCache()
+	{
+		if (GbIsThreadCacheDestroyed)
+		{
+			return nullptr;
+		}
+
+		FThreadCache& Cache = GThreadCache;
+		if (!Cache.bIsRegistered)
+		{
+			FScopedSpinLock ScopedLock(GRegistryLock);
+			Cache.NextRegistered = GRegistryHead;
+			if (GRegistryHead)
+			{
+				GRegistryHead->PrevRegistered = &Cache;
+			}
+			GRegistryHead = &Cache;
+			Cache.bIsRegistered = true;
+		}
+
+		return &Cache;
+	}
+
+	/**
+	 * @brief 새 청크를 커밋해 블록 목록으로 만드는 함수 (등급 락을 잡은 상태에서 호출)
+	 * 청크는 하나의 태그에만 속하므로 블록 주소만으로 할당 당시의 태그를 알 수 있다
+	 * @return 청크의 블록들을 연결한 목록 (주소 공간이 소진되었거나 커밋에 실패하면 nullptr)
+	 */
+	FFreeBlock* CarveNewChunk(EMemoryTag InTag, uint32 InClassIndex)
+	{
+		uint8* Base = GetPoolBase();
+		if (!Base)
+		{
+			return nullptr;
+		}
+
+		// Trim으로 반환된 청크가 있으면 다른 태그 / 등급이 쓰던 청크라도 먼저 재사용
+		size_t ChunkIndex = NumPoolChunks;
+		{
+			FScopedSpinLock ScopedLock(GFreeChunkLock);
+			if (GNumFreeChunks > 0)
+			{
+				ChunkIndex = GFreeChunkIndices[--GNumFreeChunks];
+			}
+		}
+
+		if (ChunkIndex == NumPoolChunks)
+		{
+			ChunkIndex = GNextPoolChunk.fetch_add(1, std::memory_order_relaxed);
+			if (ChunkIndex >= NumPoolChunks)
+			{
+				return nullptr;
+			}
+		}
+
+		uint8* Chunk = Base + ChunkIndex * ChunkSize;
+		if (!CommitChunk(Chunk))
+		{
+			FScopedSpinLock ScopedLock(GFreeChunkLock);
+			GFreeChunkIndices[GNumFreeChunks++] = static_cast<uint32>(ChunkIndex);
+			return nullptr;
+		}
+		GNumCommittedChunks.fetch_add(1, std::memory_order_relaxed);
+		GChunkSizeClasses[ChunkIndex] = static_cast<uint8>(InClassIndex);
+		GChunkTags[ChunkIndex] = InTag;
+
+		const uint32 BlockSize = SizeClasses[InClassIndex];
+		const uint32 NumBlocks = static_cast<uint32>(ChunkSize / BlockSize);
+
+		// 앞쪽 블록부터 사용되도록 역순으로 연결
+		FFreeBlock* Head = nullptr;
+		for (uint32 BlockIndex = NumBlocks; BlockIndex > 0; --BlockIndex)
+		{
+			FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Chunk + (BlockIndex - 1) * BlockSize);
+			Block->Next = Head;
+			Head = Block;
+		}
+
+		return Head;
+	}
+
+	/**
+	 * @brief 전역 목록에서 최대 InCount개의 블록을 떼어오는 함수
+	 * @param OutNumBlocks 실제로 가져온 블록 수
+	 */
+	FFreeBlock* PopGlobalBlocks(EMemoryTag InTag, uint32 InClassIndex, uint32 InCount, uint32& OutNumBlocks)
+	{
+		FGlobalSizeClass& SizeClass = GGlobalSizeClasses[static_cast<uint32>(InTag)][InClassIndex];
+		FScopedSpinLock ScopedLock(SizeClass.Lock);
+
+		if (!SizeClass.FreeList)
+		{
+			SizeClass.FreeList = CarveNewChunk(InTag, InClassIndex);
+		}
+
+		FFreeBlock* Head = SizeClass.FreeList;
+		FFreeBlock* Tail = nullptr;
+		OutNumBlocks = 0;
+		for (FFreeBlock* Block = Head; Block && OutNumBlocks < InCount; Block = Block->Next)
+		{
+			Tail = Block;
+			++OutNumBlocks;
+		}
+
+		if (!Tail)
+		{
+			return nullptr;
+		}
+
+		SizeClass.FreeList = Tail->Next;
+		Tail->Next = nullptr;
+		return Head;
+	}
+
+	void PushGlobalBlocks(EMemoryTag InTag, uint32 InClassIndex, FFreeBlock* InHead, FFreeBlock* InTail)
+	{
+		FGlobalSizeClass& SizeClass = GGlobalSizeClasses[static_cast<uint32>(InTag)][InClassIndex];
+		FScopedSpinLock ScopedLock(SizeClass.Lock);
+
+		InTail->Next = SizeClass.FreeList;
+		SizeClass.FreeList = InHead;
+	}
+
+	/**
+	 * @brief 한 태그 / 등급의 전역 목록에서 모든 블록이 돌아온 청크를 떼어내 디커밋하는 함수 (GTrimLock을 잡은 상태에서 호출)
+	 * 청크는 하나의 태그 / 등급에만 속하므로, 이 목록에 청크의 블록 수만큼 대기 중이면 사용 중이거나 캐시된 블록이 없다
+	 * @return 디커밋한 청크 수
+	 */
+	size_t TrimGlobalSizeClass(EMemoryTag InTag, uint32 InClassIndex)
+	{
+		constexpr uint16 TrimmedChunkMark = UINT16_MAX;
+
+		FGlobalSizeClass& SizeClass = GGlobalSizeClasses[static_cast<uint32>(InTag)][InClassIndex];
+		FScopedSpinLock ScopedLock(SizeClass.Lock);
+
+		if (!SizeClass.FreeList)
+		{
+			return 0;
+		}
+
+		const uint16 NumBlocksPerChunk = static_cast<uint16>(ChunkSize / SizeClasses[InClassIndex]);
+		for (FFreeBlock* Block = SizeClass.FreeList; Block; Block = Block->Next)
+		{
+			++GChunkFreeCounts[GetPoolChunkIndex(Block)];
+		}
+
+		// 모든 블록이 대기 중인 청크의 블록은 목록에서 빼고, 나머지는 순서를 유지한 채 다시 연결
+		size_t NumTrimmedChunks = 0;
+		FFreeBlock* KeptHead = nullptr;
+		FFreeBlock** KeptTail = &KeptHead;
+		for (FFreeBlock* Block = SizeClass.FreeList; Block;)
+		{
+			FFreeBlock* Next = Block->Next;
+			uint16& FreeCount = GChunkFreeCounts[GetPoolChunkIndex(Block)];
+			if (FreeCount == NumBlocksPerChunk)
+			{
+				GTrimmedChunkIndices[NumTrimmedChunks++] = static_cast<uint32>(GetPoolChunkIndex(Block));
+				FreeCount = TrimmedChunkMark;
+			}
+			else if (FreeCount != TrimmedChunkMark)
+			{
+				*KeptTail = Block;
+				KeptTail = &Block->Next;
+			}
+			Block = Next;
+		}
+		*KeptTail = nullptr;
+		SizeClass.FreeList = KeptHead;
+
+		for (FFreeBlock* Block = KeptHead; Block; Block = Block->Next)
+		{
+			GChunkFreeCounts[GetPoolChunkIndex(Block)] = 0;
+		}
+
+		// 블록 링크를 모두 읽은 뒤에 디커밋하고, 그 다음에야 다른 태그 / 등급이 재사용할 수 있게 공개
+		uint8* Base = GPoolBase.load(std::memory_order_relaxed);
+		for (size_t Index = 0; Index < NumTrimmedChunks; ++Index)
+		{
+			const uint32 ChunkIndex = GTrimmedChunkIndices[Index];
+			GChunkFreeCounts[ChunkIndex] = 0;
+			DecommitChunk(Base + static_cast<size_t>(ChunkIndex) * ChunkSize);
+		}
+
+		{
+			FScopedSpinLock FreeChunkLock(GFreeChunkLock);
+			for (size_t Index = 0; Index < NumTrimmedChunks; ++Index)
+			{
+				GFreeChunkIndices[GNumFreeChunks++] = GTrimmedChunkIndices[Index];
+			}
+		}
+		GNumCommittedChunks.fetch_sub(NumTrimmedChunks, std::memory_order_relaxed);
+
+		return NumTrimmedChunks;
+	}
+
+	void* AllocateSmall(EMemoryTag InTag, uint32 InClassIndex, FThreadCache* InCache)
+	{
+		if (!InCache)
+		{
+			uint32 NumBlocks = 0;
+			return PopGlobalBlocks(InTag, InClassIndex, 1, NumBlocks);
+		}
+
+		const uint32 TagIndex = static_cast<uint32>(InTag);
+		FFreeBlock*& FreeList = InCache->FreeLists[TagIndex][InClassIndex];
+		uint32& NumFree = InCache->NumFree[TagIndex][InClassIndex];
+
+		if (!FreeList)
+		{
+			FreeList = PopGlobalBlocks(InTag, InClassIndex, GetBatchCount(InClassIndex), NumFree);
+		}
+
+		FFreeBlock* Block = FreeList;
+		if (Block)
+		{
+			FreeList = Block->Next;
+			--NumFree;
+		}
+
+		return Block;
+	}
+
+	void FreeSmall(void* InMemory, EMemoryTag InTag, uint32 InClassIndex, FThreadCache* InCache)
+	{
+		FFreeBlock* Block = static_cast<FFreeBlock*>(InMemory);
+
+		if (!InCache)
+		{
+			PushGlobalBlocks(InTag, InClassIndex, Block, Block);
+			return;
+		}
+
+		const uint32 TagIndex = static_cast<uint32>(InTag);
+		FFreeBlock*& FreeList = InCache->FreeLists[TagIndex][InClassIndex];
+		uint32& NumFree = InCache->NumFree[TagIndex][InClassIndex];
+
+		Block->Next = FreeList;
+		FreeList = Block;
+
+		// 캐시가 너무 커지면 한 묶음을 전역 목록으로 반환해 다른 스레드가 재사용할 수 있게 함
+		const uint32 BatchCount = GetBatchCount(InClassIndex);
+		if (++NumFree > BatchCount * 2)
+		{
+			FFreeBlock* Head = FreeList;
+			FFreeBlock* Tail = Head;
+			for (uint32 Index = 1; Index < BatchCount; ++Index)
+			{
+				Tail = Tail->Next;
+			}
+
+			FreeList = Tail->Next;
+			NumFree -= BatchCount;
+			PushGlobalBlocks(InTag, InClassIndex, Head, Tail);
+		}
+	}
+
+	void* AllocateLarge(size_t InSize, size_t InAlignment, EMemoryTag InTag)
+	{
+		const size_t HeaderOffset = (sizeof(FLargeAllocHeader) + InAlignment - 1) & ~(InAlignment - 1);
+		uint8* BaseAddress = static_cast<uint8*>(SystemAlignedMalloc(HeaderOffset + InSize, InAlignment));
+		if (!BaseAddress)
+		{
+			return nullptr;
+		}
+
+		uint8* Memory = BaseAddress + HeaderOffset;
+		FLargeAllocHeader* Header = reinterpret_cast<FLargeAllocHeader*>(Memory) - 1;
+		Header->BaseAddress = BaseAddress;
+		Header->Size = InSize;
+		Header->Tag = InTag;
+		return Memory;
+	}
+
+	const FLargeAllocHeader* GetLargeAllocHeader(const void* InMemory)
+	{
+		return static_cast<const FLargeAllocHeader*>(InMemory) - 1;
+	}
+
+	/**
+	 * @brief 스레드 캐시에 대기 중인 블록을 모두 전역 목록으로 돌려주는 함수
+	 */
+	void FlushThreadCache(FThreadCache& InCache)
+	{
+		for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+		{
+			for (uint32 ClassIndex = 0; ClassIndex < NumSizeClasses; ++ClassIndex)
+			{
+				FFreeBlock* Head = InCache.FreeLists[TagIndex][ClassIndex];
+				if (!Head)
+				{
+					continue;
+				}
+
+				FFreeBlock* Tail = Head;
+				while (Tail->Next)
+				{
+					Tail = Tail->Next;
+				}
+				PushGlobalBlocks(static_cast<EMemoryTag>(TagIndex), ClassIndex, Head, Tail);
+
+				InCache.FreeLists[TagIndex][ClassIndex] = nullptr;
+				InCache.NumFree[TagIndex][ClassIndex] = 0;
+			}
+		}
+	}
+
+	/**
+	 * @brief 스레드 종료 시 캐시된 블록을 전역 목록으로 돌려주고 통계를 누적값으로 옮기는 소멸자
+	 */
+	FThreadCache::~FThreadCache()
+	{
+		FlushThreadCache(*this);
+
+		if (bIsRegistered)
+		{
+			FScopedSpinLock ScopedLock(GRegistryLock);
+			for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+			{
+				GRetiredAllocatedBytes[TagIndex].fetch_add(AllocatedBytes[TagIndex].load(std::memory_order_relaxed),
+				                                           std::memory_order_relaxed);
+				GRetiredAllocationCount[TagIndex].fetch_add(AllocationCount[TagIndex].load(std::memory_order_relaxed),
+				                                            std::memory_order_relaxed);
+			}
+
+			if (PrevRegistered)
+			{
+				PrevRegistered->NextRegistered = NextRegistered;
+			}
+			else
+			{
+				GRegistryHead = NextRegistered;
+			}
+			if (NextRegistered)
+			{
+				NextRegistered->PrevRegistered = PrevRegistered;
+			}
+			bIsRegistered = false;
+		}
+
+		GbIsThreadCacheDestroyed = true;
+	}
+}
+
+void* FMemory::Malloc(size_t InSize, size_t InAlignment)
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	const size_t Alignment = max(InAlignment, DefaultAlignment);
+	const size_t Size = max(InSize, static_cast<size_t>(1));
+
+	FThreadCache* Cache = GetThreadCache();
+	const EMemoryTag Tag = GCurrentMemoryTag;
 
-	// Debug Print
-	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        InSize, TotalAllocationBytes, TotalAllocationCount);
+	void* Memory = nullptr;
+	size_t AllocationSize = Size;
+
+	const uint32 ClassIndex = GetSizeClass(Size, Alignment);
+	if (ClassIndex != InvalidSizeClass)
+	{
+		Memory = AllocateSmall(Tag, ClassIndex, Cache);
+		AllocationSize = SizeClasses[ClassIndex];
+	}
+
+	// 큰 할당이거나 작은 할당용 주소 공간을 사용할 수 없는 경우
+	if (!Memory)
+	{
+		Memory = AllocateLarge(Size, Alignment, Tag);
+		AllocationSize = Size;
+	}
 
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + InSize));
-	MemoryHeader->size = InSize;
-	MemoryHeader->bIsAligned = false;
+	if (Memory)
+	{
+		AddStat(Cache, Tag, static_cast<int64>(AllocationSize), 1);
+	}
 
-	return MemoryHeader + 1;
+	return Memory;
 }
 
-/**
- * @brief 오버로드된 함수로 생성 처리한 메모리 공간을 할당 해제하는 함수
- * @param InMemory 처음에 객체 할당용으로 제공된 메모리 주소
- */
-void operator delete(void* InMemory) noexcept
+void FMemory::Free(void* InMemory)
 {
 	if (!InMemory)
 	{
 		return;
 	}
 
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(InMemory) - 1;
-	size_t MemoryAllocSize = MemoryHeader->size;
+	FThreadCache* Cache = GetThreadCache();
+
+	if (IsPoolPointer(InMemory))
+	{
+		const size_t ChunkIndex = GetPoolChunkIndex(InMemory);
+		const uint32 ClassIndex = GChunkSizeClasses[ChunkIndex];
+		const EMemoryTag Tag = GChunkTags[ChunkIndex];
+		AddStat(Cache, Tag, -static_cast<int64>(SizeClasses[ClassIndex]), -1);
+		FreeSmall(InMemory, Tag, ClassIndex, Cache);
+		return;
+	}
 
-	// Debug Print
-	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
+	const FLargeAllocHeader* Header = GetLargeAllocHeader(InMemory);
+	AddStat(Cache, Header->Tag, -static_cast<int64>(Header->Size), -1);
+	SystemAlignedFree(Header->BaseAddress);
+}
 
-	if (TotalAllocationCount > 0)
+size_t FMemory::GetAllocationSize(const void* InMemory)
+{
+	if (!InMemory)
 	{
-		--TotalAllocationCount;
+		return 0;
 	}
-	else
+
+	if (IsPoolPointer(InMemory))
 	{
-		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
+		return SizeClasses[GChunkSizeClasses[GetPoolChunkIndex(InMemory)]];
 	}
 
-	if (TotalAllocationBytes >= MemoryAllocSize)
+	return GetLargeAllocHeader(InMemory)->Size;
+}
+
+EMemoryTag FMemory::GetCurrentTag()
+{
+	return GCurrentMemoryTag;
+}
+
+void FMemory::SetCurrentTag(EMemoryTag InTag)
+{
+	GCurrentMemoryTag = InTag;
+}
+
+EMemoryTag FMemory::GetAllocationTag(const void* InMemory)
+{
+	if (!InMemory)
 	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
+		return EMemoryTag::Untagged;
 	}
-	else
+
+	if (IsPoolPointer(InMemory))
 	{
-		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
+		return GChunkTags[GetPoolChunkIndex(InMemory)];
 	}
 
-	if (MemoryHeader->bIsAligned)
+	return GetLargeAllocHeader(InMemory)->Tag;
+}
+
+const char* FMemory::GetTagName(EMemoryTag InTag)
+{
+	const uint32 TagIndex = static_cast<uint32>(InTag);
+	return TagIndex < NumMemoryTags ? MemoryTagNames[TagIndex] : "Invalid";
+}
+
+uint64 FMemory::GetTotalAllocationBytes()
+{
+	FMemoryTagStat Stats[NumMemoryTags];
+	GetTagStats(Stats);
+
+	uint64 Total = 0;
+	for (const FMemoryTagStat& Stat : Stats)
 	{
-		_aligned_free(MemoryHeader);
+		Total += Stat.AllocatedBytes;
 	}
-	else
+
+	return Total;
+}
+
+uint64 FMemory::GetTotalAllocationCount()
+{
+	FMemoryTagStat Stats[NumMemoryTags];
+	GetTagStats(Stats);
+
+	uint64 Total = 0;
+	for (const FMemoryTagStat& Stat : Stats)
 	{
-		free(MemoryHeader);
+		Total += Stat.AllocationCount;
 	}
+
+	return Total;
+}
+
+FMemoryTagStat FMemory::GetTagStat(EMemoryTag InTag)
+{
+	FMemoryTagStat Stats[NumMemoryTags];
+	GetTagStats(Stats);
+	return Stats[static_cast<uint32>(InTag)];
+}
+
+void FMemory::GetTagStats(FMemoryTagStat (&OutStats)[NumMemoryTags])
+{
+	int64 AllocatedBytes[NumMemoryTags];
+	int64 AllocationCount[NumMemoryTags];
+
+	{
+		FScopedSpinLock ScopedLock(GRegistryLock);
+
+		for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+		{
+			AllocatedBytes[TagIndex] = GRetiredAllocatedBytes[TagIndex].load(std::memory_order_relaxed);
+			AllocationCount[TagIndex] = GRetiredAllocationCount[TagIndex].load(std::memory_order_relaxed);
+		}
+
+		for (const FThreadCache* Cache = GRegistryHead; Cache; Cache = Cache->NextRegistered)
+		{
+			for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+			{
+				AllocatedBytes[TagIndex] += Cache->AllocatedBytes[TagIndex].load(std::memory_order_relaxed);
+				AllocationCount[TagIndex] += Cache->AllocationCount[TagIndex].load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// 다른 스레드의 카운터를 읽는 도중 값이 바뀌면 일시적으로 음수가 될 수 있으므로 0으로 보정
+	for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+	{
+		OutStats[TagIndex].AllocatedBytes = static_cast<uint64>(max(AllocatedBytes[TagIndex], static_cast<int64>(0)));
+		OutStats[TagIndex].AllocationCount = static_cast<uint64>(max(AllocationCount[TagIndex], static_cast<int64>(0)));
+	}
+}
+
+uint64 FMemory::Trim()
+{
+	if (!GPoolBase.load(std::memory_order_relaxed))
+	{
+		return 0;
+	}
+
+	if (FThreadCache* Cache = GetThreadCache())
+	{
+		FlushThreadCache(*Cache);
+	}
+
+	FScopedSpinLock ScopedLock(GTrimLock);
+
+	size_t NumTrimmedChunks = 0;
+	for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+	{
+		for (uint32 ClassIndex = 0; ClassIndex < NumSizeClasses; ++ClassIndex)
+		{
+			NumTrimmedChunks += TrimGlobalSizeClass(static_cast<EMemoryTag>(TagIndex), ClassIndex);
+		}
+	}
+
+	return static_cast<uint64>(NumTrimmedChunks) * ChunkSize;
+}
+
+uint64 FMemory::GetCommittedSmallBytes()
+{
+	return static_cast<uint64>(GNumCommittedChunks.load(std::memory_order_relaxed)) * ChunkSize;
+}
+
+FString FMemory::DumpTagStats()
+{
+	FMemoryTagStat Stats[NumMemoryTags];
+	GetTagStats(Stats);
+
+	// 통계 문자열 자체의 할당이 결과에 섞이지 않도록 수집이 끝난 뒤에 문자열을 만든다
+	FString Result = "Tag            Count        Bytes\n";
+
+	FMemoryTagStat Total;
+	for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+	{
+		char Line[128];
+		(void)snprintf(Line, sizeof(Line), "%-12s %8llu %14llu\n", MemoryTagNames[TagIndex],
+		               static_cast<unsigned long long>(Stats[TagIndex].AllocationCount),
+		               static_cast<unsigned long long>(Stats[TagIndex].AllocatedBytes));
+		Result += Line;
+
+		Total.AllocationCount += Stats[TagIndex].AllocationCount;
+		Total.AllocatedBytes += Stats[TagIndex].AllocatedBytes;
+	}
+
+	char Line[128];
+	(void)snprintf(Line, sizeof(Line), "%-12s %8llu %14llu\n", "Total",
+	               static_cast<unsigned long long>(Total.AllocationCount),
+	               static_cast<unsigned long long>(Total.AllocatedBytes));
+	Result += Line;
+
+	return Result;
+}
+
+/**
+ * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
+ * @param InSize 할당 size
+ * @return 할당한 공간의 첫 메모리 주소
+ */
+void* operator new(size_t InSize)
+{
+	void* Memory = FMemory::Malloc(InSize);
+	if (!Memory)
+	{
+		throw std::bad_alloc();
+	}
+
+	return Memory;
+}
+
+/**
+ * @brief 오버로드된 함수로 생성 처리한 메모리 공간을 할당 해제하는 함수
+ * @param InMemory 처음에 객체 할당용으로 제공된 메모리 주소
+ */
+void operator delete(void* InMemory) noexcept
+{
+	FMemory::Free(InMemory);
 }
 
 /**
@@ -97,36 +947,53 @@ void operator delete[](void* InMemory) noexcept
 }
 
 // C++17에서 추가로 제공된 Align된 메모리에 대한 오버로딩 함수
-// SIMD 타입이 추후 필요한 것으로 보고 미리 구현해 둠
+// 반환 주소가 요청한 정렬을 그대로 만족하며, 해제는 일반 delete와 같은 경로를 사용한다
 
 void* operator new(size_t InSize, align_val_t InAlignment)
 {
-	size_t Alignment = static_cast<size_t>(InAlignment);
+	void* Memory = FMemory::Malloc(InSize, static_cast<size_t>(InAlignment));
+	if (!Memory)
+	{
+		throw std::bad_alloc();
+	}
+
+	return Memory;
+}
+
+void* operator new[](size_t InSize, align_val_t InAlignment)
+{
+	return ::operator new(InSize, InAlignment);
+}
 
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+void operator delete(void* InMemory, align_val_t InAlignment) noexcept
+{
+	FMemory::Free(InMemory);
+}
 
-	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
-	size_t TotalSize = sizeof(AllocHeader) + InSize;
+void operator delete[](void* InMemory, align_val_t InAlignment) noexcept
+{
+	FMemory::Free(InMemory);
+}
 
-	// aligned_alloc 사용
-	// 크기는 정렬값의 배수로 처리해야 함
-	size_t AlignedTotalSize = (TotalSize + Alignment - 1) & ~(Alignment - 1);
+// 크기를 전달받는 delete는 표준 라이브러리 기본 구현에 맡기지 않고 같은 경로로 연결
+// (블록 크기는 FMemory가 직접 알고 있으므로 전달받은 크기는 사용하지 않음)
 
-#ifdef _MSC_VER
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(_aligned_malloc(AlignedTotalSize, Alignment));
-#else
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(aligned_malloc(Alignment, AlignedTotalSize));
-#endif
+void operator delete(void* InMemory, size_t InSize) noexcept
+{
+	FMemory::Free(InMemory);
+}
 
-	// 실제 할당된 크기를 저장
-	MemoryHeader->size = InSize;
-	MemoryHeader->bIsAligned = true;
+void operator delete[](void* InMemory, size_t InSize) noexcept
+{
+	FMemory::Free(InMemory);
+}
 
-	return MemoryHeader + 1;
+void operator delete(void* InMemory, size_t InSize, align_val_t InAlignment) noexcept
+{
+	FMemory::Free(InMemory);
 }
 
-void operator delete(void* InMemory, align_val_t InAlignment) noexcept
+void operator delete[](void* InMemory, size_t InSize, align_val_t InAlignment) noexcept
 {
-	::operator delete(InMemory);
+	FMemory::Free(InMemory);
 }
@@ -1,11 +1,132 @@
 #pragma once
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+/**
+ * @brief 할당을 귀속시킬 메모리 태그 (언리얼 LLM 스타일)
+ * 스레드마다 현재 태그를 가지며, FMemoryTagScope로 진입점에서 지정한다
+ */
+enum class EMemoryTag : uint8
+{
+	Untagged,
+	Object,
+	Asset,
+	StaticMesh,
+	Texture,
+	Renderer,
+	UI,
+	Logger,
+
+	Count
+};
 
-struct AllocHeader
+constexpr uint32 NumMemoryTags = static_cast<uint32>(EMemoryTag::Count);
+
+/**
+ * @brief 태그 하나에 귀속된 살아있는 할당 통계
+ */
+struct FMemoryTagStat
 {
-	size_t size;
-	bool bIsAligned;
+	uint64 AllocatedBytes = 0;
+	uint64 AllocationCount = 0;
 };
 
+/**
+ * @brief 엔진 전역 메모리 할당자
+ * 전역 operator new / delete가 이 할당자를 사용하도록 Memory.cpp에서 오버로딩되어 있다
+ *
+ * 작은 할당(MaxSmallSize 이하)은 크기 등급별로 나눈 뒤, 미리 예약해 둔 주소 공간의 64KB 청크에서 잘라 쓴다
+ * 각 스레드는 등급별 Free List 캐시를 가지므로 대부분의 할당 / 해제가 잠금 없이 처리되며,
+ * 캐시가 비거나 넘칠 때만 등급별 전역 목록과 묶음 단위로 주고받는다
+ * 큰 할당은 시스템 할당자를 사용하고 반환 주소 바로 앞에 크기 정보를 기록한다
+ *
+ * 통계는 스레드별 카운터의 합으로 계산되므로 경합 없이도 정확한 값을 유지한다
+ * 할당 크기는 요청 크기가 아닌 실제로 제공된 크기(GetAllocationSize) 기준으로 집계된다
+ *
+ * 모든 할당은 할당 시점 스레드의 현재 메모리 태그에 귀속된다
+ * 작은 할당은 태그별로 청크를 따로 사용하고 큰 할당은 헤더에 태그를 기록하므로,
+ * 다른 스레드나 다른 태그 범위에서 해제되더라도 원래 태그에서 차감된다
+ *
+ * 작은 할당용 청크는 해제되어도 자동으로 OS에 돌려주지 않으므로, Trim 전까지 커밋 메모리는 태그 / 등급별 최대 사용량을 유지한다
+ * Trim은 모든 블록이 전역 목록에 돌아온 청크를 디커밋하고, 디커밋된 청크는 태그 / 등급과 무관하게 다음 청크로 재사용된다
+ */
+class FMemory
+{
+public:
+	static constexpr size_t DefaultAlignment = 16;
+	static constexpr size_t MaxSmallSize = 1024;
+
+	/**
+	 * @brief 메모리를 할당하는 함수
+	 * @param InSize 할당 크기
+	 * @param InAlignment 정렬 단위 (2의 거듭제곱)
+	 * @return 할당된 메모리 주소 (실패 시 nullptr)
+	 */
+	static void* Malloc(size_t InSize, size_t InAlignment = DefaultAlignment);
+
+	static void Free(void* InMemory);
+
+	/**
+	 * @brief 할당된 블록의 실제 사용 가능한 크기를 반환하는 함수
+	 * 작은 할당은 청크 테이블 조회, 큰 할당은 헤더 조회로 끝나므로 O(1)이다
+	 */
+	static size_t GetAllocationSize(const void* InMemory);
+
+	// Memory Tag
+	static EMemoryTag GetCurrentTag();
+	static void SetCurrentTag(EMemoryTag InTag);
+	static EMemoryTag GetAllocationTag(const void* InMemory);
+	static const char* GetTagName(EMemoryTag InTag);
+
+	// Stat
+	static uint64 GetTotalAllocationBytes();
+	static uint64 GetTotalAllocationCount();
+	static FMemoryTagStat GetTagStat(EMemoryTag InTag);
+
+	/**
+	 * @brief 모든 태그의 통계를 한 번에 수집하는 함수
+	 * @param OutStats 태그 인덱스 순서로 채워질 NumMemoryTags 크기의 배열
+	 */
+	static void GetTagStats(FMemoryTagStat (&OutStats)[NumMemoryTags]);
+
+	/**
+	 * @brief 태그별 통계를 사람이 읽을 수 있는 표 형태의 문자열로 만드는 함수
+	 * 오버레이 없이도 콘솔이나 로그로 내보낼 수 있도록 렌더링과 분리되어 있다
+	 */
+	static FString DumpTagStats();
+
+	/**
+	 * @brief 블록이 모두 해제된 작은 할당용 청크를 OS에 돌려주는 함수 (레벨 교체 후 등 한가한 시점에 호출)
+	 * 호출 스레드의 캐시는 먼저 전역 목록으로 비우며, 다른 스레드 캐시에 남은 블록이 있는 청크는 유지된다
+	 * @return 디커밋한 바이트 수
+	 */
+	static uint64 Trim();
+
+	/**
+	 * @brief 작은 할당용으로 현재 커밋되어 있는 바이트 수 (사용 중 + 목록에 대기 중인 블록 포함)
+	 */
+	static uint64 GetCommittedSmallBytes();
+};
+
+/**
+ * @brief 범위 동안 현재 스레드의 메모리 태그를 지정하는 클래스
+ * 중첩되면 가장 안쪽 태그가 적용되고, 범위를 벗어나면 이전 태그로 복원된다
+ */
+class FMemoryTagScope
+{
+public:
+	explicit FMemoryTagScope(EMemoryTag InTag)
+		: PreviousTag(FMemory::GetCurrentTag())
+	{
+		FMemory::SetCurrentTag(InTag);
+	}
+
+	~FMemoryTagScope()
+	{
+		FMemory::SetCurrentTag(PreviousTag);
+	}
+
+	FMemoryTagScope(const FMemoryTagScope&) = delete;
+	FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+private:
+	EMemoryTag PreviousTag;
+};
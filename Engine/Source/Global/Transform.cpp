@@ -0,0 +1,211 @@
+#include "pch.h"
+#include "Global/Transform.h"
+
+namespace
+{
+	/**
+	 * @brief 단위 쿼터니언으로 벡터를 회전하는 함수
+	 * q * v * q^-1을 전개한 v + 2w(u x v) + 2u x (u x v) 형태로, 쿼터니언 곱 두 번과 나눗셈을 생략한다
+	 */
+	FVector RotateByQuaternion(const FQuaternion& InRotation, const FVector& InVector)
+	{
+		const float TX = 2.0f * (InRotation.Y * InVector.Z - InRotation.Z * InVector.Y);
+		const float TY = 2.0f * (InRotation.Z * InVector.X - InRotation.X * InVector.Z);
+		const float TZ = 2.0f * (InRotation.X * InVector.Y - InRotation.Y * InVector.X);
+
+		return FVector(
+			InVector.X + InRotation.W * TX + (InRotation.Y * TZ - InRotation.Z * TY),
+			InVector.Y + InRotation.W * TY + (InRotation.Z * TX - InRotation.X * TZ),
+			InVector.Z + InRotation.W * TZ + (InRotation.X * TY - InRotation.Y * TX));
+	}
+
+	/**
+	 * @brief 단위 쿼터니언의 3x3 회전 행렬 (열 벡터 기준)
+	 */
+	void GetRotationMatrix(const FQuaternion& InRotation, float OutMatrix[3][3])
+	{
+		const float X2 = InRotation.X + InRotation.X;
+		const float Y2 = InRotation.Y + InRotation.Y;
+		const float Z2 = InRotation.Z + InRotation.Z;
+
+		const float XX = InRotation.X * X2;
+		const float YY = InRotation.Y * Y2;
+		const float ZZ = InRotation.Z * Z2;
+		const float XY = InRotation.X * Y2;
+		const float XZ = InRotation.X * Z2;
+		const float YZ = InRotation.Y * Z2;
+		const float WX = InRotation.W * X2;
+		const float WY = InRotation.W * Y2;
+		const float WZ = InRotation.W * Z2;
+
+		OutMatrix[0][0] = 1.0f - (YY + ZZ);
+		OutMatrix[0][1] = XY - WZ;
+		OutMatrix[0][2] = XZ + WY;
+
+		OutMatrix[1][0] = XY + WZ;
+		OutMatrix[1][1] = 1.0f - (XX + ZZ);
+		OutMatrix[1][2] = YZ - WX;
+
+		OutMatrix[2][0] = XZ - WY;
+		OutMatrix[2][1] = YZ + WX;
+		OutMatrix[2][2] = 1.0f - (XX + YY);
+	}
+
+	float SafeReciprocal(float InValue)
+	{
+		return InValue != 0.0f ? 1.0f / InValue : 0.0f;
+	}
+}
+
+FQuatTransform::FQuatTransform(const FTransform& InTransform)
+	: Translation(InTransform.Location),
+	  Rotation(MakeRotation(FVector::GetDegreeToRadian(InTransform.Rotation))),
+	  Scale3D(InTransform.Scale)
+{
+}
+
+/**
+ * RotationMatrix는 RotX(Pitch) * RotY(Yaw) * RotZ(Roll)이고 각 축 행렬은 표준 회전의 반대 방향이므로
+ * q = qx(-Pitch) * qy(-Yaw) * qz(-Roll)을 반각 삼각함수로 전개한 식이다
+ */
+FQuaternion FQuatTransform::MakeRotation(const FVector& InRotationRadian)
+{
+	const float SX = sinf(InRotationRadian.X * 0.5f);
+	const float CX = cosf(InRotationRadian.X * 0.5f);
+	const float SY = sinf(InRotationRadian.Y * 0.5f);
+	const float CY = cosf(InRotationRadian.Y * 0.5f);
+	const float SZ = sinf(InRotationRadian.Z * 0.5f);
+	const float CZ = cosf(InRotationRadian.Z * 0.5f);
+
+	return FQuaternion(
+		CX * SY * SZ - SX * CY * CZ,
+		-CX * SY * CZ - SX * CY * SZ,
+		SX * SY * CZ - CX * CY * SZ,
+		CX * CY * CZ + SX * SY * SZ);
+}
+
+FVector FQuatTransform::GetEulerDegrees(const FQuaternion& InRotation)
+{
+	float Matrix[3][3];
+	GetRotationMatrix(InRotation, Matrix);
+
+	// 표준 회전 Rx(a) * Ry(b) * Rz(c) 분해 후 엔진 각도(부호 반대)로 변환
+	// b는 asin 대신 atan2로 구해 ±90도 부근에서도 정밀도를 유지한다
+	const float CosB = sqrtf(Matrix[0][0] * Matrix[0][0] + Matrix[0][1] * Matrix[0][1]);
+	const float B = atan2f(Matrix[0][2], CosB);
+	float A;
+	float C;
+	if (CosB > 1e-4f)
+	{
+		A = atan2f(-Matrix[1][2], Matrix[2][2]);
+		C = atan2f(-Matrix[0][1], Matrix[0][0]);
+	}
+	else
+	{
+		// 짐벌 락: Roll을 0으로 두고 나머지를 Pitch에 싣는다
+		A = atan2f(Matrix[2][1], Matrix[1][1]);
+		C = 0.0f;
+	}
+
+	return FVector::GetRadianToDegree(FVector(-A, -B, -C));
+}
+
+/**
+ * M = S * R * T이므로 3x3 부분은 S * R, 이동 열은 (S * R) * t이다
+ */
+FMatrix FQuatTransform::ToMatrix() const
+{
+	float R[3][3];
+	GetRotationMatrix(Rotation, R);
+
+	const float Scale[3] = {Scale3D.X, Scale3D.Y, Scale3D.Z};
+
+	FMatrix Result;
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		Result.Data[Row][0] = Scale[Row] * R[Row][0];
+		Result.Data[Row][1] = Scale[Row] * R[Row][1];
+		Result.Data[Row][2] = Scale[Row] * R[Row][2];
+		Result.Data[Row][3] = Result.Data[Row][0] * Translation.X + Result.Data[Row][1] * Translation.Y +
+			Result.Data[Row][2] * Translation.Z;
+	}
+	Result.Data[3][3] = 1.0f;
+
+	return Result;
+}
+
+/**
+ * M^-1 = T^-1 * R^T * S^-1이므로 3x3 부분은 R^T의 열을 스케일로 나눈 값, 이동 열은 -t이다
+ */
+FMatrix FQuatTransform::ToInverseMatrix() const
+{
+	float R[3][3];
+	GetRotationMatrix(Rotation, R);
+
+	const float InvScale[3] = {SafeReciprocal(Scale3D.X), SafeReciprocal(Scale3D.Y), SafeReciprocal(Scale3D.Z)};
+
+	FMatrix Result;
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		Result.Data[Row][0] = R[0][Row] * InvScale[0];
+		Result.Data[Row][1] = R[1][Row] * InvScale[1];
+		Result.Data[Row][2] = R[2][Row] * InvScale[2];
+	}
+	Result.Data[0][3] = -Translation.X;
+	Result.Data[1][3] = -Translation.Y;
+	Result.Data[2][3] = -Translation.Z;
+	Result.Data[3][3] = 1.0f;
+
+	return Result;
+}
+
+/**
+ * A * B는 x -> Sa * Ra * (Sb * Rb * (x + tb) + ta)이므로
+ * 스케일은 성분 곱, 회전은 쿼터니언 곱, 이동은 tb + Rb^-1 * (ta / Sb)가 된다
+ */
+FQuatTransform FQuatTransform::operator*(const FQuatTransform& InOther) const
+{
+	const FVector ScaledTranslation(Translation.X * SafeReciprocal(InOther.Scale3D.X),
+	                                Translation.Y * SafeReciprocal(InOther.Scale3D.Y),
+	                                Translation.Z * SafeReciprocal(InOther.Scale3D.Z));
+
+	FQuatTransform Result;
+	Result.Scale3D = FVector(Scale3D.X * InOther.Scale3D.X, Scale3D.Y * InOther.Scale3D.Y,
+	                         Scale3D.Z * InOther.Scale3D.Z);
+	Result.Rotation = Rotation * InOther.Rotation;
+	Result.Translation = InOther.Translation + RotateByQuaternion(InOther.Rotation.Conjugate(), ScaledTranslation);
+	return Result;
+}
+
+FQuatTransform FQuatTransform::Inverse() const
+{
+	const FVector RotatedTranslation = RotateByQuaternion(Rotation, Translation);
+
+	FQuatTransform Result;
+	Result.Scale3D = FVector(SafeReciprocal(Scale3D.X), SafeReciprocal(Scale3D.Y), SafeReciprocal(Scale3D.Z));
+	Result.Rotation = Rotation.Conjugate();
+	Result.Translation = FVector(-Scale3D.X * RotatedTranslation.X, -Scale3D.Y * RotatedTranslation.Y,
+	                             -Scale3D.Z * RotatedTranslation.Z);
+	return Result;
+}
+
+FVector FQuatTransform::TransformPosition(const FVector& InPosition) const
+{
+	const FVector Rotated = RotateByQuaternion(Rotation, InPosition + Translation);
+	return FVector(Rotated.X * Scale3D.X, Rotated.Y * Scale3D.Y, Rotated.Z * Scale3D.Z);
+}
+
+bool FQuatTransform::Equals(const FQuatTransform& InOther, float InTolerance) const
+{
+	// q와 -q는 같은 회전이므로 내적의 절댓값으로 비교
+	const float RotationDot = Rotation.X * InOther.Rotation.X + Rotation.Y * InOther.Rotation.Y +
+		Rotation.Z * InOther.Rotation.Z + Rotation.W * InOther.Rotation.W;
+
+	return std::abs(Translation.X - InOther.Translation.X) <= InTolerance &&
+		std::abs(Translation.Y - InOther.Translation.Y) <= InTolerance &&
+		std::abs(Translation.Z - InOther.Translation.Z) <= InTolerance &&
+		std::abs(Scale3D.X - InOther.Scale3D.X) <= InTolerance &&
+		std::abs(Scale3D.Y - InOther.Scale3D.Y) <= InTolerance &&
+		std::abs(Scale3D.Z - InOther.Scale3D.Z) <= InTolerance &&
+		std::abs(RotationDot) >= 1.0f - InTolerance;
+}
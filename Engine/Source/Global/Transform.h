@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * @brief 이동 / 쿼터니언 회전 / 스케일로 표현한 변환
+ * 엔진의 모델 행렬 규약(FMatrix::GetModelMatrix, 열 벡터 기준 S * R * T)을 그대로 따르므로
+ * ToMatrix 결과는 같은 Location / Rotation / Scale로 만든 GetModelMatrix와 같다
+ *
+ * 4x4 행렬 곱 없이 행렬, 역행렬, 변환끼리의 합성을 닫힌 식으로 계산한다
+ * 합성과 역변환은 스케일이 균등할 때 정확하며, 비균등 스케일에서는 언리얼 엔진의 FTransform과 같은 근사를 사용한다
+ *
+ * FTransform(CoreTypes.h)은 에디터 / 스폰용 오일러 각 변환 정보로 그대로 두고, 계산에는 이 구조체를 사용한다
+ */
+struct FQuatTransform
+{
+	FVector Translation = FVector(0.0f, 0.0f, 0.0f);
+	FQuaternion Rotation = FQuaternion::Identity();
+	FVector Scale3D = FVector(1.0f, 1.0f, 1.0f);
+
+	FQuatTransform() = default;
+
+	FQuatTransform(const FVector& InTranslation, const FQuaternion& InRotation, const FVector& InScale3D)
+		: Translation(InTranslation), Rotation(InRotation), Scale3D(InScale3D)
+	{
+	}
+
+	/**
+	 * @brief 에디터 오일러 각(도 단위) 변환 정보로부터 생성
+	 */
+	explicit FQuatTransform(const FTransform& InTransform);
+
+	static FQuatTransform Identity() { return FQuatTransform(); }
+
+	/**
+	 * @brief FMatrix::RotationMatrix와 같은 회전을 나타내는 쿼터니언을 만드는 함수
+	 * @param InRotationRadian (Pitch, Yaw, Roll) 라디안, RotationMatrix의 입력과 같은 순서
+	 */
+	static FQuaternion MakeRotation(const FVector& InRotationRadian);
+
+	/**
+	 * @brief MakeRotation의 역변환으로 엔진 오일러 각(도 단위)을 구하는 함수
+	 * 같은 회전을 나타내는 여러 각도 중 Yaw가 [-90, 90] 범위인 값을 돌려준다
+	 */
+	static FVector GetEulerDegrees(const FQuaternion& InRotation);
+
+	FMatrix ToMatrix() const;
+	FMatrix ToInverseMatrix() const;
+
+	/**
+	 * @brief 두 변환의 합성
+	 * 결과의 ToMatrix는 this->ToMatrix() * InOther.ToMatrix()와 같다 (부모 * 자식 순서)
+	 */
+	FQuatTransform operator*(const FQuatTransform& InOther) const;
+
+	FQuatTransform Inverse() const;
+
+	/**
+	 * @brief 위치에 변환을 적용하는 함수 (ToMatrix() * (InPosition, 1)과 같다)
+	 */
+	FVector TransformPosition(const FVector& InPosition) const;
+
+	bool Equals(const FQuatTransform& InOther, float InTolerance = 1e-4f) const;
+};
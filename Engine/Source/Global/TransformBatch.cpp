@@ -0,0 +1,213 @@
+#include "pch.h"
+#include "Global/TransformBatch.h"
+#include "Global/MatrixMath.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+int32 FTransformBatch::Add(const FQuatTransform& InTransform, int32 InParentIndex,
+                           const FMatrix* InExternalParentMatrix)
+{
+	assert(InParentIndex < Num() && "FTransformBatch: 부모는 자식보다 먼저 추가되어야 합니다");
+
+	LocationX.Add(InTransform.Translation.X);
+	LocationY.Add(InTransform.Translation.Y);
+	LocationZ.Add(InTransform.Translation.Z);
+
+	RotationX.Add(InTransform.Rotation.X);
+	RotationY.Add(InTransform.Rotation.Y);
+	RotationZ.Add(InTransform.Rotation.Z);
+	RotationW.Add(InTransform.Rotation.W);
+
+	ScaleX.Add(InTransform.Scale3D.X);
+	ScaleY.Add(InTransform.Scale3D.Y);
+	ScaleZ.Add(InTransform.Scale3D.Z);
+
+	if (InParentIndex == INDEX_NONE && InExternalParentMatrix)
+	{
+		ParentIndices.Add(-2 - ExternalParentMatrices.Num());
+		ExternalParentMatrices.Add(*InExternalParentMatrix);
+	}
+	else
+	{
+		ParentIndices.Add(InParentIndex);
+	}
+
+	return ParentIndices.Num() - 1;
+}
+
+void FTransformBatch::Reserve(int32 InNumTransforms)
+{
+	for (TArray<float>* Component : {&LocationX, &LocationY, &LocationZ, &RotationX, &RotationY, &RotationZ,
+	                                 &RotationW, &ScaleX, &ScaleY, &ScaleZ})
+	{
+		Component->Reserve(InNumTransforms);
+	}
+
+	ParentIndices.Reserve(InNumTransforms);
+	LocalMatrices.Reserve(InNumTransforms);
+	WorldMatrices.Reserve(InNumTransforms);
+}
+
+void FTransformBatch::Reset()
+{
+	for (TArray<float>* Component : {&LocationX, &LocationY, &LocationZ, &RotationX, &RotationY, &RotationZ,
+	                                 &RotationW, &ScaleX, &ScaleY, &ScaleZ})
+	{
+		Component->Reset();
+	}
+
+	ParentIndices.Reset();
+	ExternalParentMatrices.Reset();
+	LocalMatrices.Reset();
+	WorldMatrices.Reset();
+}
+
+/**
+ * @brief 위상 순서로 정렬되어 있으므로 앞에서부터 한 번 순회하면 부모의 월드 행렬이 항상 먼저 준비된다
+ */
+void FTransformBatch::ComputeWorldMatrices()
+{
+	ComputeLocalMatrices();
+
+	const int32 NumTransforms = Num();
+	WorldMatrices.SetNum(NumTransforms);
+
+	for (int32 Index = 0; Index < NumTransforms; ++Index)
+	{
+		const int32 ParentIndex = ParentIndices[Index];
+		if (ParentIndex >= 0)
+		{
+			MatrixMath::Multiply(WorldMatrices[Index], WorldMatrices[ParentIndex], LocalMatrices[Index]);
+		}
+		else if (ParentIndex == INDEX_NONE)
+		{
+			WorldMatrices[Index] = LocalMatrices[Index];
+		}
+		else
+		{
+			MatrixMath::Multiply(WorldMatrices[Index], ExternalParentMatrices[-2 - ParentIndex], LocalMatrices[Index]);
+		}
+	}
+}
+
+/**
+ * @brief SoA 입력으로부터 로컬 행렬(S * R * T)을 계산하는 함수
+ * SIMD가 가능하면 4개 항목을 레인 하나씩 맡아 계산한 뒤 전치해 저장하고, 나머지는 같은 식의 스칼라 루프로 처리한다
+ */
+void FTransformBatch::ComputeLocalMatrices()
+{
+	const int32 NumTransforms = Num();
+	LocalMatrices.SetNum(NumTransforms);
+
+	int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 LastRow = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+	for (; Index + 4 <= NumTransforms; Index += 4)
+	{
+		const __m128 QX = _mm_loadu_ps(&RotationX[Index]);
+		const __m128 QY = _mm_loadu_ps(&RotationY[Index]);
+		const __m128 QZ = _mm_loadu_ps(&RotationZ[Index]);
+		const __m128 QW = _mm_loadu_ps(&RotationW[Index]);
+
+		const __m128 X2 = _mm_add_ps(QX, QX);
+		const __m128 Y2 = _mm_add_ps(QY, QY);
+		const __m128 Z2 = _mm_add_ps(QZ, QZ);
+
+		const __m128 XX = _mm_mul_ps(QX, X2);
+		const __m128 YY = _mm_mul_ps(QY, Y2);
+		const __m128 ZZ = _mm_mul_ps(QZ, Z2);
+		const __m128 XY = _mm_mul_ps(QX, Y2);
+		const __m128 XZ = _mm_mul_ps(QX, Z2);
+		const __m128 YZ = _mm_mul_ps(QY, Z2);
+		const __m128 WX = _mm_mul_ps(QW, X2);
+		const __m128 WY = _mm_mul_ps(QW, Y2);
+		const __m128 WZ = _mm_mul_ps(QW, Z2);
+
+		const __m128 SX = _mm_loadu_ps(&ScaleX[Index]);
+		const __m128 SY = _mm_loadu_ps(&ScaleY[Index]);
+		const __m128 SZ = _mm_loadu_ps(&ScaleZ[Index]);
+
+		const __m128 TX = _mm_loadu_ps(&LocationX[Index]);
+		const __m128 TY = _mm_loadu_ps(&LocationY[Index]);
+		const __m128 TZ = _mm_loadu_ps(&LocationZ[Index]);
+
+		// 행마다 스케일을 곱한 회전 성분과 이동 열
+		__m128 M00 = _mm_mul_ps(SX, _mm_sub_ps(One, _mm_add_ps(YY, ZZ)));
+		__m128 M01 = _mm_mul_ps(SX, _mm_sub_ps(XY, WZ));
+		__m128 M02 = _mm_mul_ps(SX, _mm_add_ps(XZ, WY));
+		__m128 M03 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(M00, TX), _mm_mul_ps(M01, TY)), _mm_mul_ps(M02, TZ));
+
+		__m128 M10 = _mm_mul_ps(SY, _mm_add_ps(XY, WZ));
+		__m128 M11 = _mm_mul_ps(SY, _mm_sub_ps(One, _mm_add_ps(XX, ZZ)));
+		__m128 M12 = _mm_mul_ps(SY, _mm_sub_ps(YZ, WX));
+		__m128 M13 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(M10, TX), _mm_mul_ps(M11, TY)), _mm_mul_ps(M12, TZ));
+
+		__m128 M20 = _mm_mul_ps(SZ, _mm_sub_ps(XZ, WY));
+		__m128 M21 = _mm_mul_ps(SZ, _mm_add_ps(YZ, WX));
+		__m128 M22 = _mm_mul_ps(SZ, _mm_sub_ps(One, _mm_add_ps(XX, YY)));
+		__m128 M23 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(M20, TX), _mm_mul_ps(M21, TY)), _mm_mul_ps(M22, TZ));
+
+		// 성분별 레지스터를 항목별 행으로 전치
+		_MM_TRANSPOSE4_PS(M00, M01, M02, M03);
+		_MM_TRANSPOSE4_PS(M10, M11, M12, M13);
+		_MM_TRANSPOSE4_PS(M20, M21, M22, M23);
+
+		const __m128 Rows[3][4] = {{M00, M01, M02, M03}, {M10, M11, M12, M13}, {M20, M21, M22, M23}};
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			FMatrix& Local = LocalMatrices[Index + Lane];
+			_mm_storeu_ps(Local.Data[0], Rows[0][Lane]);
+			_mm_storeu_ps(Local.Data[1], Rows[1][Lane]);
+			_mm_storeu_ps(Local.Data[2], Rows[2][Lane]);
+			_mm_storeu_ps(Local.Data[3], LastRow);
+		}
+	}
+#endif
+
+	for (; Index < NumTransforms; ++Index)
+	{
+		const float X2 = RotationX[Index] + RotationX[Index];
+		const float Y2 = RotationY[Index] + RotationY[Index];
+		const float Z2 = RotationZ[Index] + RotationZ[Index];
+
+		const float XX = RotationX[Index] * X2;
+		const float YY = RotationY[Index] * Y2;
+		const float ZZ = RotationZ[Index] * Z2;
+		const float XY = RotationX[Index] * Y2;
+		const float XZ = RotationX[Index] * Z2;
+		const float YZ = RotationY[Index] * Z2;
+		const float WX = RotationW[Index] * X2;
+		const float WY = RotationW[Index] * Y2;
+		const float WZ = RotationW[Index] * Z2;
+
+		const float TX = LocationX[Index];
+		const float TY = LocationY[Index];
+		const float TZ = LocationZ[Index];
+
+		FMatrix& Local = LocalMatrices[Index];
+		Local.Data[0][0] = ScaleX[Index] * (1.0f - (YY + ZZ));
+		Local.Data[0][1] = ScaleX[Index] * (XY - WZ);
+		Local.Data[0][2] = ScaleX[Index] * (XZ + WY);
+		Local.Data[0][3] = Local.Data[0][0] * TX + Local.Data[0][1] * TY + Local.Data[0][2] * TZ;
+
+		Local.Data[1][0] = ScaleY[Index] * (XY + WZ);
+		Local.Data[1][1] = ScaleY[Index] * (1.0f - (XX + ZZ));
+		Local.Data[1][2] = ScaleY[Index] * (YZ - WX);
+		Local.Data[1][3] = Local.Data[1][0] * TX + Local.Data[1][1] * TY + Local.Data[1][2] * TZ;
+
+		Local.Data[2][0] = ScaleZ[Index] * (XZ - WY);
+		Local.Data[2][1] = ScaleZ[Index] * (YZ + WX);
+		Local.Data[2][2] = ScaleZ[Index] * (1.0f - (XX + YY));
+		Local.Data[2][3] = Local.Data[2][0] * TX + Local.Data[2][1] * TY + Local.Data[2][2] * TZ;
+
+		Local.Data[3][0] = 0.0f;
+		Local.Data[3][1] = 0.0f;
+		Local.Data[3][2] = 0.0f;
+		Local.Data[3][3] = 1.0f;
+	}
+}
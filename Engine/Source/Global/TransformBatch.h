@@ -0,0 +1,81 @@
+#pragma once
+
+/**
+ * @brief 여러 변환의 월드 행렬을 한 번에 계산하기 위한 SoA(Structure of Arrays) 배치
+ * 성분별로 연속된 배열에 저장하므로 로컬 행렬 계산을 4개씩 SIMD 레인에 나눠 처리할 수 있다
+ *
+ * 회전은 FQuatTransform과 같은 쿼터니언이며, 로컬 행렬은 FQuatTransform::ToMatrix와 같은 규약(S * R * T)이다
+ * 부모는 항상 자식보다 앞에 추가되어야 하며(위상 순서), 배치 밖의 부모는 월드 행렬을 직접 넘겨 받는다
+ *
+ * 사용 예시)
+ *	Batch.Reset();
+ *	const int32 ParentIndex = Batch.Add(ParentTransform);
+ *	Batch.Add(ChildTransform, ParentIndex);
+ *	Batch.ComputeWorldMatrices();
+ *	Batch.GetWorldMatrix(ParentIndex);
+ */
+class FTransformBatch
+{
+public:
+	static constexpr int32 INDEX_NONE = -1;
+
+	/**
+	 * @brief 변환을 추가하는 함수
+	 * @param InTransform 부모 기준 상대 변환
+	 * @param InParentIndex 배치 내부 부모 인덱스 (이 항목보다 앞이어야 함, 없으면 INDEX_NONE)
+	 * @param InExternalParentMatrix 배치 밖 부모의 월드 행렬 (InParentIndex가 INDEX_NONE일 때만 사용, 없으면 nullptr)
+	 * @return 추가된 항목의 인덱스
+	 */
+	int32 Add(const FQuatTransform& InTransform, int32 InParentIndex = INDEX_NONE,
+	          const FMatrix* InExternalParentMatrix = nullptr);
+
+	void Reserve(int32 InNumTransforms);
+
+	/**
+	 * @brief 항목을 비우는 함수 (매 프레임 재사용할 수 있도록 메모리는 유지)
+	 */
+	void Reset();
+
+	int32 Num() const { return ParentIndices.Num(); }
+
+	/**
+	 * @brief 모든 항목의 로컬 행렬을 계산한 뒤 위상 순서대로 부모 행렬을 곱해 월드 행렬을 계산하는 함수
+	 */
+	void ComputeWorldMatrices();
+
+	/**
+	 * @brief 로컬 행렬만 계산하는 함수 (부모 정보는 무시하며, 부모 곱은 호출자가 직접 수행)
+	 */
+	void ComputeLocalMatrices();
+
+	const FMatrix& GetLocalMatrix(int32 InIndex) const { return LocalMatrices[InIndex]; }
+	const FMatrix& GetWorldMatrix(int32 InIndex) const { return WorldMatrices[InIndex]; }
+	const TArray<FMatrix>& GetWorldMatrices() const { return WorldMatrices; }
+
+private:
+	// Location
+	TArray<float> LocationX;
+	TArray<float> LocationY;
+	TArray<float> LocationZ;
+
+	// Rotation (Quaternion)
+	TArray<float> RotationX;
+	TArray<float> RotationY;
+	TArray<float> RotationZ;
+	TArray<float> RotationW;
+
+	// Scale
+	TArray<float> ScaleX;
+	TArray<float> ScaleY;
+	TArray<float> ScaleZ;
+
+	/**
+	 * @brief 0 이상이면 배치 내부 부모, INDEX_NONE이면 부모 없음,
+	 * 그 아래 값은 ExternalParentMatrices[-2 - 값]을 부모로 사용
+	 */
+	TArray<int32> ParentIndices;
+	TArray<FMatrix> ExternalParentMatrices;
+
+	TArray<FMatrix> LocalMatrices;
+	TArray<FMatrix> WorldMatrices;
+};
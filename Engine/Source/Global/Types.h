@@ -27,6 +27,24 @@ using int32 = std::int32_t;
 using uint64 = std::uint64_t;
 using int64 = std::int64_t;
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief 0이 아닌 64비트 값에서 가장 낮은 1 비트의 위치를 반환하는 함수
+ */
+inline uint32 CountTrailingZeros64(uint64 InValue)
+{
+#if defined(_MSC_VER)
+    unsigned long BitIndex;
+    _BitScanForward64(&BitIndex, InValue);
+    return static_cast<uint32>(BitIndex);
+#else
+    return static_cast<uint32>(__builtin_ctzll(InValue));
+#endif
+}
+
 // Extension
 #include "FString.h"
 
@@ -5,3 +5,55 @@ bool FAABB::RaycastHit() const
 {
 	return false;
 }
+
+FAABB FAABB::TransformBy(const FMatrix& InMatrix) const
+{
+	const FVector Center = GetCenter();
+	const FVector Extent = GetExtent();
+
+	float WorldCenter[3];
+	float WorldExtent[3];
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		const float* M = InMatrix.Data[Row];
+		WorldCenter[Row] = M[0] * Center.X + M[1] * Center.Y + M[2] * Center.Z + M[3];
+		WorldExtent[Row] = std::abs(M[0]) * Extent.X + std::abs(M[1]) * Extent.Y + std::abs(M[2]) * Extent.Z;
+	}
+
+	return FAABB(FVector(WorldCenter[0] - WorldExtent[0], WorldCenter[1] - WorldExtent[1], WorldCenter[2] - WorldExtent[2]),
+	             FVector(WorldCenter[0] + WorldExtent[0], WorldCenter[1] + WorldExtent[1], WorldCenter[2] + WorldExtent[2]));
+}
+
+/**
+ * 상자는 볼록하므로 변환된 중심에서 가장 먼 점은 꼭짓점 중 하나이고,
+ * 중심 대칭인 꼭짓점 쌍은 거리가 같으므로 반 크기 벡터의 부호 조합 4개만 변환하면 된다
+ * (부모 체인의 비균등 스케일로 전단이 생겨도 정확하다)
+ */
+FBoundingSphere FAABB::TransformSphereBy(const FMatrix& InMatrix) const
+{
+	const FVector Center = GetCenter();
+	const FVector Extent = GetExtent();
+
+	float MaxDistanceSquared = 0.0f;
+	for (int32 Corner = 0; Corner < 4; ++Corner)
+	{
+		const float EX = Extent.X;
+		const float EY = Corner & 1 ? -Extent.Y : Extent.Y;
+		const float EZ = Corner & 2 ? -Extent.Z : Extent.Z;
+
+		float DistanceSquared = 0.0f;
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			const float Offset = InMatrix.Data[Row][0] * EX + InMatrix.Data[Row][1] * EY + InMatrix.Data[Row][2] * EZ;
+			DistanceSquared += Offset * Offset;
+		}
+		MaxDistanceSquared = max(MaxDistanceSquared, DistanceSquared);
+	}
+
+	const FVector WorldCenter(
+		InMatrix.Data[0][0] * Center.X + InMatrix.Data[0][1] * Center.Y + InMatrix.Data[0][2] * Center.Z + InMatrix.Data[0][3],
+		InMatrix.Data[1][0] * Center.X + InMatrix.Data[1][1] * Center.Y + InMatrix.Data[1][2] * Center.Z + InMatrix.Data[1][3],
+		InMatrix.Data[2][0] * Center.X + InMatrix.Data[2][1] * Center.Y + InMatrix.Data[2][2] * Center.Z + InMatrix.Data[2][3]);
+
+	return FBoundingSphere(WorldCenter, sqrtf(MaxDistanceSquared));
+}
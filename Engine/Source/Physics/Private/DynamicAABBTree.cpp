@@ -0,0 +1,432 @@
+#include "pch.h"
+#include "Physics/Public/DynamicAABBTree.h"
+
+namespace
+{
+	/**
+	 * @brief Fat AABB 여유분 (반 크기에 대한 비율과 최소값)
+	 */
+	constexpr float FatMarginRatio = 0.1f;
+	constexpr float MinFatMargin = 0.05f;
+
+	/**
+	 * @brief 표면적 대신 쓰는 둘레 (상수배 차이라 비용 비교 결과가 같음)
+	 */
+	float GetPerimeter(const FVector& InMin, const FVector& InMax)
+	{
+		const FVector Size = InMax - InMin;
+		return Size.X + Size.Y + Size.Z;
+	}
+
+	void Combine(const FVector& InMinA, const FVector& InMaxA, const FVector& InMinB, const FVector& InMaxB,
+	             FVector& OutMin, FVector& OutMax)
+	{
+		OutMin = FVector(min(InMinA.X, InMinB.X), min(InMinA.Y, InMinB.Y), min(InMinA.Z, InMinB.Z));
+		OutMax = FVector(max(InMaxA.X, InMaxB.X), max(InMaxA.Y, InMaxB.Y), max(InMaxA.Z, InMaxB.Z));
+	}
+
+	bool Contains(const FVector& InOuterMin, const FVector& InOuterMax, const FVector& InMin, const FVector& InMax)
+	{
+		return InOuterMin.X <= InMin.X && InOuterMin.Y <= InMin.Y && InOuterMin.Z <= InMin.Z &&
+			InMax.X <= InOuterMax.X && InMax.Y <= InOuterMax.Y && InMax.Z <= InOuterMax.Z;
+	}
+}
+
+int32 FDynamicAABBTree::CreateProxy(const FAABB& InBounds, void* InUserData)
+{
+	const int32 ProxyId = AllocateNode();
+	FNode& Node = Nodes[ProxyId];
+
+	const FVector Extent = InBounds.GetExtent();
+	const FVector Margin(max(Extent.X * FatMarginRatio, MinFatMargin), max(Extent.Y * FatMarginRatio, MinFatMargin),
+	                     max(Extent.Z * FatMarginRatio, MinFatMargin));
+	Node.Min = InBounds.Min - Margin;
+	Node.Max = InBounds.Max + Margin;
+	Node.UserData = InUserData;
+	Node.Height = 0;
+
+	InsertLeaf(ProxyId);
+	++NumProxies;
+
+	return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 InProxyId)
+{
+	assert(InProxyId >= 0 && InProxyId < Nodes.Num() && Nodes[InProxyId].IsLeaf());
+
+	RemoveLeaf(InProxyId);
+	FreeNode(InProxyId);
+	--NumProxies;
+}
+
+/**
+ * @brief 새 범위가 아직 Fat AABB 안이면 아무것도 하지 않는다
+ * 벗어났으면 리프를 떼어 새 Fat AABB로 다시 삽입한다
+ */
+bool FDynamicAABBTree::MoveProxy(int32 InProxyId, const FAABB& InBounds)
+{
+	assert(InProxyId >= 0 && InProxyId < Nodes.Num() && Nodes[InProxyId].IsLeaf());
+
+	FNode& Node = Nodes[InProxyId];
+	if (Contains(Node.Min, Node.Max, InBounds.Min, InBounds.Max))
+	{
+		return false;
+	}
+
+	RemoveLeaf(InProxyId);
+
+	const FVector Extent = InBounds.GetExtent();
+	const FVector Margin(max(Extent.X * FatMarginRatio, MinFatMargin), max(Extent.Y * FatMarginRatio, MinFatMargin),
+	                     max(Extent.Z * FatMarginRatio, MinFatMargin));
+	Node.Min = InBounds.Min - Margin;
+	Node.Max = InBounds.Max + Margin;
+
+	InsertLeaf(InProxyId);
+	return true;
+}
+
+void FDynamicAABBTree::Reset()
+{
+	Nodes.Reset();
+	Root = NullNode;
+	FreeList = NullNode;
+	NumProxies = 0;
+}
+
+bool FDynamicAABBTree::IntersectsRay(const FVector& InOrigin, const FVector& InInvDirection, float InMaxDistance,
+                                     const FVector& InMin, const FVector& InMax, float& OutEntryDistance)
+{
+	float Near = 0.0f;
+	float Far = InMaxDistance;
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Origin = (&InOrigin.X)[Axis];
+		const float InvDirection = (&InInvDirection.X)[Axis];
+		float T0 = ((&InMin.X)[Axis] - Origin) * InvDirection;
+		float T1 = ((&InMax.X)[Axis] - Origin) * InvDirection;
+		if (T0 > T1)
+		{
+			std::swap(T0, T1);
+		}
+
+		Near = max(Near, T0);
+		Far = min(Far, T1);
+		if (Near > Far)
+		{
+			return false;
+		}
+	}
+
+	OutEntryDistance = Near;
+	return true;
+}
+
+bool FDynamicAABBTree::Validate() const
+{
+	if (Root == NullNode)
+	{
+		return NumProxies == 0;
+	}
+
+	if (Nodes[Root].Parent != NullNode)
+	{
+		return false;
+	}
+
+	// 해제 목록과 사용 중인 노드 수의 합이 전체 노드 수와 같아야 함
+	int32 NumFreeNodes = 0;
+	for (int32 NodeIndex = FreeList; NodeIndex != NullNode; NodeIndex = Nodes[NodeIndex].Parent)
+	{
+		if (Nodes[NodeIndex].Height != -1 || ++NumFreeNodes > Nodes.Num())
+		{
+			return false;
+		}
+	}
+
+	const int32 NumUsedNodes = ValidateNode(Root);
+	return NumUsedNodes >= 0 && NumUsedNodes + NumFreeNodes == Nodes.Num() && NumUsedNodes == 2 * NumProxies - 1;
+}
+
+/**
+ * @return 하위 노드 수, 규칙을 어기면 -1
+ */
+int32 FDynamicAABBTree::ValidateNode(int32 InNodeIndex) const
+{
+	const FNode& Node = Nodes[InNodeIndex];
+	if (Node.IsLeaf())
+	{
+		return Node.Child2 == NullNode && Node.Height == 0 ? 1 : -1;
+	}
+
+	const FNode& Child1 = Nodes[Node.Child1];
+	const FNode& Child2 = Nodes[Node.Child2];
+	if (Child1.Parent != InNodeIndex || Child2.Parent != InNodeIndex)
+	{
+		return -1;
+	}
+
+	if (Node.Height != 1 + max(Child1.Height, Child2.Height))
+	{
+		return -1;
+	}
+
+	if (!Contains(Node.Min, Node.Max, Child1.Min, Child1.Max) || !Contains(Node.Min, Node.Max, Child2.Min, Child2.Max))
+	{
+		return -1;
+	}
+
+	const int32 NumChild1Nodes = ValidateNode(Node.Child1);
+	const int32 NumChild2Nodes = ValidateNode(Node.Child2);
+	if (NumChild1Nodes < 0 || NumChild2Nodes < 0)
+	{
+		return -1;
+	}
+
+	return 1 + NumChild1Nodes + NumChild2Nodes;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+	if (FreeList == NullNode)
+	{
+		Nodes.Add(FNode());
+		return Nodes.Num() - 1;
+	}
+
+	const int32 NodeIndex = FreeList;
+	FreeList = Nodes[NodeIndex].Parent;
+	Nodes[NodeIndex] = FNode();
+	return NodeIndex;
+}
+
+void FDynamicAABBTree::FreeNode(int32 InNodeIndex)
+{
+	FNode& Node = Nodes[InNodeIndex];
+	Node.UserData = nullptr;
+	Node.Child1 = NullNode;
+	Node.Child2 = NullNode;
+	Node.Height = -1;
+	Node.Parent = FreeList;
+	FreeList = InNodeIndex;
+}
+
+/**
+ * @brief 형제 후보를 고를 때 (새 부모를 만드는 비용 + 조상들의 둘레 증가량)이 가장 작은 쪽으로 내려간다 (Branch and Bound 근사)
+ */
+void FDynamicAABBTree::InsertLeaf(int32 InLeaf)
+{
+	if (Root == NullNode)
+	{
+		Root = InLeaf;
+		Nodes[Root].Parent = NullNode;
+		return;
+	}
+
+	const FVector LeafMin = Nodes[InLeaf].Min;
+	const FVector LeafMax = Nodes[InLeaf].Max;
+
+	int32 Sibling = Root;
+	while (!Nodes[Sibling].IsLeaf())
+	{
+		const FNode& Node = Nodes[Sibling];
+
+		FVector CombinedMin, CombinedMax;
+		Combine(Node.Min, Node.Max, LeafMin, LeafMax, CombinedMin, CombinedMax);
+		const float Perimeter = GetPerimeter(Node.Min, Node.Max);
+		const float CombinedPerimeter = GetPerimeter(CombinedMin, CombinedMax);
+
+		// 이 노드를 형제로 삼아 새 부모를 만드는 비용
+		const float Cost = 2.0f * CombinedPerimeter;
+
+		// 더 내려갈 때 조상이 떠안는 최소 비용
+		const float InheritanceCost = 2.0f * (CombinedPerimeter - Perimeter);
+
+		float ChildCosts[2];
+		const int32 Children[2] = {Node.Child1, Node.Child2};
+		for (int32 ChildIndex = 0; ChildIndex < 2; ++ChildIndex)
+		{
+			const FNode& Child = Nodes[Children[ChildIndex]];
+			FVector ChildMin, ChildMax;
+			Combine(Child.Min, Child.Max, LeafMin, LeafMax, ChildMin, ChildMax);
+
+			const float NewPerimeter = GetPerimeter(ChildMin, ChildMax);
+			ChildCosts[ChildIndex] = Child.IsLeaf()
+				                         ? NewPerimeter + InheritanceCost
+				                         : NewPerimeter - GetPerimeter(Child.Min, Child.Max) + InheritanceCost;
+		}
+
+		if (Cost < ChildCosts[0] && Cost < ChildCosts[1])
+		{
+			break;
+		}
+
+		Sibling = ChildCosts[0] < ChildCosts[1] ? Children[0] : Children[1];
+	}
+
+	const int32 OldParent = Nodes[Sibling].Parent;
+	const int32 NewParent = AllocateNode();
+	{
+		FNode& Parent = Nodes[NewParent];
+		Parent.Parent = OldParent;
+		Combine(LeafMin, LeafMax, Nodes[Sibling].Min, Nodes[Sibling].Max, Parent.Min, Parent.Max);
+		Parent.Height = Nodes[Sibling].Height + 1;
+		Parent.Child1 = Sibling;
+		Parent.Child2 = InLeaf;
+	}
+
+	if (OldParent != NullNode)
+	{
+		if (Nodes[OldParent].Child1 == Sibling)
+		{
+			Nodes[OldParent].Child1 = NewParent;
+		}
+		else
+		{
+			Nodes[OldParent].Child2 = NewParent;
+		}
+	}
+	else
+	{
+		Root = NewParent;
+	}
+
+	Nodes[Sibling].Parent = NewParent;
+	Nodes[InLeaf].Parent = NewParent;
+
+	RefitAncestors(Nodes[InLeaf].Parent);
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 InLeaf)
+{
+	if (InLeaf == Root)
+	{
+		Root = NullNode;
+		return;
+	}
+
+	const int32 Parent = Nodes[InLeaf].Parent;
+	const int32 GrandParent = Nodes[Parent].Parent;
+	const int32 Sibling = Nodes[Parent].Child1 == InLeaf ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+	// 부모 자리를 형제가 대신함
+	if (GrandParent != NullNode)
+	{
+		if (Nodes[GrandParent].Child1 == Parent)
+		{
+			Nodes[GrandParent].Child1 = Sibling;
+		}
+		else
+		{
+			Nodes[GrandParent].Child2 = Sibling;
+		}
+		Nodes[Sibling].Parent = GrandParent;
+		FreeNode(Parent);
+
+		RefitAncestors(GrandParent);
+	}
+	else
+	{
+		Root = Sibling;
+		Nodes[Sibling].Parent = NullNode;
+		FreeNode(Parent);
+	}
+
+	Nodes[InLeaf].Parent = NullNode;
+}
+
+/**
+ * @brief 루트까지 올라가며 균형을 맞추고 높이와 범위를 다시 계산하는 함수
+ */
+void FDynamicAABBTree::RefitAncestors(int32 InNodeIndex)
+{
+	int32 NodeIndex = InNodeIndex;
+	while (NodeIndex != NullNode)
+	{
+		NodeIndex = Balance(NodeIndex);
+
+		FNode& Node = Nodes[NodeIndex];
+		const FNode& Child1 = Nodes[Node.Child1];
+		const FNode& Child2 = Nodes[Node.Child2];
+		Node.Height = 1 + max(Child1.Height, Child2.Height);
+		Combine(Child1.Min, Child1.Max, Child2.Min, Child2.Max, Node.Min, Node.Max);
+
+		NodeIndex = Node.Parent;
+	}
+}
+
+/**
+ * @brief 한쪽 자식이 2 이상 높으면 높은 쪽 자식을 위로 올리는 회전을 수행하는 함수 (AVL 방식)
+ * @return 회전 후 이 자리를 차지한 노드
+ */
+int32 FDynamicAABBTree::Balance(int32 InNodeIndex)
+{
+	const int32 A = InNodeIndex;
+	FNode& NodeA = Nodes[A];
+	if (NodeA.IsLeaf() || NodeA.Height < 2)
+	{
+		return A;
+	}
+
+	const int32 B = NodeA.Child1;
+	const int32 C = NodeA.Child2;
+	const int32 Difference = Nodes[C].Height - Nodes[B].Height;
+	if (Difference >= -1 && Difference <= 1)
+	{
+		return A;
+	}
+
+	// 높은 쪽 자식 Up을 A 자리로 올리고, Up의 자식 중 낮은 쪽을 A에게 넘김
+	const int32 Up = Difference > 1 ? C : B;
+	const int32 Down = Difference > 1 ? B : C;
+
+	FNode& NodeUp = Nodes[Up];
+	const int32 F = NodeUp.Child1;
+	const int32 G = NodeUp.Child2;
+
+	NodeUp.Child1 = A;
+	NodeUp.Parent = NodeA.Parent;
+	NodeA.Parent = Up;
+
+	if (NodeUp.Parent != NullNode)
+	{
+		if (Nodes[NodeUp.Parent].Child1 == A)
+		{
+			Nodes[NodeUp.Parent].Child1 = Up;
+		}
+		else
+		{
+			Nodes[NodeUp.Parent].Child2 = Up;
+		}
+	}
+	else
+	{
+		Root = Up;
+	}
+
+	const int32 Keep = Nodes[F].Height > Nodes[G].Height ? F : G;
+	const int32 Give = Keep == F ? G : F;
+
+	NodeUp.Child2 = Keep;
+	if (Difference > 1)
+	{
+		NodeA.Child2 = Give;
+	}
+	else
+	{
+		NodeA.Child1 = Give;
+	}
+	Nodes[Give].Parent = A;
+
+	const FNode& DownNode = Nodes[Down];
+	const FNode& GiveNode = Nodes[Give];
+	Combine(DownNode.Min, DownNode.Max, GiveNode.Min, GiveNode.Max, NodeA.Min, NodeA.Max);
+	NodeA.Height = 1 + max(DownNode.Height, GiveNode.Height);
+
+	const FNode& KeepNode = Nodes[Keep];
+	Combine(NodeA.Min, NodeA.Max, KeepNode.Min, KeepNode.Max, NodeUp.Min, NodeUp.Max);
+	NodeUp.Height = 1 + max(NodeA.Height, KeepNode.Height);
+
+	return Up;
+}
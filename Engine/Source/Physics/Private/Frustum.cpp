@@ -0,0 +1,211 @@
+#include "pch.h"
+#include "Physics/Public/Frustum.h"
+#include "Global/MatrixMath.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief 클립 좌표 조건(-W <= X, Y <= W, 0 <= Z <= W)을 행렬의 행 조합으로 옮겨 평면을 구한다 (Gribb-Hartmann)
+ * 반 크기와의 판정이 거리 단위가 되도록 법선 길이로 정규화한다
+ */
+FFrustum::FFrustum(const FMatrix& InViewProjection)
+{
+	const float* Row0 = InViewProjection.Data[0];
+	const float* Row1 = InViewProjection.Data[1];
+	const float* Row2 = InViewProjection.Data[2];
+	const float* Row3 = InViewProjection.Data[3];
+
+	for (int32 Axis = 0; Axis < 4; ++Axis)
+	{
+		(&Planes[Left].X)[Axis] = Row3[Axis] + Row0[Axis];
+		(&Planes[Right].X)[Axis] = Row3[Axis] - Row0[Axis];
+		(&Planes[Bottom].X)[Axis] = Row3[Axis] + Row1[Axis];
+		(&Planes[Top].X)[Axis] = Row3[Axis] - Row1[Axis];
+		(&Planes[Near].X)[Axis] = Row2[Axis];
+		(&Planes[Far].X)[Axis] = Row3[Axis] - Row2[Axis];
+	}
+
+	for (FVector4& Plane : Planes)
+	{
+		const float Length = std::sqrt(Plane.X * Plane.X + Plane.Y * Plane.Y + Plane.Z * Plane.Z);
+		if (Length > 0.0f)
+		{
+			const float InvLength = 1.0f / Length;
+			Plane = FVector4(Plane.X * InvLength, Plane.Y * InvLength, Plane.Z * InvLength, Plane.W * InvLength);
+		}
+	}
+}
+
+bool FFrustum::IntersectsPoint(const FVector& InPoint) const
+{
+	for (const FVector4& Plane : Planes)
+	{
+		if (Plane.X * InPoint.X + Plane.Y * InPoint.Y + Plane.Z * InPoint.Z + Plane.W < 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief 평면 하나라도 AABB 전체가 바깥쪽에 있으면 보이지 않는 것으로 판정하는 함수
+ * 모서리 근처에서는 실제로 겹치지 않아도 true가 될 수 있는 보수적 판정이다
+ * FCullingBoundsBatch::Cull과 결과가 같도록 덧셈 순서를 맞춘다
+ */
+bool FFrustum::IntersectsAABB(const FAABB& InBox) const
+{
+	const FVector Center = InBox.GetCenter();
+	const FVector Extent = InBox.GetExtent();
+
+	for (const FVector4& Plane : Planes)
+	{
+		const float Distance = (Plane.X * Center.X + Plane.Y * Center.Y) + (Plane.Z * Center.Z + Plane.W);
+		const float Radius = std::abs(Plane.X) * Extent.X + std::abs(Plane.Y) * Extent.Y + std::abs(Plane.Z) * Extent.Z;
+		if (Distance + Radius < 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FFrustum::IntersectsSphere(const FBoundingSphere& InSphere) const
+{
+	for (const FVector4& Plane : Planes)
+	{
+		const float Distance = Plane.X * InSphere.Center.X + Plane.Y * InSphere.Center.Y + Plane.Z * InSphere.Center.Z +
+			Plane.W;
+		if (Distance + InSphere.Radius < 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int32 FCullingBoundsBatch::Add(const FAABB& InBox)
+{
+	const FVector Center = InBox.GetCenter();
+	const FVector Extent = InBox.GetExtent();
+
+	CenterX.Add(Center.X);
+	CenterY.Add(Center.Y);
+	CenterZ.Add(Center.Z);
+
+	ExtentX.Add(Extent.X);
+	ExtentY.Add(Extent.Y);
+	ExtentZ.Add(Extent.Z);
+
+	return CenterX.Num() - 1;
+}
+
+void FCullingBoundsBatch::Reserve(int32 InNumBounds)
+{
+	for (TArray<float>* Component : {&CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ})
+	{
+		Component->Reserve(InNumBounds);
+	}
+}
+
+void FCullingBoundsBatch::Reset()
+{
+	for (TArray<float>* Component : {&CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ})
+	{
+		Component->Reset();
+	}
+}
+
+/**
+ * @brief SIMD가 가능하면 AABB 4개를 레인 하나씩 맡아 6개 평면과 판정하고, 나머지는 같은 식의 스칼라 루프로 처리한다
+ */
+int32 FCullingBoundsBatch::Cull(const FFrustum& InFrustum, TArray<uint8>& OutVisibility) const
+{
+	const int32 NumBounds = Num();
+	OutVisibility.SetNum(NumBounds);
+
+	int32 NumVisible = 0;
+	int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	__m128 PlaneX[FFrustum::Num];
+	__m128 PlaneY[FFrustum::Num];
+	__m128 PlaneZ[FFrustum::Num];
+	__m128 PlaneW[FFrustum::Num];
+	__m128 AbsPlaneX[FFrustum::Num];
+	__m128 AbsPlaneY[FFrustum::Num];
+	__m128 AbsPlaneZ[FFrustum::Num];
+
+	const __m128 SignMask = _mm_set1_ps(-0.0f);
+	for (int32 PlaneIndex = 0; PlaneIndex < FFrustum::Num; ++PlaneIndex)
+	{
+		const FVector4& Plane = InFrustum.Planes[PlaneIndex];
+		PlaneX[PlaneIndex] = _mm_set1_ps(Plane.X);
+		PlaneY[PlaneIndex] = _mm_set1_ps(Plane.Y);
+		PlaneZ[PlaneIndex] = _mm_set1_ps(Plane.Z);
+		PlaneW[PlaneIndex] = _mm_set1_ps(Plane.W);
+		AbsPlaneX[PlaneIndex] = _mm_andnot_ps(SignMask, PlaneX[PlaneIndex]);
+		AbsPlaneY[PlaneIndex] = _mm_andnot_ps(SignMask, PlaneY[PlaneIndex]);
+		AbsPlaneZ[PlaneIndex] = _mm_andnot_ps(SignMask, PlaneZ[PlaneIndex]);
+	}
+
+	const __m128 Zero = _mm_setzero_ps();
+	for (; Index + 4 <= NumBounds; Index += 4)
+	{
+		const __m128 CX = _mm_loadu_ps(&CenterX[Index]);
+		const __m128 CY = _mm_loadu_ps(&CenterY[Index]);
+		const __m128 CZ = _mm_loadu_ps(&CenterZ[Index]);
+		const __m128 EX = _mm_loadu_ps(&ExtentX[Index]);
+		const __m128 EY = _mm_loadu_ps(&ExtentY[Index]);
+		const __m128 EZ = _mm_loadu_ps(&ExtentZ[Index]);
+
+		// 레인별로 한 평면이라도 완전히 바깥이면 비트가 켜짐
+		__m128 Outside = Zero;
+		for (int32 PlaneIndex = 0; PlaneIndex < FFrustum::Num; ++PlaneIndex)
+		{
+			const __m128 Distance = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(PlaneX[PlaneIndex], CX), _mm_mul_ps(PlaneY[PlaneIndex], CY)),
+				_mm_add_ps(_mm_mul_ps(PlaneZ[PlaneIndex], CZ), PlaneW[PlaneIndex]));
+			const __m128 Radius = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(AbsPlaneX[PlaneIndex], EX), _mm_mul_ps(AbsPlaneY[PlaneIndex], EY)),
+				_mm_mul_ps(AbsPlaneZ[PlaneIndex], EZ));
+			Outside = _mm_or_ps(Outside, _mm_cmplt_ps(_mm_add_ps(Distance, Radius), Zero));
+		}
+
+		const int32 OutsideMask = _mm_movemask_ps(Outside);
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			const uint8 bVisible = ((OutsideMask >> Lane) & 1) == 0;
+			OutVisibility[Index + Lane] = bVisible;
+			NumVisible += bVisible;
+		}
+	}
+#endif
+
+	for (; Index < NumBounds; ++Index)
+	{
+		uint8 bVisible = 1;
+		for (const FVector4& Plane : InFrustum.Planes)
+		{
+			const float Distance = (Plane.X * CenterX[Index] + Plane.Y * CenterY[Index]) +
+				(Plane.Z * CenterZ[Index] + Plane.W);
+			const float Radius = std::abs(Plane.X) * ExtentX[Index] + std::abs(Plane.Y) * ExtentY[Index] +
+				std::abs(Plane.Z) * ExtentZ[Index];
+			if (Distance + Radius < 0.0f)
+			{
+				bVisible = 0;
+				break;
+			}
+		}
+
+		OutVisibility[Index] = bVisible;
+		NumVisible += bVisible;
+	}
+
+	return NumVisible;
+}
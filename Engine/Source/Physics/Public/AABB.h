@@ -1,5 +1,6 @@
 #pragma once
 #include "Physics/Public/BoundingVolume.h"
+#include "Physics/Public/BoundingSphere.h"
 #include "Global/Vector.h"
 
 struct FAABB : public IBoundingVolume
@@ -12,4 +13,19 @@ struct FAABB : public IBoundingVolume
 
 	bool RaycastHit() const override;
 	EBoundingVolumeType GetType() const override { return EBoundingVolumeType::AABB; }
+
+	FVector GetCenter() const { return (Min + Max) * 0.5f; }
+	FVector GetExtent() const { return (Max - Min) * 0.5f; }
+
+	/**
+	 * @brief 모델 행렬(열 벡터 기준 아핀 행렬)로 변환한 AABB를 구하는 함수
+	 * 8개 꼭짓점을 변환해 감싸는 AABB와 같은 결과를, 중심과 반 크기에 행렬 성분의 절댓값을 곱해 한 번에 계산한다
+	 */
+	FAABB TransformBy(const FMatrix& InMatrix) const;
+
+	/**
+	 * @brief 모델 행렬로 변환한 AABB를 감싸는 경계 구를 구하는 함수
+	 * 중심은 변환된 AABB 중심, 반지름은 변환된 꼭짓점까지의 최대 거리이다
+	 */
+	FBoundingSphere TransformSphereBy(const FMatrix& InMatrix) const;
 };
@@ -0,0 +1,207 @@
+#pragma once
+#include "Physics/Public/Frustum.h"
+
+/**
+ * @brief 움직이는 객체를 위한 동적 AABB 트리 (Bounding Volume Hierarchy)
+ * 리프마다 실제 범위보다 조금 큰 Fat AABB를 보관해, 작은 이동은 트리를 건드리지 않고 넘긴다
+ * 삽입은 표면적(둘레) 증가량이 가장 작은 형제를 찾고, 삽입 / 제거 경로의 노드는 회전으로 좌우 높이 차이를 줄인다
+ *
+ * 질의 결과는 Fat AABB 기준이므로 정확한 판정이 필요하면 콜백에서 실제 범위로 다시 확인해야 한다
+ *
+ * 사용 예시)
+ *	const int32 ProxyId = Tree.CreateProxy(Bounds, Primitive);
+ *	Tree.MoveProxy(ProxyId, NewBounds);
+ *	Tree.QueryFrustum(Frustum, [&](int32 InProxyId) { Out.Add(Tree.GetUserData(InProxyId)); return true; });
+ *	Tree.DestroyProxy(ProxyId);
+ */
+class FDynamicAABBTree
+{
+public:
+	static constexpr int32 NullNode = -1;
+
+	/**
+	 * @brief 리프를 추가하는 함수
+	 * @return 프록시 ID (제거 전까지 유지)
+	 */
+	int32 CreateProxy(const FAABB& InBounds, void* InUserData);
+	void DestroyProxy(int32 InProxyId);
+
+	/**
+	 * @brief 리프의 범위를 갱신하는 함수
+	 * @return 새 범위가 Fat AABB를 벗어나 트리에 다시 삽입했으면 true
+	 */
+	bool MoveProxy(int32 InProxyId, const FAABB& InBounds);
+
+	/**
+	 * @brief 모든 노드를 비우는 함수 (메모리는 유지)
+	 */
+	void Reset();
+
+	void* GetUserData(int32 InProxyId) const { return Nodes[InProxyId].UserData; }
+	FAABB GetFatBounds(int32 InProxyId) const { return FAABB(Nodes[InProxyId].Min, Nodes[InProxyId].Max); }
+
+	int32 GetNumProxies() const { return NumProxies; }
+	int32 GetHeight() const { return Root == NullNode ? 0 : Nodes[Root].Height; }
+
+	/**
+	 * @brief 부모 / 자식 연결, 높이, 범위 포함 관계와 노드 수를 검사하는 함수 (벤치마크 검증용)
+	 */
+	bool Validate() const;
+
+	/**
+	 * @brief 범위 판정을 통과한 노드만 내려가며 리프마다 콜백을 호출하는 함수
+	 * @param InOverlapTest bool(const FVector& Min, const FVector& Max)
+	 * @param InCallback bool(int32 ProxyId), false를 반환하면 질의 중단
+	 */
+	template <typename TestType, typename FuncType>
+	void Query(TestType InOverlapTest, FuncType InCallback) const;
+
+	template <typename FuncType>
+	void QueryAABB(const FAABB& InBounds, FuncType InCallback) const;
+
+	template <typename FuncType>
+	void QuerySphere(const FBoundingSphere& InSphere, FuncType InCallback) const;
+
+	template <typename FuncType>
+	void QueryFrustum(const FFrustum& InFrustum, FuncType InCallback) const;
+
+	/**
+	 * @brief 광선과 겹치는 리프마다 콜백을 호출하는 함수
+	 * @param InDirection 정규화된 방향
+	 * @param InMaxDistance 광선 길이
+	 * @param InCallback bool(int32 ProxyId, float EntryDistance), false를 반환하면 질의 중단
+	 */
+	template <typename FuncType>
+	void RayCast(const FVector& InOrigin, const FVector& InDirection, float InMaxDistance, FuncType InCallback) const;
+
+	/**
+	 * @brief 광선과 AABB의 교차 구간 시작 거리를 구하는 함수 (Slab 방식)
+	 * @param InInvDirection 방향의 역수 (성분이 0이면 매우 큰 값)
+	 */
+	static bool IntersectsRay(const FVector& InOrigin, const FVector& InInvDirection, float InMaxDistance,
+	                          const FVector& InMin, const FVector& InMax, float& OutEntryDistance);
+
+private:
+	struct FNode
+	{
+		FVector Min;
+		FVector Max;
+		void* UserData = nullptr;
+
+		// 사용 중이면 부모, 해제된 노드면 다음 빈 노드
+		int32 Parent = NullNode;
+		int32 Child1 = NullNode;
+		int32 Child2 = NullNode;
+
+		// 리프는 0, 해제된 노드는 -1
+		int32 Height = -1;
+
+		bool IsLeaf() const { return Child1 == NullNode; }
+	};
+
+	int32 AllocateNode();
+	void FreeNode(int32 InNodeIndex);
+
+	void InsertLeaf(int32 InLeaf);
+	void RemoveLeaf(int32 InLeaf);
+	void RefitAncestors(int32 InNodeIndex);
+	int32 Balance(int32 InNodeIndex);
+
+	int32 ValidateNode(int32 InNodeIndex) const;
+
+	TArray<FNode> Nodes;
+	int32 Root = NullNode;
+	int32 FreeList = NullNode;
+	int32 NumProxies = 0;
+};
+
+template <typename TestType, typename FuncType>
+void FDynamicAABBTree::Query(TestType InOverlapTest, FuncType InCallback) const
+{
+	if (Root == NullNode)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(Root);
+
+	while (!Stack.IsEmpty())
+	{
+		const int32 NodeIndex = Stack.Last();
+		Stack.Pop();
+
+		const FNode& Node = Nodes[NodeIndex];
+		if (!InOverlapTest(Node.Min, Node.Max))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			if (!InCallback(NodeIndex))
+			{
+				return;
+			}
+		}
+		else
+		{
+			Stack.Add(Node.Child1);
+			Stack.Add(Node.Child2);
+		}
+	}
+}
+
+template <typename FuncType>
+void FDynamicAABBTree::QueryAABB(const FAABB& InBounds, FuncType InCallback) const
+{
+	Query([&InBounds](const FVector& InMin, const FVector& InMax)
+	{
+		return InMin.X <= InBounds.Max.X && InMax.X >= InBounds.Min.X &&
+			InMin.Y <= InBounds.Max.Y && InMax.Y >= InBounds.Min.Y &&
+			InMin.Z <= InBounds.Max.Z && InMax.Z >= InBounds.Min.Z;
+	}, InCallback);
+}
+
+template <typename FuncType>
+void FDynamicAABBTree::QuerySphere(const FBoundingSphere& InSphere, FuncType InCallback) const
+{
+	const float RadiusSquared = InSphere.Radius * InSphere.Radius;
+	Query([&InSphere, RadiusSquared](const FVector& InMin, const FVector& InMax)
+	{
+		// 구 중심에서 상자까지의 최단 거리
+		const float DX = max(max(InMin.X - InSphere.Center.X, 0.0f), InSphere.Center.X - InMax.X);
+		const float DY = max(max(InMin.Y - InSphere.Center.Y, 0.0f), InSphere.Center.Y - InMax.Y);
+		const float DZ = max(max(InMin.Z - InSphere.Center.Z, 0.0f), InSphere.Center.Z - InMax.Z);
+		return DX * DX + DY * DY + DZ * DZ <= RadiusSquared;
+	}, InCallback);
+}
+
+template <typename FuncType>
+void FDynamicAABBTree::QueryFrustum(const FFrustum& InFrustum, FuncType InCallback) const
+{
+	Query([&InFrustum](const FVector& InMin, const FVector& InMax)
+	{
+		return InFrustum.IntersectsAABB(FAABB(InMin, InMax));
+	}, InCallback);
+}
+
+template <typename FuncType>
+void FDynamicAABBTree::RayCast(const FVector& InOrigin, const FVector& InDirection, float InMaxDistance,
+                               FuncType InCallback) const
+{
+	constexpr float LargeValue = 1e30f;
+	const FVector InvDirection(InDirection.X != 0.0f ? 1.0f / InDirection.X : LargeValue,
+	                           InDirection.Y != 0.0f ? 1.0f / InDirection.Y : LargeValue,
+	                           InDirection.Z != 0.0f ? 1.0f / InDirection.Z : LargeValue);
+
+	float EntryDistance = 0.0f;
+	Query([&](const FVector& InMin, const FVector& InMax)
+	{
+		return IntersectsRay(InOrigin, InvDirection, InMaxDistance, InMin, InMax, EntryDistance);
+	}, [&](int32 InProxyId)
+	{
+		// 리프는 판정 직후 콜백되므로 EntryDistance는 이 리프의 값
+		return InCallback(InProxyId, EntryDistance);
+	});
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+/**
+ * @brief 뷰-투영 행렬에서 추출한 6개 평면으로 이루어진 절두체
+ * 평면은 (Normal, D) 형태의 FVector4이며 Normal · P + D >= 0 이면 평면 안쪽이다
+ * 행렬은 셰이더와 같은 열 벡터 규약(Clip = Projection * View * P)을 따르고, 깊이 범위는 D3D 기준 [0, W]이다
+ */
+struct FFrustum
+{
+	enum EPlane : uint8
+	{
+		Left,
+		Right,
+		Bottom,
+		Top,
+		Near,
+		Far,
+		Num
+	};
+
+	FVector4 Planes[Num];
+
+	FFrustum() = default;
+
+	/**
+	 * @param InViewProjection Projection * View (열 벡터 규약)
+	 */
+	explicit FFrustum(const FMatrix& InViewProjection);
+
+	bool IntersectsPoint(const FVector& InPoint) const;
+	bool IntersectsAABB(const FAABB& InBox) const;
+	bool IntersectsSphere(const FBoundingSphere& InSphere) const;
+};
+
+/**
+ * @brief 절두체 컬링용 AABB 묶음 (중심 / 반 크기를 성분별 배열로 보관하는 SoA)
+ * 4개씩 SIMD 레인에 올려 6개 평면과 동시에 판정한다
+ *
+ * 사용 예시)
+ *	Bounds.Reset();
+ *	Bounds.Add(Primitive->GetWorldBounds());
+ *	const int32 NumVisible = Bounds.Cull(FFrustum(ViewProjection), Visibility);
+ */
+class FCullingBoundsBatch
+{
+public:
+	int32 Add(const FAABB& InBox);
+	void Reserve(int32 InNumBounds);
+
+	/**
+	 * @brief 항목을 비우는 함수 (매 프레임 재사용할 수 있도록 메모리는 유지)
+	 */
+	void Reset();
+
+	int32 Num() const { return CenterX.Num(); }
+
+	/**
+	 * @brief 모든 AABB를 절두체와 판정하는 함수 (FFrustum::IntersectsAABB와 같은 결과)
+	 * @param OutVisibility 항목별 결과 (1이면 절두체와 겹침)
+	 * @return 절두체와 겹치는 항목 수
+	 */
+	int32 Cull(const FFrustum& InFrustum, TArray<uint8>& OutVisibility) const;
+
+private:
+	TArray<float> CenterX;
+	TArray<float> CenterY;
+	TArray<float> CenterZ;
+
+	TArray<float> ExtentX;
+	TArray<float> ExtentY;
+	TArray<float> ExtentZ;
+};
@@ -127,10 +127,47 @@ void AActor::BeginPlay()
 {
 }
 
+/**
+ * @brief 일괄 생성 시 원형(Archetype) Actor의 설정을 복사하는 함수
+ * Transform은 호출자가 별도로 지정하므로 Transform 이외의 상태만 복사한다
+ * @param InArchetype 복사할 원형 Actor
+ */
+void AActor::CopyFromArchetype(const AActor* InArchetype)
+{
+	if (!InArchetype)
+	{
+		return;
+	}
+
+	bHidden = InArchetype->bHidden;
+	bTickInEditor = InArchetype->bTickInEditor;
+	SetUniformScale(InArchetype->IsUniformScale());
+}
+
 void AActor::EndPlay()
 {
 }
 
+/**
+ * @brief 숨김 상태는 렌더 프록시에 복사되므로, 바뀌면 프리미티브 컴포넌트의 프록시 갱신을 예약한다
+ */
+void AActor::SetActorHiddenInGame(bool bNewHidden)
+{
+	if (bHidden == bNewHidden)
+	{
+		return;
+	}
+
+	bHidden = bNewHidden;
+	for (const TObjectPtr<UActorComponent>& Component : OwnedComponents)
+	{
+		if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component).Get())
+		{
+			Primitive->MarkRenderStateDirty();
+		}
+	}
+}
+
 TArray<UPrimitiveComponent*> AActor::GetPrimitiveComponents() const
 {
 	TArray<UPrimitiveComponent*> PrimitiveComponents;
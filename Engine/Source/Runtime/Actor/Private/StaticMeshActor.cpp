@@ -5,6 +5,7 @@
 #include "Runtime/Component/Public/BillBoardComponent.h"
 
 IMPLEMENT_CLASS(AStaticMeshActor, AActor)
+IMPLEMENT_BLOCK_ALLOCATED_CLASS(AStaticMeshActor, 1024)
 
 AStaticMeshActor::AStaticMeshActor()
 {
@@ -56,6 +57,36 @@ void AStaticMeshActor::Tick(float DeltaSeconds)
 	// 필요시 여기에 추가
 }
 
+/**
+ * @brief 원형 Actor의 StaticMesh와 Material Override를 로그 없이 그대로 공유하는 함수
+ * @param InArchetype 복사할 원형 Actor
+ */
+void AStaticMeshActor::CopyFromArchetype(const AActor* InArchetype)
+{
+	Super::CopyFromArchetype(InArchetype);
+
+	const AStaticMeshActor* Archetype = Cast<AStaticMeshActor>(InArchetype);
+	if (Archetype && StaticMeshComponent)
+	{
+		StaticMeshComponent->CopyMeshFromArchetype(Archetype->GetStaticMeshComponent());
+	}
+}
+
+/**
+ * @brief 이후 생성될 InCount개의 Actor와 StaticMeshComponent가 연속된 메모리 블록에 놓이도록 예약하는 함수
+ * @param InCount 일괄 생성할 Actor 수
+ */
+void AStaticMeshActor::ReserveBatchAllocation(int32 InCount) const
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	GetBlockAllocator().ReserveContiguous(static_cast<uint32>(InCount));
+	UStaticMeshComponent::GetBlockAllocator().ReserveContiguous(static_cast<uint32>(InCount));
+}
+
 void AStaticMeshActor::SetStaticMesh(UStaticMesh* InStaticMesh)
 {
 	if (StaticMeshComponent)
@@ -48,6 +48,10 @@ public:
 	virtual void EndPlay();
 	virtual void Tick(float DeltaSeconds);
 
+	// 일괄 생성 (ULevel::SpawnActors) 지원
+	virtual void CopyFromArchetype(const AActor* InArchetype);
+	virtual void ReserveBatchAllocation(int32 InCount) const {}
+
 	// Getter & Setter
 	USceneComponent* GetRootComponent() const { return RootComponent.Get(); }
 	const TArray<TObjectPtr<UActorComponent>>& GetOwnedComponents() const { return OwnedComponents; }
@@ -66,16 +70,24 @@ public:
 	bool IsActorTickEnabled() const { return bTickInEditor; }
 
 	// 언리얼 엔진 호환성을 위한 GetComponents 템플릿 함수
+	// 매 프레임 호출되는 경로이므로 일반적인 컴포넌트 수까지는 힙 할당 없이 반환
+	static constexpr uint32 NumInlineComponents = 8;
+
 	template<typename T>
-	TArray<T*> GetComponents() const;
+	TArray<T*, TInlineAllocator<NumInlineComponents>> GetComponents() const;
 
 	// Hidden 관련 함수들 (언리얼 엔진 호환)
 	bool GetActorHiddenInGame() const { return bHidden; }
-	void SetActorHiddenInGame(bool bNewHidden) { bHidden = bNewHidden; }
+	void SetActorHiddenInGame(bool bNewHidden);
+
+	// ULevel 액터 목록에서의 안정적인 인덱스 (등록되지 않았으면 -1)
+	int32 GetLevelActorIndex() const { return LevelActorIndex; }
+	void SetLevelActorIndex(int32 InIndex) { LevelActorIndex = InIndex; }
 
 private:
 	TObjectPtr<USceneComponent> RootComponent = nullptr;
 	TArray<TObjectPtr<UActorComponent>> OwnedComponents;
+	int32 LevelActorIndex = -1;
 	bool bTickInEditor = false;
 	bool bHidden = false; // 언리얼 엔진 호환성을 위한 Hidden 상태
 };
@@ -107,11 +119,11 @@ TObjectPtr<T> AActor::CreateDefaultSubobject(const FName& InName)
 
 // GetComponents 템플릿 함수 구현
 template<typename T>
-TArray<T*> AActor::GetComponents() const
+TArray<T*, TInlineAllocator<AActor::NumInlineComponents>> AActor::GetComponents() const
 {
 	static_assert(std::is_base_of_v<UActorComponent, T>, "GetComponents는 UActorComponent를 상속받은 클래스만 사용 가능합니다");
 	
-	TArray<T*> Result;
+	TArray<T*, TInlineAllocator<NumInlineComponents>> Result;
 	for (const auto& Component : OwnedComponents)
 	{
 		if (T* CastedComponent = Cast<T>(Component))
@@ -1,5 +1,6 @@
 #pragma once
 #include "Runtime/Actor/Public/Actor.h"
+#include "Runtime/Core/Public/BlockAllocator.h"
 #include "Physics/Public/AABB.h"
 
 class UStaticMeshComponent;
@@ -14,6 +15,7 @@ class AStaticMeshActor :
 {
 	GENERATED_BODY()
 	DECLARE_CLASS(AStaticMeshActor, AActor)
+	DECLARE_BLOCK_ALLOCATED_CLASS(AStaticMeshActor)
 
 public:
 	AStaticMeshActor();
@@ -24,6 +26,9 @@ public:
 	void EndPlay() override;
 	void Tick(float DeltaSeconds) override;
 
+	void CopyFromArchetype(const AActor* InArchetype) override;
+	void ReserveBatchAllocation(int32 InCount) const override;
+
 	// StaticMesh 관련 함수들
 	void SetStaticMesh(class UStaticMesh* InStaticMesh);
 	UStaticMesh* GetStaticMesh() const;
@@ -2,6 +2,9 @@
 #include "Runtime/Component/Public/PrimitiveComponent.h"
 
 #include "Physics/Public/AABB.h"
+#include "Physics/Public/DynamicAABBTree.h"
+#include "Runtime/Level/Public/TransformHierarchy.h"
+#include "Runtime/Renderer/Public/Scene.h"
 
 IMPLEMENT_CLASS(UPrimitiveComponent, USceneComponent)
 
@@ -10,6 +13,33 @@ UPrimitiveComponent::UPrimitiveComponent()
 	ComponentType = EComponentType::Primitive;
 }
 
+UPrimitiveComponent::~UPrimitiveComponent()
+{
+	if (SpatialTree)
+	{
+		SpatialTree->DestroyProxy(SpatialProxyId);
+		SpatialTree = nullptr;
+		SpatialProxyId = -1;
+	}
+
+	if (Scene)
+	{
+		Scene->RemovePrimitive(this);
+	}
+}
+
+void UPrimitiveComponent::SetSpatialProxy(FDynamicAABBTree* InTree, int32 InProxyId)
+{
+	SpatialTree = InTree;
+	SpatialProxyId = InProxyId;
+}
+
+void UPrimitiveComponent::SetSceneProxy(FScene* InScene, int32 InProxyIndex)
+{
+	Scene = InScene;
+	SceneProxyIndex = InProxyIndex;
+}
+
 void USceneComponent::SetRelativeLocation(const FVector& Location)
 {
 	RelativeLocation = Location;
@@ -34,6 +64,25 @@ void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 	MarkAsDirty();
 }
 
+/**
+ * @brief Location, Rotation, Scale을 한 번에 설정하는 함수
+ * 개별 Setter와 달리 Dirty 전파를 한 번만 수행하며, 일괄 생성처럼 호출자가 Dirty 처리를 미루는 경우 생략할 수 있다
+ * @param InTransform 적용할 상대 Transform
+ * @param bInMarkDirty false일 경우 호출자가 이후 MarkAsDirty를 직접 호출해야 함
+ */
+void USceneComponent::SetRelativeTransform(const FTransform& InTransform, bool bInMarkDirty)
+{
+	RelativeLocation = InTransform.Location;
+	RelativeRotation = InTransform.Rotation;
+	RelativeScale3D = FVector(max(InTransform.Scale.X, MinScale), max(InTransform.Scale.Y, MinScale),
+	                          max(InTransform.Scale.Z, MinScale));
+
+	if (bInMarkDirty)
+	{
+		MarkAsDirty();
+	}
+}
+
 void USceneComponent::SetUniformScale(bool bIsUniform)
 {
 	bIsUniformScale = bIsUniform;
@@ -57,38 +106,56 @@ const FVector& USceneComponent::GetRelativeScale3D() const
 	return RelativeScale3D;
 }
 
-const FMatrix& USceneComponent::GetWorldTransformMatrix() const
+FMatrix USceneComponent::ComputeWorldTransformMatrix() const
 {
-	if (bIsTransformDirty)
+	const FMatrix LocalTransform = FMatrix::GetModelMatrix(GetRelativeLocation(), FVector::GetDegreeToRadian(GetRelativeRotation()), GetRelativeScale3D());
+
+	// 부모 컴포넌트가 있는 경우 부모의 변환도 적용
+	if (ParentAttachment)
 	{
-		WorldTransformMatrix = FMatrix::GetModelMatrix(GetRelativeLocation(), FVector::GetDegreeToRadian(GetRelativeRotation()), GetRelativeScale3D());
+		return ParentAttachment->GetWorldTransformMatrix() * LocalTransform;
+	}
+
+	return LocalTransform;
+}
 
-		// 부모 컴포넌트가 있는 경우 부모의 변환도 적용
-		if (ParentAttachment)
+/**
+ * @brief 월드 행렬을 반환하는 함수
+ * 계층에 등록된 컴포넌트는 노드의 월드 행렬을 읽고, Update 전에 Dirty라면 조상 체인으로 계산해 노드에 기록한다
+ * 등록되지 않은 컴포넌트만 멤버 캐시에 지연 계산한다
+ */
+const FMatrix& USceneComponent::GetWorldTransformMatrix() const
+{
+	if (TransformHierarchy)
+	{
+		if (bIsTransformDirty)
 		{
-			FMatrix ParentTransform = ParentAttachment->GetWorldTransformMatrix();
-			WorldTransformMatrix = ParentTransform * WorldTransformMatrix;
+			TransformHierarchy->SetWorldMatrix(TransformHierarchyIndex, ComputeWorldTransformMatrix());
+			bIsTransformDirty = false;
 		}
 
+		return TransformHierarchy->GetWorldMatrix(TransformHierarchyIndex);
+	}
+
+	if (bIsTransformDirty)
+	{
+		WorldTransformMatrix = ComputeWorldTransformMatrix();
 		bIsTransformDirty = false;
 	}
 
 	return WorldTransformMatrix;
 }
 
+/**
+ * @brief 월드 행렬의 역행렬을 캐시해 반환하는 함수
+ * 월드 행렬은 항상 회전 / 스케일 / 이동만으로 이루어진 아핀 행렬이므로 조상 체인을 다시 곱하지 않고
+ * 캐시된 월드 행렬에 아핀 전용 역행렬을 적용하며, 월드 행렬과 함께 MarkAsDirty에서 무효화된다
+ */
 const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
 {
-
 	if (bIsTransformDirtyInverse)
 	{
-		WorldTransformMatrixInverse = FMatrix::Identity();
-		for (USceneComponent* Ancester = ParentAttachment; Ancester && Ancester->ParentAttachment; Ancester = Ancester->ParentAttachment)
-		{
-			WorldTransformMatrixInverse = FMatrix::GetModelMatrixInverse(Ancester->RelativeLocation, FVector::GetDegreeToRadian(Ancester->RelativeRotation), Ancester->RelativeScale3D) * WorldTransformMatrixInverse;
-
-		}
-		WorldTransformMatrixInverse = WorldTransformMatrixInverse * FMatrix::GetModelMatrixInverse(RelativeLocation, FVector::GetDegreeToRadian(RelativeRotation), RelativeScale3D);
-
+		WorldTransformMatrixInverse = GetWorldTransformMatrix().InverseAffine();
 		bIsTransformDirtyInverse = false;
 	}
 
@@ -155,20 +222,109 @@ bool UPrimitiveComponent::UseIndexedRendering() const
 	return false;
 }
 
-void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax) const
+bool UPrimitiveComponent::GetLocalBounds(FAABB& OutLocalBounds) const
 {
-	// 기본 구현: AABB가 없으면 빈 박스 반환
 	if (BoundingVolume && BoundingVolume->GetType() == EBoundingVolumeType::AABB)
 	{
-		FAABB* aabb = static_cast<FAABB*>(BoundingVolume);
-		OutMin = aabb->Min;
-		OutMax = aabb->Max;
+		OutLocalBounds = *static_cast<FAABB*>(BoundingVolume);
+		return true;
+	}
+
+	return false;
+}
+
+void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax) const
+{
+	const FAABB& Bounds = GetWorldBounds();
+	OutMin = Bounds.Min;
+	OutMax = Bounds.Max;
+}
+
+const FAABB& UPrimitiveComponent::GetWorldBounds() const
+{
+	if (bIsBoundsDirty)
+	{
+		UpdateWorldBounds();
+	}
+
+	return WorldBounds;
+}
+
+const FBoundingSphere& UPrimitiveComponent::GetWorldBoundingSphere() const
+{
+	if (bIsBoundsDirty)
+	{
+		UpdateWorldBounds();
+	}
+
+	return WorldBoundingSphere;
+}
+
+bool UPrimitiveComponent::HasBounds() const
+{
+	if (bIsBoundsDirty)
+	{
+		UpdateWorldBounds();
+	}
+
+	return bHasBounds;
+}
+
+void UPrimitiveComponent::OnTransformChanged()
+{
+	bIsBoundsDirty = true;
+}
+
+void UPrimitiveComponent::SetActive(bool bInActive)
+{
+	Super::SetActive(bInActive);
+	MarkRenderStateDirty();
+}
+
+void UPrimitiveComponent::SetVisibility(bool bVisibility)
+{
+	if (bVisible == bVisibility)
+	{
+		return;
+	}
+
+	bVisible = bVisibility;
+	MarkRenderStateDirty();
+}
+
+void UPrimitiveComponent::MarkBoundsDirty()
+{
+	bIsBoundsDirty = true;
+	MarkRenderStateDirty();
+}
+
+void UPrimitiveComponent::MarkRenderStateDirty()
+{
+	if (FTransformHierarchy* Hierarchy = GetTransformHierarchy())
+	{
+		Hierarchy->MarkDirty(GetTransformHierarchyIndex());
 	}
-	else
+}
+
+/**
+ * @brief 로컬 AABB를 월드 행렬로 변환해 월드 AABB와 경계 구를 갱신하는 함수
+ */
+void UPrimitiveComponent::UpdateWorldBounds() const
+{
+	bIsBoundsDirty = false;
+
+	FAABB LocalBounds;
+	bHasBounds = GetLocalBounds(LocalBounds);
+	if (!bHasBounds)
 	{
-		OutMin = FVector(0.0f, 0.0f, 0.0f);
-		OutMax = FVector(0.0f, 0.0f, 0.0f);
+		WorldBounds = FAABB();
+		WorldBoundingSphere = FBoundingSphere();
+		return;
 	}
+
+	const FMatrix& WorldMatrix = GetWorldTransformMatrix();
+	WorldBounds = LocalBounds.TransformBy(WorldMatrix);
+	WorldBoundingSphere = LocalBounds.TransformSphereBy(WorldMatrix);
 }
 
 FMatrix UPrimitiveComponent::GetWorldMatrix() const
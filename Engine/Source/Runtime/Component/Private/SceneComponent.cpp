@@ -1,7 +1,16 @@
 #include "pch.h"
 #include "Runtime/Component/Public/SceneComponent.h"
 
-IMPLEMENT_CLASS(USceneComponent, UActorComponent)
+#include "Runtime/Level/Public/TransformHierarchy.h"
+
+IMPLEMENT_CLASS_WITH_PROPERTIES(USceneComponent, UActorComponent)
+
+// Metadata와 이름을 맞춰 두어 CopyMatchingProperties로 바로 옮길 수 있도록 함
+BEGIN_PROPERTY_TABLE(USceneComponent)
+	PROPERTY_NAMED(RelativeLocation, "Location")
+	PROPERTY_NAMED(RelativeRotation, "Rotation")
+	PROPERTY_NAMED(RelativeScale3D, "Scale")
+END_PROPERTY_TABLE()
 
 USceneComponent::USceneComponent()
 {
@@ -10,6 +19,11 @@ USceneComponent::USceneComponent()
 
 USceneComponent::~USceneComponent()
 {
+	if (TransformHierarchy)
+	{
+		TransformHierarchy->UnregisterComponent(this);
+	}
+
 	// 부모에서 자신을 제거
 	if (ParentAttachment != nullptr)
 	{
@@ -17,13 +31,14 @@ USceneComponent::~USceneComponent()
 		ParentAttachment = nullptr;
 	}
 
-	// 자식 컴포넌트들의 부모 참조 해제 및 삭제
-	for (USceneComponent* child : Children)
+	// 자식 컴포넌트는 각자의 Actor가 소유하므로 삭제하지 않고 부모 참조만 해제
+	// 부모가 사라져 자손의 월드 행렬이 바뀌므로 Dirty로 표시 (계층은 위의 등록 해제로 다시 구성됨)
+	for (USceneComponent* Child : Children)
 	{
-		if (child != nullptr)
+		if (Child != nullptr)
 		{
-			child->ParentAttachment = nullptr; // 부모 참조 해제
-			delete child;
+			Child->ParentAttachment = nullptr;
+			Child->MarkAsDirty();
 		}
 	}
 	Children.Empty();
@@ -42,9 +57,9 @@ void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
 	}
 
 	//부모의 조상중에 내 자식이 있으면 순환참조 -> 스택오버플로우 일어남.
-	for (USceneComponent* Ancester = NewParent; NewParent; Ancester = NewParent->ParentAttachment)
+	for (USceneComponent* Ancester = NewParent; Ancester; Ancester = Ancester->ParentAttachment)
 	{
-		if (NewParent == this) //조상중에 내 자식이 있다면 조상중에 내가 있을 것임.
+		if (Ancester == this) //조상중에 내 자식이 있다면 조상중에 내가 있을 것임.
 			return;
 	}
 
@@ -56,11 +71,26 @@ void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
 	}
 
 	ParentAttachment = NewParent;
+	if (ParentAttachment)
+	{
+		ParentAttachment->Children.Add(this);
+	}
+
+	// 깊이가 바뀌므로 계층을 다시 구성해야 함
+	if (TransformHierarchy)
+	{
+		TransformHierarchy->MarkStructureDirty();
+	}
 
 	MarkAsDirty();
 
 }
 
+USceneComponent* USceneComponent::GetParentAttachment() const
+{
+	return ParentAttachment;
+}
+
 void USceneComponent::RemoveChild(USceneComponent* ChildDeleted)
 {
 	// 버그 수정: this가 아닌 ChildDeleted를 제거해야 함
@@ -74,9 +104,61 @@ void USceneComponent::MarkAsDirty()
 
 	OnTransformChanged();
 
+	// 월드 행렬 계산은 다음 FTransformHierarchy::Update에서 일괄 처리하지만,
+	// 그 전에 자식의 월드 행렬을 읽어도 최신 값이 나오도록 Dirty 비트는 바로 자식에게 전파
+	if (TransformHierarchy)
+	{
+		TransformHierarchy->MarkDirty(TransformHierarchyIndex);
+	}
+
 	for (USceneComponent* Child : Children)
 	{
 		Child->MarkAsDirty();
 	}
 }
 
+FQuatTransform USceneComponent::GetRelativeQuatTransform() const
+{
+	return FQuatTransform(FTransform(RelativeLocation, RelativeRotation, RelativeScale3D));
+}
+
+void USceneComponent::SetRelativeQuatTransform(const FQuatTransform& InTransform)
+{
+	SetRelativeTransform(FTransform(InTransform.Translation, FQuatTransform::GetEulerDegrees(InTransform.Rotation),
+	                                InTransform.Scale3D));
+}
+
+FQuatTransform USceneComponent::GetWorldQuatTransform() const
+{
+	FQuatTransform WorldTransform = GetRelativeQuatTransform();
+	for (USceneComponent* Ancestor = ParentAttachment; Ancestor; Ancestor = Ancestor->ParentAttachment)
+	{
+		WorldTransform = Ancestor->GetRelativeQuatTransform() * WorldTransform;
+	}
+
+	return WorldTransform;
+}
+
+bool USceneComponent::IsTransformDirty() const
+{
+	return bIsTransformDirty;
+}
+
+void USceneComponent::OnWorldTransformMatrixUpdated()
+{
+	bIsTransformDirty = false;
+	bIsTransformDirtyInverse = true;
+
+	// 부모 때문에 바뀐 자식은 MarkAsDirty를 거치지 않으므로 여기서 알림
+	OnTransformChanged();
+}
+
+void USceneComponent::SetTransformHierarchy(FTransformHierarchy* InHierarchy, int32 InIndex)
+{
+	TransformHierarchy = InHierarchy;
+	TransformHierarchyIndex = InIndex;
+
+	// 월드 행렬을 보관하는 곳(노드 / 멤버)이 바뀌므로 다음에 읽을 때 다시 계산
+	bIsTransformDirty = true;
+	bIsTransformDirtyInverse = true;
+}
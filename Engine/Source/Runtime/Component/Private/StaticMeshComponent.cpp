@@ -5,6 +5,7 @@
 #include "Runtime/Subsystem/Asset/Public/AssetSubsystem.h"
 
 IMPLEMENT_CLASS(UStaticMeshComponent, UMeshComponent)
+IMPLEMENT_BLOCK_ALLOCATED_CLASS(UStaticMeshComponent, 1024)
 
 UStaticMeshComponent::UStaticMeshComponent()
 {
@@ -16,13 +17,10 @@ UStaticMeshComponent::UStaticMeshComponent()
 void UStaticMeshComponent::SetStaticMesh(UStaticMesh* InStaticMesh)
 {
 	StaticMesh = InStaticMesh;
+	MarkBoundsDirty();
 
 	if (StaticMesh && StaticMesh->IsValidMesh())
 	{
-		UE_LOG("StaticMeshComponent::SetStaticMesh - Setting mesh: %s", 
-		       StaticMesh->GetAssetPathFileName().c_str());
-		UE_LOG("  VertexBuffer: %p, IndexBuffer: %p", 
-		       StaticMesh->GetVertexBuffer(), StaticMesh->GetIndexBuffer());
 		InitializeMeshRenderData();
 		MaterialOverrideMap.Empty(); // 스태틱메시 바꿀었으므로 머티리얼 오버라이드 맵 초기화
 	}
@@ -32,6 +30,20 @@ void UStaticMeshComponent::SetStaticMesh(UStaticMesh* InStaticMesh)
 	}
 }
 
+void UStaticMeshComponent::CopyMeshFromArchetype(const UStaticMeshComponent* InArchetype)
+{
+	if (!InArchetype)
+	{
+		return;
+	}
+
+	StaticMesh = InArchetype->StaticMesh;
+	MarkBoundsDirty();
+	Vertices = InArchetype->Vertices;
+	NumVertices = InArchetype->NumVertices;
+	MaterialOverrideMap = InArchetype->MaterialOverrideMap;
+}
+
 bool UStaticMeshComponent::HasValidMeshData() const
 {
 	return StaticMesh != nullptr && StaticMesh->IsValidMesh();
@@ -130,59 +142,21 @@ EShaderType UStaticMeshComponent::GetShaderType() const
 
 FAABB UStaticMeshComponent::GetAABB() const
 {
-	if (StaticMesh && StaticMesh->IsValidMesh())
-	{
-		return StaticMesh->CalculateAABB();
-	}
-	return FAABB();
+	FAABB LocalBounds;
+	GetLocalBounds(LocalBounds);
+	return LocalBounds;
 }
 
-void UStaticMeshComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax) const
+bool UStaticMeshComponent::GetLocalBounds(FAABB& OutLocalBounds) const
 {
 	if (StaticMesh && StaticMesh->IsValidMesh())
 	{
-		FAABB LocalAABB = StaticMesh->CalculateAABB();
-
-		// 월드 변환 행렬 적용
-		const FMatrix& WorldTransform = GetWorldTransformMatrix();
-
-		// AABB의 8개 꼭짓점을 모두 변환하여 새로운 AABB 계산
-		FVector Corners[8] = {
-			FVector(LocalAABB.Min.X, LocalAABB.Min.Y, LocalAABB.Min.Z),
-			FVector(LocalAABB.Max.X, LocalAABB.Min.Y, LocalAABB.Min.Z),
-			FVector(LocalAABB.Min.X, LocalAABB.Max.Y, LocalAABB.Min.Z),
-			FVector(LocalAABB.Max.X, LocalAABB.Max.Y, LocalAABB.Min.Z),
-			FVector(LocalAABB.Min.X, LocalAABB.Min.Y, LocalAABB.Max.Z),
-			FVector(LocalAABB.Max.X, LocalAABB.Min.Y, LocalAABB.Max.Z),
-			FVector(LocalAABB.Min.X, LocalAABB.Max.Y, LocalAABB.Max.Z),
-			FVector(LocalAABB.Max.X, LocalAABB.Max.Y, LocalAABB.Max.Z)
-		};
-
-		// 첫 번째 꼭짓점으로 초기화
-		FVector TransformedCorner = FMatrix::VectorMultiply(Corners[0], WorldTransform);
-		OutMin = OutMax = TransformedCorner;
-
-		// 나머지 꼭짓점들로 Min/Max 갱신
-		for (int32 i = 1; i < 8; ++i)
-		{
-			TransformedCorner = FMatrix::VectorMultiply(Corners[i], WorldTransform);
-
-			OutMin.X = std::min(OutMin.X, TransformedCorner.X);
-			OutMin.Y = std::min(OutMin.Y, TransformedCorner.Y);
-			OutMin.Z = std::min(OutMin.Z, TransformedCorner.Z);
-
-			OutMax.X = std::max(OutMax.X, TransformedCorner.X);
-			OutMax.Y = std::max(OutMax.Y, TransformedCorner.Y);
-			OutMax.Z = std::max(OutMax.Z, TransformedCorner.Z);
-		}
+		OutLocalBounds = StaticMesh->GetLocalBounds();
+		return true;
 	}
 
-    else
-	{
-		// 유효한 메시가 없으면 빈 박스 반환
-		OutMin = FVector(0.0f, 0.0f, 0.0f);
-		OutMax = FVector(0.0f, 0.0f, 0.0f);
-	}
+	OutLocalBounds = FAABB();
+	return false;
 }
 
 // Material Override 관련 메서드 구현
@@ -201,7 +175,10 @@ void UStaticMeshComponent::SetMaterialOverride(int32 SlotIndex, UMaterialInterfa
 	{
 		// nullptr이 전달되면 오버라이드 제거
 		RemoveMaterialOverride(SlotIndex);
+		return;
 	}
+
+	MarkRenderStateDirty();
 }
 
 UMaterialInterface* UStaticMeshComponent::GetMaterialOverride(int32 SlotIndex) const
@@ -217,11 +194,13 @@ UMaterialInterface* UStaticMeshComponent::GetMaterialOverride(int32 SlotIndex) c
 void UStaticMeshComponent::RemoveMaterialOverride(int32 SlotIndex)
 {
 	MaterialOverrideMap.Remove(SlotIndex);
+	MarkRenderStateDirty();
 }
 
 void UStaticMeshComponent::ClearMaterialOverrides()
 {
 	MaterialOverrideMap.Empty();
+	MarkRenderStateDirty();
 }
 
 const TArray<UMaterialInterface*>& UStaticMeshComponent::GetMaterailSlots() const
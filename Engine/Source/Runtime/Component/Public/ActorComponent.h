@@ -27,9 +27,9 @@ public:
 
 	// Component Active State
 	bool IsActive() const { return bIsActive; }
-	void SetActive(bool bInActive) { bIsActive = bInActive; }
-	virtual void Activate() { bIsActive = true; }
-	virtual void Deactivate() { bIsActive = false; }
+	virtual void SetActive(bool bInActive) { bIsActive = bInActive; }
+	virtual void Activate() { SetActive(true); }
+	virtual void Deactivate() { SetActive(false); }
 
 protected:
 	EComponentType ComponentType;
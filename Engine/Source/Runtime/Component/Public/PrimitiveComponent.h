@@ -1,8 +1,11 @@
 #pragma once
 #include "Runtime/Component/Public/SceneComponent.h"
-#include "Physics/Public/BoundingVolume.h"
+#include "Physics/Public/AABB.h"
 
 class UMaterial;
+class FDynamicAABBTree;
+class FScene;
+
 UCLASS()
 class UPrimitiveComponent :
 	public USceneComponent
@@ -12,6 +15,7 @@ class UPrimitiveComponent :
 
 public:
 	UPrimitiveComponent();
+	~UPrimitiveComponent() override;
 
 	const TArray<FVertex>* GetVerticesData() const;
 	ID3D11Buffer* GetVertexBuffer() const;
@@ -22,7 +26,7 @@ public:
 	// Legacy render function removed
 
 	bool IsVisible() const { return bVisible; }
-	void SetVisibility(bool bVisibility) { bVisible = bVisibility; }
+	void SetVisibility(bool bVisibility);
 
 	FVector4 GetColor() const { return Color; }
 	void SetColor(const FVector4& InColor) { Color = InColor; }
@@ -45,11 +49,51 @@ public:
 
 	// BoundingVolume 관련 함수들
 	/**
-	 * @brief 월드 좌표계 AABB를 가져옴
+	 * @brief 로컬 좌표계 AABB를 가져옴
+	 * 기본 구현은 BoundingVolume이 AABB일 때 그 값을 사용하며, 메시를 가진 컴포넌트는 메시의 캐시된 범위를 반환한다
+	 * @return 범위가 없는 프리미티브면 false
+	 */
+	virtual bool GetLocalBounds(FAABB& OutLocalBounds) const;
+
+	/**
+	 * @brief 월드 좌표계 AABB를 가져옴 (범위가 없으면 크기 0인 박스)
 	 * @param OutMin 최소 좌표 (출력)
 	 * @param OutMax 최대 좌표 (출력)
 	 */
-	virtual void GetWorldAABB(FVector& OutMin, FVector& OutMax) const;
+	void GetWorldAABB(FVector& OutMin, FVector& OutMax) const;
+
+	/**
+	 * @brief 캐시된 월드 AABB / 경계 구
+	 * Transform이 Dirty가 되었거나 로컬 범위가 바뀐 뒤 처음 조회할 때만 다시 계산한다
+	 */
+	const FAABB& GetWorldBounds() const;
+	const FBoundingSphere& GetWorldBoundingSphere() const;
+	bool HasBounds() const;
+
+	void OnTransformChanged() override;
+	void SetActive(bool bInActive) override;
+
+	/**
+	 * @brief 이 컴포넌트의 리프를 가진 공간 인덱스와 프록시 ID (레벨에 속하지 않거나 범위가 없으면 nullptr / -1)
+	 * 프록시는 ULevel이 Transform 갱신 직후에 생성 / 이동하며, 컴포넌트가 먼저 삭제되면 소멸자에서 제거한다
+	 */
+	FDynamicAABBTree* GetSpatialTree() const { return SpatialTree; }
+	int32 GetSpatialProxyId() const { return SpatialProxyId; }
+	void SetSpatialProxy(FDynamicAABBTree* InTree, int32 InProxyId);
+
+	/**
+	 * @brief 이 컴포넌트의 렌더 프록시를 가진 씬과 프록시 인덱스 (등록되지 않았으면 nullptr / -1)
+	 * 인덱스는 다른 프록시가 제거될 때 FScene이 다시 기록한다
+	 */
+	FScene* GetScene() const { return Scene; }
+	int32 GetSceneProxyIndex() const { return SceneProxyIndex; }
+	void SetSceneProxy(FScene* InScene, int32 InProxyIndex);
+
+	/**
+	 * @brief 메시, 머티리얼, 표시 여부처럼 렌더 프록시에 복사된 상태가 바뀌었음을 알리는 함수
+	 * Transform 계층에 Dirty로 기록해 다음 갱신에서 프록시를 다시 채우도록 한다
+	 */
+	void MarkRenderStateDirty();
 
 	/**
 	 * @brief BoundingVolume을 가져옴
@@ -70,4 +114,24 @@ protected:
 	bool bVisible = true;
 
 	IBoundingVolume* BoundingVolume = nullptr;
+
+	/**
+	 * @brief 로컬 범위가 바뀌었을 때(메시 교체 등) 월드 범위 캐시를 무효화하는 함수
+	 * Transform 계층에 등록되어 있으면 Dirty로 기록해 다음 갱신에서 공간 인덱스의 리프도 옮기도록 한다
+	 */
+	void MarkBoundsDirty();
+
+private:
+	void UpdateWorldBounds() const;
+
+	FDynamicAABBTree* SpatialTree = nullptr;
+	int32 SpatialProxyId = -1;
+
+	FScene* Scene = nullptr;
+	int32 SceneProxyIndex = -1;
+
+	mutable bool bIsBoundsDirty = true;
+	mutable bool bHasBounds = false;
+	mutable FAABB WorldBounds;
+	mutable FBoundingSphere WorldBoundingSphere;
 };
@@ -1,17 +1,22 @@
 #pragma once
 #include "Runtime/Component/Public/ActorComponent.h"
+#include "Runtime/Core/Public/Property.h"
+
+class FTransformHierarchy;
 
 UCLASS()
 class USceneComponent : public UActorComponent
 {
 	GENERATED_BODY()
 	DECLARE_CLASS(USceneComponent, UActorComponent)
+	DECLARE_PROPERTY_TABLE()
 
 public:
 	USceneComponent();
 	virtual ~USceneComponent();
 
 	void SetParentAttachment(USceneComponent* SceneComponent);
+	USceneComponent* GetParentAttachment() const;
 	void RemoveChild(USceneComponent* ChildDeleted);
 
 	void MarkAsDirty();
@@ -20,6 +25,7 @@ public:
 	void SetRelativeLocation(const FVector& Location);
 	void SetRelativeRotation(const FVector& Rotation);
 	void SetRelativeScale3D(const FVector& Scale);
+	void SetRelativeTransform(const FTransform& InTransform, bool bInMarkDirty = true);
 	void SetUniformScale(bool bIsUniform);
 
 	bool IsUniformScale() const;
@@ -28,10 +34,47 @@ public:
 	const FVector& GetRelativeRotation() const;
 	const FVector& GetRelativeScale3D() const;
 
+	/**
+	 * @brief 상대 변환을 쿼터니언 변환으로 다루는 함수
+	 * 편집 / 직렬화 기준 값은 오일러 각 RelativeRotation이므로, Set은 오일러 각으로 변환해 저장한다
+	 */
+	FQuatTransform GetRelativeQuatTransform() const;
+	void SetRelativeQuatTransform(const FQuatTransform& InTransform);
+
+	/**
+	 * @brief 부모 체인을 4x4 행렬 곱 없이 합성한 월드 변환
+	 * 자식 쪽 스케일이 비균등하면 근사값이므로, 렌더링 / 피킹은 GetWorldTransformMatrix를 사용한다
+	 */
+	FQuatTransform GetWorldQuatTransform() const;
+
 	const FMatrix& GetWorldTransformMatrix() const;
 	const FMatrix& GetWorldTransformMatrixInverse() const;
 
+	bool IsTransformDirty() const;
+
+	/**
+	 * @brief FTransformHierarchy::Update가 이 컴포넌트 노드의 월드 행렬을 다시 계산했을 때 호출되는 함수
+	 * 역행렬 캐시는 Dirty로 두어 필요할 때 계산하도록 한다
+	 */
+	void OnWorldTransformMatrixUpdated();
+
+	/**
+	 * @brief 이 컴포넌트를 노드로 가진 Transform 계층 (레벨에 속하지 않으면 nullptr)
+	 * 등록된 컴포넌트의 월드 행렬은 계층의 노드가 보관하고, 등록되지 않은 컴포넌트만 멤버 캐시를 사용한다
+	 */
+	FTransformHierarchy* GetTransformHierarchy() const { return TransformHierarchy; }
+	int32 GetTransformHierarchyIndex() const { return TransformHierarchyIndex; }
+	void SetTransformHierarchy(FTransformHierarchy* InHierarchy, int32 InIndex);
+
 private:
+	/**
+	 * @brief 로컬 행렬에 부모의 월드 행렬을 곱해 월드 행렬을 계산하는 함수
+	 */
+	FMatrix ComputeWorldTransformMatrix() const;
+
+	FTransformHierarchy* TransformHierarchy = nullptr;
+	int32 TransformHierarchyIndex = -1;
+
 	mutable bool bIsTransformDirty = true;
 	mutable bool bIsTransformDirtyInverse = true;
 	mutable FMatrix WorldTransformMatrix;
@@ -1,6 +1,7 @@
 #pragma once
 #include "Runtime/Component/Public/MeshComponent.h"
 #include "Asset/Public/StaticMesh.h"
+#include "Runtime/Core/Public/BlockAllocator.h"
 
 class UMaterialInterface;
 
@@ -15,6 +16,7 @@ class UStaticMeshComponent :
 {
 	GENERATED_BODY()
 	DECLARE_CLASS(UStaticMeshComponent, UMeshComponent)
+	DECLARE_BLOCK_ALLOCATED_CLASS(UStaticMeshComponent)
 
 public:
 	UStaticMeshComponent();
@@ -31,6 +33,13 @@ public:
 	 */
 	UStaticMesh* GetStaticMesh() const { return StaticMesh; }
 
+	/**
+	 * @brief 다른 컴포넌트가 이미 확인한 스태틱 메시와 머티리얼 오버라이드를 그대로 공유
+	 * 일괄 생성 경로에서 사용하며, 메시 유효성 검사와 로그를 생략한다
+	 * @param InArchetype 복사할 원형 컴포넌트
+	 */
+	void CopyMeshFromArchetype(const UStaticMeshComponent* InArchetype);
+
 	// UMeshComponent로부터 재정의
 	virtual bool HasValidMeshData() const override;
 	virtual uint32 GetNumVertices() const override;
@@ -48,13 +57,13 @@ public:
 
 	// BoundingVolume 관련 기능
 	/**
-	 * @brief 스태틱 메시를 기반으로 AABB 계산
-	 * @return 계산된 AABB
+	 * @brief 스태틱 메시의 로컬 AABB (메시에 캐시된 값)
+	 * @return 로컬 AABB, 메시가 없으면 크기 0인 박스
 	 */
 	FAABB GetAABB() const;
 
 	// PrimitiveComponent 오버라이드
-	virtual void GetWorldAABB(FVector& OutMin, FVector& OutMax) const override;
+	virtual bool GetLocalBounds(FAABB& OutLocalBounds) const override;
 
 	// Material Override 관련 기능
 	/**
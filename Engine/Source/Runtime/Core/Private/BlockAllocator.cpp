@@ -0,0 +1,110 @@
+#include "pch.h"
+#include "Runtime/Core/Public/BlockAllocator.h"
+
+FFixedBlockAllocator::FFixedBlockAllocator(size_t InBlockSize, size_t InBlockAlignment, uint32 InBlocksPerChunk)
+	: BlockAlignment(max(InBlockAlignment, alignof(FFreeBlock)))
+	  , BlocksPerChunk(max(InBlocksPerChunk, 1u))
+{
+	// Free List 노드를 블록 안에 저장하므로 최소 포인터 크기는 보장해야 함
+	size_t ActualSize = max(InBlockSize, sizeof(FFreeBlock));
+	BlockSize = (ActualSize + BlockAlignment - 1) & ~(BlockAlignment - 1);
+}
+
+FFixedBlockAllocator::~FFixedBlockAllocator()
+{
+	for (void* Chunk : Chunks)
+	{
+		::operator delete(Chunk, std::align_val_t(BlockAlignment));
+	}
+
+	Chunks.Empty();
+}
+
+/**
+ * @brief 블록 하나를 할당하는 함수
+ * 연속 할당 예약이 남아있다면 청크에서, 그렇지 않다면 Free List를 우선 사용한다
+ * @return 할당된 블록의 주소
+ */
+void* FFixedBlockAllocator::Allocate()
+{
+	++NumAllocatedBlocks;
+
+	if (PendingContiguousCount > 0)
+	{
+		--PendingContiguousCount;
+	}
+	else if (FreeList)
+	{
+		FFreeBlock* Block = FreeList;
+		FreeList = Block->Next;
+		return Block;
+	}
+
+	if (ChunkCursor == ChunkEnd)
+	{
+		AllocateChunk(BlocksPerChunk);
+	}
+
+	void* Block = ChunkCursor;
+	ChunkCursor += BlockSize;
+	return Block;
+}
+
+/**
+ * @brief 블록을 Free List로 반환하는 함수
+ * @param InMemory Allocate로 할당받은 블록의 주소
+ */
+void FFixedBlockAllocator::Free(void* InMemory)
+{
+	if (!InMemory)
+	{
+		return;
+	}
+
+	assert(NumAllocatedBlocks > 0);
+	--NumAllocatedBlocks;
+
+	FFreeBlock* Block = static_cast<FFreeBlock*>(InMemory);
+	Block->Next = FreeList;
+	FreeList = Block;
+}
+
+/**
+ * @brief 이후 InCount개의 할당이 하나의 청크 안에서 연속된 주소로 이루어지도록 예약하는 함수
+ * 현재 청크의 남은 공간이 부족하면 InCount개 이상을 담을 수 있는 청크를 새로 할당한다
+ * @param InCount 연속으로 할당할 블록 수
+ */
+void FFixedBlockAllocator::ReserveContiguous(uint32 InCount)
+{
+	if (InCount == 0)
+	{
+		return;
+	}
+
+	const size_t RemainingBlocks = static_cast<size_t>(ChunkEnd - ChunkCursor) / BlockSize;
+	if (RemainingBlocks < InCount)
+	{
+		AllocateChunk(max(InCount, BlocksPerChunk));
+	}
+
+	PendingContiguousCount = InCount;
+}
+
+void FFixedBlockAllocator::AllocateChunk(uint32 InBlockCount)
+{
+	// 기존 청크의 남은 공간은 버리지 않고 Free List로 넘겨 재사용
+	while (ChunkCursor && ChunkCursor + BlockSize <= ChunkEnd)
+	{
+		FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(ChunkCursor);
+		Block->Next = FreeList;
+		FreeList = Block;
+		ChunkCursor += BlockSize;
+	}
+
+	const size_t ChunkSize = BlockSize * InBlockCount;
+	void* Chunk = ::operator new(ChunkSize, std::align_val_t(BlockAlignment));
+	Chunks.Add(Chunk);
+
+	ChunkCursor = static_cast<uint8*>(Chunk);
+	ChunkEnd = ChunkCursor + ChunkSize;
+}
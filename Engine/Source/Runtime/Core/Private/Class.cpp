@@ -70,6 +70,27 @@ TObjectPtr<UObject> UClass::CreateDefaultObject()
 	return nullptr;
 }
 
+/**
+ * @brief 클래스의 프로퍼티 테이블 반환
+ * 자신이 테이블을 선언하지 않았다면 가장 가까운 부모 클래스의 테이블을 사용한다
+ * @return 프로퍼티 테이블 (계층 전체에 없으면 nullptr)
+ */
+const FPropertyTable* UClass::GetPropertyTable() const
+{
+	const UClass* CurrentClass = this;
+	while (CurrentClass)
+	{
+		if (CurrentClass->PropertyTable)
+		{
+			return CurrentClass->PropertyTable;
+		}
+
+		CurrentClass = CurrentClass->SuperClass.Get();
+	}
+
+	return nullptr;
+}
+
 /**
  * @brief 클래스 이름으로 UClass 찾기
  * @param InClassName 찾을 클래스 이름
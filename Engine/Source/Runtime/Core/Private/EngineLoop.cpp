@@ -2,6 +2,7 @@
 #include "Runtime/Core/Public/EngineLoop.h"
 
 #include "Runtime/Core/Public/AppWindow.h"
+#include "Runtime/Core/Public/FrameArena.h"
 #include "Runtime/Engine/Public/Engine.h"
 #include "Runtime/Engine/Public/EditorEngine.h"
 #include "Runtime/Engine/Public/GameInstance.h"
@@ -150,6 +151,9 @@ void FEngineLoop::Tick()
 {
 	UpdateDeltaTime();
 
+	// 두 프레임 전의 임시 할당을 일괄 회수
+	FFrameArena::GetInstance().BeginFrame();
+
 	// Process input task
 	if (auto* InputSubsystem = GEngine->GetEngineSubsystem<UInputSubsystem>())
 	{
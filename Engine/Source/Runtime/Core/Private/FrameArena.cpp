@@ -0,0 +1,107 @@
+#include "pch.h"
+#include "Runtime/Core/Public/FrameArena.h"
+
+FFrameArena& FFrameArena::GetInstance()
+{
+	static FFrameArena Instance;
+	return Instance;
+}
+
+FFrameArena::~FFrameArena()
+{
+	for (FFrameBuffer& Buffer : Buffers)
+	{
+		ResetBuffer(Buffer);
+		for (const FPage& Page : Buffer.Pages)
+		{
+			FreePage(Page);
+		}
+		Buffer.Pages.Empty();
+	}
+}
+
+void FFrameArena::BeginFrame()
+{
+	const size_t FrameUsedBytes = Buffers[CurrentBufferIndex].UsedBytes;
+	LastFrameUsedBytes = FrameUsedBytes;
+	HighWaterMark = max(HighWaterMark, FrameUsedBytes);
+
+	++FrameNumber;
+	CurrentBufferIndex = static_cast<uint32>(FrameNumber % NumBufferedFrames);
+
+	// 새로 사용할 버퍼는 NumBufferedFrames 프레임 전의 데이터를 담고 있으므로 이 시점에 재설정해도 안전
+	ResetBuffer(Buffers[CurrentBufferIndex]);
+}
+
+void FFrameArena::Free(void* InMemory, size_t InSize)
+{
+	FFrameBuffer& Buffer = Buffers[CurrentBufferIndex];
+	uint8* Memory = static_cast<uint8*>(InMemory);
+
+	// 스택처럼 가장 최근 할당을 되돌리는 경우만 공간을 회수
+	if (Memory && Memory + InSize == Buffer.Cursor)
+	{
+		Buffer.Cursor = Memory;
+		Buffer.UsedBytes -= InSize;
+	}
+}
+
+/**
+ * @brief 현재 페이지에 공간이 부족할 때 다음 페이지로 넘어가 할당하는 함수
+ * 기본 페이지보다 큰 요청은 전용 메모리를 할당해 현재 페이지의 남은 공간을 낭비하지 않는다
+ */
+void* FFrameArena::AllocateSlow(size_t InSize, size_t InAlignment)
+{
+	FFrameBuffer& Buffer = Buffers[CurrentBufferIndex];
+
+	if (InSize + InAlignment > DefaultPageSize)
+	{
+		FPage Page = AllocatePage(InSize + InAlignment);
+		Buffer.OversizedPages.Add(Page);
+
+		Buffer.UsedBytes += InSize;
+		++Buffer.NumAllocations;
+		return AlignPointer(Page.Memory, InAlignment);
+	}
+
+	// 이전 프레임에서 확보해 둔 페이지가 남아있다면 재사용
+	++Buffer.PageIndex;
+	if (Buffer.PageIndex >= Buffer.Pages.Num())
+	{
+		Buffer.Pages.Add(AllocatePage(DefaultPageSize));
+	}
+
+	const FPage& Page = Buffer.Pages[Buffer.PageIndex];
+	Buffer.Cursor = Page.Memory;
+	Buffer.End = Page.Memory + Page.Size;
+
+	return Allocate(InSize, InAlignment);
+}
+
+void FFrameArena::ResetBuffer(FFrameBuffer& InBuffer)
+{
+	for (const FPage& Page : InBuffer.OversizedPages)
+	{
+		FreePage(Page);
+	}
+	InBuffer.OversizedPages.Empty();
+
+	// 기본 페이지는 반환하지 않고 다음 사용 시 첫 페이지부터 다시 채운다
+	InBuffer.PageIndex = -1;
+	InBuffer.Cursor = nullptr;
+	InBuffer.End = nullptr;
+	InBuffer.UsedBytes = 0;
+	InBuffer.NumAllocations = 0;
+}
+
+FFrameArena::FPage FFrameArena::AllocatePage(size_t InSize)
+{
+	ReservedBytes += InSize;
+	return FPage{static_cast<uint8*>(::operator new(InSize)), InSize};
+}
+
+void FFrameArena::FreePage(const FPage& InPage)
+{
+	ReservedBytes -= InPage.Size;
+	::operator delete(InPage.Memory);
+}
@@ -5,6 +5,49 @@
 
 uint32 UEngineStatics::NextUUID = 0;
 TArray<TObjectPtr<UObject>> GUObjectArray;
+TArray<uint32> GUObjectSerialNumbers;
+
+// 재사용 가능한 빈 슬롯 인덱스 목록과 슬롯 시리얼 넘버 발급기
+static TArray<int32> GUObjectFreeIndices;
+static uint32 GNextObjectSerialNumber = 1;
+
+/**
+ * @brief GUObjectArray에 객체를 등록하고 슬롯 인덱스를 반환하는 함수
+ * 빈 슬롯이 있으면 재사용하며, 슬롯마다 새로운 시리얼 넘버를 발급하여 이전 약참조 핸들을 무효화한다
+ * @param InObject 등록할 객체
+ * @return 할당된 슬롯 인덱스
+ */
+static uint32 AllocateObjectIndex(UObject* InObject)
+{
+	const uint32 SerialNumber = GNextObjectSerialNumber++;
+	if (GNextObjectSerialNumber == 0)
+	{
+		GNextObjectSerialNumber = 1;
+	}
+
+	if (!GUObjectFreeIndices.IsEmpty())
+	{
+		const int32 Index = GUObjectFreeIndices.Pop(false);
+		GUObjectArray[Index] = TObjectPtr(InObject);
+		GUObjectSerialNumbers[Index] = SerialNumber;
+		return static_cast<uint32>(Index);
+	}
+
+	GUObjectArray.Add(TObjectPtr(InObject));
+	GUObjectSerialNumbers.Add(SerialNumber);
+	return static_cast<uint32>(GUObjectArray.Num()) - 1;
+}
+
+/**
+ * @brief 슬롯을 비우고 시리얼 넘버를 0으로 만들어 해당 슬롯을 가리키는 약참조 핸들을 무효화하는 함수
+ * @param InIndex 해제할 슬롯 인덱스
+ */
+static void ReleaseObjectIndex(int32 InIndex)
+{
+	GUObjectArray[InIndex] = nullptr;
+	GUObjectSerialNumbers[InIndex] = 0;
+	GUObjectFreeIndices.Add(InIndex);
+}
 
 IMPLEMENT_CLASS_BASE(UObject)
 
@@ -14,8 +57,7 @@ UObject::UObject()
 	UUID = UEngineStatics::GenUUID();
 	Name = FName("Object_" + to_string(UUID));
 
-	GUObjectArray.Add(TObjectPtr(this));
-	InternalIndex = static_cast<uint32>(GUObjectArray.Num()) - 1;
+	InternalIndex = AllocateObjectIndex(this);
 }
 
 UObject::UObject(const FName& InName)
@@ -24,8 +66,7 @@ UObject::UObject(const FName& InName)
 {
 	UUID = UEngineStatics::GenUUID();
 
-	GUObjectArray.Add(TObjectPtr(this));
-	InternalIndex = GUObjectArray.Num() - 1;
+	InternalIndex = AllocateObjectIndex(this);
 }
 
 UObject::~UObject()
@@ -34,8 +75,8 @@ UObject::~UObject()
 	if (static_cast<int32>(InternalIndex) < GUObjectArray.Num() &&
 		GUObjectArray[static_cast<int32>(InternalIndex)].Get() == this)
 	{
-		// 현재 위치의 포인터를 nullptr로 설정 (배열 크기는 유지)
-		GUObjectArray[static_cast<int32>(InternalIndex)] = nullptr;
+		// 현재 위치의 슬롯을 비우고 재사용 목록에 추가 (배열 크기는 유지)
+		ReleaseObjectIndex(static_cast<int32>(InternalIndex));
 	}
 	else
 	{
@@ -44,7 +85,7 @@ UObject::~UObject()
 		{
 			if (GUObjectArray[i].Get() == this)
 			{
-				GUObjectArray[i] = nullptr;
+				ReleaseObjectIndex(i);
 				break;
 			}
 		}
@@ -80,52 +121,43 @@ bool UObject::IsA(TObjectPtr<UClass> InClass) const
 
 /**
  * @brief GUObjectArray의 nullptr 요소들을 정리하는 함수
- * 배치 처리로 안전한 시점에 수행하여 성능 하락을 방지
+ * 약참조 핸들이 슬롯 인덱스를 들고 있으므로 살아있는 객체의 인덱스는 옮기지 않는다
+ * 대신 배열 끝의 빈 슬롯만 잘라내고, 남은 빈 슬롯은 앞쪽부터 재사용되도록 목록을 재구성한다
  */
 void UObject::CleanupGUObjectArray()
 {
-	size_t OriginalSize = GUObjectArray.Num();
-	uint32 NullCount = 0;
+	const int32 OriginalSize = GUObjectArray.Num();
 
-	// nullptr이 아닌 요소들만 보존
-	int32 RemovedCount = GUObjectArray.RemoveAll(
-		[](const TObjectPtr<UObject>& Pointer)
-		{
-			// 유효하지 않거나 nullptr인 경우 true를 반환하여 제거 대상임을 알림
-			// TObjectPtr<UObject>는 Get() 없이 바로 포인터 비교가 가능합니다.
-			return !Pointer;
-		}
-	);
+	int32 NewSize = OriginalSize;
+	while (NewSize > 0 && !GUObjectArray[NewSize - 1])
+	{
+		--NewSize;
+	}
+
+	GUObjectArray.SetNum(NewSize);
+	GUObjectSerialNumbers.SetNum(NewSize);
 
-	// 모든 유효한 객체들의 InternalIndex 재설정
-	for (int32 i = 0; i < GUObjectArray.Num(); ++i)
+	// 높은 인덱스부터 넣어두면 Pop 시 낮은 인덱스가 먼저 재사용된다
+	GUObjectFreeIndices.Empty();
+	for (int32 i = NewSize - 1; i >= 0; --i)
 	{
-		if (GUObjectArray[i])
+		if (!GUObjectArray[i])
 		{
-			GUObjectArray[i]->SetInternalIndex(i);
+			GUObjectFreeIndices.Add(i);
 		}
 	}
 
-	UE_LOG_SYSTEM("GUObjectArray: Compaction 완료 | 기존: %zu, 정리후: %d, 제거된 nullptr: %u",
-	              OriginalSize, GUObjectArray.Num(), NullCount);
+	UE_LOG_SYSTEM("GUObjectArray: 정리 완료 | 기존: %d, 정리후: %d, 재사용 대기 슬롯: %d",
+	              OriginalSize, NewSize, GUObjectFreeIndices.Num());
 }
 
 /**
  * @brief GUObjectArray의 nullptr 개수를 반환하는 함수
+ * 빈 슬롯은 모두 재사용 목록에 들어있으므로 O(1)로 계산된다
  */
 uint32 UObject::GetNullObjectCount()
 {
-	uint32 NullCount = 0;
-
-	for (const auto& PointerCheck : GUObjectArray)
-	{
-		if (!PointerCheck || PointerCheck.Get() == nullptr)
-		{
-			++NullCount;
-		}
-	}
-
-	return NullCount;
+	return static_cast<uint32>(GUObjectFreeIndices.Num());
 }
 
 /**
@@ -155,6 +187,12 @@ void UObject::CheckAndCleanupGUObjectArray()
 	uint32 NullCount = GetNullObjectCount();
 	size_t TotalSize = GUObjectArray.Num();
 
+	// 배열 끝이 비어있지 않으면 잘라낼 슬롯이 없으므로 빈 슬롯은 재사용에 맡긴다
+	if (TotalSize == 0 || GUObjectArray[static_cast<int32>(TotalSize) - 1])
+	{
+		return;
+	}
+
 	// 임계치 체크: 절대값 또는 비율
 	if (NullCount >= CLEANUP_THRESHOLD ||
 		(TotalSize > 0 && static_cast<float>(NullCount) / TotalSize >= CLEANUP_RATIO && TotalSize >= CLEANUP_MIN))
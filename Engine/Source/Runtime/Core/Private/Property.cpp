@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "Runtime/Core/Public/Property.h"
+
+/**
+ * @brief 테이블에 프로퍼티를 추가하는 함수
+ * 선언 순서가 곧 직렬화 순서이므로 기존 파일 포맷과 동일한 순서로 등록해야 한다
+ */
+void FPropertyTable::AddProperty(const char* InName, uint32 InOffset, uint32 InSize, EPropertyType InType,
+                                 EPropertyFlags InFlags)
+{
+	assert(InOffset + InSize <= StructSize);
+	Properties.Add(FProperty{InName, InOffset, InSize, InType, InFlags});
+}
+
+/**
+ * @brief 등록된 프로퍼티로부터 직렬화 단계를 계산하는 함수
+ * 선언 순서상 이웃한 통째 복사 가능 프로퍼티가 메모리상으로도 패딩 없이 이어질 때만 하나의 구간으로 병합한다
+ * 직렬화 순서가 곧 파일 포맷이므로 병합은 선언 순서를 깨뜨리지 않는 범위에서만 수행한다
+ */
+void FPropertyTable::Finalize()
+{
+	SerializeRuns.Empty();
+
+	bool bHasSkippedProperty = false;
+	for (int32 Index = 0; Index < Properties.Num(); ++Index)
+	{
+		const FProperty& Property = Properties[Index];
+		if (HasPropertyFlag(Property.Flags, EPropertyFlags::Transient))
+		{
+			bHasSkippedProperty = true;
+			continue;
+		}
+
+		if (!Property.IsTriviallyCopyable())
+		{
+			SerializeRuns.Add(FPropertyRun{Property.Offset, Property.Size, Index});
+			continue;
+		}
+
+		if (SerializeRuns.Num() > 0)
+		{
+			FPropertyRun& LastRun = SerializeRuns[SerializeRuns.Num() - 1];
+			if (LastRun.IsBulkRun() && LastRun.Offset + LastRun.Size == Property.Offset)
+			{
+				LastRun.Size += Property.Size;
+				continue;
+			}
+		}
+
+		SerializeRuns.Add(FPropertyRun{Property.Offset, Property.Size});
+	}
+
+	bIsFullyTrivial = !bHasSkippedProperty && SerializeRuns.Num() == 1 && SerializeRuns[0].IsBulkRun() &&
+		SerializeRuns[0].Offset == 0 && SerializeRuns[0].Size == StructSize;
+}
+
+const FProperty* FPropertyTable::FindProperty(const char* InName) const
+{
+	for (const FProperty& Property : Properties)
+	{
+		if (strcmp(Property.Name, InName) == 0)
+		{
+			return &Property;
+		}
+	}
+
+	return nullptr;
+}
+
+int32 FPropertyTable::CopyMatchingProperties(const FPropertyTable& InSourceTable, const void* InSource,
+                                             const FPropertyTable& InDestTable, void* OutDest)
+{
+	int32 CopiedCount = 0;
+
+	for (const FProperty& DestProperty : InDestTable.GetProperties())
+	{
+		const FProperty* SourceProperty = InSourceTable.FindProperty(DestProperty.Name);
+		if (!SourceProperty || SourceProperty->Type != DestProperty.Type || SourceProperty->Size != DestProperty.Size)
+		{
+			continue;
+		}
+
+		if (DestProperty.Type == EPropertyType::String)
+		{
+			DestProperty.GetValue<FString>(OutDest) = SourceProperty->GetValue<FString>(InSource);
+		}
+		else
+		{
+			memcpy(DestProperty.GetValuePtr(OutDest), SourceProperty->GetValuePtr(InSource), DestProperty.Size);
+		}
+
+		++CopiedCount;
+	}
+
+	return CopiedCount;
+}
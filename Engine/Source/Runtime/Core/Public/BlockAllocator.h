@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @brief 같은 크기의 객체를 청크 단위의 연속된 블록에서 할당하는 고정 크기 할당자
+ * 해제된 블록은 내부 Free List로 재사용되며, 청크는 할당자가 소멸될 때 한꺼번에 반환된다
+ * 대량 생성 시 ReserveContiguous를 호출하면 이후 N개의 할당이 하나의 청크에서 연속적으로 이루어진다
+ * @param BlockSize 블록 하나의 크기 (정렬 단위로 올림)
+ * @param BlockAlignment 블록 정렬 단위
+ * @param BlocksPerChunk 기본 청크 하나에 담기는 블록 수
+ */
+class FFixedBlockAllocator
+{
+public:
+	FFixedBlockAllocator(size_t InBlockSize, size_t InBlockAlignment, uint32 InBlocksPerChunk = 256);
+	~FFixedBlockAllocator();
+
+	FFixedBlockAllocator(const FFixedBlockAllocator&) = delete;
+	FFixedBlockAllocator& operator=(const FFixedBlockAllocator&) = delete;
+
+	void* Allocate();
+	void Free(void* InMemory);
+
+	void ReserveContiguous(uint32 InCount);
+
+	// Getter
+	size_t GetBlockSize() const { return BlockSize; }
+	uint32 GetNumAllocatedBlocks() const { return NumAllocatedBlocks; }
+	uint32 GetNumChunks() const { return static_cast<uint32>(Chunks.Num()); }
+
+private:
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	void AllocateChunk(uint32 InBlockCount);
+
+	size_t BlockSize;
+	size_t BlockAlignment;
+	uint32 BlocksPerChunk;
+
+	TArray<void*> Chunks;
+	uint8* ChunkCursor = nullptr;
+	uint8* ChunkEnd = nullptr;
+	FFreeBlock* FreeList = nullptr;
+
+	// ReserveContiguous 이후 Free List를 건너뛰고 청크에서 연속 할당해야 하는 남은 블록 수
+	uint32 PendingContiguousCount = 0;
+	uint32 NumAllocatedBlocks = 0;
+};
+
+/**
+ * @brief 클래스 전용 operator new / delete를 고정 크기 블록 할당자로 연결하는 매크로
+ * 정확히 해당 클래스 크기의 할당만 블록 할당자를 사용하며, 파생 클래스처럼 크기가 다르면 전역 할당자로 폴백한다
+ * 할당자는 일부러 소멸시키지 않는다 (정적 객체 소멸 순서와 무관하게 종료 중의 늦은 delete도 안전, 청크는 프로세스 종료 시 OS가 회수)
+ */
+#define DECLARE_BLOCK_ALLOCATED_CLASS(ClassName) \
+public: \
+    static void* operator new(size_t InSize); \
+    static void operator delete(void* InMemory, size_t InSize) noexcept; \
+    static FFixedBlockAllocator& GetBlockAllocator();
+
+#define IMPLEMENT_BLOCK_ALLOCATED_CLASS(ClassName, BlocksPerChunk) \
+    FFixedBlockAllocator& ClassName::GetBlockAllocator() \
+    { \
+        static FFixedBlockAllocator* Allocator = new FFixedBlockAllocator(sizeof(ClassName), alignof(ClassName), BlocksPerChunk); \
+        return *Allocator; \
+    } \
+    void* ClassName::operator new(size_t InSize) \
+    { \
+        if (InSize == sizeof(ClassName)) \
+        { \
+            return GetBlockAllocator().Allocate(); \
+        } \
+        return ::operator new(InSize); \
+    } \
+    void ClassName::operator delete(void* InMemory, size_t InSize) noexcept \
+    { \
+        if (InSize == sizeof(ClassName)) \
+        { \
+            GetBlockAllocator().Free(InMemory); \
+            return; \
+        } \
+        ::operator delete(InMemory); \
+    }
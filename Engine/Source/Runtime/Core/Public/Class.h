@@ -4,6 +4,7 @@
 
 class UObject;
 class UClass;
+class FPropertyTable;
 
 /**
  * @brief UClass Metadata System
@@ -12,6 +13,7 @@ class UClass;
  * @param SuperClass 부모 클래스
  * @param ClassSize 클래스 크기
  * @param Constructor 생성자 함수 포인터
+ * @param PropertyTable 직렬화 대상 프로퍼티 테이블 (선언하지 않은 클래스는 nullptr)
  */
 class UClass
 {
@@ -35,6 +37,10 @@ public:
 	size_t GetClassSize() const { return ClassSize; }
 	uint32 GetNextGenNumber() const { return NextGenNumber; }
 	void IncrementGenNumber() { ++NextGenNumber; }
+	const FPropertyTable* GetPropertyTable() const;
+
+	// Setter
+	void SetPropertyTable(const FPropertyTable* InPropertyTable) { PropertyTable = InPropertyTable; }
 
 private:
 	FName ClassName;
@@ -42,6 +48,7 @@ private:
 	size_t ClassSize;
 	ClassConstructorType Constructor;
 	uint32 NextGenNumber = 0;
+	const FPropertyTable* PropertyTable = nullptr;
 
 	// Class Registry
 	static TArray<TObjectPtr<UClass>> AllClasses;
@@ -73,8 +80,8 @@ public: \
 private: \
     static TObjectPtr<UClass> ClassPrivate;
 
-// 클래스 구현부에 사용하는 매크로
-#define IMPLEMENT_CLASS(ClassName, SuperClassName) \
+// 클래스 구현부 공통 매크로 (RegisterStatement는 UClass 생성 직후, 등록 전에 ClassPrivate를 대상으로 실행됨)
+#define IMPLEMENT_CLASS_WITH_REGISTRATION(ClassName, SuperClassName, RegisterStatement) \
     TObjectPtr<UClass> ClassName::ClassPrivate = nullptr; \
     TObjectPtr<UClass> ClassName::StaticClass() \
     { \
@@ -86,6 +93,7 @@ private: \
                 sizeof(ClassName), \
                 &ClassName::CreateDefaultObject##ClassName \
             )); \
+            RegisterStatement \
             UClass::SignUpClass(ClassPrivate); \
         } \
         return ClassPrivate; \
@@ -103,6 +111,16 @@ private: \
         return ClassName::StaticClass()->GetNextGenNumber(); \
     }
 
+// 클래스 구현부에 사용하는 매크로
+#define IMPLEMENT_CLASS(ClassName, SuperClassName) \
+    IMPLEMENT_CLASS_WITH_REGISTRATION(ClassName, SuperClassName, )
+
+// 프로퍼티 테이블(DECLARE_PROPERTY_TABLE)을 선언한 클래스의 구현부에 사용하는 매크로
+// IMPLEMENT_CLASS와 같은 구현에 테이블 연결만 더하므로 두 매크로의 UClass 생성 방식은 항상 같다
+#define IMPLEMENT_CLASS_WITH_PROPERTIES(ClassName, SuperClassName) \
+    IMPLEMENT_CLASS_WITH_REGISTRATION(ClassName, SuperClassName, \
+        ClassPrivate->SetPropertyTable(&ClassName::StaticPropertyTable());)
+
 /**
  * @brief 싱글톤 클래스용 RTTI 매크로 시스템
  *
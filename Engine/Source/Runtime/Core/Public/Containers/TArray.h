@@ -1,13 +1,31 @@
 #pragma once
+#include "TInlineAllocator.h"
 
 using std::vector;
 using std::allocator;
 using std::initializer_list;
 using std::is_trivially_constructible_v;
 
+/**
+ * @brief TArray의 할당자 타입으로부터 실제 저장소 타입을 결정하는 트레잇
+ * std 할당자는 vector를, TInlineAllocator는 인라인 버퍼를 가진 저장소를 사용한다
+ */
+template<typename T, typename AllocatorType>
+struct TArrayStorage
+{
+    using Type = vector<T, AllocatorType>;
+};
+
+template<typename T, uint32 NumInlineElements>
+struct TArrayStorage<T, TInlineAllocator<NumInlineElements>>
+{
+    using Type = typename TInlineAllocator<NumInlineElements>::template ForElementType<T>;
+};
+
 /**
  * @brief 언리얼 엔진 스타일의 동적 배열 컨테이너
  * 언리얼 호환성을 위하여 vector를 대체할 목적으로 추가 구현
+ * 두 번째 템플릿 인자로 TInlineAllocator<N>을 넘기면 N개까지는 힙 할당 없이 객체 내부에 저장된다
  */
 template<typename T, typename AllocatorType = allocator<T>>
 class TArray
@@ -17,10 +35,11 @@ public:
     using ElementType = T;
     using SizeType = int32;
     using IndexType = int32;
-    using Iterator = typename vector<T, AllocatorType>::iterator;
-    using ConstIterator = typename vector<T, AllocatorType>::const_iterator;
-    using ReverseIterator = typename vector<T, AllocatorType>::reverse_iterator;
-    using ConstReverseIterator = typename vector<T, AllocatorType>::const_reverse_iterator;
+    using StorageType = typename TArrayStorage<T, AllocatorType>::Type;
+    using Iterator = typename StorageType::iterator;
+    using ConstIterator = typename StorageType::const_iterator;
+    using ReverseIterator = typename StorageType::reverse_iterator;
+    using ConstReverseIterator = typename StorageType::const_reverse_iterator;
 
     // Constructors
     TArray() = default;
@@ -137,12 +156,13 @@ public:
         }
     }
 
+    // 원소만 비우고 메모리는 유지 (NewSize는 원소 수가 아닌 최소 여유 공간)
     void Reset(SizeType NewSize = 0)
     {
         Data.clear();
         if (NewSize > 0)
         {
-            Data.resize(static_cast<size_t>(NewSize));
+            Data.reserve(static_cast<size_t>(NewSize));
         }
     }
 
@@ -439,7 +459,7 @@ public:
 
     ElementType Pop(bool bAllowShrinking)
     {
-        ElementType Result = move(Data.back());
+        ElementType Result = std::move(Data.back());
         Data.pop_back();
         if (bAllowShrinking)
         {
@@ -600,13 +620,13 @@ public:
     ConstReverseIterator rend() const { return Data.rend(); }
     ConstReverseIterator crend() const { return Data.crend(); }
 
-    // Conversion to STL
-    const vector<T, AllocatorType>& ToStdVector() const
+    // Conversion to STL (TInlineAllocator를 사용하는 경우 vector 호환 저장소를 반환)
+    const StorageType& ToStdVector() const
     {
         return Data;
     }
 
-    vector<T, AllocatorType>& ToStdVector()
+    StorageType& ToStdVector()
     {
         return Data;
     }
@@ -623,7 +643,7 @@ public:
     }
 
 private:
-	vector<T, AllocatorType> Data;
+	StorageType Data;
     static constexpr IndexType INDEX_NONE = -1;
 };
 
@@ -0,0 +1,66 @@
+#pragma once
+#include "TArray.h"
+
+/**
+ * @brief 연속된 메모리 구간을 소유하지 않고 참조하는 경량 뷰 클래스
+ * 언리얼 엔진의 TArrayView를 프로젝트 상황에 맞게 로컬라이징한 버전
+ * 원본 배열의 생명주기가 뷰보다 길어야 한다
+ */
+template <typename T>
+class TArrayView
+{
+public:
+	using ElementType = T;
+	using SizeType = int32;
+	using IndexType = int32;
+
+	TArrayView() = default;
+
+	TArrayView(ElementType* InData, SizeType InNum)
+		: DataPtr(InData), ArrayNum(InNum)
+	{
+	}
+
+	template <typename OtherElementType, typename AllocatorType,
+	          typename = std::enable_if_t<std::is_convertible_v<OtherElementType*, ElementType*>>>
+	TArrayView(TArray<OtherElementType, AllocatorType>& InArray)
+		: DataPtr(InArray.GetData()), ArrayNum(InArray.Num())
+	{
+	}
+
+	template <typename OtherElementType, typename AllocatorType,
+	          typename = std::enable_if_t<std::is_convertible_v<const OtherElementType*, ElementType*>>>
+	TArrayView(const TArray<OtherElementType, AllocatorType>& InArray)
+		: DataPtr(InArray.GetData()), ArrayNum(InArray.Num())
+	{
+	}
+
+	ElementType& operator[](IndexType Index) const
+	{
+		assert(IsValidIndex(Index));
+		return DataPtr[Index];
+	}
+
+	ElementType* GetData() const { return DataPtr; }
+	SizeType Num() const { return ArrayNum; }
+	bool IsEmpty() const { return ArrayNum == 0; }
+	bool IsValidIndex(IndexType Index) const { return Index >= 0 && Index < ArrayNum; }
+
+	/**
+	 * @brief 뷰의 일부 구간만 참조하는 새 뷰를 반환하는 함수
+	 * @param InIndex 시작 인덱스
+	 * @param InCount 구간 길이
+	 */
+	TArrayView Slice(IndexType InIndex, SizeType InCount) const
+	{
+		assert(InIndex >= 0 && InCount >= 0 && InIndex + InCount <= ArrayNum);
+		return TArrayView(DataPtr + InIndex, InCount);
+	}
+
+	ElementType* begin() const { return DataPtr; }
+	ElementType* end() const { return DataPtr + ArrayNum; }
+
+private:
+	ElementType* DataPtr = nullptr;
+	SizeType ArrayNum = 0;
+};
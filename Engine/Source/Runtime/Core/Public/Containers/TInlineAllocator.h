@@ -0,0 +1,429 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <iterator>
+#include <initializer_list>
+
+/**
+ * @brief 처음 NumInlineElements개의 원소를 배열 객체 내부에 저장하는 TArray용 할당자
+ * 언리얼 엔진의 TInlineAllocator를 프로젝트 상황에 맞게 로컬라이징한 버전
+ * 원소 수가 인라인 용량을 넘어서는 순간에만 힙으로 옮겨가므로, 매 프레임 생성되는 작은 임시 배열의 힙 할당을 없앨 수 있다
+ *
+ * 사용 예시)
+ *	TArray<USceneComponent*, TInlineAllocator<8>> Components;
+ *
+ * @param NumInlineElements 힙 할당 없이 저장할 수 있는 원소 수
+ */
+template <uint32 NumInlineElements>
+class TInlineAllocator
+{
+	static_assert(NumInlineElements > 0, "TInlineAllocator의 인라인 원소 수는 1 이상이어야 합니다");
+
+public:
+	/**
+	 * @brief TArray가 내부 저장소로 사용하는 std::vector 호환 컨테이너
+	 * TArray가 사용하는 vector 인터페이스만 구현하며, 반복자는 원시 포인터이다
+	 * 힙 포인터가 nullptr이면 인라인 버퍼를 사용 중인 상태로, 객체 내부에 자기 자신을 가리키는 포인터를 두지 않으므로
+	 * 배열 객체가 이동되어도 별도의 포인터 보정이 필요 없다
+	 */
+	template <typename T>
+	class ForElementType
+	{
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		ForElementType() = default;
+
+		explicit ForElementType(size_t InCount)
+		{
+			resize(InCount);
+		}
+
+		ForElementType(size_t InCount, const T& InValue)
+		{
+			resize(InCount, InValue);
+		}
+
+		ForElementType(std::initializer_list<T> InList)
+			: ForElementType(InList.begin(), InList.end())
+		{
+		}
+
+		template <typename InputIterator,
+		          typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+		ForElementType(InputIterator InFirst, InputIterator InLast)
+		{
+			insert(end(), InFirst, InLast);
+		}
+
+		ForElementType(const ForElementType& InOther)
+			: ForElementType(InOther.begin(), InOther.end())
+		{
+		}
+
+		ForElementType(ForElementType&& InOther) noexcept
+		{
+			MoveFrom(InOther);
+		}
+
+		~ForElementType()
+		{
+			DestroyRange(data(), data() + Size);
+			FreeHeap();
+		}
+
+		ForElementType& operator=(const ForElementType& InOther)
+		{
+			if (this != &InOther)
+			{
+				clear();
+				insert(end(), InOther.begin(), InOther.end());
+			}
+			return *this;
+		}
+
+		ForElementType& operator=(ForElementType&& InOther) noexcept
+		{
+			if (this != &InOther)
+			{
+				DestroyRange(data(), data() + Size);
+				FreeHeap();
+				Size = 0;
+				MoveFrom(InOther);
+			}
+			return *this;
+		}
+
+		// Element access
+		T* data() { return HeapData ? HeapData : GetInlineData(); }
+		const T* data() const { return HeapData ? HeapData : GetInlineData(); }
+
+		T& operator[](size_t InIndex) { return data()[InIndex]; }
+		const T& operator[](size_t InIndex) const { return data()[InIndex]; }
+
+		T& back() { return data()[Size - 1]; }
+		const T& back() const { return data()[Size - 1]; }
+
+		// Size and capacity
+		size_t size() const { return Size; }
+		size_t capacity() const { return Capacity; }
+		bool empty() const { return Size == 0; }
+
+		/**
+		 * @brief 인라인 버퍼를 사용 중인지 여부
+		 */
+		bool IsInline() const { return HeapData == nullptr; }
+
+		void reserve(size_t InCapacity)
+		{
+			if (InCapacity > Capacity)
+			{
+				Reallocate(InCapacity);
+			}
+		}
+
+		/**
+		 * @brief 여유 공간을 반환하는 함수
+		 * 원소 수가 인라인 용량 이하로 줄었다면 인라인 버퍼로 되돌아간다
+		 */
+		void shrink_to_fit()
+		{
+			if (HeapData && Size < Capacity)
+			{
+				Reallocate(Size);
+			}
+		}
+
+		void clear()
+		{
+			DestroyRange(data(), data() + Size);
+			Size = 0;
+		}
+
+		void resize(size_t InCount)
+		{
+			if (InCount < Size)
+			{
+				DestroyRange(data() + InCount, data() + Size);
+				Size = InCount;
+				return;
+			}
+
+			reserve(InCount);
+			for (; Size < InCount; ++Size)
+			{
+				new(data() + Size) T();
+			}
+		}
+
+		void resize(size_t InCount, const T& InValue)
+		{
+			if (InCount < Size)
+			{
+				DestroyRange(data() + InCount, data() + Size);
+				Size = InCount;
+				return;
+			}
+
+			if (InCount > Capacity)
+			{
+				// InValue가 자기 자신의 원소일 수 있으므로 재할당 전에 복사해 둔다
+				T Value(InValue);
+				reserve(InCount);
+				for (; Size < InCount; ++Size)
+				{
+					new(data() + Size) T(Value);
+				}
+				return;
+			}
+
+			for (; Size < InCount; ++Size)
+			{
+				new(data() + Size) T(InValue);
+			}
+		}
+
+		// Modifiers
+		void push_back(const T& InValue) { emplace_back(InValue); }
+		void push_back(T&& InValue) { emplace_back(std::move(InValue)); }
+
+		template <typename... ArgsType>
+		T& emplace_back(ArgsType&&... Args)
+		{
+			if (Size == Capacity)
+			{
+				// 인자가 기존 원소를 참조할 수 있으므로 새 버퍼에 먼저 생성한 뒤 기존 원소를 옮긴다
+				const size_t NewCapacity = GetGrowCapacity(Size + 1);
+				T* NewData = AllocateHeap(NewCapacity);
+				new(NewData + Size) T(std::forward<ArgsType>(Args)...);
+				RelocateTo(NewData, NewCapacity);
+			}
+			else
+			{
+				new(data() + Size) T(std::forward<ArgsType>(Args)...);
+			}
+
+			++Size;
+			return back();
+		}
+
+		template <typename... ArgsType>
+		iterator emplace(const_iterator InPosition, ArgsType&&... Args)
+		{
+			const size_t Index = static_cast<size_t>(InPosition - data());
+			emplace_back(std::forward<ArgsType>(Args)...);
+			std::rotate(data() + Index, data() + Size - 1, data() + Size);
+			return data() + Index;
+		}
+
+		iterator insert(const_iterator InPosition, const T& InValue)
+		{
+			return emplace(InPosition, InValue);
+		}
+
+		iterator insert(const_iterator InPosition, T&& InValue)
+		{
+			return emplace(InPosition, std::move(InValue));
+		}
+
+		template <typename InputIterator,
+		          typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+		iterator insert(const_iterator InPosition, InputIterator InFirst, InputIterator InLast)
+		{
+			const size_t Index = static_cast<size_t>(InPosition - data());
+			const size_t OldSize = Size;
+
+			if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+			                                typename std::iterator_traits<InputIterator>::iterator_category>)
+			{
+				reserve(Size + static_cast<size_t>(std::distance(InFirst, InLast)));
+			}
+
+			for (; InFirst != InLast; ++InFirst)
+			{
+				emplace_back(*InFirst);
+			}
+
+			std::rotate(data() + Index, data() + OldSize, data() + Size);
+			return data() + Index;
+		}
+
+		iterator insert(const_iterator InPosition, std::initializer_list<T> InList)
+		{
+			return insert(InPosition, InList.begin(), InList.end());
+		}
+
+		iterator erase(const_iterator InPosition)
+		{
+			return erase(InPosition, InPosition + 1);
+		}
+
+		iterator erase(const_iterator InFirst, const_iterator InLast)
+		{
+			T* First = data() + (InFirst - data());
+			T* Last = data() + (InLast - data());
+			if (First != Last)
+			{
+				T* NewEnd = std::move(Last, data() + Size, First);
+				DestroyRange(NewEnd, data() + Size);
+				Size = static_cast<size_t>(NewEnd - data());
+			}
+			return First;
+		}
+
+		void pop_back()
+		{
+			--Size;
+			data()[Size].~T();
+		}
+
+		void swap(ForElementType& InOther) noexcept
+		{
+			ForElementType Temp(std::move(InOther));
+			InOther = std::move(*this);
+			*this = std::move(Temp);
+		}
+
+		// Iterators
+		iterator begin() { return data(); }
+		const_iterator begin() const { return data(); }
+		const_iterator cbegin() const { return data(); }
+		iterator end() { return data() + Size; }
+		const_iterator end() const { return data() + Size; }
+		const_iterator cend() const { return data() + Size; }
+
+		reverse_iterator rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+		const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+		const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+		bool operator==(const ForElementType& InOther) const
+		{
+			return Size == InOther.Size && std::equal(begin(), end(), InOther.begin());
+		}
+
+		bool operator!=(const ForElementType& InOther) const
+		{
+			return !(*this == InOther);
+		}
+
+	private:
+		T* GetInlineData() { return reinterpret_cast<T*>(InlineData); }
+		const T* GetInlineData() const { return reinterpret_cast<const T*>(InlineData); }
+
+		static T* AllocateHeap(size_t InCapacity)
+		{
+			return std::allocator<T>().allocate(InCapacity);
+		}
+
+		void FreeHeap()
+		{
+			if (HeapData)
+			{
+				std::allocator<T>().deallocate(HeapData, Capacity);
+				HeapData = nullptr;
+			}
+			Capacity = NumInlineElements;
+		}
+
+		static void DestroyRange(T* InFirst, T* InLast)
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (; InFirst != InLast; ++InFirst)
+				{
+					InFirst->~T();
+				}
+			}
+		}
+
+		size_t GetGrowCapacity(size_t InRequired) const
+		{
+			return std::max(InRequired, Capacity * 2);
+		}
+
+		/**
+		 * @brief 기존 원소를 새 버퍼로 옮기고 이전 힙 버퍼를 반환하는 함수
+		 * @param InNewData 새 버퍼 (nullptr이면 인라인 버퍼)
+		 * @param InNewCapacity 새 버퍼의 용량
+		 */
+		void RelocateTo(T* InNewData, size_t InNewCapacity)
+		{
+			T* OldData = data();
+			T* Destination = InNewData ? InNewData : GetInlineData();
+
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				if (Size > 0)
+				{
+					memcpy(static_cast<void*>(Destination), OldData, Size * sizeof(T));
+				}
+			}
+			else
+			{
+				for (size_t Index = 0; Index < Size; ++Index)
+				{
+					new(Destination + Index) T(std::move(OldData[Index]));
+					OldData[Index].~T();
+				}
+			}
+
+			FreeHeap();
+			HeapData = InNewData;
+			Capacity = InNewData ? InNewCapacity : NumInlineElements;
+		}
+
+		void Reallocate(size_t InNewCapacity)
+		{
+			if (InNewCapacity <= NumInlineElements)
+			{
+				if (HeapData)
+				{
+					RelocateTo(nullptr, NumInlineElements);
+				}
+				return;
+			}
+
+			RelocateTo(AllocateHeap(InNewCapacity), InNewCapacity);
+		}
+
+		/**
+		 * @brief 다른 컨테이너의 원소를 이동하는 함수 (this는 비어있는 상태여야 함)
+		 * 힙을 사용 중이라면 버퍼를 그대로 가져오고, 인라인이라면 원소 단위로 이동한다
+		 */
+		void MoveFrom(ForElementType& InOther)
+		{
+			if (InOther.HeapData)
+			{
+				HeapData = InOther.HeapData;
+				Capacity = InOther.Capacity;
+				Size = InOther.Size;
+
+				InOther.HeapData = nullptr;
+				InOther.Capacity = NumInlineElements;
+				InOther.Size = 0;
+				return;
+			}
+
+			for (size_t Index = 0; Index < InOther.Size; ++Index)
+			{
+				new(GetInlineData() + Index) T(std::move(InOther.GetInlineData()[Index]));
+			}
+			Size = InOther.Size;
+			InOther.clear();
+		}
+
+		alignas(T) uint8 InlineData[sizeof(T) * NumInlineElements];
+		T* HeapData = nullptr;
+		size_t Size = 0;
+		size_t Capacity = NumInlineElements;
+	};
+};
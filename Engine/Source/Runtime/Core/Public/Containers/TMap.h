@@ -2,6 +2,8 @@
 
 #include <unordered_map>
 #include <functional>
+#include <tuple>
+#include "TRobinHoodHashTable.h"
 
 using std::unordered_map;
 using std::hash;
@@ -9,9 +11,28 @@ using std::equal_to;
 using std::allocator;
 using std::pair;
 
+/**
+ * @brief TMap 원소(키-값 쌍)에서 키를 꺼내는 정책
+ */
+template<typename KeyType, typename ValueType>
+struct TDefaultMapKeyFuncs
+{
+    static const KeyType& GetKey(const pair<const KeyType, ValueType>& InPair)
+    {
+        return InPair.first;
+    }
+};
+
 /**
  * @brief 언리얼 엔진 스타일의 키-값 맵 컨테이너
- * 언리얼 호환성을 위하여 unordered_map을 대체할 목적으로 구현
+ * 원소를 노드 단위로 할당하는 unordered_map 대신 TRobinHoodHashTable 위에 구현하여
+ * 키-값 쌍이 하나의 연속된 슬롯 배열에 저장된다
+ * 원소의 키는 const이므로 순회 중에도 수정할 수 없다 (슬롯 이동 시 키는 복사된다)
+ * @note Robin Hood 삽입과 Backward Shift 삭제가 다른 원소를 옮기므로, Find / operator[] / Add가 반환한
+ * 값의 포인터와 참조는 같은 맵에 대한 다음 삽입(Add / Emplace / FindOrAdd / operator[]) 또는 삭제 전까지만 유효하다
+ * 값을 오래 들고 있어야 한다면 값 자체(또는 값이 가리키는 객체 포인터)를 복사해 둔다
+ * @param HasherType, KeyEqualType 둘 다 is_transparent를 정의하면 KeyType이 아닌 값으로도 Find / Contains를 호출할 수 있다
+ * @param AllocatorType 기존 선언과의 호환을 위해 남겨둔 인자로, 슬롯 배열은 std::allocator로 할당된다
  */
 template<typename KeyType, typename ValueType, typename HasherType = hash<KeyType>, typename KeyEqualType = equal_to<KeyType>, typename AllocatorType = allocator<pair<const KeyType, ValueType>>>
 class TMap
@@ -22,20 +43,25 @@ public:
     using KeyInitType = KeyType;
     using ValueInitType = ValueType;
     using SizeType = int32;
-    using Iterator = typename unordered_map<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType>::iterator;
-    using ConstIterator = typename unordered_map<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType>::const_iterator;
+    using HashTableType = TRobinHoodHashTable<ElementType, KeyType, TDefaultMapKeyFuncs<KeyType, ValueType>, HasherType, KeyEqualType>;
+    using Iterator = typename HashTableType::Iterator;
+    using ConstIterator = typename HashTableType::ConstIterator;
 
     // Constructors
     TMap() = default;
 
     explicit TMap(SizeType ExpectedNumElements)
-        : Data(static_cast<size_t>(ExpectedNumElements))
     {
+        Data.Reserve(static_cast<size_t>(ExpectedNumElements));
     }
 
     TMap(std::initializer_list<ElementType> InitList)
-        : Data(InitList)
     {
+        Data.Reserve(InitList.size());
+        for (const ElementType& Element : InitList)
+        {
+            Add(Element.first, Element.second);
+        }
     }
 
     // Copy and Move constructors/assignments
@@ -50,12 +76,27 @@ public:
     // Element access
     ValueType& operator[](const KeyType& Key)
     {
-        return Data[Key];
+        return FindOrAdd(Key);
     }
 
     ValueType& operator[](KeyType&& Key)
     {
-        return Data[std::move(Key)];
+        return FindOrAdd(std::move(Key));
+    }
+
+    /**
+     * @brief 키에 해당하는 값을 찾고, 없다면 기본값으로 추가한 뒤 반환 (언리얼 스타일)
+     */
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        auto [Index, bInserted] = Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(Key), std::tuple<>());
+        return Data.GetElement(Index).second;
+    }
+
+    ValueType& FindOrAdd(KeyType&& Key)
+    {
+        auto [Index, bInserted] = Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(std::move(Key)), std::tuple<>());
+        return Data.GetElement(Index).second;
     }
 
     /**
@@ -65,14 +106,46 @@ public:
      */
     ValueType* Find(const KeyType& Key)
     {
-        auto It = Data.find(Key);
-        return (It != Data.end()) ? &It->second : nullptr;
+        return GetValuePtr(Data.FindIndex(Key));
     }
 
     const ValueType* Find(const KeyType& Key) const
     {
-        auto It = Data.find(Key);
-        return (It != Data.end()) ? &It->second : nullptr;
+        return GetValuePtr(Data.FindIndex(Key));
+    }
+
+    /**
+     * @brief KeyType으로 변환하지 않고 값을 찾는 함수 (투명 해셔 / 비교자를 사용할 때만 활성화)
+     */
+    template<typename ComparableKeyType, typename = TEnableIfTransparentLookup<HasherType, KeyEqualType, ComparableKeyType>>
+    ValueType* Find(const ComparableKeyType& Key)
+    {
+        return GetValuePtr(Data.FindIndex(Key));
+    }
+
+    template<typename ComparableKeyType, typename = TEnableIfTransparentLookup<HasherType, KeyEqualType, ComparableKeyType>>
+    const ValueType* Find(const ComparableKeyType& Key) const
+    {
+        return GetValuePtr(Data.FindIndex(Key));
+    }
+
+    /**
+     * @brief 미리 계산된 해시 값으로 값을 찾는 함수 (언리얼 스타일)
+     * KeyHash는 HasherType이 같은 키에 대해 반환하는 값과 같아야 하며, Key는 KeyType과 == 비교가 가능하면 된다
+     * @param KeyHash 키의 해시 값
+     * @param Key 비교에 사용할 키
+     * @return 값에 대한 포인터 (없으면 nullptr)
+     */
+    template<typename ComparableKeyType>
+    ValueType* FindByHash(size_t KeyHash, const ComparableKeyType& Key)
+    {
+        return GetValuePtr(Data.FindIndexByHash(KeyHash, Key));
+    }
+
+    template<typename ComparableKeyType>
+    const ValueType* FindByHash(size_t KeyHash, const ComparableKeyType& Key) const
+    {
+        return GetValuePtr(Data.FindIndexByHash(KeyHash, Key));
     }
 
     /**
@@ -83,8 +156,8 @@ public:
      */
     ValueType FindRef(const KeyType& Key, const ValueType& DefaultValue = ValueType{}) const
     {
-        auto It = Data.find(Key);
-        return (It != Data.end()) ? It->second : DefaultValue;
+        const ValueType* Value = Find(Key);
+        return Value ? *Value : DefaultValue;
     }
 
     /**
@@ -92,94 +165,125 @@ public:
      */
     bool Contains(const KeyType& Key) const
     {
-        return Data.find(Key) != Data.end();
+        return Data.FindIndex(Key) != HashTableType::INDEX_NONE;
+    }
+
+    template<typename ComparableKeyType, typename = TEnableIfTransparentLookup<HasherType, KeyEqualType, ComparableKeyType>>
+    bool Contains(const ComparableKeyType& Key) const
+    {
+        return Data.FindIndex(Key) != HashTableType::INDEX_NONE;
     }
 
     // Size and capacity
     SizeType Num() const
     {
-        return static_cast<SizeType>(Data.size());
+        return Data.Num();
     }
 
     bool IsEmpty() const
     {
-        return Data.empty();
+        return Data.IsEmpty();
+    }
+
+    /**
+     * @brief 현재 할당된 슬롯 수 (원소 수가 아님)
+     */
+    SizeType GetCapacity() const
+    {
+        return Data.GetCapacity();
     }
 
     // Modifiers
+    /**
+     * @brief 모든 원소를 제거하고 메모리를 반환 (ExpectedNumElements가 있다면 그만큼 다시 확보)
+     */
     void Empty(SizeType ExpectedNumElements = 0)
     {
-        Data.clear();
+        Data.Release();
         if (ExpectedNumElements > 0)
         {
-            Data.reserve(static_cast<size_t>(ExpectedNumElements));
+            Data.Reserve(static_cast<size_t>(ExpectedNumElements));
         }
     }
 
+    /**
+     * @brief 슬롯 메모리는 유지한 채 모든 원소를 제거
+     */
     void Reset()
     {
-        Data.clear();
+        Data.Clear();
     }
 
     void Shrink()
     {
-        Data.rehash(0);
+        Data.Rehash(0);
     }
 
     void Reserve(SizeType Number)
     {
-        Data.reserve(static_cast<size_t>(Number));
+        Data.Reserve(static_cast<size_t>(Number));
+    }
+
+    /**
+     * @brief 슬롯 수를 직접 지정해 재해시
+     * @param NumSlots 원하는 슬롯 수 (2의 거듭제곱으로 올림되며, 현재 원소를 담을 수 있는 크기 미만으로는 줄지 않음)
+     */
+    void Rehash(SizeType NumSlots)
+    {
+        Data.Rehash(static_cast<size_t>(NumSlots));
     }
 
     /**
      * @brief 키-값 쌍을 추가 (언리얼 스타일)
+     * 이미 키가 존재한다면 값을 덮어쓴다
      * @param Key 추가할 키
      * @param Value 추가할 값
      * @return 추가된 값에 대한 참조
      */
     ValueType& Add(const KeyType& Key, const ValueType& Value)
     {
-        return Data[Key] = Value;
+        return AddImpl(Key, Key, Value);
     }
 
     ValueType& Add(const KeyType& Key, ValueType&& Value)
     {
-        return Data[Key] = std::move(Value);
+        return AddImpl(Key, Key, std::move(Value));
     }
 
     ValueType& Add(KeyType&& Key, const ValueType& Value)
     {
-        return Data[std::move(Key)] = Value;
+        return AddImpl(Key, std::move(Key), Value);
     }
 
     ValueType& Add(KeyType&& Key, ValueType&& Value)
     {
-        return Data[std::move(Key)] = std::move(Value);
+        return AddImpl(Key, std::move(Key), std::move(Value));
     }
 
     /**
      * @brief 키-값 쌍을 안전하게 추가 (언리얼 스타일)
+     * 이미 키가 존재한다면 기존 값을 유지한다
      * @param Key 추가할 키
      * @param Value 추가할 값
      * @return 추가된 값에 대한 참조
      */
     ValueType& Emplace(const KeyType& Key, const ValueType& Value)
     {
-        auto [It, bInserted] = Data.emplace(Key, Value);
-        return It->second;
+        auto [Index, bInserted] = Data.FindOrEmplace(Key, Key, Value);
+        return Data.GetElement(Index).second;
     }
 
     ValueType& Emplace(KeyType&& Key, ValueType&& Value)
     {
-        auto [It, bInserted] = Data.emplace(std::move(Key), std::move(Value));
-        return It->second;
+        auto [Index, bInserted] = Data.FindOrEmplace(Key, std::move(Key), std::move(Value));
+        return Data.GetElement(Index).second;
     }
 
     template<typename... ArgsType>
     ValueType& Emplace(const KeyType& Key, ArgsType&&... Args)
     {
-        auto [It, bInserted] = Data.emplace(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<ArgsType>(Args)...));
-        return It->second;
+        auto [Index, bInserted] = Data.FindOrEmplace(Key, std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<ArgsType>(Args)...));
+        return Data.GetElement(Index).second;
     }
 
     /**
@@ -189,7 +293,7 @@ public:
      */
     SizeType Remove(const KeyType& Key)
     {
-        return static_cast<SizeType>(Data.erase(Key));
+        return Data.Remove(Key);
     }
 
     /**
@@ -200,11 +304,11 @@ public:
      */
     bool RemoveAndCopyValue(const KeyType& Key, ValueType& OutValue)
     {
-        auto It = Data.find(Key);
-        if (It != Data.end())
+        const size_t Index = Data.FindIndex(Key);
+        if (Index != HashTableType::INDEX_NONE)
         {
-            OutValue = It->second;
-            Data.erase(It);
+            OutValue = std::move(Data.GetElement(Index).second);
+            Data.RemoveAtIndex(Index);
             return true;
         }
         return false;
@@ -242,7 +346,29 @@ public:
     }
 
 private:
-    unordered_map<KeyType, ValueType, HasherType, KeyEqualType, AllocatorType> Data;
+    ValueType* GetValuePtr(size_t Index)
+    {
+        return Index != HashTableType::INDEX_NONE ? &Data.GetElement(Index).second : nullptr;
+    }
+
+    const ValueType* GetValuePtr(size_t Index) const
+    {
+        return Index != HashTableType::INDEX_NONE ? &Data.GetElement(Index).second : nullptr;
+    }
+
+    template<typename KeyArgType, typename ValueArgType>
+    ValueType& AddImpl(const KeyType& LookupKey, KeyArgType&& Key, ValueArgType&& Value)
+    {
+        auto [Index, bInserted] = Data.FindOrEmplace(LookupKey, std::forward<KeyArgType>(Key), std::forward<ValueArgType>(Value));
+        ValueType& Result = Data.GetElement(Index).second;
+        if (!bInserted)
+        {
+            Result = std::forward<ValueArgType>(Value);
+        }
+        return Result;
+    }
+
+    HashTableType Data;
 };
 
 /**
@@ -0,0 +1,694 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 투명(heterogeneous) 조회를 지원하는 해셔 / 비교자인지 판별하는 트레잇
+ * HasherType과 KeyEqualType 모두 is_transparent를 정의해야 키 타입이 아닌 값으로 조회할 수 있다
+ */
+template <typename T, typename = void>
+struct TIsTransparent : std::false_type
+{
+};
+
+template <typename T>
+struct TIsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type
+{
+};
+
+/**
+ * @brief 투명 조회용 멤버 템플릿을 SFINAE로 활성화하는 별칭
+ * 조회 키 타입에 의존하도록 만들어 두어야 비활성 상태에서도 클래스 인스턴스화가 실패하지 않는다
+ */
+template <typename HasherType, typename KeyEqualType, typename ComparableKeyType>
+using TEnableIfTransparentLookup = std::enable_if_t<TIsTransparent<HasherType>::value && TIsTransparent<KeyEqualType>::value, ComparableKeyType>;
+
+/**
+ * @brief 슬롯 사이에서 원소를 옮기는 정책 (옮긴 뒤 원본은 바로 소멸된다)
+ */
+template <typename ElementType>
+struct TRelocateElement
+{
+    static void Relocate(ElementType* OutDest, ElementType& InSource)
+    {
+        new(OutDest) ElementType(std::move(InSource));
+        InSource.~ElementType();
+    }
+};
+
+/**
+ * @brief pair<const Key, Value> 특수화
+ * const 키는 이동 생성 시 복사되므로(FString이라면 문자열 할당) 곧 소멸할 원본의 키에서 직접 이동한다
+ */
+template <typename KeyType, typename ValueType>
+struct TRelocateElement<std::pair<const KeyType, ValueType>>
+{
+    static void Relocate(std::pair<const KeyType, ValueType>* OutDest, std::pair<const KeyType, ValueType>& InSource)
+    {
+        new(OutDest) std::pair<const KeyType, ValueType>(std::move(const_cast<KeyType&>(InSource.first)),
+                                                         std::move(InSource.second));
+        InSource.~pair();
+    }
+};
+
+/**
+ * @brief TMap / TSet이 공유하는 Robin Hood 방식의 오픈 어드레싱 해시 테이블
+ * 원소를 노드가 아닌 하나의 연속된 슬롯 배열에 저장하므로 삽입 시 원소마다 힙 할당이 발생하지 않고,
+ * 조회는 선형 탐사로 인접 메모리만 확인한다
+ * 각 슬롯은 1바이트 탐사 거리(0 = 빈 슬롯, n = 홈 버킷으로부터 n - 1칸)를 가지며,
+ * 삽입 시 탐사 거리가 더 짧은 원소를 밀어내 클러스터 내 거리 편차를 줄이고 삭제 시 Backward Shift로 툼스톤을 남기지 않는다
+ * @note 삽입(밀어내기 / 재해시)과 삭제(Backward Shift) 모두 다른 원소를 옮기므로,
+ * Find 등으로 얻은 원소 / 값의 포인터와 참조, 반복자는 같은 테이블에 대한 다음 삽입 / 삭제 전까지만 유효하다
+ * 원소는 이동 생성 / 소멸(TRelocateElement)로만 옮기므로 대입이 불가능한 타입(예: pair<const Key, Value>)도 저장할 수 있다
+ * @param ElementType 슬롯에 저장되는 원소 타입
+ * @param KeyFuncs 원소로부터 키를 꺼내는 정책 (static const KeyType& GetKey(const ElementType&))
+ */
+template <typename ElementType, typename KeyType, typename KeyFuncs, typename HasherType, typename KeyEqualType>
+class TRobinHoodHashTable
+{
+public:
+    using SizeType = int32;
+
+    static constexpr size_t INDEX_NONE = static_cast<size_t>(-1);
+
+    /**
+     * @brief 점유된 슬롯만 순회하는 반복자
+     * 점유 패턴은 무작위라 슬롯마다 분기하면 분기 예측이 빗나가므로, 64슬롯 블록의 점유 비트마스크를 한 번에 만들어 두고
+     * 마스크의 최하위 비트를 차례로 꺼낸다 (예측이 어려운 분기는 블록당 한 번)
+     */
+    template <bool bConst>
+    class TBaseIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = ptrdiff_t;
+        using TableType = std::conditional_t<bConst, const TRobinHoodHashTable, TRobinHoodHashTable>;
+        using reference = std::conditional_t<bConst, const ElementType&, ElementType&>;
+        using pointer = std::conditional_t<bConst, const ElementType*, ElementType*>;
+
+        TBaseIterator() = default;
+
+        TBaseIterator(TableType* InTable, size_t InIndex)
+            : Table(InTable), Index(InIndex), BlockStart(InIndex & ~BlockMask)
+        {
+            if (Index < Table->Capacity)
+            {
+                OccupiedMask = Table->GetOccupiedMask(BlockStart) & (~static_cast<uint64>(0) << (Index - BlockStart));
+                SkipEmpty();
+            }
+        }
+
+        // 비 const 반복자에서 const 반복자로의 변환
+        template <bool bOtherConst, typename = std::enable_if_t<bConst && !bOtherConst>>
+        TBaseIterator(const TBaseIterator<bOtherConst>& InOther)
+            : Table(InOther.Table), Index(InOther.Index), BlockStart(InOther.BlockStart),
+              OccupiedMask(InOther.OccupiedMask)
+        {
+        }
+
+        reference operator*() const { return Table->Slots[Index]; }
+        pointer operator->() const { return &Table->Slots[Index]; }
+
+        TBaseIterator& operator++()
+        {
+            OccupiedMask &= OccupiedMask - 1;
+            SkipEmpty();
+            return *this;
+        }
+
+        TBaseIterator operator++(int)
+        {
+            TBaseIterator Temp = *this;
+            ++(*this);
+            return Temp;
+        }
+
+        bool operator==(const TBaseIterator& InOther) const { return Index == InOther.Index; }
+        bool operator!=(const TBaseIterator& InOther) const { return Index != InOther.Index; }
+
+        size_t GetIndex() const { return Index; }
+
+    private:
+        template <bool>
+        friend class TBaseIterator;
+
+        /**
+         * @brief 남은 점유 비트가 없으면 다음 블록으로 넘어가며 다음 점유 슬롯으로 이동하는 함수
+         */
+        void SkipEmpty()
+        {
+            while (OccupiedMask == 0)
+            {
+                BlockStart += BlockSize;
+                if (BlockStart >= Table->Capacity)
+                {
+                    Index = Table->Capacity;
+                    return;
+                }
+                OccupiedMask = Table->GetOccupiedMask(BlockStart);
+            }
+            Index = BlockStart + CountTrailingZeros64(OccupiedMask);
+        }
+
+        static constexpr size_t BlockSize = 64;
+        static constexpr size_t BlockMask = BlockSize - 1;
+
+        TableType* Table = nullptr;
+        size_t Index = 0;
+        size_t BlockStart = 0;
+        uint64 OccupiedMask = 0;
+    };
+
+    using Iterator = TBaseIterator<false>;
+    using ConstIterator = TBaseIterator<true>;
+
+    TRobinHoodHashTable() = default;
+
+    TRobinHoodHashTable(const TRobinHoodHashTable& InOther)
+    {
+        CopyFrom(InOther);
+    }
+
+    TRobinHoodHashTable(TRobinHoodHashTable&& InOther) noexcept
+    {
+        MoveFrom(InOther);
+    }
+
+    TRobinHoodHashTable& operator=(const TRobinHoodHashTable& InOther)
+    {
+        if (this != &InOther)
+        {
+            Release();
+            CopyFrom(InOther);
+        }
+        return *this;
+    }
+
+    TRobinHoodHashTable& operator=(TRobinHoodHashTable&& InOther) noexcept
+    {
+        if (this != &InOther)
+        {
+            Release();
+            MoveFrom(InOther);
+        }
+        return *this;
+    }
+
+    ~TRobinHoodHashTable()
+    {
+        Release();
+    }
+
+    // Size and capacity
+    SizeType Num() const { return static_cast<SizeType>(Size); }
+    bool IsEmpty() const { return Size == 0; }
+
+    /**
+     * @brief 현재 슬롯 수 (항상 0 또는 2의 거듭제곱)
+     */
+    SizeType GetCapacity() const { return static_cast<SizeType>(Capacity); }
+
+    /**
+     * @brief 재해시 없이 InNumElements개를 담을 수 있도록 슬롯을 확보하는 함수
+     */
+    void Reserve(size_t InNumElements)
+    {
+        const size_t Required = GetRequiredCapacity(InNumElements);
+        if (Required > Capacity)
+        {
+            Rehash(Required);
+        }
+    }
+
+    /**
+     * @brief 슬롯 수를 지정해 재해시하는 함수
+     * 요청한 값은 2의 거듭제곱으로 올림되며(최소 MinCapacity), 현재 원소 수를 최대 부하율 이하로 담을 수 없다면 그만큼 더 늘어난다
+     * 0을 넘기면 현재 원소 수에 맞게 줄어들고, 비어있다면 슬롯 메모리를 모두 반환한다
+     */
+    void Rehash(size_t InNumSlots)
+    {
+        const size_t NewCapacity = InNumSlots == 0
+                                       ? GetRequiredCapacity(Size)
+                                       : std::max({MinCapacity, RoundUpToPowerOfTwo(InNumSlots), GetRequiredCapacity(Size)});
+        if (NewCapacity != Capacity)
+        {
+            Resize(NewCapacity);
+        }
+    }
+
+    void Clear()
+    {
+        for (size_t Index = 0; Index < Capacity; ++Index)
+        {
+            if (Distances[Index] != 0)
+            {
+                Slots[Index].~ElementType();
+                Distances[Index] = 0;
+            }
+        }
+        Size = 0;
+    }
+
+    /**
+     * @brief 모든 원소를 제거하고 슬롯 메모리까지 반환하는 함수
+     */
+    void Release()
+    {
+        Clear();
+        if (Capacity > 0)
+        {
+            std::allocator<ElementType>().deallocate(Slots, Capacity);
+            delete[] Distances;
+        }
+        Slots = nullptr;
+        Distances = nullptr;
+        Capacity = 0;
+        Shift = 64;
+    }
+
+    // Lookup
+    template <typename ComparableKeyType>
+    size_t FindIndex(const ComparableKeyType& InKey) const
+    {
+        return FindIndexByHash(static_cast<size_t>(Hasher(InKey)), InKey,
+                               [this](const KeyType& InStored, const ComparableKeyType& InQuery)
+                               {
+                                   return KeyEqual(InStored, InQuery);
+                               });
+    }
+
+    /**
+     * @brief 미리 계산된 해시 값으로 원소를 찾는 함수
+     * 키 타입과 == 비교가 가능한 타입이라면 키 객체를 만들지 않고 조회할 수 있다
+     */
+    template <typename ComparableKeyType>
+    size_t FindIndexByHash(size_t InHash, const ComparableKeyType& InKey) const
+    {
+        return FindIndexByHash(InHash, InKey, [](const KeyType& InStored, const ComparableKeyType& InQuery)
+        {
+            return InStored == InQuery;
+        });
+    }
+
+    ElementType& GetElement(size_t InIndex) { return Slots[InIndex]; }
+    const ElementType& GetElement(size_t InIndex) const { return Slots[InIndex]; }
+
+    /**
+     * @brief 키가 없을 때만 원소를 생성해 삽입하는 함수
+     * @param InKey 중복 검사용 키
+     * @param InConstructArgs 원소 생성 인자
+     * @return 삽입되었거나 이미 존재하던 원소의 슬롯 인덱스와 삽입 여부
+     */
+    template <typename ComparableKeyType, typename... ArgsType>
+    std::pair<size_t, bool> FindOrEmplace(const ComparableKeyType& InKey, ArgsType&&... InConstructArgs)
+    {
+        const size_t Hash = static_cast<size_t>(Hasher(InKey));
+        const size_t ExistingIndex = FindIndexByHash(Hash, InKey,
+                                                     [this](const KeyType& InStored, const ComparableKeyType& InQuery)
+                                                     {
+                                                         return KeyEqual(InStored, InQuery);
+                                                     });
+        if (ExistingIndex != INDEX_NONE)
+        {
+            return {ExistingIndex, false};
+        }
+
+        // 인자가 이 테이블의 원소를 참조할 수 있으므로 재해시 전에 원소를 먼저 만들어 둔다
+        alignas(ElementType) unsigned char ElementStorage[sizeof(ElementType)];
+        ElementType* Element = new(ElementStorage) ElementType(std::forward<ArgsType>(InConstructArgs)...);
+        return {InsertNew(Hash, *Element), true};
+    }
+
+    /**
+     * @brief 이미 생성된 원소를 키 중복 검사 후 삽입하는 함수
+     */
+    std::pair<size_t, bool> Insert(ElementType&& InElement)
+    {
+        const KeyType& Key = KeyFuncs::GetKey(InElement);
+        const size_t Hash = static_cast<size_t>(Hasher(Key));
+        const size_t ExistingIndex = FindIndexByHash(Hash, Key, [this](const KeyType& InStored, const KeyType& InQuery)
+        {
+            return KeyEqual(InStored, InQuery);
+        });
+        if (ExistingIndex != INDEX_NONE)
+        {
+            return {ExistingIndex, false};
+        }
+
+        alignas(ElementType) unsigned char ElementStorage[sizeof(ElementType)];
+        ElementType* Element = new(ElementStorage) ElementType(std::move(InElement));
+        return {InsertNew(Hash, *Element), true};
+    }
+
+    /**
+     * @brief 슬롯의 원소를 제거하고 뒤따르는 원소를 한 칸씩 당기는 함수 (Backward Shift Deletion)
+     */
+    void RemoveAtIndex(size_t InIndex)
+    {
+        Slots[InIndex].~ElementType();
+
+        size_t Current = InIndex;
+        size_t Next = (Current + 1) & (Capacity - 1);
+        while (Distances[Next] > 1)
+        {
+            TRelocateElement<ElementType>::Relocate(&Slots[Current], Slots[Next]);
+            Distances[Current] = static_cast<uint8>(Distances[Next] - 1);
+
+            Current = Next;
+            Next = (Next + 1) & (Capacity - 1);
+        }
+
+        Distances[Current] = 0;
+        --Size;
+    }
+
+    template <typename ComparableKeyType>
+    SizeType Remove(const ComparableKeyType& InKey)
+    {
+        const size_t Index = FindIndex(InKey);
+        if (Index == INDEX_NONE)
+        {
+            return 0;
+        }
+
+        RemoveAtIndex(Index);
+        return 1;
+    }
+
+    /**
+     * @brief 조건을 만족하는 원소를 모두 제거하는 함수
+     * Backward Shift로 현재 슬롯에 다음 원소가 당겨질 수 있으므로 제거 후에는 같은 슬롯을 다시 검사한다
+     */
+    template <typename PredicateType>
+    SizeType RemoveAll(PredicateType InPredicate)
+    {
+        SizeType RemovedCount = 0;
+        size_t Index = 0;
+        while (Index < Capacity)
+        {
+            if (Distances[Index] != 0 && InPredicate(Slots[Index]))
+            {
+                RemoveAtIndex(Index);
+                ++RemovedCount;
+                continue;
+            }
+            ++Index;
+        }
+        return RemovedCount;
+    }
+
+    // Iterators
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, Capacity); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, Capacity); }
+
+private:
+    // 최대 부하율 (MaxLoadNumerator / MaxLoadDenominator)
+    static constexpr size_t MaxLoadNumerator = 4;
+    static constexpr size_t MaxLoadDenominator = 5;
+    static constexpr size_t MinCapacity = 8;
+    static constexpr uint8 MaxDistance = 0xFF;
+
+    static size_t RoundUpToPowerOfTwo(size_t InValue)
+    {
+        size_t Result = 1;
+        while (Result < InValue)
+        {
+            Result <<= 1;
+        }
+        return Result;
+    }
+
+    static size_t GetRequiredCapacity(size_t InNumElements)
+    {
+        if (InNumElements == 0)
+        {
+            return 0;
+        }
+
+        const size_t MinSlots = (InNumElements * MaxLoadDenominator + MaxLoadNumerator - 1) / MaxLoadNumerator;
+        return std::max(MinCapacity, RoundUpToPowerOfTwo(MinSlots));
+    }
+
+    /**
+     * @brief 해시 값을 홈 버킷 인덱스로 변환하는 함수
+     * std::hash가 항등 함수인 구현(정수 / 포인터)에서도 하위 비트에 편향되지 않도록 피보나치 해싱으로 상위 비트를 사용한다
+     */
+    size_t GetHomeIndex(size_t InHash) const
+    {
+        return static_cast<size_t>((static_cast<uint64>(InHash) * 0x9E3779B97F4A7C15ull) >> Shift);
+    }
+
+    template <typename ComparableKeyType, typename MatchFuncType>
+    size_t FindIndexByHash(size_t InHash, const ComparableKeyType& InKey, MatchFuncType InMatchFunc) const
+    {
+        if (Size == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        const size_t Mask = Capacity - 1;
+        size_t Index = GetHomeIndex(InHash);
+        uint32 Distance = 1;
+
+        // Robin Hood 불변식: 현재 슬롯의 거리가 탐사 거리보다 짧다면 키는 테이블에 없다
+        while (Distances[Index] >= Distance)
+        {
+            if (Distances[Index] == Distance && InMatchFunc(KeyFuncs::GetKey(Slots[Index]), InKey))
+            {
+                return Index;
+            }
+
+            Index = (Index + 1) & Mask;
+            ++Distance;
+        }
+
+        return INDEX_NONE;
+    }
+
+    /**
+     * @brief 홈 버킷부터 첫 빈 슬롯까지의 거리가 탐사 거리 한도 안에 있는지 확인하는 함수
+     * 삽입 중 밀려나는 원소의 거리는 이 값을 넘지 않으므로 사전에 검사하면 삽입 도중 재해시가 일어나지 않는다
+     */
+    bool CanInsertWithoutOverflow(size_t InHomeIndex) const
+    {
+        const size_t Mask = Capacity - 1;
+        size_t Index = InHomeIndex;
+        uint32 Distance = 1;
+        while (Distances[Index] != 0)
+        {
+            if (Distance >= MaxDistance)
+            {
+                return false;
+            }
+
+            Index = (Index + 1) & Mask;
+            ++Distance;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 키 중복 검사가 끝난 원소를 필요하면 재해시한 뒤 삽입하는 함수
+     * @param InSource 슬롯으로 옮겨질 원소 (옮긴 뒤 소멸되므로 호출자는 다시 소멸시키지 않는다)
+     */
+    size_t InsertNew(size_t InHash, ElementType& InSource)
+    {
+        if (Capacity == 0 || (Size + 1) * MaxLoadDenominator > Capacity * MaxLoadNumerator)
+        {
+            Resize(std::max(MinCapacity, Capacity * 2));
+        }
+
+        while (!CanInsertWithoutOverflow(GetHomeIndex(InHash)))
+        {
+            // 부하율이 충분히 낮은데도 한도를 넘는다면 해시 함수가 대부분의 키에 같은 값을 반환하는 상태
+            assert(Size * 8 >= Capacity && "TRobinHoodHashTable: 해시 충돌이 비정상적으로 많습니다");
+            Resize(Capacity * 2);
+        }
+
+        return InsertUnchecked(InHash, InSource);
+    }
+
+    /**
+     * @brief 키 중복 검사와 용량 검사가 끝난 원소를 삽입하는 함수
+     * 탐사 거리가 자신보다 짧은 원소를 만나면 자리를 빼앗고, 밀려난 원소로 탐사를 이어간다
+     * @param InSource 슬롯으로 옮겨질 원소 (옮긴 뒤 소멸된다)
+     * @return 처음 넘겨받은 원소가 최종적으로 놓인 슬롯 인덱스
+     */
+    size_t InsertUnchecked(size_t InHash, ElementType& InSource)
+    {
+        const size_t Mask = Capacity - 1;
+        size_t Index = GetHomeIndex(InHash);
+        uint8 Distance = 1;
+        size_t ResultIndex = INDEX_NONE;
+
+        // 밀려난 원소를 두 버퍼에 번갈아 담아 슬롯과 교환 (원소 타입에 대입 연산이 없어도 동작)
+        alignas(ElementType) unsigned char CarryStorage[2][sizeof(ElementType)];
+        uint32 CarrySlot = 0;
+        ElementType* Carry = reinterpret_cast<ElementType*>(CarryStorage[CarrySlot]);
+        TRelocateElement<ElementType>::Relocate(Carry, InSource);
+
+        while (true)
+        {
+            if (Distances[Index] == 0)
+            {
+                TRelocateElement<ElementType>::Relocate(&Slots[Index], *Carry);
+                Distances[Index] = Distance;
+                ++Size;
+                return ResultIndex == INDEX_NONE ? Index : ResultIndex;
+            }
+
+            if (Distances[Index] < Distance)
+            {
+                CarrySlot ^= 1;
+                ElementType* Displaced = reinterpret_cast<ElementType*>(CarryStorage[CarrySlot]);
+                TRelocateElement<ElementType>::Relocate(Displaced, Slots[Index]);
+                TRelocateElement<ElementType>::Relocate(&Slots[Index], *Carry);
+                Carry = Displaced;
+                std::swap(Distance, Distances[Index]);
+
+                if (ResultIndex == INDEX_NONE)
+                {
+                    ResultIndex = Index;
+                }
+            }
+
+            Index = (Index + 1) & Mask;
+            ++Distance;
+        }
+    }
+
+    /**
+     * @brief 슬롯 배열을 새 용량으로 다시 만들고 모든 원소를 재삽입하는 함수
+     * 용량을 늘려도 해시가 몰린 구간은 탐사 거리 한도를 넘을 수 있으므로, 재삽입 전에 검사해 한도를 넘으면 한 번 더 늘린다
+     */
+    void Resize(size_t InNewCapacity)
+    {
+        ElementType* OldSlots = Slots;
+        uint8* OldDistances = Distances;
+        const size_t OldCapacity = Capacity;
+
+        Capacity = InNewCapacity;
+        Size = 0;
+        if (Capacity > 0)
+        {
+            Slots = std::allocator<ElementType>().allocate(Capacity);
+            Distances = new uint8[Capacity]();
+            Shift = 64 - GetLog2(Capacity);
+        }
+        else
+        {
+            Slots = nullptr;
+            Distances = nullptr;
+            Shift = 64;
+        }
+
+        for (size_t Index = 0; Index < OldCapacity; ++Index)
+        {
+            if (OldDistances[Index] != 0)
+            {
+                const size_t Hash = static_cast<size_t>(Hasher(KeyFuncs::GetKey(OldSlots[Index])));
+                while (!CanInsertWithoutOverflow(GetHomeIndex(Hash)))
+                {
+                    Resize(Capacity * 2);
+                }
+                InsertUnchecked(Hash, OldSlots[Index]);
+            }
+        }
+
+        if (OldCapacity > 0)
+        {
+            std::allocator<ElementType>().deallocate(OldSlots, OldCapacity);
+            delete[] OldDistances;
+        }
+    }
+
+    /**
+     * @brief InBlockStart부터 최대 64슬롯의 점유 여부를 비트마스크로 만드는 함수 (비트 n = 슬롯 InBlockStart + n)
+     * 탐사 거리 8바이트를 한 번에 읽어 0이 아닌 바이트의 최상위 비트를 세우고, 곱셈으로 그 8비트를 한 바이트에 모은다
+     * 용량은 8 이상의 2의 거듭제곱이므로 블록은 항상 8슬롯 단위로 끝난다
+     */
+    uint64 GetOccupiedMask(size_t InBlockStart) const
+    {
+        constexpr uint64 LowBits = 0x7F7F7F7F7F7F7F7Full;
+        constexpr uint64 HighBits = 0x8080808080808080ull;
+        constexpr uint64 GatherBits = 0x0102040810204080ull;
+
+        const size_t NumWords = std::min<size_t>(8, (Capacity - InBlockStart) >> 3);
+        uint64 Result = 0;
+        for (size_t WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+        {
+            // 리틀 엔디언 기준으로 바이트 n이 슬롯 InBlockStart + WordIndex * 8 + n
+            uint64 Word;
+            std::memcpy(&Word, Distances + InBlockStart + WordIndex * 8, sizeof(Word));
+            const uint64 NonZeroBytes = (((Word & LowBits) + LowBits) | Word) & HighBits;
+            Result |= ((NonZeroBytes >> 7) * GatherBits >> 56) << (WordIndex * 8);
+        }
+        return Result;
+    }
+
+    static uint32 GetLog2(size_t InPowerOfTwo)
+    {
+        uint32 Result = 0;
+        while ((static_cast<size_t>(1) << Result) < InPowerOfTwo)
+        {
+            ++Result;
+        }
+        return Result;
+    }
+
+    void CopyFrom(const TRobinHoodHashTable& InOther)
+    {
+        if (InOther.Capacity == 0)
+        {
+            return;
+        }
+
+        // 슬롯 배치를 그대로 복제하므로 재해시가 필요 없다
+        Capacity = InOther.Capacity;
+        Shift = InOther.Shift;
+        Slots = std::allocator<ElementType>().allocate(Capacity);
+        Distances = new uint8[Capacity];
+        std::copy(InOther.Distances, InOther.Distances + Capacity, Distances);
+
+        for (size_t Index = 0; Index < Capacity; ++Index)
+        {
+            if (Distances[Index] != 0)
+            {
+                new(&Slots[Index]) ElementType(InOther.Slots[Index]);
+            }
+        }
+        Size = InOther.Size;
+    }
+
+    void MoveFrom(TRobinHoodHashTable& InOther)
+    {
+        Slots = InOther.Slots;
+        Distances = InOther.Distances;
+        Capacity = InOther.Capacity;
+        Size = InOther.Size;
+        Shift = InOther.Shift;
+
+        InOther.Slots = nullptr;
+        InOther.Distances = nullptr;
+        InOther.Capacity = 0;
+        InOther.Size = 0;
+        InOther.Shift = 64;
+    }
+
+    ElementType* Slots = nullptr;
+    uint8* Distances = nullptr;
+    size_t Capacity = 0;
+    size_t Size = 0;
+    uint32 Shift = 64;
+
+    HasherType Hasher;
+    KeyEqualType KeyEqual;
+};
@@ -2,15 +2,31 @@
 
 #include <unordered_set>
 #include <functional>
+#include "TRobinHoodHashTable.h"
 
 using std::unordered_set;
 using std::hash;
 using std::equal_to;
 using std::allocator;
 
+/**
+ * @brief TSet 원소 자체를 키로 사용하는 정책
+ */
+template<typename ElementType>
+struct TDefaultSetKeyFuncs
+{
+    static const ElementType& GetKey(const ElementType& InElement)
+    {
+        return InElement;
+    }
+};
+
 /**
  * @brief 언리얼 엔진 스타일의 Set 컨테이너
- * 언리얼 호환성을 위하여 unordered_set을 대체할 목적으로 구현
+ * 원소를 노드 단위로 할당하는 unordered_set 대신 TRobinHoodHashTable 위에 구현하여 원소가 하나의 연속된 슬롯 배열에 저장된다
+ * @note 원소 주소는 다음 삽입 / 삭제 전까지만 유효하다
+ * @param HasherType, KeyEqualType 둘 다 is_transparent를 정의하면 ElementType이 아닌 값으로도 Find / Contains를 호출할 수 있다
+ * @param AllocatorType 기존 선언과의 호환을 위해 남겨둔 인자로, 슬롯 배열은 std::allocator로 할당된다
  */
 template<typename ElementType, typename HasherType = hash<ElementType>, typename KeyEqualType = equal_to<ElementType>, typename AllocatorType = allocator<ElementType>>
 class TSet
@@ -19,20 +35,26 @@ public:
     // Type definitions
     using KeyType = ElementType;
     using SizeType = int32;
-    using Iterator = typename unordered_set<ElementType, HasherType, KeyEqualType, AllocatorType>::iterator;
-    using ConstIterator = typename unordered_set<ElementType, HasherType, KeyEqualType, AllocatorType>::const_iterator;
+    using HashTableType = TRobinHoodHashTable<ElementType, ElementType, TDefaultSetKeyFuncs<ElementType>, HasherType, KeyEqualType>;
+    // 원소가 곧 키이므로 순회 중 수정할 수 없도록 두 반복자 모두 const 원소를 가리킨다
+    using Iterator = typename HashTableType::ConstIterator;
+    using ConstIterator = typename HashTableType::ConstIterator;
 
     // Constructors
     TSet() = default;
 
     explicit TSet(SizeType ExpectedNumElements)
-        : Data(static_cast<size_t>(ExpectedNumElements))
     {
+        Data.Reserve(static_cast<size_t>(ExpectedNumElements));
     }
 
     TSet(std::initializer_list<ElementType> InitList)
-        : Data(InitList)
     {
+        Data.Reserve(InitList.size());
+        for (const ElementType& Element : InitList)
+        {
+            Add(Element);
+        }
     }
 
     // Copy and Move constructors/assignments
@@ -51,13 +73,13 @@ public:
      */
     bool Add(const ElementType& InElement)
     {
-        auto [Iterator, bInserted] = Data.insert(InElement);
+        auto [Index, bInserted] = Data.FindOrEmplace(InElement, InElement);
         return bInserted;
     }
 
     bool Add(ElementType&& InElement)
     {
-        auto [Iterator, bInserted] = Data.insert(std::move(InElement));
+        auto [Index, bInserted] = Data.FindOrEmplace(InElement, std::move(InElement));
         return bInserted;
     }
 
@@ -68,20 +90,18 @@ public:
      */
     bool Emplace(const ElementType& InElement)
     {
-        auto [Iterator, bInserted] = Data.emplace(InElement);
-        return bInserted;
+        return Add(InElement);
     }
 
     bool Emplace(ElementType&& InElement)
     {
-        auto [Iterator, bInserted] = Data.emplace(std::move(InElement));
-        return bInserted;
+        return Add(std::move(InElement));
     }
 
     template<typename... ArgsType>
     bool Emplace(ArgsType&&... Args)
     {
-        auto [Iterator, bInserted] = Data.emplace(std::forward<ArgsType>(Args)...);
+        auto [Index, bInserted] = Data.Insert(ElementType(std::forward<ArgsType>(Args)...));
         return bInserted;
     }
 
@@ -90,7 +110,13 @@ public:
      */
     bool Contains(const ElementType& InElement) const
     {
-        return Data.find(InElement) != Data.end();
+        return Data.FindIndex(InElement) != HashTableType::INDEX_NONE;
+    }
+
+    template<typename ComparableKeyType, typename = TEnableIfTransparentLookup<HasherType, KeyEqualType, ComparableKeyType>>
+    bool Contains(const ComparableKeyType& InKey) const
+    {
+        return Data.FindIndex(InKey) != HashTableType::INDEX_NONE;
     }
 
     /**
@@ -100,7 +126,7 @@ public:
      */
     SizeType Remove(const ElementType& InElement)
     {
-        return static_cast<SizeType>(Data.erase(InElement));
+        return Data.Remove(InElement);
     }
 
     /**
@@ -110,60 +136,94 @@ public:
      */
     const ElementType* Find(const ElementType& InElement) const
     {
-        auto It = Data.find(InElement);
-        return (It != Data.end()) ? &(*It) : nullptr;
+        const size_t Index = Data.FindIndex(InElement);
+        return Index != HashTableType::INDEX_NONE ? &Data.GetElement(Index) : nullptr;
     }
 
     ElementType* Find(const ElementType& InElement)
     {
-        auto It = Data.find(InElement);
-        return (It != Data.end()) ? const_cast<ElementType*>(&(*It)) : nullptr;
+        const size_t Index = Data.FindIndex(InElement);
+        return Index != HashTableType::INDEX_NONE ? &Data.GetElement(Index) : nullptr;
+    }
+
+    /**
+     * @brief 미리 계산된 해시 값으로 요소를 찾는 함수 (언리얼 스타일)
+     * @param KeyHash HasherType이 같은 요소에 대해 반환하는 해시 값
+     * @param InKey ElementType과 == 비교가 가능한 값
+     * @return 요소에 대한 포인터 (없으면 nullptr)
+     */
+    template<typename ComparableKeyType>
+    const ElementType* FindByHash(size_t KeyHash, const ComparableKeyType& InKey) const
+    {
+        const size_t Index = Data.FindIndexByHash(KeyHash, InKey);
+        return Index != HashTableType::INDEX_NONE ? &Data.GetElement(Index) : nullptr;
     }
 
     // Size and capacity
     SizeType Num() const
     {
-        return static_cast<SizeType>(Data.size());
+        return Data.Num();
     }
 
     bool IsEmpty() const
     {
-        return Data.empty();
+        return Data.IsEmpty();
+    }
+
+    /**
+     * @brief 현재 할당된 슬롯 수 (원소 수가 아님)
+     */
+    SizeType GetCapacity() const
+    {
+        return Data.GetCapacity();
     }
 
     // Modifiers
+    /**
+     * @brief 모든 요소를 제거하고 메모리를 반환 (ExpectedNumElements가 있다면 그만큼 다시 확보)
+     */
     void Empty(SizeType ExpectedNumElements = 0)
     {
-        Data.clear();
+        Data.Release();
         if (ExpectedNumElements > 0)
         {
-            Data.reserve(static_cast<size_t>(ExpectedNumElements));
+            Data.Reserve(static_cast<size_t>(ExpectedNumElements));
         }
     }
 
+    /**
+     * @brief 슬롯 메모리는 유지한 채 모든 요소를 제거
+     */
     void Reset()
     {
-        Data.clear();
+        Data.Clear();
     }
 
     void Shrink()
     {
-        Data.rehash(0);
+        Data.Rehash(0);
     }
 
     void Reserve(SizeType Number)
     {
-        Data.reserve(static_cast<size_t>(Number));
+        Data.Reserve(static_cast<size_t>(Number));
+    }
+
+    /**
+     * @brief 슬롯 수를 직접 지정해 재해시
+     * @param NumSlots 원하는 슬롯 수 (2의 거듭제곱으로 올림되며, 현재 요소를 담을 수 있는 크기 미만으로는 줄지 않음)
+     */
+    void Rehash(SizeType NumSlots)
+    {
+        Data.Rehash(static_cast<size_t>(NumSlots));
     }
 
     // Iterators
-    Iterator begin() { return Data.begin(); }
-    Iterator end() { return Data.end(); }
-    ConstIterator begin() const { return Data.begin(); }
-    ConstIterator end() const { return Data.end(); }
+    Iterator begin() const { return Data.begin(); }
+    Iterator end() const { return Data.end(); }
 
     ConstIterator CreateConstIterator() const { return Data.begin(); }
-    Iterator CreateIterator() { return Data.begin(); }
+    Iterator CreateIterator() const { return Data.begin(); }
 
     /**
      * @brief 각 요소에 대해 함수를 실행하는 언리얼 스타일 함수
@@ -178,15 +238,6 @@ public:
         }
     }
 
-    template<typename FuncType>
-    void ForEach(FuncType Func)
-    {
-        for (auto& Element : Data)
-        {
-            Func(Element);
-        }
-    }
-
     /**
      * @brief 조건에 맞는 모든 요소를 제거
      * @param Predicate 제거 조건을 판단하는 함수
@@ -195,23 +246,12 @@ public:
     template<typename PredicateType>
     SizeType RemoveAll(PredicateType Predicate)
     {
-        SizeType RemovedCount = 0;
-        auto It = Data.begin();
-        while (It != Data.end())
+        return Data.RemoveAll([&Predicate](const ElementType& InElement)
         {
-            if (Predicate(*It))
-            {
-                It = Data.erase(It);
-                ++RemovedCount;
-            }
-            else
-            {
-                ++It;
-            }
-        }
-        return RemovedCount;
+            return Predicate(InElement);
+        });
     }
 
 private:
-    unordered_set<ElementType, HasherType, KeyEqualType, AllocatorType> Data;
+    HashTableType Data;
 };
\ No newline at end of file
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include "TArray.h"
+
+/**
+ * @brief 인덱스가 변하지 않는 희소 배열 컨테이너 (언리얼 TSparseArray 스타일)
+ * 원소는 고정 크기 청크에 저장되므로 배열이 커져도 기존 원소의 주소가 바뀌지 않는다
+ * 제거된 슬롯은 Free List로 연결되어 다음 추가 시 재사용되며, 추가 / 제거 모두 O(1)이다
+ * 순회는 할당 비트맵에서 비어있는 슬롯을 64개 단위로 건너뛴다
+ * @note 순회 중 현재 원소를 RemoveAt으로 제거하는 것은 안전하다
+ * 반복자는 현재 64슬롯 단어의 남은 비트를 들고 있으므로, 같은 단어에서 아직 방문하지 않은 다른 원소를 제거해서는 안 된다
+ * @param ElementsPerChunkLog2 청크 하나에 담기는 원소 수의 log2
+ */
+template<typename ElementType, uint32 ElementsPerChunkLog2 = 8>
+class TSparseArray
+{
+public:
+    // Type definitions
+    using SizeType = int32;
+    using IndexType = int32;
+
+    static constexpr IndexType INDEX_NONE = -1;
+    static constexpr IndexType ElementsPerChunk = static_cast<IndexType>(1) << ElementsPerChunkLog2;
+
+    // 할당 비트맵 한 단어(64슬롯)가 한 청크 안에 들어가야 반복자가 단어 단위로 슬롯 포인터를 캐시할 수 있다
+    static_assert(ElementsPerChunkLog2 >= 6, "TSparseArray: 청크는 최소 64개 원소를 담아야 합니다");
+
+private:
+    /**
+     * @brief 원소 또는 다음 빈 슬롯 인덱스를 담는 저장 공간
+     */
+    struct FSlot
+    {
+        alignas(alignof(ElementType) > alignof(IndexType) ? alignof(ElementType) : alignof(IndexType))
+        uint8 Bytes[sizeof(ElementType) > sizeof(IndexType) ? sizeof(ElementType) : sizeof(IndexType)];
+    };
+
+    /**
+     * @brief 할당된 원소만 순회하는 반복자
+     * 현재 단어의 남은 할당 비트와 그 단어의 첫 슬롯 포인터를 들고 있어, 증가는 최하위 비트 하나를 지우고
+     * 역참조는 캐시한 포인터에 비트 위치를 더하는 것으로 끝난다 (비트맵 / 청크 배열은 단어가 바뀔 때만 읽음)
+     */
+    template<bool bConst>
+    class TBaseIterator
+    {
+    public:
+        using ArrayType = std::conditional_t<bConst, const TSparseArray, TSparseArray>;
+        using ReferenceType = std::conditional_t<bConst, const ElementType&, ElementType&>;
+        using PointerType = std::conditional_t<bConst, const ElementType*, ElementType*>;
+
+        TBaseIterator(ArrayType* InArray, IndexType InStartIndex)
+            : Array(InArray), Index(InArray->MaxIndex)
+        {
+            if (InStartIndex >= Array->MaxIndex)
+            {
+                return;
+            }
+
+            WordIndex = InStartIndex >> 6;
+            RemainingFlags = Array->AllocationFlags[WordIndex] & (~0ull << (InStartIndex & 63));
+            WordSlots = Array->GetSlot(WordIndex << 6);
+            SkipEmpty();
+        }
+
+        ReferenceType operator*() const { return *GetElement(); }
+        PointerType operator->() const { return GetElement(); }
+
+        TBaseIterator& operator++()
+        {
+            RemainingFlags &= RemainingFlags - 1;
+            SkipEmpty();
+            return *this;
+        }
+
+        bool operator==(const TBaseIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const TBaseIterator& Other) const { return Index != Other.Index; }
+
+        // 현재 원소의 안정적인 인덱스
+        IndexType GetIndex() const { return Index; }
+
+    private:
+        PointerType GetElement() const
+        {
+            return std::launder(reinterpret_cast<PointerType>(WordSlots[Index & 63].Bytes));
+        }
+
+        /**
+         * @brief 현재 단어에 남은 비트가 없으면 0이 아닌 다음 단어로 넘어가 다음 할당 인덱스로 이동하는 함수
+         * MaxIndex 이후의 비트는 항상 0이므로 단어 단위로만 경계를 확인하면 된다
+         */
+        void SkipEmpty()
+        {
+            if (RemainingFlags == 0)
+            {
+                const IndexType NumWords = Array->AllocationFlags.Num();
+                do
+                {
+                    if (++WordIndex >= NumWords)
+                    {
+                        Index = Array->MaxIndex;
+                        return;
+                    }
+                    RemainingFlags = Array->AllocationFlags[WordIndex];
+                }
+                while (RemainingFlags == 0);
+
+                WordSlots = Array->GetSlot(WordIndex << 6);
+            }
+
+            Index = (WordIndex << 6) + static_cast<IndexType>(CountTrailingZeros64(RemainingFlags));
+        }
+
+        ArrayType* Array;
+        IndexType Index;
+        IndexType WordIndex = 0;
+        uint64 RemainingFlags = 0;
+        FSlot* WordSlots = nullptr;
+    };
+
+public:
+    using Iterator = TBaseIterator<false>;
+    using ConstIterator = TBaseIterator<true>;
+
+    // Constructors
+    TSparseArray() = default;
+
+    TSparseArray(const TSparseArray& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    TSparseArray(TSparseArray&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    TSparseArray& operator=(const TSparseArray& Other)
+    {
+        if (this != &Other)
+        {
+            Empty();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TSparseArray& operator=(TSparseArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Empty();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    ~TSparseArray()
+    {
+        DestructElements();
+    }
+
+    // Element access
+    ElementType& operator[](IndexType Index)
+    {
+        assert(IsAllocated(Index) && "TSparseArray: 할당되지 않은 인덱스에 접근했습니다");
+        return *GetElementPointer(Index);
+    }
+
+    const ElementType& operator[](IndexType Index) const
+    {
+        assert(IsAllocated(Index) && "TSparseArray: 할당되지 않은 인덱스에 접근했습니다");
+        return *GetElementPointer(Index);
+    }
+
+    // Capacity
+    SizeType Num() const { return NumElements; }
+    bool IsEmpty() const { return NumElements == 0; }
+
+    // 한 번이라도 사용된 가장 큰 인덱스 + 1 (인덱스 기반 순회의 상한)
+    IndexType GetMaxIndex() const { return MaxIndex; }
+
+    bool IsValidIndex(IndexType Index) const
+    {
+        return Index >= 0 && Index < MaxIndex;
+    }
+
+    bool IsAllocated(IndexType Index) const
+    {
+        return IsValidIndex(Index) && (AllocationFlags[Index >> 6] & (1ull << (Index & 63))) != 0;
+    }
+
+    void Reserve(SizeType Number)
+    {
+        while (Chunks.Num() * ElementsPerChunk < Number)
+        {
+            Chunks.Add(std::make_unique<FSlot[]>(ElementsPerChunk));
+        }
+        AllocationFlags.Reserve((Number + 63) / 64);
+    }
+
+    // Modifiers
+    /**
+     * @brief 원소를 추가하고 안정적인 인덱스를 반환하는 함수
+     * 제거된 슬롯이 있으면 가장 최근에 비워진 슬롯을 재사용한다
+     */
+    template<typename... Args>
+    IndexType Emplace(Args&&... args)
+    {
+        const IndexType Index = AllocateIndex();
+        new (GetElementPointer(Index)) ElementType(std::forward<Args>(args)...);
+        return Index;
+    }
+
+    IndexType Add(const ElementType& Element)
+    {
+        return Emplace(Element);
+    }
+
+    IndexType Add(ElementType&& Element)
+    {
+        return Emplace(std::move(Element));
+    }
+
+    /**
+     * @brief 원소를 제거하는 함수
+     * 다른 원소의 인덱스와 주소는 그대로 유지된다
+     */
+    void RemoveAt(IndexType Index)
+    {
+        assert(IsAllocated(Index) && "TSparseArray: 할당되지 않은 인덱스를 제거하려고 했습니다");
+
+        GetElementPointer(Index)->~ElementType();
+        AllocationFlags[Index >> 6] &= ~(1ull << (Index & 63));
+
+        SetNextFreeIndex(Index, FirstFreeIndex);
+        FirstFreeIndex = Index;
+        --NumElements;
+    }
+
+    /**
+     * @brief 값이 같은 첫 원소를 제거하는 함수 (O(N))
+     * @return 제거 여부
+     */
+    bool RemoveSingle(const ElementType& Element)
+    {
+        const IndexType Index = Find(Element);
+        if (Index == INDEX_NONE)
+        {
+            return false;
+        }
+
+        RemoveAt(Index);
+        return true;
+    }
+
+    /**
+     * @brief 모든 원소를 제거하되 청크는 유지하는 함수
+     */
+    void Reset()
+    {
+        DestructElements();
+
+        for (uint64& Flags : AllocationFlags)
+        {
+            Flags = 0;
+        }
+        MaxIndex = 0;
+        NumElements = 0;
+        FirstFreeIndex = INDEX_NONE;
+    }
+
+    /**
+     * @brief 모든 원소를 제거하고 청크까지 해제하는 함수
+     */
+    void Empty()
+    {
+        DestructElements();
+
+        Chunks.Empty();
+        AllocationFlags.Empty();
+        MaxIndex = 0;
+        NumElements = 0;
+        FirstFreeIndex = INDEX_NONE;
+    }
+
+    // Search
+    IndexType Find(const ElementType& Element) const
+    {
+        for (ConstIterator It = begin(); It != end(); ++It)
+        {
+            if (*It == Element)
+            {
+                return It.GetIndex();
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    bool Contains(const ElementType& Element) const
+    {
+        return Find(Element) != INDEX_NONE;
+    }
+
+    // Iterators
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, MaxIndex); }
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, MaxIndex); }
+
+private:
+    TArray<std::unique_ptr<FSlot[]>> Chunks;
+    TArray<uint64> AllocationFlags;
+    IndexType MaxIndex = 0;
+    SizeType NumElements = 0;
+    IndexType FirstFreeIndex = INDEX_NONE;
+
+    FSlot* GetSlot(IndexType Index) const
+    {
+        return &Chunks[Index >> ElementsPerChunkLog2][Index & (ElementsPerChunk - 1)];
+    }
+
+    ElementType* GetElementPointer(IndexType Index) const
+    {
+        return std::launder(reinterpret_cast<ElementType*>(GetSlot(Index)->Bytes));
+    }
+
+    IndexType GetNextFreeIndex(IndexType Index) const
+    {
+        IndexType NextFreeIndex;
+        memcpy(&NextFreeIndex, GetSlot(Index)->Bytes, sizeof(IndexType));
+        return NextFreeIndex;
+    }
+
+    void SetNextFreeIndex(IndexType Index, IndexType InNextFreeIndex)
+    {
+        memcpy(GetSlot(Index)->Bytes, &InNextFreeIndex, sizeof(IndexType));
+    }
+
+    /**
+     * @brief 빈 슬롯을 하나 확보하고 할당 비트를 세우는 함수
+     */
+    IndexType AllocateIndex()
+    {
+        IndexType Index;
+        if (FirstFreeIndex != INDEX_NONE)
+        {
+            Index = FirstFreeIndex;
+            FirstFreeIndex = GetNextFreeIndex(Index);
+        }
+        else
+        {
+            Index = MaxIndex++;
+            if ((Index >> ElementsPerChunkLog2) >= Chunks.Num())
+            {
+                Chunks.Add(std::make_unique<FSlot[]>(ElementsPerChunk));
+            }
+            if ((Index >> 6) >= AllocationFlags.Num())
+            {
+                AllocationFlags.Add(0);
+            }
+        }
+
+        AllocationFlags[Index >> 6] |= 1ull << (Index & 63);
+        ++NumElements;
+        return Index;
+    }
+
+    void DestructElements()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (ElementType& Element : *this)
+            {
+                Element.~ElementType();
+            }
+        }
+    }
+
+    /**
+     * @brief 인덱스와 Free List 구성을 그대로 유지하며 복사하는 함수 (비어있는 상태에서 호출)
+     */
+    void CopyFrom(const TSparseArray& Other)
+    {
+        Reserve(Other.MaxIndex);
+        AllocationFlags = Other.AllocationFlags;
+        MaxIndex = Other.MaxIndex;
+        NumElements = Other.NumElements;
+        FirstFreeIndex = Other.FirstFreeIndex;
+
+        for (IndexType Index = 0; Index < MaxIndex; ++Index)
+        {
+            if (Other.IsAllocated(Index))
+            {
+                new (GetElementPointer(Index)) ElementType(*Other.GetElementPointer(Index));
+            }
+            else
+            {
+                SetNextFreeIndex(Index, Other.GetNextFreeIndex(Index));
+            }
+        }
+    }
+
+    void MoveFrom(TSparseArray& Other)
+    {
+        Chunks = std::move(Other.Chunks);
+        AllocationFlags = std::move(Other.AllocationFlags);
+        MaxIndex = Other.MaxIndex;
+        NumElements = Other.NumElements;
+        FirstFreeIndex = Other.FirstFreeIndex;
+
+        Other.Chunks.Empty();
+        Other.AllocationFlags.Empty();
+        Other.MaxIndex = 0;
+        Other.NumElements = 0;
+        Other.FirstFreeIndex = INDEX_NONE;
+    }
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+/**
+ * @brief 프레임 단위로 수명이 끝나는 임시 데이터를 위한 선형(Bump Pointer) 할당자
+ * 큰 페이지에서 포인터를 밀어 올리는 방식으로 할당하며, 개별 해제 없이 프레임 시작 시 한꺼번에 재설정된다
+ * NumBufferedFrames개의 버퍼를 번갈아 사용하므로 이번 프레임에 할당한 메모리는 다음 프레임까지 유효하다
+ * (렌더 측에서 직전 프레임의 데이터를 읽는 경우에도 안전)
+ * @note 게임 스레드 전용이며, 할당된 객체의 소멸자는 호출되지 않으므로 필요하다면 직접 호출해야 한다
+ */
+class FFrameArena
+{
+public:
+	static constexpr uint32 NumBufferedFrames = 2;
+	static constexpr size_t DefaultPageSize = static_cast<size_t>(MEGA);
+	static constexpr size_t DefaultAlignment = alignof(std::max_align_t);
+
+	static FFrameArena& GetInstance();
+
+	FFrameArena(const FFrameArena&) = delete;
+	FFrameArena& operator=(const FFrameArena&) = delete;
+
+	/**
+	 * @brief 새 프레임을 시작하는 함수
+	 * NumBufferedFrames 프레임 전에 사용했던 버퍼를 재설정하고 현재 버퍼로 전환한다
+	 * FEngineLoop::Tick의 시작에서 한 번 호출된다
+	 */
+	void BeginFrame();
+
+	/**
+	 * @brief 현재 프레임 버퍼에서 메모리를 할당하는 함수
+	 * @param InSize 할당 크기
+	 * @param InAlignment 정렬 단위 (2의 거듭제곱)
+	 * @return 할당된 메모리 주소 (다음 프레임이 끝날 때까지 유효)
+	 */
+	void* Allocate(size_t InSize, size_t InAlignment = DefaultAlignment)
+	{
+		FFrameBuffer& Buffer = Buffers[CurrentBufferIndex];
+
+		uint8* AlignedCursor = AlignPointer(Buffer.Cursor, InAlignment);
+		if (AlignedCursor && AlignedCursor + InSize <= Buffer.End)
+		{
+			Buffer.Cursor = AlignedCursor + InSize;
+			Buffer.UsedBytes += InSize;
+			++Buffer.NumAllocations;
+			return AlignedCursor;
+		}
+
+		return AllocateSlow(InSize, InAlignment);
+	}
+
+	/**
+	 * @brief 가장 마지막 할당이라면 커서를 되돌려 공간을 반환하는 함수
+	 * 그 외의 주소는 무시하며, 메모리는 프레임 재설정 시점에 회수된다
+	 */
+	void Free(void* InMemory, size_t InSize);
+
+	/**
+	 * @brief 현재 프레임 버퍼에 객체를 생성하는 함수
+	 */
+	template <typename T, typename... ArgsType>
+	T* New(ArgsType&&... InArgs)
+	{
+		return new(Allocate(sizeof(T), alignof(T))) T(std::forward<ArgsType>(InArgs)...);
+	}
+
+	// Stat
+	uint64 GetFrameNumber() const { return FrameNumber; }
+	size_t GetUsedBytes() const { return Buffers[CurrentBufferIndex].UsedBytes; }
+	uint32 GetNumAllocations() const { return Buffers[CurrentBufferIndex].NumAllocations; }
+	size_t GetLastFrameUsedBytes() const { return LastFrameUsedBytes; }
+	size_t GetHighWaterMark() const { return HighWaterMark; }
+	size_t GetReservedBytes() const { return ReservedBytes; }
+
+private:
+	struct FPage
+	{
+		uint8* Memory;
+		size_t Size;
+	};
+
+	/**
+	 * @param Pages 재사용되는 기본 크기 페이지 목록
+	 * @param OversizedPages 페이지 크기를 넘는 할당을 위한 전용 메모리 (버퍼 재설정 시 반환)
+	 * @param PageIndex 현재 할당 중인 Pages 인덱스
+	 */
+	struct FFrameBuffer
+	{
+		TArray<FPage> Pages;
+		TArray<FPage> OversizedPages;
+		int32 PageIndex = -1;
+		uint8* Cursor = nullptr;
+		uint8* End = nullptr;
+		size_t UsedBytes = 0;
+		uint32 NumAllocations = 0;
+	};
+
+	FFrameArena() = default;
+	~FFrameArena();
+
+	static uint8* AlignPointer(uint8* InPointer, size_t InAlignment)
+	{
+		return reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(InPointer) + InAlignment - 1) &
+			~(static_cast<uintptr_t>(InAlignment) - 1));
+	}
+
+	void* AllocateSlow(size_t InSize, size_t InAlignment);
+	void ResetBuffer(FFrameBuffer& InBuffer);
+	FPage AllocatePage(size_t InSize);
+	void FreePage(const FPage& InPage);
+
+	FFrameBuffer Buffers[NumBufferedFrames];
+	uint32 CurrentBufferIndex = 0;
+	uint64 FrameNumber = 0;
+
+	size_t LastFrameUsedBytes = 0;
+	size_t HighWaterMark = 0;
+	size_t ReservedBytes = 0;
+};
+
+/**
+ * @brief FFrameArena를 사용하는 STL 호환 할당자
+ * TArray<T, TFrameAllocator<T>> (또는 TFrameArray<T>)처럼 사용하며, 컨테이너는 다음 프레임이 끝나기 전에 파괴되어야 한다
+ */
+template <typename T>
+class TFrameAllocator
+{
+public:
+	using value_type = T;
+
+	TFrameAllocator() noexcept = default;
+
+	template <typename OtherType>
+	TFrameAllocator(const TFrameAllocator<OtherType>&) noexcept
+	{
+	}
+
+	T* allocate(size_t InCount)
+	{
+		return static_cast<T*>(FFrameArena::GetInstance().Allocate(InCount * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T* InMemory, size_t InCount) noexcept
+	{
+		FFrameArena::GetInstance().Free(InMemory, InCount * sizeof(T));
+	}
+
+	template <typename OtherType>
+	bool operator==(const TFrameAllocator<OtherType>&) const noexcept { return true; }
+
+	template <typename OtherType>
+	bool operator!=(const TFrameAllocator<OtherType>&) const noexcept { return false; }
+};
+
+template <typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
@@ -247,3 +247,6 @@ T* GetTypedOuter(const UObject* InObject)
 }
 
 extern TArray<TObjectPtr<UObject>> GUObjectArray;
+
+// GUObjectArray와 같은 인덱스를 사용하는 슬롯별 시리얼 넘버 (0은 빈 슬롯)
+extern TArray<uint32> GUObjectSerialNumbers;
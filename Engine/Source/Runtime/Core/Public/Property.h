@@ -0,0 +1,192 @@
+#pragma once
+#include <cstddef>
+#include "Global/Types.h"
+#include "Global/Vector.h"
+
+/**
+ * @brief 리플렉션 프로퍼티 타입 태그
+ * 직렬화 방식(통째 복사 가능 여부, JSON 표현)을 결정하는 데 사용된다
+ */
+enum class EPropertyType : uint8
+{
+	Bool,
+	UInt8,
+	Int32,
+	UInt32,
+	Float,
+	Vector,
+	Vector2,
+	Vector4,
+	Enum,
+	String
+};
+
+/**
+ * @brief 프로퍼티 플래그
+ * Transient: 어떤 직렬화에도 포함하지 않음
+ * NoTextExport: 바이너리에는 포함하되 JSON 같은 텍스트 포맷에서는 제외 (키 등으로 따로 저장되는 값)
+ */
+enum class EPropertyFlags : uint8
+{
+	None = 0,
+	Transient = 1 << 0,
+	NoTextExport = 1 << 1
+};
+
+inline bool HasPropertyFlag(EPropertyFlags InFlags, EPropertyFlags InFlag)
+{
+	return (static_cast<uint8>(InFlags) & static_cast<uint8>(InFlag)) != 0;
+}
+
+/**
+ * @brief 멤버 타입으로부터 프로퍼티 타입 태그를 결정하는 트레잇
+ * 등록되지 않은 타입을 PROPERTY 매크로에 넘기면 컴파일 에러가 발생한다
+ */
+template <typename T, typename = void>
+struct TPropertyTypeTraits;
+
+template <> struct TPropertyTypeTraits<bool> { static constexpr EPropertyType Type = EPropertyType::Bool; };
+template <> struct TPropertyTypeTraits<uint8> { static constexpr EPropertyType Type = EPropertyType::UInt8; };
+template <> struct TPropertyTypeTraits<int32> { static constexpr EPropertyType Type = EPropertyType::Int32; };
+template <> struct TPropertyTypeTraits<uint32> { static constexpr EPropertyType Type = EPropertyType::UInt32; };
+template <> struct TPropertyTypeTraits<float> { static constexpr EPropertyType Type = EPropertyType::Float; };
+template <> struct TPropertyTypeTraits<FVector> { static constexpr EPropertyType Type = EPropertyType::Vector; };
+template <> struct TPropertyTypeTraits<FVector2> { static constexpr EPropertyType Type = EPropertyType::Vector2; };
+template <> struct TPropertyTypeTraits<FVector4> { static constexpr EPropertyType Type = EPropertyType::Vector4; };
+template <> struct TPropertyTypeTraits<FString> { static constexpr EPropertyType Type = EPropertyType::String; };
+
+template <typename T>
+struct TPropertyTypeTraits<T, std::enable_if_t<std::is_enum_v<T>>>
+{
+	static constexpr EPropertyType Type = EPropertyType::Enum;
+};
+
+/**
+ * @brief 리플렉션 프로퍼티 하나의 정보
+ * @param Name 프로퍼티 이름 (직렬화 키로 사용)
+ * @param Offset 객체 시작 주소로부터의 오프셋
+ * @param Size 프로퍼티 크기
+ * @param Type 타입 태그
+ * @param Flags 직렬화 플래그
+ */
+struct FProperty
+{
+	const char* Name;
+	uint32 Offset;
+	uint32 Size;
+	EPropertyType Type;
+	EPropertyFlags Flags;
+
+	bool IsTriviallyCopyable() const { return Type != EPropertyType::String; }
+
+	void* GetValuePtr(void* InObject) const { return static_cast<uint8*>(InObject) + Offset; }
+	const void* GetValuePtr(const void* InObject) const { return static_cast<const uint8*>(InObject) + Offset; }
+
+	template <typename T>
+	T& GetValue(void* InObject) const { return *static_cast<T*>(GetValuePtr(InObject)); }
+
+	template <typename T>
+	const T& GetValue(const void* InObject) const { return *static_cast<const T*>(GetValuePtr(InObject)); }
+};
+
+/**
+ * @brief 직렬화 단계 하나
+ * 메모리상 연속된 통째 복사 가능 프로퍼티 구간이거나, 개별 핸들러가 필요한 프로퍼티 하나를 나타낸다
+ * @param Offset 구간 시작 오프셋
+ * @param Size 구간 크기
+ * @param PropertyIndex 개별 처리 대상 프로퍼티 인덱스 (통째 복사 구간이면 INDEX_NONE)
+ */
+struct FPropertyRun
+{
+	static constexpr int32 INDEX_NONE = -1;
+
+	uint32 Offset;
+	uint32 Size;
+	int32 PropertyIndex = INDEX_NONE;
+
+	bool IsBulkRun() const { return PropertyIndex == INDEX_NONE; }
+};
+
+/**
+ * @brief 클래스 / 구조체 하나의 직렬화 프로퍼티 목록
+ * Finalize 시점에 선언 순서를 유지한 채로 인접한 통째 복사 가능 프로퍼티를 하나의 FPropertyRun으로 병합해 둔다
+ * @param Properties 선언 순서대로 정렬된 프로퍼티 목록
+ * @param SerializeRuns 선언 순서대로 정렬된 직렬화 단계
+ * @param StructSize 구조체 전체 크기
+ */
+class FPropertyTable
+{
+public:
+	FPropertyTable() = default;
+	explicit FPropertyTable(uint32 InStructSize) : StructSize(InStructSize) {}
+
+	void AddProperty(const char* InName, uint32 InOffset, uint32 InSize, EPropertyType InType,
+	                 EPropertyFlags InFlags = EPropertyFlags::None);
+	void Finalize();
+
+	const FProperty* FindProperty(const char* InName) const;
+
+	/**
+	 * @brief 이름과 타입이 같은 프로퍼티를 다른 테이블의 객체로 복사하는 함수
+	 * 서로 다른 타입(예: Component -> Metadata) 사이에서 필드를 일일이 나열하지 않고 값을 옮길 때 사용한다
+	 * @return 복사된 프로퍼티 수
+	 */
+	static int32 CopyMatchingProperties(const FPropertyTable& InSourceTable, const void* InSource,
+	                                    const FPropertyTable& InDestTable, void* OutDest);
+
+	// Getter
+	const TArray<FProperty>& GetProperties() const { return Properties; }
+	const TArray<FPropertyRun>& GetSerializeRuns() const { return SerializeRuns; }
+	uint32 GetStructSize() const { return StructSize; }
+
+	/**
+	 * @brief 구조체 전체가 패딩 없이 하나의 통째 복사 구간으로 이루어져 있는지 여부
+	 * true라면 이 구조체의 배열은 배열 전체를 한 번에 복사할 수 있다
+	 */
+	bool IsFullyTrivial() const { return bIsFullyTrivial; }
+
+private:
+	TArray<FProperty> Properties;
+	TArray<FPropertyRun> SerializeRuns;
+	uint32 StructSize = 0;
+	bool bIsFullyTrivial = false;
+};
+
+/**
+ * @brief 프로퍼티 테이블 선언 / 구현 매크로
+ * 선언부에 DECLARE_PROPERTY_TABLE()을, 구현부에 BEGIN_PROPERTY_TABLE ~ END_PROPERTY_TABLE을 배치한다
+ * UObject 파생 클래스는 IMPLEMENT_CLASS 대신 IMPLEMENT_CLASS_WITH_PROPERTIES를 사용하면 UClass에 테이블이 연결된다
+ *
+ * 예시)
+ *	BEGIN_PROPERTY_TABLE(FPrimitiveMetadata)
+ *		PROPERTY(Location)
+ *		PROPERTY_FLAGS(ID, EPropertyFlags::NoTextExport)
+ *	END_PROPERTY_TABLE()
+ */
+#define DECLARE_PROPERTY_TABLE() \
+public: \
+    static const FPropertyTable& StaticPropertyTable();
+
+#define BEGIN_PROPERTY_TABLE(TypeName) \
+    const FPropertyTable& TypeName::StaticPropertyTable() \
+    { \
+        using ThisPropertyOwner = TypeName; \
+        static const FPropertyTable Table = [] \
+        { \
+            FPropertyTable Result(static_cast<uint32>(sizeof(ThisPropertyOwner)));
+
+#define PROPERTY_NAMED_FLAGS(Member, DisplayName, InFlags) \
+            Result.AddProperty(DisplayName, static_cast<uint32>(offsetof(ThisPropertyOwner, Member)), \
+                static_cast<uint32>(sizeof(ThisPropertyOwner::Member)), \
+                TPropertyTypeTraits<std::remove_cv_t<decltype(ThisPropertyOwner::Member)>>::Type, InFlags);
+
+#define PROPERTY(Member) PROPERTY_NAMED_FLAGS(Member, #Member, EPropertyFlags::None)
+#define PROPERTY_NAMED(Member, DisplayName) PROPERTY_NAMED_FLAGS(Member, DisplayName, EPropertyFlags::None)
+#define PROPERTY_FLAGS(Member, InFlags) PROPERTY_NAMED_FLAGS(Member, #Member, InFlags)
+
+#define END_PROPERTY_TABLE() \
+            Result.Finalize(); \
+            return Result; \
+        }(); \
+        return Table; \
+    }
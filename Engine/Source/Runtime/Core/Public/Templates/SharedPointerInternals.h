@@ -63,7 +63,7 @@ public:
 	/**
 	 * @brief Shared 참조 카운트 감소 및 객체 파괴 처리
 	 */
-	void ReleaseSharedReference() const
+	void ReleaseSharedReference()
 	{
 		int32 OldCount;
 		if constexpr (Mode == ESPMode::ThreadSafe)
@@ -116,7 +116,7 @@ public:
 	/**
 	 * @brief Weak 참조 카운트 감소 및 제어 블록 해제 처리
 	 */
-	void ReleaseWeakReference() const
+	void ReleaseWeakReference()
 	{
 		int32 OldCount;
 		if constexpr (Mode == ESPMode::ThreadSafe)
@@ -251,7 +251,7 @@ public:
 
 		// 객체를 올바르게 정렬된 위치에 Placement New로 생성 - 여기서 생성자 인자 전달!
 		void* ObjectMemory = reinterpret_cast<char*>(Memory) + PaddedControllerSize;
-		T* ObjectPtr = new(ObjectMemory) T(Forward<Args>(InArgs)...);
+		T* ObjectPtr = new(ObjectMemory) T(std::forward<Args>(InArgs)...);
 
 		return Controller;
 	}
@@ -211,7 +211,7 @@ public:
 		Ptr = Other.Ptr;
 		Other.Ptr = TempPtr;
 
-		FReferenceControllerBase* TempController = RefController;
+		FReferenceControllerBase<Mode>* TempController = RefController;
 		RefController = Other.RefController;
 		Other.RefController = TempController;
 	}
@@ -298,7 +298,7 @@ TSharedPtr<T, Mode> MakeShared(Args&&... InArgs)
 {
 	// 제어 블록과 객체를 한 번에 할당하고 생성
 	FReferenceControllerWithObject<T, Mode>* Controller =
-		FReferenceControllerWithObject<T, Mode>::Create(Forward<Args>(InArgs)...);
+		FReferenceControllerWithObject<T, Mode>::Create(std::forward<Args>(InArgs)...);
 
 	// 객체 포인터는 올바르게 정렬된 위치에 존재
 	T* ObjectPtr = Controller->GetObjectPtr();
@@ -344,7 +344,7 @@ private:
 template<typename T, typename... Args>
 TUniquePtr<T> MakeUnique(Args&&... InArgs)
 {
-	return TUniquePtr<T>(new T(Forward<Args>(InArgs)...));
+	return TUniquePtr<T>(new T(std::forward<Args>(InArgs)...));
 }
 
 /**
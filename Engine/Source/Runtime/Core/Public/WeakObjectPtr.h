@@ -0,0 +1,241 @@
+#pragma once
+#include "Runtime/Core/Public/Object.h"
+
+/**
+ * @brief GUObjectArray 슬롯 인덱스와 시리얼 넘버로 구성된 8바이트 약참조 핸들
+ * 객체가 소멸되면 해당 슬롯의 시리얼 넘버가 0으로 초기화되므로, 소멸된 객체는 O(1)로 nullptr이 된다
+ * 포인터를 직접 들고 있지 않기 때문에 컨테이너나 렌더 측 프록시에 저장해도 안전하다
+ * @param ObjectIndex GUObjectArray 상의 슬롯 인덱스
+ * @param ObjectSerialNumber 핸들 생성 시점의 슬롯 시리얼 넘버
+ */
+struct FWeakObjectPtr
+{
+public:
+	FWeakObjectPtr() = default;
+
+	FWeakObjectPtr(nullptr_t)
+	{
+	}
+
+	explicit FWeakObjectPtr(const UObject* InObject)
+	{
+		Reset(InObject);
+	}
+
+	/**
+	 * @brief 핸들이 가리키는 객체를 교체하는 함수
+	 * Duplicate 등으로 슬롯 등록 없이 만들어진 객체는 null 핸들로 처리한다
+	 * @param InObject 새로 참조할 객체
+	 */
+	void Reset(const UObject* InObject)
+	{
+		if (InObject)
+		{
+			const int32 Index = static_cast<int32>(InObject->GetInternalIndex());
+			if (GUObjectArray.IsValidIndex(Index) && GUObjectArray[Index].Get() == InObject)
+			{
+				ObjectIndex = Index;
+				ObjectSerialNumber = GUObjectSerialNumbers[Index];
+				return;
+			}
+		}
+
+		Reset();
+	}
+
+	void Reset()
+	{
+		ObjectIndex = INVALID_OBJECT_INDEX;
+		ObjectSerialNumber = 0;
+	}
+
+	/**
+	 * @brief 핸들이 아직 살아있는 객체를 가리키는지 판단하는 함수
+	 * 음수 인덱스는 unsigned 비교 한 번으로 걸러지며, 이후 시리얼 넘버 로드 후 비교만 수행한다
+	 */
+	bool IsValid() const
+	{
+		return static_cast<uint32>(ObjectIndex) < static_cast<uint32>(GUObjectSerialNumbers.Num()) &&
+			GUObjectSerialNumbers[ObjectIndex] == ObjectSerialNumber;
+	}
+
+	/**
+	 * @brief 핸들이 한 번이라도 객체를 가리켰지만 그 객체가 소멸된 상태인지 판단하는 함수
+	 */
+	bool IsStale() const
+	{
+		return ObjectIndex != INVALID_OBJECT_INDEX && !IsValid();
+	}
+
+	UObject* Get() const
+	{
+		return IsValid() ? GUObjectArray[ObjectIndex].Get() : nullptr;
+	}
+
+	bool operator==(const FWeakObjectPtr& InOther) const
+	{
+		return ObjectIndex == InOther.ObjectIndex && ObjectSerialNumber == InOther.ObjectSerialNumber;
+	}
+
+	bool operator!=(const FWeakObjectPtr& InOther) const
+	{
+		return !(*this == InOther);
+	}
+
+	int32 GetObjectIndex() const { return ObjectIndex; }
+	uint32 GetObjectSerialNumber() const { return ObjectSerialNumber; }
+
+private:
+	static constexpr int32 INVALID_OBJECT_INDEX = -1;
+
+	int32 ObjectIndex = INVALID_OBJECT_INDEX;
+	uint32 ObjectSerialNumber = 0;
+};
+
+static_assert(sizeof(FWeakObjectPtr) == 8, "FWeakObjectPtr는 8바이트 핸들이어야 한다");
+
+/**
+ * @brief 타입 정보를 가진 약참조 핸들
+ * 언리얼 엔진의 TWeakObjectPtr을 프로젝트 상황에 맞게 로컬라이징한 버전
+ * 선택 상태, 기즈모 타겟처럼 대상이 먼저 소멸될 수 있는 참조에 사용한다
+ */
+template <typename T>
+struct TWeakObjectPtr
+{
+	static_assert(!std::is_void_v<T>, "TWeakObjectPtr<T>는 void 타입으로 사용할 수 없습니다");
+
+public:
+	using ElementType = T;
+
+	TWeakObjectPtr() = default;
+
+	TWeakObjectPtr(nullptr_t)
+	{
+	}
+
+	TWeakObjectPtr(const T* InObject)
+		: WeakPtr(InObject)
+	{
+	}
+
+	template <typename U,
+	          typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+	TWeakObjectPtr(const TObjectPtr<U>& InObjectPtr)
+		: WeakPtr(InObjectPtr.Get())
+	{
+	}
+
+	template <typename U,
+	          typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+	TWeakObjectPtr(const TWeakObjectPtr<U>& InOther)
+		: WeakPtr(InOther.WeakPtr)
+	{
+	}
+
+	TWeakObjectPtr& operator=(nullptr_t)
+	{
+		WeakPtr.Reset();
+		return *this;
+	}
+
+	TWeakObjectPtr& operator=(const T* InObject)
+	{
+		WeakPtr.Reset(InObject);
+		return *this;
+	}
+
+	template <typename U,
+	          typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+	TWeakObjectPtr& operator=(const TObjectPtr<U>& InObjectPtr)
+	{
+		WeakPtr.Reset(InObjectPtr.Get());
+		return *this;
+	}
+
+	void Reset() { WeakPtr.Reset(); }
+
+	// 소멸된 객체일 경우 nullptr 반환
+	T* Get() const
+	{
+		return static_cast<T*>(WeakPtr.Get());
+	}
+
+	bool IsValid() const { return WeakPtr.IsValid(); }
+	bool IsStale() const { return WeakPtr.IsStale(); }
+
+	T* operator->() const
+	{
+		return Get();
+	}
+
+	T& operator*() const
+	{
+		return *Get();
+	}
+
+	explicit operator bool() const
+	{
+		return IsValid();
+	}
+
+	bool operator!() const
+	{
+		return !IsValid();
+	}
+
+	template <typename U>
+	bool operator==(const TWeakObjectPtr<U>& InOther) const
+	{
+		return WeakPtr == InOther.WeakPtr;
+	}
+
+	template <typename U>
+	bool operator!=(const TWeakObjectPtr<U>& InOther) const
+	{
+		return WeakPtr != InOther.WeakPtr;
+	}
+
+	bool operator==(const T* InOther) const
+	{
+		return Get() == InOther;
+	}
+
+	bool operator!=(const T* InOther) const
+	{
+		return Get() != InOther;
+	}
+
+	const FWeakObjectPtr& GetWeakHandle() const { return WeakPtr; }
+
+	template <typename U>
+	friend struct TWeakObjectPtr;
+
+private:
+	FWeakObjectPtr WeakPtr;
+};
+
+static_assert(sizeof(TWeakObjectPtr<UObject>) == 8, "TWeakObjectPtr는 8바이트 핸들이어야 한다");
+
+// 해시 함수 지원
+namespace std
+{
+	template <>
+	struct hash<FWeakObjectPtr>
+	{
+		size_t operator()(const FWeakObjectPtr& InPtr) const noexcept
+		{
+			const uint64 Key = (static_cast<uint64>(InPtr.GetObjectSerialNumber()) << 32) |
+				static_cast<uint32>(InPtr.GetObjectIndex());
+			return hash<uint64>{}(Key);
+		}
+	};
+
+	template <typename T>
+	struct hash<TWeakObjectPtr<T>>
+	{
+		size_t operator()(const TWeakObjectPtr<T>& InPtr) const noexcept
+		{
+			return hash<FWeakObjectPtr>{}(InPtr.GetWeakHandle());
+		}
+	};
+}
@@ -35,7 +35,7 @@ void UWorld::Tick(float DeltaSeconds) const
 		return;
 	}
 
-	const TArray<TObjectPtr<AActor>>& Actors = Level->GetLevelActors();
+	const TSparseArray<TObjectPtr<AActor>>& Actors = Level->GetLevelActors();
 
 	for (const auto& Actor : Actors)
 	{
@@ -75,7 +75,7 @@ void UWorld::InitializeActorsForPlay() const
 		return;
 	}
 
-	const TArray<TObjectPtr<AActor>>& Actors = Level->GetLevelActors();
+	const TSparseArray<TObjectPtr<AActor>>& Actors = Level->GetLevelActors();
 	for (const auto& Actor : Actors)
 	{
 		if (Actor)
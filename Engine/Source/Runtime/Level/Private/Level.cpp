@@ -21,6 +21,9 @@ ULevel::ULevel(const FName& InName)
 
 ULevel::~ULevel()
 {
+	TransformHierarchy.Reset();
+	ResetPrimitiveProxies();
+
 	for (auto& Actor : Actors)
 	{
 		if (Actor)
@@ -40,6 +43,9 @@ ULevel::~ULevel()
  */
 void ULevel::Release()
 {
+	TransformHierarchy.Reset();
+	ResetPrimitiveProxies();
+
 	for (auto& Actor : Actors)
 	{
 		if (Actor)
@@ -69,6 +75,268 @@ void ULevel::Cleanup()
 {
 }
 
+/**
+ * @brief 원형(Archetype) Actor를 복제하여 주어진 Transform마다 Actor를 일괄 생성하는 함수
+ * 메시, 머티리얼 등 공유 리소스는 원형에서 한 번만 확인된 것을 그대로 사용하며,
+ * 컴포넌트는 연속된 메모리 블록에 할당하고 Dirty 전파와 레벨 등록은 모든 생성이 끝난 뒤 한 번에 처리한다
+ * @param InTemplate 복제할 원형 Actor (레벨에 등록되지 않은 Actor여도 무방)
+ * @param InTransforms 생성할 Actor들의 Transform
+ * @param bInAddToLevel false면 레벨 등록을 호출자에게 맡김 (여러 번의 일괄 생성 결과를 다른 순서로 등록할 때)
+ * @return 생성된 Actor 목록
+ */
+TArray<TObjectPtr<AActor>> ULevel::SpawnActors(TObjectPtr<AActor> InTemplate, TArrayView<const FTransform> InTransforms,
+                                               bool bInAddToLevel)
+{
+	TArray<TObjectPtr<AActor>> SpawnedActors;
+	if (!InTemplate || InTransforms.IsEmpty())
+	{
+		return SpawnedActors;
+	}
+
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	TObjectPtr<UClass> ActorClass = InTemplate->GetClass();
+	const int32 SpawnCount = InTransforms.Num();
+
+	// Actor 이름 접두사는 클래스 이름에서 A 접두사를 제외한 형태로 사용 (Factory 규칙과 동일)
+	FString NamePrefix = ActorClass->GetClassTypeName().ToString();
+	if (!NamePrefix.empty() && NamePrefix[0] == 'A')
+	{
+		NamePrefix.erase(0, 1);
+	}
+	NamePrefix += "_";
+
+	SpawnedActors.Reserve(SpawnCount);
+	InTemplate->ReserveBatchAllocation(SpawnCount);
+
+	// 1단계: 생성 및 상태 복사 (Dirty 전파 없음)
+	for (const FTransform& Transform : InTransforms)
+	{
+		TObjectPtr<AActor> NewActor = Cast<AActor>(ActorClass->CreateDefaultObject());
+		if (!NewActor)
+		{
+			continue;
+		}
+
+		NewActor->SetOuter(this);
+		NewActor->SetDisplayName(NamePrefix + to_string(ActorClass->GetNextGenNumber()));
+		NewActor->EnsureRootComponent();
+		NewActor->CopyFromArchetype(InTemplate);
+		NewActor->GetRootComponent()->SetRelativeTransform(Transform, false);
+
+		SpawnedActors.Add(NewActor);
+	}
+
+	// 2단계: Transform Dirty 전파를 Actor당 한 번만 수행
+	for (const TObjectPtr<AActor>& Actor : SpawnedActors)
+	{
+		Actor->GetRootComponent()->MarkAsDirty();
+	}
+
+	// 3단계: 레벨 등록
+	if (bInAddToLevel)
+	{
+		Actors.Reserve(Actors.Num() + SpawnedActors.Num());
+		for (const TObjectPtr<AActor>& Actor : SpawnedActors)
+		{
+			AddLevelActor(Actor);
+		}
+	}
+
+	const auto EndTime = std::chrono::high_resolution_clock::now();
+	const double ElapsedMs = std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+	LastBatchSpawnTimePerActorUs = SpawnedActors.IsEmpty() ? 0.0 : ElapsedMs * 1000.0 / SpawnedActors.Num();
+
+	UE_LOG_SYSTEM("Level: %s %d개 일괄 생성 완료 (총 %.3f ms, Actor당 %.3f us)",
+	              ActorClass->GetClassTypeName().ToString().data(), SpawnedActors.Num(), ElapsedMs,
+	              LastBatchSpawnTimePerActorUs);
+
+	return SpawnedActors;
+}
+
+/**
+ * @brief Transform 계층에 기록된 Dirty 노드만 깊이 순으로 갱신하는 함수
+ * 구조가 바뀐 프레임에만 Actor를 순회해 계층을 다시 구성한다
+ * 월드 행렬이나 렌더 상태가 바뀐 프리미티브는 이어서 공간 인덱스의 리프와 렌더 프록시를 생성 / 갱신한다
+ */
+void ULevel::UpdateComponentTransforms()
+{
+	TransformHierarchy.Update(Actors);
+
+	TransformHierarchy.ForEachUpdatedComponent([this](USceneComponent* InComponent)
+	{
+		if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(InComponent))
+		{
+			UpdateSpatialProxy(Primitive);
+			Scene.AddPrimitive(Primitive);
+		}
+	});
+}
+
+/**
+ * @brief 범위가 생기면 리프를 만들고, 바뀌면 옮기고, 없어지면 제거하는 함수
+ * 이동은 Fat AABB를 벗어났을 때만 트리를 수정한다
+ */
+void ULevel::UpdateSpatialProxy(UPrimitiveComponent* InPrimitive)
+{
+	const int32 ProxyId = InPrimitive->GetSpatialProxyId();
+	if (!InPrimitive->HasBounds())
+	{
+		if (InPrimitive->GetSpatialTree())
+		{
+			SpatialTree.DestroyProxy(ProxyId);
+			InPrimitive->SetSpatialProxy(nullptr, -1);
+		}
+		return;
+	}
+
+	if (InPrimitive->GetSpatialTree())
+	{
+		SpatialTree.MoveProxy(ProxyId, InPrimitive->GetWorldBounds());
+	}
+	else
+	{
+		InPrimitive->SetSpatialProxy(&SpatialTree, SpatialTree.CreateProxy(InPrimitive->GetWorldBounds(), InPrimitive));
+	}
+}
+
+/**
+ * @brief Actor의 프리미티브가 가진 공간 인덱스 리프와 렌더 프록시를 제거하는 함수
+ */
+void ULevel::RemovePrimitiveProxies(const AActor* InActor)
+{
+	for (const TObjectPtr<UActorComponent>& Component : InActor->GetOwnedComponents())
+	{
+		UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component).Get();
+		if (!Primitive)
+		{
+			continue;
+		}
+
+		if (Primitive->GetSpatialTree() == &SpatialTree)
+		{
+			SpatialTree.DestroyProxy(Primitive->GetSpatialProxyId());
+			Primitive->SetSpatialProxy(nullptr, -1);
+		}
+
+		Scene.RemovePrimitive(Primitive);
+	}
+}
+
+void ULevel::ResetPrimitiveProxies()
+{
+	for (const TObjectPtr<AActor>& Actor : Actors)
+	{
+		if (Actor)
+		{
+			RemovePrimitiveProxies(Actor.Get());
+		}
+	}
+
+	SpatialTree.Reset();
+	Scene.Reset();
+}
+
+void ULevel::QueryPrimitivesInFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	SpatialTree.QueryFrustum(InFrustum, [&](int32 InProxyId)
+	{
+		UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(SpatialTree.GetUserData(InProxyId));
+		if (InFrustum.IntersectsAABB(Primitive->GetWorldBounds()))
+		{
+			OutPrimitives.Add(Primitive);
+		}
+		return true;
+	});
+}
+
+void ULevel::QueryPrimitivesInAABB(const FAABB& InBounds, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	SpatialTree.QueryAABB(InBounds, [&](int32 InProxyId)
+	{
+		UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(SpatialTree.GetUserData(InProxyId));
+		const FAABB& Bounds = Primitive->GetWorldBounds();
+		if (Bounds.Min.X <= InBounds.Max.X && Bounds.Max.X >= InBounds.Min.X &&
+			Bounds.Min.Y <= InBounds.Max.Y && Bounds.Max.Y >= InBounds.Min.Y &&
+			Bounds.Min.Z <= InBounds.Max.Z && Bounds.Max.Z >= InBounds.Min.Z)
+		{
+			OutPrimitives.Add(Primitive);
+		}
+		return true;
+	});
+}
+
+void ULevel::QueryPrimitivesInSphere(const FBoundingSphere& InSphere, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	const float RadiusSquared = InSphere.Radius * InSphere.Radius;
+	SpatialTree.QuerySphere(InSphere, [&](int32 InProxyId)
+	{
+		UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(SpatialTree.GetUserData(InProxyId));
+		const FAABB& Bounds = Primitive->GetWorldBounds();
+		const float DX = max(max(Bounds.Min.X - InSphere.Center.X, 0.0f), InSphere.Center.X - Bounds.Max.X);
+		const float DY = max(max(Bounds.Min.Y - InSphere.Center.Y, 0.0f), InSphere.Center.Y - Bounds.Max.Y);
+		const float DZ = max(max(Bounds.Min.Z - InSphere.Center.Z, 0.0f), InSphere.Center.Z - Bounds.Max.Z);
+		if (DX * DX + DY * DY + DZ * DZ <= RadiusSquared)
+		{
+			OutPrimitives.Add(Primitive);
+		}
+		return true;
+	});
+}
+
+void ULevel::QueryPrimitivesAlongRay(const FRay& InRay, float InMaxDistance,
+                                     TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	const FVector Origin(InRay.Origin.X, InRay.Origin.Y, InRay.Origin.Z);
+	FVector Direction(InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z);
+	Direction.Normalize();
+
+	constexpr float LargeValue = 1e30f;
+	const FVector InvDirection(Direction.X != 0.0f ? 1.0f / Direction.X : LargeValue,
+	                           Direction.Y != 0.0f ? 1.0f / Direction.Y : LargeValue,
+	                           Direction.Z != 0.0f ? 1.0f / Direction.Z : LargeValue);
+
+	TArray<TPair<float, UPrimitiveComponent*>> Hits;
+	SpatialTree.RayCast(Origin, Direction, InMaxDistance, [&](int32 InProxyId, float)
+	{
+		UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(SpatialTree.GetUserData(InProxyId));
+		const FAABB& Bounds = Primitive->GetWorldBounds();
+
+		float Distance = 0.0f;
+		if (FDynamicAABBTree::IntersectsRay(Origin, InvDirection, InMaxDistance, Bounds.Min, Bounds.Max, Distance))
+		{
+			Hits.Add({Distance, Primitive});
+		}
+		return true;
+	});
+
+	std::sort(Hits.begin(), Hits.end(), [](const TPair<float, UPrimitiveComponent*>& InA,
+	                                       const TPair<float, UPrimitiveComponent*>& InB)
+	{
+		return InA.first < InB.first;
+	});
+
+	for (const TPair<float, UPrimitiveComponent*>& Hit : Hits)
+	{
+		OutPrimitives.Add(Hit.second);
+	}
+}
+
+/**
+ * @brief Level에 Actor를 등록하는 함수
+ * 부여된 인덱스를 Actor에 기록해 두어 제거 시 검색 없이 O(1)로 처리한다
+ */
+void ULevel::AddLevelActor(TObjectPtr<AActor> InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+
+	InActor->SetLevelActorIndex(Actors.Add(InActor));
+	TransformHierarchy.MarkStructureDirty();
+}
+
 /**
  * @brief Level에서 Actor를 제거하는 함수
  */
@@ -79,8 +347,19 @@ bool ULevel::DestroyActor(TObjectPtr<AActor> InActor)
 		return false;
 	}
 
-	// LevelActors 리스트에서 제거
-	Actors.RemoveSingle(InActor);
+	// LevelActors 리스트에서 제거 (다른 Actor의 인덱스는 변하지 않음)
+	const int32 LevelActorIndex = InActor->GetLevelActorIndex();
+	if (Actors.IsAllocated(LevelActorIndex) && Actors[LevelActorIndex] == InActor)
+	{
+		Actors.RemoveAt(LevelActorIndex);
+	}
+	else
+	{
+		Actors.RemoveSingle(InActor);
+	}
+	InActor->SetLevelActorIndex(-1);
+	TransformHierarchy.RemoveActor(InActor.Get());
+	RemovePrimitiveProxies(InActor.Get());
 
 	// Outer 관계를 끊어서 GC에서 자연스럽게 정리되도록 함
 	InActor->SetOuter(nullptr);
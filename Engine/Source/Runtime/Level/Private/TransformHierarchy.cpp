@@ -0,0 +1,447 @@
+#include "pch.h"
+#include "Runtime/Level/Public/TransformHierarchy.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Global/MatrixMath.h"
+#include "Runtime/Actor/Public/Actor.h"
+#include "Runtime/Component/Public/SceneComponent.h"
+
+namespace
+{
+	// 한 작업이 맡을 최소 노드 수 (이보다 적으면 작업을 나누고 깨우는 비용이 더 큼)
+	constexpr int32 MinNodesPerTask = 2048;
+
+	int32 GetMaxTasks()
+	{
+		static const int32 MaxTasks = static_cast<int32>(max(std::thread::hardware_concurrency(), 1u));
+		return MaxTasks;
+	}
+}
+
+/**
+ * @brief 한 깊이의 Dirty 구간을 나눈 작업을 처리하는 상주 워커 스레드
+ * 스레드는 생성 시 한 번만 만들고, Run마다 깨워 작업 번호를 하나씩 가져가게 한 뒤 호출 스레드도 함께 처리한다
+ */
+class FTransformUpdateWorkers
+{
+public:
+	explicit FTransformUpdateWorkers(int32 InNumThreads)
+	{
+		Threads.Reserve(InNumThreads);
+		for (int32 Index = 0; Index < InNumThreads; ++Index)
+		{
+			Threads.Add(std::thread([this]() { WorkerMain(); }));
+		}
+	}
+
+	~FTransformUpdateWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			bIsStopping = true;
+		}
+		WakeCondition.notify_all();
+
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+
+	FTransformUpdateWorkers(const FTransformUpdateWorkers&) = delete;
+	FTransformUpdateWorkers& operator=(const FTransformUpdateWorkers&) = delete;
+
+	/**
+	 * @brief InTask(0) ~ InTask(InNumTasks - 1)을 모두 처리할 때까지 기다리는 함수
+	 */
+	void Run(int32 InNumTasks, const std::function<void(int32)>& InTask)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+
+			// 이전 Run에 늦게 합류한 워커가 작업 번호를 다 확인하고 빠질 때까지 대기
+			DoneCondition.wait(Lock, [this]() { return NumActiveWorkers == 0; });
+
+			CurrentTask = &InTask;
+			NumTasks = InNumTasks;
+			NumCompletedTasks = 0;
+			NextTask.store(0, std::memory_order_relaxed);
+			++Generation;
+		}
+		WakeCondition.notify_all();
+
+		ProcessTasks(InTask, InNumTasks);
+
+		std::unique_lock<std::mutex> Lock(Mutex);
+		DoneCondition.wait(Lock, [this]() { return NumCompletedTasks == NumTasks && NumActiveWorkers == 0; });
+		CurrentTask = nullptr;
+	}
+
+private:
+	void WorkerMain()
+	{
+		uint64 SeenGeneration = 0;
+		while (true)
+		{
+			const std::function<void(int32)>* Task;
+			int32 TaskCount;
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				WakeCondition.wait(Lock, [this, SeenGeneration]() { return bIsStopping || Generation != SeenGeneration; });
+				if (bIsStopping)
+				{
+					return;
+				}
+
+				SeenGeneration = Generation;
+				if (!CurrentTask)
+				{
+					continue;
+				}
+
+				Task = CurrentTask;
+				TaskCount = NumTasks;
+				++NumActiveWorkers;
+			}
+
+			ProcessTasks(*Task, TaskCount);
+
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				--NumActiveWorkers;
+			}
+			DoneCondition.notify_all();
+		}
+	}
+
+	void ProcessTasks(const std::function<void(int32)>& InTask, int32 InNumTasks)
+	{
+		int32 NumProcessed = 0;
+		for (int32 TaskIndex = NextTask.fetch_add(1); TaskIndex < InNumTasks; TaskIndex = NextTask.fetch_add(1))
+		{
+			InTask(TaskIndex);
+			++NumProcessed;
+		}
+
+		if (NumProcessed > 0)
+		{
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				NumCompletedTasks += NumProcessed;
+			}
+			DoneCondition.notify_all();
+		}
+	}
+
+	TArray<std::thread> Threads;
+
+	std::mutex Mutex;
+	std::condition_variable WakeCondition;
+	std::condition_variable DoneCondition;
+
+	const std::function<void(int32)>* CurrentTask = nullptr;
+	int32 NumTasks = 0;
+	int32 NumCompletedTasks = 0;
+	int32 NumActiveWorkers = 0;
+	uint64 Generation = 0;
+	bool bIsStopping = false;
+	std::atomic<int32> NextTask = 0;
+};
+
+FTransformHierarchy::~FTransformHierarchy()
+{
+	Reset();
+}
+
+void FTransformHierarchy::MarkDirty(int32 InIndex)
+{
+	if (!bIsStructureDirty && InIndex >= 0 && InIndex < Components.Num())
+	{
+		SetDirty(InIndex);
+	}
+}
+
+void FTransformHierarchy::RemoveActor(const AActor* InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+
+	for (const TObjectPtr<UActorComponent>& Component : InActor->GetOwnedComponents())
+	{
+		if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component).Get())
+		{
+			UnregisterComponent(SceneComponent);
+		}
+	}
+}
+
+void FTransformHierarchy::UnregisterComponent(USceneComponent* InComponent)
+{
+	if (!InComponent || InComponent->GetTransformHierarchy() != this)
+	{
+		return;
+	}
+
+	const int32 Index = InComponent->GetTransformHierarchyIndex();
+	if (Index >= 0 && Index < Components.Num() && Components[Index] == InComponent)
+	{
+		Components[Index] = nullptr;
+	}
+
+	InComponent->SetTransformHierarchy(nullptr, -1);
+	bIsStructureDirty = true;
+}
+
+void FTransformHierarchy::Reset()
+{
+	for (USceneComponent* Component : Components)
+	{
+		if (Component)
+		{
+			Component->SetTransformHierarchy(nullptr, -1);
+		}
+	}
+
+	Components.Empty();
+	ParentIndices.Empty();
+	WorldMatrices.Empty();
+	DepthOffsets.Empty();
+	DirtyBits.Empty();
+	DirtyIndices.Empty();
+	LocalBatch.Reset();
+	bIsStructureDirty = true;
+	LastUpdateCount = 0;
+}
+
+/**
+ * @brief 프레임당 한 번 호출되어 Dirty 노드의 월드 행렬을 깊이 순으로 계산하는 함수
+ * 로컬 행렬은 SoA 배치로 한 번에 계산하고, 같은 깊이의 노드는 서로 의존하지 않으므로 깊이 단위로 나눠 병렬 처리한다
+ */
+void FTransformHierarchy::Update(const TSparseArray<TObjectPtr<AActor>>& InActors)
+{
+	if (bIsStructureDirty)
+	{
+		Rebuild(InActors);
+	}
+
+	PropagateDirty();
+
+	// Dirty 노드 수집 (비트 스캔이므로 인덱스 오름차순 = 깊이 순)
+	DirtyIndices.Reset();
+	for (int32 WordIndex = 0; WordIndex < DirtyBits.Num(); ++WordIndex)
+	{
+		uint64 Word = DirtyBits[WordIndex];
+		while (Word)
+		{
+			DirtyIndices.Add((WordIndex << 6) + static_cast<int32>(CountTrailingZeros64(Word)));
+			Word &= Word - 1;
+		}
+		DirtyBits[WordIndex] = 0;
+	}
+
+	LastUpdateCount = DirtyIndices.Num();
+	if (DirtyIndices.IsEmpty())
+	{
+		return;
+	}
+
+	LocalBatch.Reset();
+	LocalBatch.Reserve(DirtyIndices.Num());
+	for (const int32 Index : DirtyIndices)
+	{
+		LocalBatch.Add(Components[Index]->GetRelativeQuatTransform());
+	}
+	LocalBatch.ComputeLocalMatrices();
+
+	// 깊이별 Dirty 구간을 순서대로 처리 (부모 깊이가 끝나야 자식 깊이를 시작)
+	int32 Position = 0;
+	for (int32 Depth = 0; Depth < GetNumDepths() && Position < DirtyIndices.Num(); ++Depth)
+	{
+		const int32 DepthEnd = DepthOffsets[Depth + 1];
+		const int32 Begin = Position;
+		while (Position < DirtyIndices.Num() && DirtyIndices[Position] < DepthEnd)
+		{
+			++Position;
+		}
+
+		UpdateDepth(Begin, Position);
+	}
+}
+
+/**
+ * @brief 레벨의 Actor를 순회해 노드를 깊이 순으로 다시 구성하는 함수
+ * 구조가 바뀐 직후에는 모든 노드를 Dirty로 두어 한 번 전부 계산한다
+ */
+void FTransformHierarchy::Rebuild(const TSparseArray<TObjectPtr<AActor>>& InActors)
+{
+	for (USceneComponent* Component : Components)
+	{
+		if (Component)
+		{
+			Component->SetTransformHierarchy(nullptr, -1);
+		}
+	}
+
+	GatheredDepths.Reset();
+	GatheredComponents.Reset();
+
+	int32 MaxDepth = -1;
+	for (const TObjectPtr<AActor>& Actor : InActors)
+	{
+		if (!Actor)
+		{
+			continue;
+		}
+
+		for (const TObjectPtr<UActorComponent>& Component : Actor->GetOwnedComponents())
+		{
+			if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component).Get())
+			{
+				MaxDepth = max(MaxDepth, GatherComponent(SceneComponent));
+			}
+		}
+	}
+
+	// 깊이 기준 계수 정렬
+	DepthOffsets.Reset();
+	DepthOffsets.SetNum(MaxDepth + 2);
+	for (USceneComponent* Component : GatheredComponents)
+	{
+		++DepthOffsets[GatheredDepths[Component] + 1];
+	}
+	for (int32 Depth = 1; Depth < DepthOffsets.Num(); ++Depth)
+	{
+		DepthOffsets[Depth] += DepthOffsets[Depth - 1];
+	}
+
+	const int32 NumNodes = GatheredComponents.Num();
+	Components.Reset();
+	Components.SetNum(NumNodes);
+	ParentIndices.Reset();
+	ParentIndices.SetNum(NumNodes);
+	WorldMatrices.SetNum(NumNodes);
+
+	TArray<int32> NextOffsets = DepthOffsets;
+	for (USceneComponent* Component : GatheredComponents)
+	{
+		const int32 Index = NextOffsets[GatheredDepths[Component]]++;
+		Components[Index] = Component;
+		Component->SetTransformHierarchy(this, Index);
+	}
+
+	// 부모가 먼저 배치되므로 부모의 인덱스는 이미 기록되어 있음
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		USceneComponent* Parent = Components[Index]->GetParentAttachment();
+		ParentIndices[Index] = Parent ? Parent->GetTransformHierarchyIndex() : -1;
+	}
+
+	DirtyBits.Reset();
+	DirtyBits.SetNum((NumNodes + 63) >> 6);
+	for (uint64& Word : DirtyBits)
+	{
+		Word = ~0ull;
+	}
+	if (NumNodes & 63)
+	{
+		DirtyBits.Last() = (1ull << (NumNodes & 63)) - 1;
+	}
+
+	bIsStructureDirty = false;
+}
+
+/**
+ * @brief 컴포넌트와 그 조상을 수집하는 함수 (다른 Actor에 붙은 부모도 함께 포함)
+ * @return 컴포넌트의 깊이 (루트가 0)
+ */
+int32 FTransformHierarchy::GatherComponent(USceneComponent* InComponent)
+{
+	if (const int32* FoundDepth = GatheredDepths.Find(InComponent))
+	{
+		return *FoundDepth;
+	}
+
+	USceneComponent* Parent = InComponent->GetParentAttachment();
+	const int32 Depth = Parent ? GatherComponent(Parent) + 1 : 0;
+
+	GatheredDepths[InComponent] = Depth;
+	GatheredComponents.Add(InComponent);
+	return Depth;
+}
+
+/**
+ * @brief 부모가 Dirty인 노드를 Dirty로 만드는 함수
+ * 깊이 순 정렬이므로 앞에서부터 한 번 순회하면 여러 단계 아래까지 전파된다
+ */
+void FTransformHierarchy::PropagateDirty()
+{
+	if (DepthOffsets.Num() < 2)
+	{
+		return;
+	}
+
+	for (int32 Index = DepthOffsets[1]; Index < Components.Num(); ++Index)
+	{
+		if (IsDirty(ParentIndices[Index]))
+		{
+			SetDirty(Index);
+		}
+	}
+}
+
+/**
+ * @brief 한 깊이의 Dirty 구간을 계산하는 함수
+ * 구간이 작으면 호출 스레드에서 바로 처리하고, 크면 여러 작업으로 나눠 상주 워커와 함께 처리한다
+ */
+void FTransformHierarchy::UpdateDepth(int32 InBegin, int32 InEnd)
+{
+	const int32 Count = InEnd - InBegin;
+	const int32 NumTasks = min(GetMaxTasks(), Count / MinNodesPerTask);
+	if (NumTasks <= 1)
+	{
+		UpdateWorldMatrices(InBegin, InEnd);
+		return;
+	}
+
+	if (!Workers)
+	{
+		Workers = MakeUnique<FTransformUpdateWorkers>(GetMaxTasks() - 1);
+	}
+
+	const int32 ChunkSize = (Count + NumTasks - 1) / NumTasks;
+	Workers->Run(NumTasks, [this, InBegin, InEnd, ChunkSize](int32 InTaskIndex)
+	{
+		const int32 ChunkBegin = InBegin + InTaskIndex * ChunkSize;
+		UpdateWorldMatrices(ChunkBegin, min(ChunkBegin + ChunkSize, InEnd));
+	});
+}
+
+/**
+ * @brief DirtyIndices[InBegin, InEnd) 노드의 월드 행렬을 계산하고 컴포넌트에 알리는 함수
+ */
+void FTransformHierarchy::UpdateWorldMatrices(int32 InBegin, int32 InEnd)
+{
+	for (int32 Position = InBegin; Position < InEnd; ++Position)
+	{
+		const int32 Index = DirtyIndices[Position];
+		const int32 ParentIndex = ParentIndices[Index];
+
+		if (ParentIndex >= 0)
+		{
+			MatrixMath::Multiply(WorldMatrices[Index], WorldMatrices[ParentIndex], LocalBatch.GetLocalMatrix(Position));
+		}
+		else
+		{
+			WorldMatrices[Index] = LocalBatch.GetLocalMatrix(Position);
+		}
+
+		Components[Index]->OnWorldTransformMatrixUpdated();
+	}
+}
@@ -1,7 +1,12 @@
 #pragma once
 #include "Runtime/Core/Public/Object.h"
+#include "Runtime/Core/Public/Containers/TArrayView.h"
+#include "Runtime/Core/Public/Containers/TSparseArray.h"
 #include "Factory/Public/FactorySystem.h"
 #include "Factory/Public/NewObject.h"
+#include "Runtime/Level/Public/TransformHierarchy.h"
+#include "Physics/Public/DynamicAABBTree.h"
+#include "Runtime/Renderer/Public/Scene.h"
 
 class AAxis;
 class UGizmo;
@@ -49,7 +54,8 @@ public:
 	virtual void Render();
 	virtual void Cleanup();
 
-	const TArray<TObjectPtr<AActor>>& GetLevelActors() const { return Actors; }
+	// Actor 인덱스는 제거 전까지 유지되므로 외부에서 핸들로 보관할 수 있다
+	const TSparseArray<TObjectPtr<AActor>>& GetLevelActors() const { return Actors; }
 	TObjectPtr<UWorld> GetWorld() const override { return OwningWorld; }
 	void SetOwningWorld(TObjectPtr<UWorld> InWorld) { OwningWorld = InWorld; }
 
@@ -57,16 +63,68 @@ public:
 	TObjectPtr<T> SpawnActor(const FName& InName = FName::FName_None,
 	                         const FTransform& InTransform = {});
 
-	// Actor 삭제
+	// 원형 Actor를 복제하여 여러 Transform에 일괄 생성
+	// bInAddToLevel이 false면 생성만 하므로, 호출자가 원하는 순서로 AddLevelActor를 호출해야 함
+	TArray<TObjectPtr<AActor>> SpawnActors(TObjectPtr<AActor> InTemplate, TArrayView<const FTransform> InTransforms,
+	                                       bool bInAddToLevel = true);
+
+	// Actor 등록 / 삭제
+	void AddLevelActor(TObjectPtr<AActor> InActor);
 	bool DestroyActor(TObjectPtr<AActor> InActor);
 
+	/**
+	 * @brief 이번 프레임에 Dirty가 된 Scene Component의 월드 행렬을 한 번에 계산해 캐시에 기록하는 함수
+	 * 렌더링 전에 한 번 호출하며, 이후에는 모든 컴포넌트의 월드 행렬이 최신 상태이다
+	 */
+	void UpdateComponentTransforms();
+
+	const FTransformHierarchy& GetTransformHierarchy() const { return TransformHierarchy; }
+
+	/**
+	 * @brief 프리미티브 공간 질의 함수들
+	 * 동적 AABB 트리로 후보를 거른 뒤 캐시된 월드 AABB로 다시 판정하므로, 결과는 전체 순회와 같다
+	 * 범위가 없는 프리미티브와 숨김 여부는 호출자가 처리한다
+	 */
+	void QueryPrimitivesInFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	void QueryPrimitivesInAABB(const FAABB& InBounds, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	void QueryPrimitivesInSphere(const FBoundingSphere& InSphere, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/**
+	 * @brief 광선과 월드 AABB가 겹치는 프리미티브를 가까운 순으로 가져오는 함수
+	 * @param InMaxDistance 광선 길이
+	 */
+	void QueryPrimitivesAlongRay(const FRay& InRay, float InMaxDistance,
+	                             TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	const FDynamicAABBTree& GetSpatialTree() const { return SpatialTree; }
+
+	// 렌더 패스가 순회하는 프리미티브 프록시 (UpdateComponentTransforms 이후 최신)
+	const FScene& GetScene() const { return Scene; }
+
+	// 마지막 일괄 생성의 Actor당 소요 시간 (마이크로초)
+	double GetLastBatchSpawnTimePerActor() const { return LastBatchSpawnTimePerActorUs; }
+
 	// Flag Control
 	uint64 GetShowFlags() const { return ShowFlags; }
 	void SetShowFlags(uint64 InShowFlags) { ShowFlags = InShowFlags; }
 
 private:
-	TArray<TObjectPtr<AActor>> Actors;
+	TSparseArray<TObjectPtr<AActor>> Actors;
 	TObjectPtr<UWorld> OwningWorld;
+	double LastBatchSpawnTimePerActorUs = 0.0;
+
+	// 레벨 전체 Scene Component의 평탄화된 Transform 계층
+	FTransformHierarchy TransformHierarchy;
+
+	// 프리미티브마다 리프 하나를 가진 공간 인덱스 (Transform 갱신 직후에 함께 갱신)
+	FDynamicAABBTree SpatialTree;
+
+	// 프리미티브마다 프록시 하나를 가진 렌더 씬 (공간 인덱스와 같은 시점에 갱신)
+	FScene Scene;
+
+	void UpdateSpatialProxy(UPrimitiveComponent* InPrimitive);
+	void RemovePrimitiveProxies(const AActor* InActor);
+	void ResetPrimitiveProxies();
 
 	// 빌보드는 처음에 표시 안하는 게 좋다는 의견이 있어 빌보드만 꺼놓고 출력
 	uint64 ShowFlags = static_cast<uint64>(EEngineShowFlags::SF_Primitives) |
@@ -92,7 +150,7 @@ TObjectPtr<T> ULevel::SpawnActor(const FName& InName, const FTransform& InTransf
 
 	if (NewActor)
 	{
-		Actors.Add(NewActor);
+		AddLevelActor(TObjectPtr<AActor>(NewActor));
 	}
 
 	return NewActor;
@@ -0,0 +1,124 @@
+#pragma once
+#include "Runtime/Core/Public/ObjectPtr.h"
+#include "Runtime/Core/Public/Containers/TSparseArray.h"
+#include "Global/TransformBatch.h"
+
+class AActor;
+class USceneComponent;
+class FTransformUpdateWorkers;
+
+/**
+ * @brief 레벨 전체 Scene Component의 Transform 계층을 평탄한 배열로 보관하는 클래스
+ * 노드는 깊이 순으로 정렬되어 부모가 항상 자식보다 앞에 있고, 같은 깊이의 노드는 연속된 구간을 이룬다
+ *
+ * 등록된 컴포넌트의 월드 행렬은 노드 배열(WorldMatrices)이 보관한다
+ * 컴포넌트의 MarkAsDirty는 노드의 Dirty 비트를 세우고(컴포넌트의 Dirty는 Children을 따라 자손까지 즉시 전파),
+ * 프레임마다 호출되는 Update에서 부모의 Dirty를 자식 노드에 전파한 뒤 깊이 단위로 월드 행렬을 계산한다
+ * Update 전에 읽은 월드 행렬은 컴포넌트가 조상 체인으로 계산해 노드에 기록한다
+ * 한 깊이의 Dirty 노드가 많으면 그 깊이를 여러 작업으로 나눠 상주 워커 스레드에서 동시에 계산한다
+ *
+ * 노드 인덱스는 구조가 바뀔 때(Actor 추가 / 제거, 부모 변경) 다시 매겨지므로 외부에서 보관하지 않는다
+ */
+class FTransformHierarchy
+{
+public:
+	FTransformHierarchy() = default;
+	~FTransformHierarchy();
+
+	FTransformHierarchy(const FTransformHierarchy&) = delete;
+	FTransformHierarchy& operator=(const FTransformHierarchy&) = delete;
+
+	/**
+	 * @brief 노드 구성이 바뀌었음을 알리는 함수 (다음 Update에서 다시 구성)
+	 */
+	void MarkStructureDirty() { bIsStructureDirty = true; }
+
+	/**
+	 * @brief 노드의 Transform이 바뀌었음을 기록하는 함수 (USceneComponent::MarkAsDirty에서 호출)
+	 */
+	void MarkDirty(int32 InIndex);
+
+	/**
+	 * @brief 레벨에서 제거되는 Actor의 컴포넌트 등록을 해제하는 함수
+	 */
+	void RemoveActor(const AActor* InActor);
+
+	/**
+	 * @brief 컴포넌트 등록을 해제하는 함수 (삭제되는 컴포넌트의 소멸자에서도 호출)
+	 * 노드 자리는 다음 Update의 재구성 전까지 비워 둔다
+	 */
+	void UnregisterComponent(USceneComponent* InComponent);
+
+	/**
+	 * @brief 모든 컴포넌트의 등록을 해제하고 노드를 비우는 함수
+	 */
+	void Reset();
+
+	/**
+	 * @brief 필요하면 구조를 다시 구성하고, Dirty 노드의 월드 행렬을 갱신하는 함수
+	 * @param InActors 레벨의 Actor 목록 (구조를 다시 구성할 때만 순회)
+	 */
+	void Update(const TSparseArray<TObjectPtr<AActor>>& InActors);
+
+	/**
+	 * @brief 노드의 월드 행렬 (USceneComponent::GetWorldTransformMatrix에서 사용)
+	 */
+	const FMatrix& GetWorldMatrix(int32 InIndex) const { return WorldMatrices[InIndex]; }
+	void SetWorldMatrix(int32 InIndex, const FMatrix& InWorldMatrix) { WorldMatrices[InIndex] = InWorldMatrix; }
+
+	int32 Num() const { return Components.Num(); }
+	int32 GetNumDepths() const { return DepthOffsets.IsEmpty() ? 0 : DepthOffsets.Num() - 1; }
+
+	// 마지막 Update에서 월드 행렬을 다시 계산한 노드 수
+	int32 GetLastUpdateCount() const { return LastUpdateCount; }
+
+	/**
+	 * @brief 마지막 Update에서 월드 행렬을 다시 계산한 컴포넌트마다 콜백을 호출하는 함수 (깊이 순)
+	 */
+	template <typename FuncType>
+	void ForEachUpdatedComponent(FuncType InFunc) const
+	{
+		for (const int32 Index : DirtyIndices)
+		{
+			if (Components[Index])
+			{
+				InFunc(Components[Index]);
+			}
+		}
+	}
+
+private:
+	void Rebuild(const TSparseArray<TObjectPtr<AActor>>& InActors);
+	int32 GatherComponent(USceneComponent* InComponent);
+	void PropagateDirty();
+	void UpdateWorldMatrices(int32 InBegin, int32 InEnd);
+	void UpdateDepth(int32 InBegin, int32 InEnd);
+
+	bool IsDirty(int32 InIndex) const { return (DirtyBits[InIndex >> 6] >> (InIndex & 63)) & 1; }
+	void SetDirty(int32 InIndex) { DirtyBits[InIndex >> 6] |= 1ull << (InIndex & 63); }
+
+	// 깊이 순으로 정렬된 노드 (같은 인덱스끼리 대응)
+	TArray<USceneComponent*> Components;
+	TArray<int32> ParentIndices;
+	TArray<FMatrix> WorldMatrices;
+
+	// 깊이 d의 노드 구간은 [DepthOffsets[d], DepthOffsets[d + 1])
+	TArray<int32> DepthOffsets;
+
+	// 노드당 1비트
+	TArray<uint64> DirtyBits;
+
+	// 이번 Update에서 갱신할 노드 (오름차순이므로 깊이별로 연속)와 그 로컬 행렬 계산용 배치
+	TArray<int32> DirtyIndices;
+	FTransformBatch LocalBatch;
+
+	// Rebuild 중 컴포넌트별 깊이 (재사용)
+	TMap<USceneComponent*, int32> GatheredDepths;
+	TArray<USceneComponent*> GatheredComponents;
+
+	// 큰 깊이를 나눠 계산하는 워커 (처음 필요할 때 만들어 계층이 파괴될 때까지 재사용)
+	TUniquePtr<FTransformUpdateWorkers> Workers;
+
+	bool bIsStructureDirty = true;
+	int32 LastUpdateCount = 0;
+};
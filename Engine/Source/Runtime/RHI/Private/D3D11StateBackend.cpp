@@ -0,0 +1,85 @@
+#include "pch.h"
+#include "Runtime/RHI/Public/RHIStateCache.h"
+
+void FD3D11StateBackend::SetVertexShader(ID3D11VertexShader* InShader)
+{
+	DeviceContext->VSSetShader(InShader, nullptr, 0);
+}
+
+void FD3D11StateBackend::SetPixelShader(ID3D11PixelShader* InShader)
+{
+	DeviceContext->PSSetShader(InShader, nullptr, 0);
+}
+
+void FD3D11StateBackend::SetInputLayout(ID3D11InputLayout* InInputLayout)
+{
+	DeviceContext->IASetInputLayout(InInputLayout);
+}
+
+void FD3D11StateBackend::SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology)
+{
+	DeviceContext->IASetPrimitiveTopology(InTopology);
+}
+
+void FD3D11StateBackend::SetVertexBuffer(uint32 InSlot, ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset)
+{
+	UINT Stride = InStride;
+	UINT Offset = InOffset;
+	DeviceContext->IASetVertexBuffers(InSlot, 1, &InBuffer, &Stride, &Offset);
+}
+
+void FD3D11StateBackend::SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset)
+{
+	DeviceContext->IASetIndexBuffer(InBuffer, InFormat, InOffset);
+}
+
+void FD3D11StateBackend::SetRasterizerState(ID3D11RasterizerState* InState)
+{
+	DeviceContext->RSSetState(InState);
+}
+
+void FD3D11StateBackend::SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef)
+{
+	DeviceContext->OMSetDepthStencilState(InState, InStencilRef);
+}
+
+void FD3D11StateBackend::SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask)
+{
+	DeviceContext->OMSetBlendState(InState, InBlendFactor, InSampleMask);
+}
+
+void FD3D11StateBackend::SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView)
+{
+	if (InStage == ERHIShaderStage::Vertex)
+	{
+		DeviceContext->VSSetShaderResources(InSlot, 1, &InView);
+	}
+	else
+	{
+		DeviceContext->PSSetShaderResources(InSlot, 1, &InView);
+	}
+}
+
+void FD3D11StateBackend::SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler)
+{
+	if (InStage == ERHIShaderStage::Vertex)
+	{
+		DeviceContext->VSSetSamplers(InSlot, 1, &InSampler);
+	}
+	else
+	{
+		DeviceContext->PSSetSamplers(InSlot, 1, &InSampler);
+	}
+}
+
+void FD3D11StateBackend::SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer)
+{
+	if (InStage == ERHIShaderStage::Vertex)
+	{
+		DeviceContext->VSSetConstantBuffers(InSlot, 1, &InBuffer);
+	}
+	else
+	{
+		DeviceContext->PSSetConstantBuffers(InSlot, 1, &InBuffer);
+	}
+}
@@ -70,10 +70,16 @@ void FRHIDevice::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDevic
 	Device = InDevice;
 	DeviceContext = InDeviceContext;
 
+	StateBackend.SetDeviceContext(DeviceContext);
+	StateCache.SetBackend(&StateBackend);
+	StateCache.Invalidate();
+
 	// 상태 객체들 생성
 	CreateRasterizerStates();
 	CreateDepthStencilStates();
 	CreateBlendStates();
+	CreateDepthWriteStates();
+	CreateColorWriteStates();
 	CreateConstantBuffer();
 	CreateSamplerState();
 
@@ -115,6 +121,30 @@ void FRHIDevice::Shutdown()
 		BlendStateDisabled = nullptr;
 	}
 
+	if (DepthWriteEnabled)
+	{
+		DepthWriteEnabled->Release();
+		DepthWriteEnabled = nullptr;
+	}
+
+	if (DepthWriteDisabled)
+	{
+		DepthWriteDisabled->Release();
+		DepthWriteDisabled = nullptr;
+	}
+
+	if (ColorWriteEnabled)
+	{
+		ColorWriteEnabled->Release();
+		ColorWriteEnabled = nullptr;
+	}
+
+	if (ColorWriteDisabled)
+	{
+		ColorWriteDisabled->Release();
+		ColorWriteDisabled = nullptr;
+	}
+
 	if (ConstantBuffer)
 	{
 		ConstantBuffer->Release();
@@ -145,6 +175,14 @@ void FRHIDevice::Shutdown()
 		DefaultSamplerState = nullptr;
 	}
 
+	PipelineStates.Reset();
+	StaticMeshPipelineStates[0] = 0;
+	StaticMeshPipelineStates[1] = 0;
+	StaticMeshDepthOnlyPipelineState = 0;
+	StateCache.SetBackend(nullptr);
+	StateCache.Invalidate();
+	StateBackend.SetDeviceContext(nullptr);
+
 	SwapChain = nullptr;
 	Device = nullptr;
 	DeviceContext = nullptr;
@@ -799,8 +837,8 @@ void FRHIDevice::UpdateConstantBuffers(const FMatrix& ModelMatrix, const FMatrix
 		DeviceContext->Unmap(ConstantBuffer, 0);
 
 		// 상수 버퍼를 정점 셰이더와 픽셀 셰이더에 바인드
-		DeviceContext->VSSetConstantBuffers(0, 1, &ConstantBuffer);
-		DeviceContext->PSSetConstantBuffers(0, 1, &ConstantBuffer);
+		StateCache.SetConstantBuffer(ERHIShaderStage::Vertex, 0, ConstantBuffer);
+		StateCache.SetConstantBuffer(ERHIShaderStage::Pixel, 0, ConstantBuffer);
 	}
 	else
 	{
@@ -830,7 +868,7 @@ void FRHIDevice::UpdateHighLightConstantBuffers(const uint32 InPicked, const FVe
 		dataPtr->Gizmo = Gizmo;
 
 		DeviceContext->Unmap(HighLightCB, 0);
-		DeviceContext->VSSetConstantBuffers(2, 1, &HighLightCB); // b2 슬롯
+		StateCache.SetConstantBuffer(ERHIShaderStage::Vertex, 2, HighLightCB); // b2 슬롯
 	}
 	else
 	{
@@ -854,7 +892,7 @@ void FRHIDevice::UpdateColorConstantBuffers(const FVector4& InColor)
 		dataPtr->Color = InColor;
 
 		DeviceContext->Unmap(ColorCB, 0);
-		DeviceContext->PSSetConstantBuffers(3, 1, &ColorCB); // b3 슬롯
+		StateCache.SetConstantBuffer(ERHIShaderStage::Pixel, 3, ColorCB); // b3 슬롯
 	}
 	else
 	{
@@ -883,7 +921,7 @@ void FRHIDevice::UpdatePixelConstantBuffers(const FObjMaterialInfo& InMaterialIn
 		// 다른 매테리얼 속성들도 필요에 따라 추가 가능
 
 		DeviceContext->Unmap(PixelConstCB, 0);
-		DeviceContext->PSSetConstantBuffers(4, 1, &PixelConstCB); // b4 슬롯
+		StateCache.SetConstantBuffer(ERHIShaderStage::Pixel, 4, PixelConstCB); // b4 슬롯
 	}
 	else
 	{
@@ -902,11 +940,11 @@ void FRHIDevice::OMSetBlendState(bool bIsBlendMode)
 	if (bIsBlendMode && BlendStateEnabled)
 	{
 		float blendFactor[4] = {0, 0, 0, 0};
-		DeviceContext->OMSetBlendState(BlendStateEnabled, blendFactor, 0xffffffff);
+		StateCache.SetBlendState(BlendStateEnabled, blendFactor, 0xffffffff);
 	}
 	else if (!bIsBlendMode && BlendStateDisabled)
 	{
-		DeviceContext->OMSetBlendState(BlendStateDisabled, nullptr, 0xffffffff);
+		StateCache.SetBlendState(BlendStateDisabled, nullptr, 0xffffffff);
 	}
 	else
 	{
@@ -927,7 +965,7 @@ void FRHIDevice::RSSetState(EViewMode ViewMode)
 	auto* FoundState = RasterizerStates.Find(ViewMode);
 	if (FoundState && *FoundState)
 	{
-		DeviceContext->RSSetState(*FoundState);
+		StateCache.SetRasterizerState(*FoundState);
 	}
 	else
 	{
@@ -947,7 +985,7 @@ void FRHIDevice::OmSetDepthStencilState(EComparisonFunc CompareFunction)
 	auto* FoundState = DepthStencilStates.Find(CompareFunction);
 	if (FoundState && *FoundState)
 	{
-		DeviceContext->OMSetDepthStencilState(*FoundState, 1);
+		StateCache.SetDepthStencilState(*FoundState, 1);
 	}
 	else
 	{
@@ -967,7 +1005,7 @@ void FRHIDevice::OmSetBlendState(bool bEnableBlending)
 	ID3D11BlendState* BlendState = bEnableBlending ? BlendStateEnabled : BlendStateDisabled;
 	if (BlendState)
 	{
-		DeviceContext->OMSetBlendState(BlendState, nullptr, 0xFFFFFFFF);
+		StateCache.SetBlendState(BlendState, nullptr, 0xFFFFFFFF);
 	}
 	else
 	{
@@ -1003,24 +1041,126 @@ void FRHIDevice::PSSetDefaultSampler(UINT StartSlot)
 		return;
 	}
 
-	DeviceContext->PSSetSamplers(StartSlot, 1, &DefaultSamplerState);
+	StateCache.SetSampler(ERHIShaderStage::Pixel, StartSlot, DefaultSamplerState);
 }
 
 void FRHIDevice::SetShader(TObjectPtr<UShader> InShader)
 {
 	if (InShader)
 	{
-		DeviceContext->VSSetShader(InShader->GetVertexShader(), nullptr, 0);
-		DeviceContext->PSSetShader(InShader->GetPixelShader(), nullptr, 0);
-		DeviceContext->IASetInputLayout(InShader->GetInputLayout());
+		StateCache.SetVertexShader(InShader->GetVertexShader());
+		StateCache.SetPixelShader(InShader->GetPixelShader());
+		StateCache.SetInputLayout(InShader->GetInputLayout());
 	}
 	else
 	{
 		// Unbind shaders
-		DeviceContext->VSSetShader(nullptr, nullptr, 0);
-		DeviceContext->PSSetShader(nullptr, nullptr, 0);
-		DeviceContext->IASetInputLayout(nullptr);
+		StateCache.SetVertexShader(nullptr);
+		StateCache.SetPixelShader(nullptr);
+		StateCache.SetInputLayout(nullptr);
+	}
+}
+
+FRHIPipelineStateDesc FRHIDevice::MakePipelineStateDesc(TObjectPtr<UShader> InShader, EViewMode InRasterMode,
+                                                        bool bInEnableBlending) const
+{
+	FRHIPipelineStateDesc Desc;
+	if (InShader)
+	{
+		Desc.VertexShader = InShader->GetVertexShader();
+		Desc.PixelShader = InShader->GetPixelShader();
+		Desc.InputLayout = InShader->GetInputLayout();
+	}
+
+	if (auto* FoundState = RasterizerStates.Find(InRasterMode))
+	{
+		Desc.RasterizerState = *FoundState;
 	}
+
+	// OMSetBlendState와 같은 Blend Factor 사용
+	if (bInEnableBlending)
+	{
+		Desc.BlendState = BlendStateEnabled;
+		for (float& Factor : Desc.BlendFactor)
+		{
+			Factor = 0.0f;
+		}
+	}
+	else
+	{
+		Desc.BlendState = BlendStateDisabled;
+	}
+
+	return Desc;
+}
+
+FRHIPipelineStateHandle FRHIDevice::FindOrAddPipelineState(TObjectPtr<UShader> InShader, EViewMode InRasterMode,
+                                                           bool bInEnableBlending)
+{
+	if (!bIsInitialized)
+	{
+		UE_LOG_ERROR("RHIDevice: FindOrAddPipelineState 실패 - 초기화되지 않았습니다");
+		return 0;
+	}
+
+	return PipelineStates.FindOrAdd(MakePipelineStateDesc(InShader, InRasterMode, bInEnableBlending));
+}
+
+FRHIPipelineStateHandle FRHIDevice::FindOrAddPipelineState(TObjectPtr<UShader> InShader, EViewMode InRasterMode,
+                                                           bool bInEnableBlending, EComparisonFunc InDepthFunction)
+{
+	if (!bIsInitialized)
+	{
+		UE_LOG_ERROR("RHIDevice: FindOrAddPipelineState 실패 - 초기화되지 않았습니다");
+		return 0;
+	}
+
+	FRHIPipelineStateDesc Desc = MakePipelineStateDesc(InShader, InRasterMode, bInEnableBlending);
+	if (auto* FoundState = DepthStencilStates.Find(InDepthFunction))
+	{
+		// OmSetDepthStencilState와 같은 Stencil Ref 사용
+		Desc.DepthStencilState = *FoundState;
+		Desc.StencilRef = 1;
+	}
+
+	return PipelineStates.FindOrAdd(Desc);
+}
+
+FRHIPipelineStateHandle FRHIDevice::FindOrAddDepthOnlyPipelineState(FRHIPipelineStateHandle InBaseHandle)
+{
+	if (!bIsInitialized || !PipelineStates.IsValid(InBaseHandle))
+	{
+		UE_LOG_ERROR("RHIDevice: FindOrAddDepthOnlyPipelineState 실패 - 등록되지 않은 핸들입니다 - Handle: %d",
+		             (int)InBaseHandle);
+		return 0;
+	}
+
+	FRHIPipelineStateDesc Desc = PipelineStates.Get(InBaseHandle);
+	Desc.PixelShader = nullptr;
+	Desc.BlendState = ColorWriteDisabled;
+	for (float& Factor : Desc.BlendFactor)
+	{
+		Factor = 1.0f;
+	}
+
+	if (auto* FoundState = DepthStencilStates.Find(EComparisonFunc::LessEqual))
+	{
+		Desc.DepthStencilState = *FoundState;
+		Desc.StencilRef = 1;
+	}
+
+	return PipelineStates.FindOrAdd(Desc);
+}
+
+void FRHIDevice::SetPipelineState(FRHIPipelineStateHandle InHandle)
+{
+	if (!bIsInitialized || !PipelineStates.IsValid(InHandle))
+	{
+		UE_LOG_ERROR("RHIDevice: SetPipelineState 실패 - 등록되지 않은 핸들입니다 - Handle: %d", (int)InHandle);
+		return;
+	}
+
+	PipelineStates.Apply(InHandle, StateCache);
 }
 
 void FRHIDevice::SetScissorRect(int32 Left, int32 Top, int32 Right, int32 Bottom)
@@ -1048,24 +1188,15 @@ void FRHIDevice::OMSetDepthWriteEnabled(bool bEnabled)
 		return;
 	}
 
-	// 기본 Depth Stencil 상태 생성
-	D3D11_DEPTH_STENCIL_DESC desc = {};
-	desc.DepthEnable = TRUE;
-	desc.DepthWriteMask = bEnabled ? D3D11_DEPTH_WRITE_MASK_ALL : D3D11_DEPTH_WRITE_MASK_ZERO;
-	desc.DepthFunc = D3D11_COMPARISON_LESS;
-	desc.StencilEnable = FALSE;
-
-	ID3D11DepthStencilState* TempState = nullptr;
-	HRESULT hr = Device->CreateDepthStencilState(&desc, &TempState);
-	if (SUCCEEDED(hr))
-	{
-		DeviceContext->OMSetDepthStencilState(TempState, 1);
-		TempState->Release(); // 임시 상태이므로 즉시 해제
-	}
-	else
+	// Initialize에서 만들어 둔 상태를 바인딩 (상태 캐시가 포인터를 기억하므로 Shutdown까지 유지)
+	ID3D11DepthStencilState* State = bEnabled ? DepthWriteEnabled : DepthWriteDisabled;
+	if (!State)
 	{
-		UE_LOG_ERROR("RHIDevice: DepthStencilState 생성 실패 (HRESULT: 0x%08lX)", hr);
+		UE_LOG_ERROR("RHIDevice: OMSetDepthWriteEnabled 실패 - DepthStencilState가 생성되지 않았습니다");
+		return;
 	}
+
+	StateCache.SetDepthStencilState(State, 1);
 }
 
 void FRHIDevice::OMSetColorWriteEnabled(bool bEnabled)
@@ -1076,23 +1207,15 @@ void FRHIDevice::OMSetColorWriteEnabled(bool bEnabled)
 		return;
 	}
 
-	// 기본 Blend 상태 생성
-	D3D11_BLEND_DESC desc = {};
-	auto& rt = desc.RenderTarget[0];
-	rt.BlendEnable = FALSE;
-	rt.RenderTargetWriteMask = bEnabled ? D3D11_COLOR_WRITE_ENABLE_ALL : 0;
-
-	ID3D11BlendState* TempState = nullptr;
-	HRESULT hr = Device->CreateBlendState(&desc, &TempState);
-	if (SUCCEEDED(hr))
-	{
-		DeviceContext->OMSetBlendState(TempState, nullptr, 0xFFFFFFFF);
-		TempState->Release(); // 임시 상태이므로 즉시 해제
-	}
-	else
+	// Initialize에서 만들어 둔 상태를 바인딩 (상태 캐시가 포인터를 기억하므로 Shutdown까지 유지)
+	ID3D11BlendState* State = bEnabled ? ColorWriteEnabled : ColorWriteDisabled;
+	if (!State)
 	{
-		UE_LOG_ERROR("RHIDevice: BlendState 생성 실패 (HRESULT: 0x%08lX)", hr);
+		UE_LOG_ERROR("RHIDevice: OMSetColorWriteEnabled 실패 - BlendState가 생성되지 않았습니다");
+		return;
 	}
+
+	StateCache.SetBlendState(State, nullptr, 0xFFFFFFFF);
 }
 
 // 렌더 타겟 관리 메서드들
@@ -1111,6 +1234,11 @@ bool FRHIDevice::BeginFrame()
 		return false;
 	}
 
+	// 직전 프레임 통계를 보관하고, 프레임 밖(ImGui 등)에서 Context에 직접 바인딩했을 수 있으므로 캐시를 비움
+	LastFrameStateStats = StateCache.GetStats();
+	StateCache.ResetStats();
+	StateCache.Invalidate();
+
 	return true;
 }
 
@@ -0,0 +1,42 @@
+#include "pch.h"
+#include "Runtime/RHI/Public/RHIPipelineState.h"
+
+FRHIPipelineStateHandle FRHIPipelineStateRegistry::FindOrAdd(const FRHIPipelineStateDesc& InDesc)
+{
+	for (int32 Index = 1; Index < States.Num(); ++Index)
+	{
+		if (States[Index] == InDesc)
+		{
+			return static_cast<FRHIPipelineStateHandle>(Index);
+		}
+	}
+
+	if (States.IsEmpty())
+	{
+		States.Add(FRHIPipelineStateDesc());
+	}
+
+	if (States.Num() > UINT16_MAX)
+	{
+		return 0;
+	}
+
+	States.Add(InDesc);
+	return static_cast<FRHIPipelineStateHandle>(States.Num() - 1);
+}
+
+void FRHIPipelineStateRegistry::Apply(FRHIPipelineStateHandle InHandle, FRHIStateCache& InStateCache) const
+{
+	const FRHIPipelineStateDesc& Desc = States[InHandle];
+
+	InStateCache.SetVertexShader(Desc.VertexShader);
+	InStateCache.SetPixelShader(Desc.PixelShader);
+	InStateCache.SetInputLayout(Desc.InputLayout);
+	InStateCache.SetRasterizerState(Desc.RasterizerState);
+	InStateCache.SetBlendState(Desc.BlendState, Desc.BlendFactor);
+
+	if (Desc.DepthStencilState)
+	{
+		InStateCache.SetDepthStencilState(Desc.DepthStencilState, Desc.StencilRef);
+	}
+}
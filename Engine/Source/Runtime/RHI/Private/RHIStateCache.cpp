@@ -0,0 +1,158 @@
+#include "pch.h"
+#include "Runtime/RHI/Public/RHIStateCache.h"
+
+uint32 FRHIStateCacheStats::GetTotalSubmitted() const
+{
+	uint32 Total = 0;
+	for (const uint32 Count : NumSubmitted)
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+uint32 FRHIStateCacheStats::GetTotalFiltered() const
+{
+	uint32 Total = 0;
+	for (const uint32 Count : NumFiltered)
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+void FRHIStateCache::Invalidate()
+{
+	VertexShader.bIsKnown = false;
+	PixelShader.bIsKnown = false;
+	InputLayout.bIsKnown = false;
+	PrimitiveTopology.bIsKnown = false;
+	VertexBuffer.bIsKnown = false;
+	IndexBuffer.bIsKnown = false;
+	RasterizerState.bIsKnown = false;
+	DepthStencilState.bIsKnown = false;
+	BlendState.bIsKnown = false;
+
+	for (int32 Stage = 0; Stage < static_cast<int32>(ERHIShaderStage::Num); ++Stage)
+	{
+		for (TShadowSlot<ID3D11ShaderResourceView*>& Slot : ShaderResources[Stage])
+		{
+			Slot.bIsKnown = false;
+		}
+		for (TShadowSlot<ID3D11SamplerState*>& Slot : Samplers[Stage])
+		{
+			Slot.bIsKnown = false;
+		}
+		for (TShadowSlot<ID3D11Buffer*>& Slot : ConstantBuffers[Stage])
+		{
+			Slot.bIsKnown = false;
+		}
+	}
+}
+
+void FRHIStateCache::SetVertexShader(ID3D11VertexShader* InShader)
+{
+	if (Count(ERHIStateType::VertexShader, VertexShader.Update(InShader)))
+	{
+		Backend->SetVertexShader(InShader);
+	}
+}
+
+void FRHIStateCache::SetPixelShader(ID3D11PixelShader* InShader)
+{
+	if (Count(ERHIStateType::PixelShader, PixelShader.Update(InShader)))
+	{
+		Backend->SetPixelShader(InShader);
+	}
+}
+
+void FRHIStateCache::SetInputLayout(ID3D11InputLayout* InInputLayout)
+{
+	if (Count(ERHIStateType::InputLayout, InputLayout.Update(InInputLayout)))
+	{
+		Backend->SetInputLayout(InInputLayout);
+	}
+}
+
+void FRHIStateCache::SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology)
+{
+	if (Count(ERHIStateType::PrimitiveTopology, PrimitiveTopology.Update(InTopology)))
+	{
+		Backend->SetPrimitiveTopology(InTopology);
+	}
+}
+
+void FRHIStateCache::SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset)
+{
+	if (Count(ERHIStateType::VertexBuffer, VertexBuffer.Update({InBuffer, InStride, InOffset})))
+	{
+		Backend->SetVertexBuffer(0, InBuffer, InStride, InOffset);
+	}
+}
+
+void FRHIStateCache::SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset)
+{
+	if (Count(ERHIStateType::IndexBuffer, IndexBuffer.Update({InBuffer, InFormat, InOffset})))
+	{
+		Backend->SetIndexBuffer(InBuffer, InFormat, InOffset);
+	}
+}
+
+void FRHIStateCache::SetRasterizerState(ID3D11RasterizerState* InState)
+{
+	if (Count(ERHIStateType::RasterizerState, RasterizerState.Update(InState)))
+	{
+		Backend->SetRasterizerState(InState);
+	}
+}
+
+void FRHIStateCache::SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef)
+{
+	if (Count(ERHIStateType::DepthStencilState, DepthStencilState.Update({InState, InStencilRef})))
+	{
+		Backend->SetDepthStencilState(InState, InStencilRef);
+	}
+}
+
+void FRHIStateCache::SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask)
+{
+	FBlendBinding Binding = {InState, {1.0f, 1.0f, 1.0f, 1.0f}, InSampleMask};
+	if (InBlendFactor)
+	{
+		memcpy(Binding.BlendFactor, InBlendFactor, sizeof(Binding.BlendFactor));
+	}
+
+	if (Count(ERHIStateType::BlendState, BlendState.Update(Binding)))
+	{
+		Backend->SetBlendState(InState, Binding.BlendFactor, InSampleMask);
+	}
+}
+
+void FRHIStateCache::SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView)
+{
+	const bool bChanged = InSlot >= MaxShaderResources ||
+		ShaderResources[static_cast<uint8>(InStage)][InSlot].Update(InView);
+	if (Count(ERHIStateType::ShaderResource, bChanged))
+	{
+		Backend->SetShaderResource(InStage, InSlot, InView);
+	}
+}
+
+void FRHIStateCache::SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler)
+{
+	const bool bChanged = InSlot >= MaxSamplers || Samplers[static_cast<uint8>(InStage)][InSlot].Update(InSampler);
+	if (Count(ERHIStateType::Sampler, bChanged))
+	{
+		Backend->SetSampler(InStage, InSlot, InSampler);
+	}
+}
+
+void FRHIStateCache::SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer)
+{
+	const bool bChanged = InSlot >= MaxConstantBuffers ||
+		ConstantBuffers[static_cast<uint8>(InStage)][InSlot].Update(InBuffer);
+	if (Count(ERHIStateType::ConstantBuffer, bChanged))
+	{
+		Backend->SetConstantBuffer(InStage, InSlot, InBuffer);
+	}
+}
@@ -2,6 +2,7 @@
 #include "Runtime/Core/Public/Object.h"
 #include "Runtime/Core/Public/Containers/TMap.h"
 #include "Source/Global/Enum.h"
+#include "Runtime/RHI/Public/RHIPipelineState.h"
 
 class UShader;
 struct FObjMaterialInfo;
@@ -77,9 +78,57 @@ public:
 	// 셔이더 설정
 	void SetShader(TObjectPtr<UShader> InShader);
 
+	/**
+	 * @brief 셰이더와 래스터 / 블렌드 모드 조합을 등록하고 핸들을 반환하는 함수 (같은 조합은 같은 핸들)
+	 * 프록시 / 메시를 만들 때 한 번 호출하고, 드로우마다 SetPipelineState로 핸들만 바인딩한다
+	 * 깊이 함수를 받지 않는 버전은 깊이 상태를 바꾸지 않는 조합을 등록한다
+	 * @return 초기화 전이면 0 (등록되지 않은 상태)
+	 */
+	FRHIPipelineStateHandle FindOrAddPipelineState(TObjectPtr<UShader> InShader, EViewMode InRasterMode,
+	                                               bool bInEnableBlending);
+	FRHIPipelineStateHandle FindOrAddPipelineState(TObjectPtr<UShader> InShader, EViewMode InRasterMode,
+	                                               bool bInEnableBlending, EComparisonFunc InDepthFunction);
+	/**
+	 * @brief 기존 조합의 셰이더 입력만 쓰는 깊이 전용 조합을 등록하는 함수 (Depth Pre-Pass용)
+	 * 픽셀 셰이더를 빼고 컬러 쓰기를 끄며, BasePass가 같은 깊이를 통과하도록 LessEqual 깊이 쓰기를 사용한다
+	 * @return 초기화 전이거나 기존 핸들이 유효하지 않으면 0
+	 */
+	FRHIPipelineStateHandle FindOrAddDepthOnlyPipelineState(FRHIPipelineStateHandle InBaseHandle);
+	void SetPipelineState(FRHIPipelineStateHandle InHandle);
+	const FRHIPipelineStateRegistry& GetPipelineStates() const { return PipelineStates; }
+
+	/**
+	 * @brief 스태틱 메시(일반 / 기즈모) 조합의 핸들을 레지스트리와 같은 수명으로 보관하는 함수
+	 * Shutdown에서 레지스트리와 함께 비워지므로 재초기화 후 다른 조합을 가리키지 않는다
+	 */
+	FRHIPipelineStateHandle GetStaticMeshPipelineState(bool bInIsGizmo) const
+	{
+		return StaticMeshPipelineStates[bInIsGizmo ? 1 : 0];
+	}
+	void SetStaticMeshPipelineState(bool bInIsGizmo, FRHIPipelineStateHandle InHandle)
+	{
+		StaticMeshPipelineStates[bInIsGizmo ? 1 : 0] = InHandle;
+	}
+	FRHIPipelineStateHandle GetStaticMeshDepthOnlyPipelineState() const { return StaticMeshDepthOnlyPipelineState; }
+	void SetStaticMeshDepthOnlyPipelineState(FRHIPipelineStateHandle InHandle)
+	{
+		StaticMeshDepthOnlyPipelineState = InHandle;
+	}
+
 	// Scissor Rect 설정
 	void SetScissorRect(int32 Left, int32 Top, int32 Right, int32 Bottom);
 
+	/**
+	 * @brief 셰이더 / 버퍼 / 상태 바인딩은 이 캐시를 거쳐 중복 바인딩을 생략함
+	 * Context에 직접 바인딩한 코드는 이후 Invalidate를 호출해야 함
+	 */
+	FRHIStateCache& GetStateCache() { return StateCache; }
+
+	/**
+	 * @brief 직전 프레임(BeginFrame 사이)의 바인딩 전달 / 생략 횟수
+	 */
+	const FRHIStateCacheStats& GetLastFrameStateStats() const { return LastFrameStateStats; }
+
 	// 렌더 타겟 관리
 	bool BeginFrame();
 	void EndFrame();
@@ -101,6 +150,16 @@ private:
 	IDXGISwapChain* SwapChain = nullptr;
 	bool bIsInitialized = false;
 
+	// 섀도 상태 캐시와 D3D11 적용 백엔드
+	FD3D11StateBackend StateBackend;
+	FRHIStateCache StateCache;
+	FRHIStateCacheStats LastFrameStateStats;
+
+	// 등록된 파이프라인 상태 조합 (Shutdown 시 비움)
+	FRHIPipelineStateRegistry PipelineStates;
+	FRHIPipelineStateHandle StaticMeshPipelineStates[2] = {};
+	FRHIPipelineStateHandle StaticMeshDepthOnlyPipelineState = 0;
+
 	// 상태 객체들 캐시
 	TMap<EViewMode, ID3D11RasterizerState*> RasterizerStates;
 	TMap<EComparisonFunc, ID3D11DepthStencilState*> DepthStencilStates;
@@ -142,6 +201,9 @@ private:
 	void CreateColorWriteStates();
 	void CreateConstantBuffer();
 	void CreateSamplerState();
+
+	FRHIPipelineStateDesc MakePipelineStateDesc(TObjectPtr<UShader> InShader, EViewMode InRasterMode,
+	                                            bool bInEnableBlending) const;
 };
 
 extern FRHIDevice* GDynamicRHI;
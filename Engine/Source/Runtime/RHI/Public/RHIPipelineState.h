@@ -0,0 +1,59 @@
+#pragma once
+#include "Runtime/RHI/Public/RHIStateCache.h"
+
+/**
+ * @brief 파이프라인 상태 레지스트리의 항목 번호 (0은 등록되지 않은 상태)
+ * 레지스트리를 가진 디바이스가 Shutdown될 때까지 유효하다
+ */
+using FRHIPipelineStateHandle = uint16;
+
+/**
+ * @brief 드로우 하나가 한 번에 바인딩하는 셰이더 / 입력 레이아웃 / 래스터 / 블렌드 / 깊이 상태 조합
+ * 모두 디바이스가 만든 객체를 가리키며 레지스트리는 소유하지 않는다
+ * DepthStencilState가 nullptr이면 깊이 상태는 바꾸지 않는다 (패스가 앞서 설정한 상태를 따름)
+ */
+struct FRHIPipelineStateDesc
+{
+	ID3D11VertexShader* VertexShader = nullptr;
+	ID3D11PixelShader* PixelShader = nullptr;
+	ID3D11InputLayout* InputLayout = nullptr;
+	ID3D11RasterizerState* RasterizerState = nullptr;
+	ID3D11BlendState* BlendState = nullptr;
+	float BlendFactor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+	ID3D11DepthStencilState* DepthStencilState = nullptr;
+	uint32 StencilRef = 0;
+
+	bool operator==(const FRHIPipelineStateDesc& InOther) const = default;
+};
+
+/**
+ * @brief 파이프라인 상태 조합을 한 번만 등록해 작은 정수 핸들로 바꿔 주는 레지스트리
+ * 등록은 프록시 / 메시를 만들 때만 하고, 드로우는 핸들로 조합을 꺼내 상태 캐시에 바인딩한다
+ * 조합 수가 적으므로 등록 시 중복 확인은 배열 순회로 충분하다
+ */
+class FRHIPipelineStateRegistry
+{
+public:
+	/**
+	 * @brief 같은 조합이 있으면 그 핸들을, 없으면 새로 등록한 핸들을 반환하는 함수 (핸들이 다 차면 0)
+	 */
+	FRHIPipelineStateHandle FindOrAdd(const FRHIPipelineStateDesc& InDesc);
+
+	bool IsValid(FRHIPipelineStateHandle InHandle) const { return InHandle != 0 && InHandle < States.Num(); }
+	const FRHIPipelineStateDesc& Get(FRHIPipelineStateHandle InHandle) const { return States[InHandle]; }
+	int32 Num() const { return max(States.Num() - 1, 0); }
+
+	/**
+	 * @brief 핸들의 조합을 상태 캐시로 바인딩하는 함수 (드로우마다 호출, 문자열 / 맵 조회 없음)
+	 */
+	void Apply(FRHIPipelineStateHandle InHandle, FRHIStateCache& InStateCache) const;
+
+	/**
+	 * @brief 등록한 조합을 모두 지우는 함수 (이전에 받은 핸들은 더 이상 유효하지 않음)
+	 */
+	void Reset() { States.Reset(); }
+
+private:
+	// 0번은 등록되지 않은 상태를 위해 비워 둠
+	TArray<FRHIPipelineStateDesc> States;
+};
@@ -0,0 +1,222 @@
+#pragma once
+
+/**
+ * @brief 상태 캐시가 추적하는 바인딩 종류 (통계 배열의 인덱스)
+ */
+enum class ERHIStateType : uint8
+{
+	VertexShader,
+	PixelShader,
+	InputLayout,
+	PrimitiveTopology,
+	VertexBuffer,
+	IndexBuffer,
+	RasterizerState,
+	DepthStencilState,
+	BlendState,
+	ShaderResource,
+	Sampler,
+	ConstantBuffer,
+
+	Num
+};
+
+/**
+ * @brief 리소스 / 샘플러 / 상수 버퍼 슬롯이 속한 셰이더 단계
+ */
+enum class ERHIShaderStage : uint8
+{
+	Vertex,
+	Pixel,
+
+	Num
+};
+
+/**
+ * @brief 상태 캐시를 통과한 바인딩을 실제로 적용하는 인터페이스
+ * D3D11 Device Context로 전달하는 구현과, 호출을 기록만 하는 측정 / 검증용 구현을 바꿔 끼울 수 있다
+ */
+class IRHIStateBackend
+{
+public:
+	virtual ~IRHIStateBackend() = default;
+
+	virtual void SetVertexShader(ID3D11VertexShader* InShader) = 0;
+	virtual void SetPixelShader(ID3D11PixelShader* InShader) = 0;
+	virtual void SetInputLayout(ID3D11InputLayout* InInputLayout) = 0;
+	virtual void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) = 0;
+	virtual void SetVertexBuffer(uint32 InSlot, ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset) = 0;
+	virtual void SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset) = 0;
+	virtual void SetRasterizerState(ID3D11RasterizerState* InState) = 0;
+	virtual void SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef) = 0;
+	virtual void SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask) = 0;
+	virtual void SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView) = 0;
+	virtual void SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler) = 0;
+	virtual void SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer) = 0;
+};
+
+/**
+ * @brief 바인딩 종류별 요청 / 적용 / 생략 횟수
+ * @param NumSubmitted 백엔드로 전달한 바인딩 수
+ * @param NumFiltered 이미 같은 값이 바인딩되어 있어 생략한 바인딩 수
+ */
+struct FRHIStateCacheStats
+{
+	uint32 NumSubmitted[static_cast<uint8>(ERHIStateType::Num)] = {};
+	uint32 NumFiltered[static_cast<uint8>(ERHIStateType::Num)] = {};
+
+	uint32 GetTotalSubmitted() const;
+	uint32 GetTotalFiltered() const;
+};
+
+/**
+ * @brief 현재 바인딩된 값을 슬롯마다 기억해 두고, 같은 값의 재바인딩을 백엔드에 전달하지 않는 섀도 상태 캐시
+ * Invalidate 이후(프레임 시작, 디바이스 재생성, 외부 코드가 Context를 직접 건드린 뒤)의 첫 바인딩은 항상 전달한다
+ * 슬롯 범위를 넘는 바인딩은 추적하지 않고 그대로 전달한다
+ */
+class FRHIStateCache
+{
+public:
+	static constexpr uint32 MaxShaderResources = 8;
+	static constexpr uint32 MaxSamplers = 4;
+	static constexpr uint32 MaxConstantBuffers = 8;
+
+	void SetBackend(IRHIStateBackend* InBackend) { Backend = InBackend; }
+	IRHIStateBackend* GetBackend() const { return Backend; }
+
+	/**
+	 * @brief 기억한 값을 모두 모르는 상태로 되돌리는 함수 (통계는 유지)
+	 */
+	void Invalidate();
+
+	void SetVertexShader(ID3D11VertexShader* InShader);
+	void SetPixelShader(ID3D11PixelShader* InShader);
+	void SetInputLayout(ID3D11InputLayout* InInputLayout);
+	void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology);
+	void SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset = 0);
+	void SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat = DXGI_FORMAT_R32_UINT, uint32 InOffset = 0);
+	void SetRasterizerState(ID3D11RasterizerState* InState);
+	void SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef);
+
+	/**
+	 * @param InBlendFactor nullptr면 D3D11과 같이 (1, 1, 1, 1)로 취급
+	 */
+	void SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4] = nullptr,
+	                   uint32 InSampleMask = 0xFFFFFFFF);
+	void SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView);
+	void SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler);
+	void SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer);
+
+	const FRHIStateCacheStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = FRHIStateCacheStats(); }
+
+private:
+	/**
+	 * @brief 슬롯 하나의 기억된 값 (bIsKnown이 false면 어떤 값이든 전달)
+	 */
+	template <typename T>
+	struct TShadowSlot
+	{
+		T Value{};
+		bool bIsKnown = false;
+
+		bool Update(const T& InValue)
+		{
+			if (bIsKnown && Value == InValue)
+			{
+				return false;
+			}
+			Value = InValue;
+			bIsKnown = true;
+			return true;
+		}
+	};
+
+	struct FVertexBufferBinding
+	{
+		ID3D11Buffer* Buffer;
+		uint32 Stride;
+		uint32 Offset;
+
+		bool operator==(const FVertexBufferBinding& InOther) const = default;
+	};
+
+	struct FIndexBufferBinding
+	{
+		ID3D11Buffer* Buffer;
+		DXGI_FORMAT Format;
+		uint32 Offset;
+
+		bool operator==(const FIndexBufferBinding& InOther) const = default;
+	};
+
+	struct FDepthStencilBinding
+	{
+		ID3D11DepthStencilState* State;
+		uint32 StencilRef;
+
+		bool operator==(const FDepthStencilBinding& InOther) const = default;
+	};
+
+	struct FBlendBinding
+	{
+		ID3D11BlendState* State;
+		float BlendFactor[4];
+		uint32 SampleMask;
+
+		bool operator==(const FBlendBinding& InOther) const = default;
+	};
+
+	/**
+	 * @brief 바인딩 결과를 통계에 기록하고 전달 여부를 반환하는 함수
+	 */
+	bool Count(ERHIStateType InType, bool bInChanged)
+	{
+		++(bInChanged ? Stats.NumSubmitted : Stats.NumFiltered)[static_cast<uint8>(InType)];
+		return bInChanged && Backend;
+	}
+
+	IRHIStateBackend* Backend = nullptr;
+
+	TShadowSlot<ID3D11VertexShader*> VertexShader;
+	TShadowSlot<ID3D11PixelShader*> PixelShader;
+	TShadowSlot<ID3D11InputLayout*> InputLayout;
+	TShadowSlot<D3D11_PRIMITIVE_TOPOLOGY> PrimitiveTopology;
+	TShadowSlot<FVertexBufferBinding> VertexBuffer;
+	TShadowSlot<FIndexBufferBinding> IndexBuffer;
+	TShadowSlot<ID3D11RasterizerState*> RasterizerState;
+	TShadowSlot<FDepthStencilBinding> DepthStencilState;
+	TShadowSlot<FBlendBinding> BlendState;
+	TShadowSlot<ID3D11ShaderResourceView*> ShaderResources[static_cast<uint8>(ERHIShaderStage::Num)][MaxShaderResources];
+	TShadowSlot<ID3D11SamplerState*> Samplers[static_cast<uint8>(ERHIShaderStage::Num)][MaxSamplers];
+	TShadowSlot<ID3D11Buffer*> ConstantBuffers[static_cast<uint8>(ERHIShaderStage::Num)][MaxConstantBuffers];
+
+	FRHIStateCacheStats Stats;
+};
+
+/**
+ * @brief 캐시를 통과한 바인딩을 D3D11 Device Context에 그대로 적용하는 백엔드
+ * D3D11 호출은 이 백엔드(D3D11StateBackend.cpp)에만 있으므로 상태 캐시는 D3D11 타입 선언만으로 빌드된다
+ */
+class FD3D11StateBackend :
+	public IRHIStateBackend
+{
+public:
+	void SetDeviceContext(ID3D11DeviceContext* InDeviceContext) { DeviceContext = InDeviceContext; }
+
+	void SetVertexShader(ID3D11VertexShader* InShader) override;
+	void SetPixelShader(ID3D11PixelShader* InShader) override;
+	void SetInputLayout(ID3D11InputLayout* InInputLayout) override;
+	void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) override;
+	void SetVertexBuffer(uint32 InSlot, ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset) override;
+	void SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset) override;
+	void SetRasterizerState(ID3D11RasterizerState* InState) override;
+	void SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef) override;
+	void SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask) override;
+	void SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView) override;
+	void SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler) override;
+	void SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer) override;
+
+private:
+	ID3D11DeviceContext* DeviceContext = nullptr;
+};
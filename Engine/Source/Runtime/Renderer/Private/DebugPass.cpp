@@ -144,7 +144,7 @@ void FDebugPass::RenderGrid(const FSceneView* View, FSceneRenderer* SceneRendere
 	ULevel* CurrentLevel = WorldSS ? WorldSS->GetCurrentLevel() : nullptr;
 	if (CurrentLevel)
 	{
-		const TArray<TObjectPtr<AActor>>& Actors = CurrentLevel->GetLevelActors();
+		const TSparseArray<TObjectPtr<AActor>>& Actors = CurrentLevel->GetLevelActors();
 		for (const TObjectPtr<AActor>& ActorPtr : Actors)
 		{
 			AActor* Actor = ActorPtr.Get();
@@ -332,7 +332,7 @@ void FDebugPass::RenderDebugComponents(const FSceneView* View, FSceneRenderer* S
 	ULevel* CurrentLevel = WorldSS->GetCurrentLevel();
 	if (CurrentLevel)
 	{
-		const TArray<TObjectPtr<AActor>>& Actors = CurrentLevel->GetLevelActors();
+		const TSparseArray<TObjectPtr<AActor>>& Actors = CurrentLevel->GetLevelActors();
 		for (const TObjectPtr<AActor>& ActorPtr : Actors)
 		{
 			AActor* Actor = ActorPtr.Get();
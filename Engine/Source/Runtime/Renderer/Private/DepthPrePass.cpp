@@ -1,11 +1,11 @@
 ﻿#include "pch.h"
 #include "Runtime/Renderer/Public/DepthPrePass.h"
 
-#include "Runtime/RHI/Public/RHIDevice.h"
+#include "Runtime/Renderer/Public/RHICommandList.h"
+#include "Runtime/Renderer/Public/Scene.h"
 #include "Runtime/Renderer/Public/SceneRenderer.h"
 #include "Runtime/Renderer/Public/SceneView.h"
 #include "Runtime/Engine/Public/World.h"
-#include "Runtime/Component/Public/PrimitiveComponent.h"
 #include "Window/Public/Viewport.h"
 
 void FDepthPrePass::Execute(const FSceneView* View, FSceneRenderer* SceneRenderer)
@@ -18,57 +18,43 @@ void FDepthPrePass::Execute(const FSceneView* View, FSceneRenderer* SceneRendere
     UWorld* World = View->GetWorld();
     if (!World) return;
 
-    ACameraActor* Camera = View->GetCamera();
+    FRHICommandList* RHICmdList = SceneRenderer->GetCommandList();
     FViewport* Viewport = View->GetViewport();
-    if (!Camera || !Viewport) return;
+    if (!RHICmdList || !Viewport) return;
 
-    // Depth Pre-Pass 설정
-    // TODO: Depth Write/Color Write 설정 구현 필요
-    GDynamicRHI->OMSetDepthWriteEnabled(true);
-    GDynamicRHI->OMSetColorWriteEnabled(false);
+    // BasePass와 같은 Show Flag를 따라야 숨긴 메시가 깊이만 남기지 않음
+    if (!World->IsShowFlagEnabled(EEngineShowFlags::SF_Primitives))
+    {
+        return;
+    }
+    const bool bShowStaticMeshes = World->IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 
-    // 모든 액터들의 깊이 정보만 렌더링
-    const TArray<TObjectPtr<AActor>>& Actors = World->GetLevel()->GetLevelActors();
-    for (AActor* Actor : Actors)
+    const FMatrix ViewMatrix = View->GetViewMatrix();
+    const FMatrix ProjectionMatrix = View->GetProjectionMatrix();
+
+    // BasePass와 같은 컬링 결과의 씬 프록시 깊이 정보만 기록
+    // 깊이 전용 패킷은 정렬 후 BasePass 드로우보다 먼저 실행되며, 컬러 쓰기 / 픽셀 셰이더 없이 LessEqual로 깊이를 씀
+    const FSceneVisibility& Visibility = SceneRenderer->GetViewVisibility();
+    const FScene* Scene = Visibility.GetScene();
+    for (const int32 ProxyIndex : Visibility.GetVisiblePrimitives())
     {
-        if (Actor && !Actor->GetActorHiddenInGame())
+        const FPrimitiveSceneProxy& Proxy = Scene->GetPrimitive(ProxyIndex);
+        if (!bShowStaticMeshes && Proxy.bIsStaticMeshActor)
         {
-            RenderActorDepth(Actor, View, SceneRenderer);
+            continue;
         }
-    }
 
-    // Depth Pre-Pass 완료 후 Color Write 다시 활성화
-    GDynamicRHI->OMSetColorWriteEnabled(true);
+        RenderPrimitiveDepth(Scene, ProxyIndex, RHICmdList, ViewMatrix, ProjectionMatrix);
+    }
 }
 
-void FDepthPrePass::RenderActorDepth(AActor* Actor, const FSceneView* View, FSceneRenderer* SceneRenderer)
+void FDepthPrePass::RenderPrimitiveDepth(const FScene* InScene, int32 InProxyIndex, FRHICommandList* RHICmdList,
+                                         const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
 {
-    if (!Actor || !View || !SceneRenderer)
+    if (!InScene || !RHICmdList || !InScene->GetPrimitive(InProxyIndex).HasMesh())
     {
 	    return;
     }
 
-    // 액터의 프리미티브 컴포넌트들을 깊이만 렌더링
-    for (USceneComponent* Component : Actor->GetComponents<USceneComponent>())
-    {
-        if (!Component)
-        {
-	        continue;
-        }
-
-        if (UActorComponent* ActorComp = Cast<UActorComponent>(Component))
-        {
-            if (!ActorComp->IsActive())
-            {
-	            continue;
-            }
-        }
-
-        if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
-        {
-            // 깊이만 렌더링하도록 설정된 상태에서 프리미티브 렌더링
-            // TODO: Primitive 컴포넌트의 깊이 전용 렌더링 구현
-            // Primitive->RenderDepthOnly(RHI, ViewMatrix, ProjectionMatrix);
-        }
-    }
+    RHICmdList->DrawSceneProxyDepthOnly(InScene, InProxyIndex, ViewMatrix, ProjectionMatrix);
 }
@@ -12,6 +12,8 @@
 #include "Texture/Public/Texture.h"
 #include "Runtime/Renderer/Public/MaterialRenderProxy.h"
 #include "Runtime/Renderer/Public/TextureRenderProxy.h"
+#include "Runtime/Renderer/Public/Scene.h"
+#include "Runtime/Renderer/Public/DrawPacket.h"
 
 class UAssetSubsystem;
 class UShader;
@@ -40,26 +42,18 @@ void FRHIDrawIndexedPrimitivesCommand::SetupShaderForComponent(UPrimitiveCompone
 		return;
 	}
 
-	// 셰이더 로드
-	UAssetSubsystem* AssetSubsystem = GEngine->GetEngineSubsystem<UAssetSubsystem>();
-	TObjectPtr<UShader> Shader = nullptr;
-	if (AssetSubsystem)
-	{
-		// TODO: 머티리얼에서 셰이더 경로를 가져오는 로직 필요
-		TArray<D3D11_INPUT_ELEMENT_DESC> LayoutDesc = {
-			{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 28, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 36, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		};
-		Shader = AssetSubsystem->LoadShader("StaticMeshShader.hlsl", LayoutDesc);
-	}
+	SetupShaderForMaterial(RHIDevice, GetStaticMeshPipelineState(RHIDevice, bUseOverrideColor),
+	                       InComponent->GetMaterial());
+}
 
-	// RHI에 셰이더 설정
-	RHIDevice->SetShader(Shader);
+void FRHIDrawIndexedPrimitivesCommand::SetupShaderForMaterial(FRHIDevice* InRHIDevice,
+                                                              FRHIPipelineStateHandle InPipelineState,
+                                                              UMaterial* InMaterial)
+{
+	BindPipelineState(InRHIDevice, InPipelineState);
 
 	// 텍스처 및 샘플러 바인딩
-	UMaterial* ComponentMaterial = InComponent->GetMaterial();
+	UMaterial* ComponentMaterial = InMaterial;
 	ID3D11ShaderResourceView* TextureSRV = nullptr;
 
 	if (ComponentMaterial)
@@ -70,7 +64,7 @@ void FRHIDrawIndexedPrimitivesCommand::SetupShaderForComponent(UPrimitiveCompone
 		if (MaterialProxy && MaterialProxy->IsValid())
 		{
 			// RenderProxy를 통해 렌더 스레드에서 텍스처 리소스 요청
-			TextureSRV = MaterialProxy->GetTextureForRendering_RenderThread(RHIDevice);
+			TextureSRV = MaterialProxy->GetTextureForRendering_RenderThread(InRHIDevice);
 		}
 		else
 		{
@@ -86,9 +80,7 @@ void FRHIDrawIndexedPrimitivesCommand::SetupShaderForComponent(UPrimitiveCompone
 	// 4. 텍스처 SRV 설정
 	if (TextureSRV)
 	{
-		ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
-		DeviceContext->PSSetShaderResources(0, 1, &TextureSRV);
-		RHIDevice->PSSetDefaultSampler(0);
+		InRHIDevice->GetStateCache().SetShaderResource(ERHIShaderStage::Pixel, 0, TextureSRV);
 	}
 	else
 	{
@@ -97,6 +89,75 @@ void FRHIDrawIndexedPrimitivesCommand::SetupShaderForComponent(UPrimitiveCompone
 	}
 }
 
+FRHIPipelineStateHandle FRHIDrawIndexedPrimitivesCommand::GetStaticMeshPipelineState(FRHIDevice* InRHIDevice,
+                                                                                    bool bInIsGizmo)
+{
+	if (!InRHIDevice || !InRHIDevice->IsInitialized())
+	{
+		return 0;
+	}
+
+	// 핸들은 레지스트리를 가진 디바이스에 보관 (디바이스 재초기화 시 함께 비워짐)
+	FRHIPipelineStateHandle PipelineState = InRHIDevice->GetStaticMeshPipelineState(bInIsGizmo);
+	if (InRHIDevice->GetPipelineStates().IsValid(PipelineState))
+	{
+		return PipelineState;
+	}
+
+	// 셰이더 로드
+	UAssetSubsystem* AssetSubsystem = GEngine->GetEngineSubsystem<UAssetSubsystem>();
+	TObjectPtr<UShader> Shader = nullptr;
+	if (AssetSubsystem)
+	{
+		// TODO: 머티리얼에서 셰이더 경로를 가져오는 로직 필요
+		TArray<D3D11_INPUT_ELEMENT_DESC> LayoutDesc = {
+			{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 28, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 36, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		};
+		Shader = AssetSubsystem->LoadShader("StaticMeshShader.hlsl", LayoutDesc);
+	}
+
+	// 기즈모는 Unlit + 알파 블렌딩, 피킹을 위해 정상 Depth Test 사용
+	PipelineState = bInIsGizmo
+		                ? InRHIDevice->FindOrAddPipelineState(Shader, EViewMode::Unlit, true, EComparisonFunc::LessEqual)
+		                : InRHIDevice->FindOrAddPipelineState(Shader, EViewMode::Lit, false);
+	InRHIDevice->SetStaticMeshPipelineState(bInIsGizmo, PipelineState);
+	return PipelineState;
+}
+
+FRHIPipelineStateHandle FRHIDrawIndexedPrimitivesCommand::GetStaticMeshDepthOnlyPipelineState(FRHIDevice* InRHIDevice)
+{
+	if (!InRHIDevice || !InRHIDevice->IsInitialized())
+	{
+		return 0;
+	}
+
+	FRHIPipelineStateHandle PipelineState = InRHIDevice->GetStaticMeshDepthOnlyPipelineState();
+	if (InRHIDevice->GetPipelineStates().IsValid(PipelineState))
+	{
+		return PipelineState;
+	}
+
+	const FRHIPipelineStateHandle BasePipelineState = GetStaticMeshPipelineState(InRHIDevice, false);
+	if (!InRHIDevice->GetPipelineStates().IsValid(BasePipelineState))
+	{
+		return 0;
+	}
+
+	PipelineState = InRHIDevice->FindOrAddDepthOnlyPipelineState(BasePipelineState);
+	InRHIDevice->SetStaticMeshDepthOnlyPipelineState(PipelineState);
+	return PipelineState;
+}
+
+void FRHIDrawIndexedPrimitivesCommand::BindPipelineState(FRHIDevice* InRHIDevice,
+                                                         FRHIPipelineStateHandle InPipelineState)
+{
+	InRHIDevice->SetPipelineState(InPipelineState);
+	InRHIDevice->PSSetDefaultSampler(0);
+}
+
 void FRHIDrawIndexedPrimitivesCommand::RenderComponent(UPrimitiveComponent* InComponent)
 {
 	if (!InComponent || !RHIDevice)
@@ -166,16 +227,11 @@ void FRHIDrawIndexedPrimitivesCommand::RenderStaticMeshComponent(UStaticMeshComp
 		break;
 	}
 
-	UINT offset = 0;
-	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &stride, &offset);
-	DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	FRHIStateCache& StateCache = RHIDevice->GetStateCache();
+	StateCache.SetVertexBuffer(VertexBuffer, stride);
+	StateCache.SetIndexBuffer(IndexBuffer);
 
-	// 기존 Renderer에서 설정했던 Render State들 복구
-	// Rasterizer State는 ViewMode에 따라 설정 (여기서는 기본값)
-	RHIDevice->RSSetState(EViewMode::Lit);
-
-	// Blend State 설정 (기본: 비활성화)
-	RHIDevice->OMSetBlendState(false);
+	// Rasterizer(Lit) / Blend(비활성화) State는 SetupShaderForComponent의 파이프라인 상태에 포함
 
 	// 언리얼 엔진 스타일: StaticMesh Section별 렌더링
 	const TArray<FStaticMeshSection>& MeshSections = StaticMesh->GetMeshGroupInfo();
@@ -204,77 +260,165 @@ void FRHIDrawIndexedPrimitivesCommand::RenderStaticMeshComponent(UStaticMeshComp
 				MaterialInterface = AssetSubsystem->GetDefaultMaterial();
 			}
 
-			// Material 정보 추출 및 설정
-			FObjMaterialInfo MaterialInfo;
-			bool bHasTexture = false;
+			BindSectionMaterial(RHIDevice, MaterialInterface);
 
-			if (MaterialInterface)
-			{
-				// MaterialInterface에서 MaterialInfo 추출
-				if (UMaterial* Material = Cast<UMaterial>(MaterialInterface))
-				{
-					MaterialInfo = Material->GetMaterialInfo();
-					bHasTexture = Material->HasTexture();
-				}
-				else
-				{
-					// UMaterialInstance나 다른 MaterialInterface 타입일 경우
-					bHasTexture = MaterialInterface->HasTexture();
-				}
+			// Draw Call 실행 (Command에서 처리되어야 함)
+			StateCache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			DeviceContext->DrawIndexed(Section.GetIndexCount(), Section.GetStartIndex(), 0);
+		}
+	}
+	else
+	{
+		BindDefaultMaterial(RHIDevice);
 
-				// Texture 바인딩 - Material에서 가져오기
-				UTexture* Texture = MaterialInterface->GetTexture();
-				ID3D11ShaderResourceView* SRV = nullptr;
+		StateCache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		DeviceContext->DrawIndexed(StaticMesh->GetIndexCount(), 0, 0);
+	}
+}
 
-				if (Texture)
-				{
-					FTextureRenderProxy* TextureProxy = Texture->GetRenderProxy();
-					if (TextureProxy)
-					{
-						SRV = TextureProxy->GetTextureForRendering_RenderThread(RHIDevice);
-					}
-				}
+/**
+ * @brief FScene에 복사된 행렬과 메시 버퍼, 섹션 머티리얼로 그리는 함수 (컴포넌트 / 메시 UObject를 읽지 않음)
+ */
+void FRHIDrawIndexedPrimitivesCommand::ExecuteSceneProxyPacket(const FDrawPacketContext& InContext,
+                                                               const FDrawPacket& InPacket)
+{
+	FRHIDevice* RHIDevice = InContext.RHIDevice;
+	const FScene* Scene = InPacket.SceneProxy.Scene;
+	if (!RHIDevice || !Scene)
+	{
+		return;
+	}
 
-				// 텍스처가 없으면 DefaultTexture 로드
-				if (!SRV && AssetSubsystem)
-				{
-					TObjectPtr<UTexture> DefaultTexture = AssetSubsystem->LoadTexture("DefaultTexture.png");
-					if (DefaultTexture)
-					{
-						FTextureRenderProxy* DefaultProxy = DefaultTexture->GetRenderProxy();
-						if (DefaultProxy)
-						{
-							SRV = DefaultProxy->GetTextureForRendering_RenderThread(RHIDevice);
-						}
-					}
-				}
+	const FPrimitiveSceneProxy& Proxy = Scene->GetPrimitive(InPacket.SceneProxy.ProxyIndex);
+	if (!Proxy.HasMesh())
+	{
+		return;
+	}
 
-				// SRV 바인딩
-				if (SRV)
-				{
-					DeviceContext->PSSetShaderResources(0, 1, &SRV);
-					bHasTexture = true;
-				}
-			}
+	const FSceneMeshInfo& Mesh = Scene->GetMesh(Proxy.MeshIndex);
+	ID3D11Buffer* VertexBuffer = Mesh.VertexBuffer;
+	ID3D11Buffer* IndexBuffer = Mesh.IndexBuffer;
+	if (!VertexBuffer || !IndexBuffer)
+	{
+		return;
+	}
 
-			// Material 정보를 Pixel Shader에 전달
-			RHIDevice->UpdatePixelConstantBuffers(MaterialInfo, MaterialInterface != nullptr, bHasTexture);
+	// RHI 초기화 전에 기록된 프록시는 핸들이 없으므로 기본 스태틱 메시 조합을 사용
+	FRHIPipelineStateHandle PipelineState = InPacket.SceneProxy.PipelineState;
+	if (!RHIDevice->GetPipelineStates().IsValid(PipelineState))
+	{
+		PipelineState = GetStaticMeshPipelineState(RHIDevice, false);
+	}
 
-			// Draw Call 실행 (Command에서 처리되어야 함)
-			DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-			DeviceContext->DrawIndexed(Section.GetIndexCount(), Section.GetStartIndex(), 0);
+	// 섹션마다 자기 텍스처를 바인딩하므로 컴포넌트 머티리얼 텍스처는 바인딩하지 않음 (드로우 전에 덮어써지는 바인딩)
+	BindPipelineState(RHIDevice, PipelineState);
+
+	const FDrawPacketView& View = InContext.Views[InPacket.ViewIndex];
+	RHIDevice->UpdateConstantBuffers(Proxy.WorldMatrix, View.ViewMatrix, View.ProjMatrix);
+
+	FRHIStateCache& StateCache = RHIDevice->GetStateCache();
+	StateCache.SetVertexBuffer(VertexBuffer, Mesh.VertexStride);
+	StateCache.SetIndexBuffer(IndexBuffer);
+	StateCache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+
+	if (Mesh.NumSections > 0)
+	{
+		const FPrimitiveSceneSection* Sections = Scene->GetSections(Mesh);
+		for (int32 SectionIndex = 0; SectionIndex < Mesh.NumSections; ++SectionIndex)
+		{
+			const FPrimitiveSceneSection& Section = Sections[SectionIndex];
+			BindSectionMaterial(RHIDevice, Section.Material);
+			DeviceContext->DrawIndexed(Section.IndexCount, Section.StartIndex, 0);
 		}
 	}
 	else
 	{
-		// Material이 없는 경우 흰색 기본 Material 사용
-		FObjMaterialInfo ObjMaterialInfo;
-		ObjMaterialInfo.DiffuseColor = FVector(1.0f, 1.0f, 1.0f); // 흰색 설정
+		BindDefaultMaterial(RHIDevice);
+		DeviceContext->DrawIndexed(Mesh.IndexCount, 0, 0);
+	}
+}
+
+void FRHIDrawIndexedPrimitivesCommand::ExecuteSceneProxyDepthOnlyPacket(const FDrawPacketContext& InContext,
+                                                                        const FDrawPacket& InPacket)
+{
+	FRHIDevice* RHIDevice = InContext.RHIDevice;
+	const FScene* Scene = InPacket.SceneProxy.Scene;
+	if (!RHIDevice || !Scene)
+	{
+		return;
+	}
+
+	const FPrimitiveSceneProxy& Proxy = Scene->GetPrimitive(InPacket.SceneProxy.ProxyIndex);
+	if (!Proxy.HasMesh())
+	{
+		return;
+	}
+
+	const FSceneMeshInfo& Mesh = Scene->GetMesh(Proxy.MeshIndex);
+	if (!Mesh.VertexBuffer || !Mesh.IndexBuffer)
+	{
+		return;
+	}
+
+	const FRHIPipelineStateHandle PipelineState = GetStaticMeshDepthOnlyPipelineState(RHIDevice);
+	if (!RHIDevice->GetPipelineStates().IsValid(PipelineState))
+	{
+		return;
+	}
+	RHIDevice->SetPipelineState(PipelineState);
+
+	const FDrawPacketView& View = InContext.Views[InPacket.ViewIndex];
+	RHIDevice->UpdateConstantBuffers(Proxy.WorldMatrix, View.ViewMatrix, View.ProjMatrix);
+
+	FRHIStateCache& StateCache = RHIDevice->GetStateCache();
+	StateCache.SetVertexBuffer(Mesh.VertexBuffer, Mesh.VertexStride);
+	StateCache.SetIndexBuffer(Mesh.IndexBuffer);
+	StateCache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+	// 섹션은 같은 인덱스 버퍼를 나눠 쓰므로 깊이만 기록할 때는 한 번에 그림
+	RHIDevice->GetDeviceContext()->DrawIndexed(Mesh.IndexCount, 0, 0);
+}
+
+void FRHIDrawIndexedPrimitivesCommand::BindSectionMaterial(FRHIDevice* InRHIDevice,
+                                                           UMaterialInterface* InMaterialInterface)
+{
+	UAssetSubsystem* AssetSubsystem = GEngine->GetEngineSubsystem<UAssetSubsystem>();
+
+	// Material 정보 추출 및 설정
+	FObjMaterialInfo MaterialInfo;
+	bool bHasTexture = false;
+
+	if (InMaterialInterface)
+	{
+		// MaterialInterface에서 MaterialInfo 추출
+		if (UMaterial* Material = Cast<UMaterial>(InMaterialInterface))
+		{
+			MaterialInfo = Material->GetMaterialInfo();
+			bHasTexture = Material->HasTexture();
+		}
+		else
+		{
+			// UMaterialInstance나 다른 MaterialInterface 타입일 경우
+			bHasTexture = InMaterialInterface->HasTexture();
+		}
+
+		// Texture 바인딩 - Material에서 가져오기
+		UTexture* Texture = InMaterialInterface->GetTexture();
+		ID3D11ShaderResourceView* SRV = nullptr;
 
-		// DefaultTexture 로드 및 바인딩
-		bool bHasTexture = false;
-		UAssetSubsystem* AssetSubsystem = GEngine->GetEngineSubsystem<UAssetSubsystem>();
-		if (AssetSubsystem)
+		if (Texture)
+		{
+			FTextureRenderProxy* TextureProxy = Texture->GetRenderProxy();
+			if (TextureProxy)
+			{
+				SRV = TextureProxy->GetTextureForRendering_RenderThread(InRHIDevice);
+			}
+		}
+
+		// 텍스처가 없으면 DefaultTexture 로드
+		if (!SRV && AssetSubsystem)
 		{
 			TObjectPtr<UTexture> DefaultTexture = AssetSubsystem->LoadTexture("DefaultTexture.png");
 			if (DefaultTexture)
@@ -282,21 +426,51 @@ void FRHIDrawIndexedPrimitivesCommand::RenderStaticMeshComponent(UStaticMeshComp
 				FTextureRenderProxy* DefaultProxy = DefaultTexture->GetRenderProxy();
 				if (DefaultProxy)
 				{
-					ID3D11ShaderResourceView* SRV = DefaultProxy->GetTextureForRendering_RenderThread(RHIDevice);
-					if (SRV)
-					{
-						DeviceContext->PSSetShaderResources(0, 1, &SRV);
-						bHasTexture = true;
-					}
+					SRV = DefaultProxy->GetTextureForRendering_RenderThread(InRHIDevice);
 				}
 			}
 		}
 
-		RHIDevice->UpdatePixelConstantBuffers(ObjMaterialInfo, true, bHasTexture);
+		// SRV 바인딩
+		if (SRV)
+		{
+			InRHIDevice->GetStateCache().SetShaderResource(ERHIShaderStage::Pixel, 0, SRV);
+			bHasTexture = true;
+		}
+	}
+
+	// Material 정보를 Pixel Shader에 전달
+	InRHIDevice->UpdatePixelConstantBuffers(MaterialInfo, InMaterialInterface != nullptr, bHasTexture);
+}
 
-		DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		DeviceContext->DrawIndexed(StaticMesh->GetIndexCount(), 0, 0);
+void FRHIDrawIndexedPrimitivesCommand::BindDefaultMaterial(FRHIDevice* InRHIDevice)
+{
+	// Material이 없는 경우 흰색 기본 Material 사용
+	FObjMaterialInfo ObjMaterialInfo;
+	ObjMaterialInfo.DiffuseColor = FVector(1.0f, 1.0f, 1.0f); // 흰색 설정
+
+	// DefaultTexture 로드 및 바인딩
+	bool bHasTexture = false;
+	UAssetSubsystem* AssetSubsystem = GEngine->GetEngineSubsystem<UAssetSubsystem>();
+	if (AssetSubsystem)
+	{
+		TObjectPtr<UTexture> DefaultTexture = AssetSubsystem->LoadTexture("DefaultTexture.png");
+		if (DefaultTexture)
+		{
+			FTextureRenderProxy* DefaultProxy = DefaultTexture->GetRenderProxy();
+			if (DefaultProxy)
+			{
+				ID3D11ShaderResourceView* SRV = DefaultProxy->GetTextureForRendering_RenderThread(InRHIDevice);
+				if (SRV)
+				{
+					InRHIDevice->GetStateCache().SetShaderResource(ERHIShaderStage::Pixel, 0, SRV);
+					bHasTexture = true;
+				}
+			}
+		}
 	}
+
+	InRHIDevice->UpdatePixelConstantBuffers(ObjMaterialInfo, true, bHasTexture);
 }
 
 void FRHIDrawIndexedPrimitivesCommand::RenderGizmoComponent(UStaticMeshComponent* StaticMeshComp)
@@ -311,11 +485,7 @@ void FRHIDrawIndexedPrimitivesCommand::RenderGizmoComponent(UStaticMeshComponent
 
 	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
 
-	// 기즈모 피킹을 위해 정상 Depth Test 사용
-	RHIDevice->OmSetDepthStencilState(EComparisonFunc::LessEqual);
-
-	// 알파 블렌딩 활성화 (기즈모 반투명 효과)
-	RHIDevice->OMSetBlendState(true);
+	// Depth Test(LessEqual) / 알파 블렌딩 / Unlit Rasterizer는 SetupShaderForComponent의 기즈모 파이프라인 상태에 포함
 
 	// 정점 및 인덱스 버퍼 설정
 	ID3D11Buffer* VertexBuffer = StaticMesh->GetVertexBuffer();
@@ -341,12 +511,9 @@ void FRHIDrawIndexedPrimitivesCommand::RenderGizmoComponent(UStaticMeshComponent
 		break;
 	}
 
-	UINT offset = 0;
-	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &stride, &offset);
-	DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
-	// 기즈모는 Unlit 모드로 렌더링
-	RHIDevice->RSSetState(EViewMode::Unlit);
+	FRHIStateCache& StateCache = RHIDevice->GetStateCache();
+	StateCache.SetVertexBuffer(VertexBuffer, stride);
+	StateCache.SetIndexBuffer(IndexBuffer);
 
 	// 기즈모 색상을 HighLightBuffer를 통해 설정 (Primitive.hlsl의 Gizmo 로직 사용)
 	uint32 gizmoAxis = 0;
@@ -374,7 +541,7 @@ void FRHIDrawIndexedPrimitivesCommand::RenderGizmoComponent(UStaticMeshComponent
 	);
 
 	// 기즈모는 Material 없이 단순 렌더링
-	DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	StateCache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	DeviceContext->DrawIndexed(StaticMesh->GetIndexCount(), 0, 0);
 
 	// 기즈모 렌더링 후 상태 정리 (다음 객체에 영향을 주지 않도록)
@@ -414,6 +581,22 @@ void FRHIDrawIndexedPrimitivesCommand::InitializeSortingKey(UPrimitiveComponent*
 		}
 	}
 
+	SetSortingKeyFromIDs(materialID, meshID);
+
+	// 디버그 정보 출력 (릴리즈에서는 제거)
+#ifdef _DEBUG
+	// UE_LOG("바그: [Sorting] Material: %p, Mesh: %p, Depth: %.2f, Priority: %d, Key: 0x%016llX\n",
+	//        MaterialPtr, meshID, depth, priority, sortingKey);
+#endif
+}
+
+void FRHIDrawIndexedPrimitivesCommand::SetSortingKeyFromIDs(uint16 InMaterialID, uint8 InMeshID)
+{
+	SetSortingKey(MakeSortingKey(InMaterialID, InMeshID, bUseOverrideColor));
+}
+
+uint64 FRHIDrawIndexedPrimitivesCommand::MakeSortingKey(uint16 InMaterialID, uint8 InMeshID, bool bInIsGizmo)
+{
 	// Depth 계산 단순화 (임시로 좌표계 사용)
 	float depth = 100.0f; // 기본 depth 값
 
@@ -435,7 +618,7 @@ void FRHIDrawIndexedPrimitivesCommand::InitializeSortingKey(UPrimitiveComponent*
 	// Priority 설정 (기즈모, 반투명 계살)
 	uint8 priority = 128; // 기본 우선순위 (128 = 중간)
 
-	if (bUseOverrideColor)
+	if (bInIsGizmo)
 	{
 		// 기즈모는 높은 우선순위 (앞에 렌더링)
 		priority = 255; // 최고 우선순위
@@ -450,12 +633,5 @@ void FRHIDrawIndexedPrimitivesCommand::InitializeSortingKey(UPrimitiveComponent*
 	*/
 
 	// 64-bit Sorting Key 생성
-	uint64 sortingKey = CreateSortingKey(depthInt, materialID, meshID, priority);
-	SetSortingKey(sortingKey);
-
-	// 디버그 정보 출력 (릴리즈에서는 제거)
-#ifdef _DEBUG
-	// UE_LOG("바그: [Sorting] Material: %p, Mesh: %p, Depth: %.2f, Priority: %d, Key: 0x%016llX\n",
-	//        MaterialPtr, meshID, depth, priority, sortingKey);
-#endif
+	return CreateSortingKey(depthInt, InMaterialID, InMeshID, priority);
 }
@@ -71,9 +71,10 @@ void FRHIDrawLineBatchCommand::Execute()
 
 	ID3D11DepthStencilState* DepthState = nullptr;
 	RHIDevice->GetDevice()->CreateDepthStencilState(&DepthDesc, &DepthState);
+	FRHIStateCache& StateCache = RHIDevice->GetStateCache();
 	if (DepthState)
 	{
-		DeviceContext->OMSetDepthStencilState(DepthState, 0);
+		StateCache.SetDepthStencilState(DepthState, 0);
 	}
 
 	// Blend State 설정
@@ -85,7 +86,7 @@ void FRHIDrawLineBatchCommand::Execute()
 	RHIDevice->GetDevice()->CreateBlendState(&BlendDesc, &BlendState);
 	if (BlendState)
 	{
-		DeviceContext->OMSetBlendState(BlendState, nullptr, 0xFFFFFFFF);
+		StateCache.SetBlendState(BlendState, nullptr, 0xFFFFFFFF);
 	}
 
 	// Rasterizer State 설정
@@ -100,7 +101,7 @@ void FRHIDrawLineBatchCommand::Execute()
 	RHIDevice->GetDevice()->CreateRasterizerState(&RasterizerDesc, &RastState);
 	if (RastState)
 	{
-		DeviceContext->RSSetState(RastState);
+		StateCache.SetRasterizerState(RastState);
 	}
 
 	// Scissor Rect 설정
@@ -127,16 +128,14 @@ void FRHIDrawLineBatchCommand::Execute()
 	ID3D11PixelShader* PS = EditorResources->GetEditorPixelShader(EShaderType::BatchLine);
 	ID3D11InputLayout* IL = EditorResources->GetEditorInputLayout(EShaderType::BatchLine);
 
-	DeviceContext->VSSetShader(VS, nullptr, 0);
-	DeviceContext->PSSetShader(PS, nullptr, 0);
-	DeviceContext->IASetInputLayout(IL);
+	StateCache.SetVertexShader(VS);
+	StateCache.SetPixelShader(PS);
+	StateCache.SetInputLayout(IL);
 
 	// 버퍼 바인딩
-	UINT Stride = sizeof(FVertexSimple);
-	UINT Offset = 0;
-	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
-	DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-	DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+	StateCache.SetVertexBuffer(VertexBuffer, sizeof(FVertexSimple));
+	StateCache.SetIndexBuffer(IndexBuffer);
+	StateCache.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
 
 	// 렌더링
 	DeviceContext->DrawIndexed(IndexCount, 0, 0);
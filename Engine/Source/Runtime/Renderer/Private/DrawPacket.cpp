@@ -0,0 +1,225 @@
+#include "pch.h"
+#include "Runtime/Renderer/Public/DrawPacket.h"
+
+#include <future>
+
+namespace
+{
+	// 병렬 정렬에서 작업 하나가 맡을 최소 패킷 수 (자동 결정 / 명시 요청)
+	constexpr int32 MinPacketsPerSortTask = 32768;
+	constexpr int32 MinPacketsPerTask = 1024;
+
+	int32 GetNumWorkers()
+	{
+		return max(static_cast<int32>(std::thread::hardware_concurrency()), 1);
+	}
+
+	/**
+	 * @brief InFunc(Task)를 작업 수만큼 실행하는 함수 (0번 작업은 호출 스레드에서 실행)
+	 */
+	template <typename FuncType>
+	void RunTasks(int32 InNumTasks, const FuncType& InFunc)
+	{
+		if (InNumTasks <= 1)
+		{
+			InFunc(0);
+			return;
+		}
+
+		TArray<std::future<void>> Tasks;
+		Tasks.Reserve(InNumTasks - 1);
+		for (int32 Task = 1; Task < InNumTasks; ++Task)
+		{
+			Tasks.Add(std::async(std::launch::async, [&InFunc, Task]
+			{
+				InFunc(Task);
+			}));
+		}
+
+		InFunc(0);
+		for (std::future<void>& Task : Tasks)
+		{
+			Task.get();
+		}
+	}
+
+	/**
+	 * @brief DigitBits 비트 자릿수의 LSD Radix Sort
+	 * Counts는 [작업][패스][자릿수] 배치이며, 사전 패스에서 원래 순서의 구간별 개수를 모두 센다
+	 * 작업이 하나면 구간이 배열 전체라 사전 패스 개수를 모든 패스에 그대로 쓰고,
+	 * 여럿이면 첫 패스 이후 구간 내용이 바뀌므로 패스마다 해당 자릿수만 다시 센다
+	 * @return 결과가 정렬 공간(InOutScratch.Packets)에 있으면 true
+	 */
+	template <int32 DigitBits>
+	bool RadixSortPackets(FDrawPacket* InPackets, FDrawPacketSortScratch& InOutScratch, int32 InCount,
+	                      bool bInSkipConstantDigits, int32 InNumTasks)
+	{
+		constexpr int32 RadixSize = 1 << DigitBits;
+		constexpr int32 NumPasses = (64 + DigitBits - 1) / DigitBits;
+		constexpr uint64 DigitMask = RadixSize - 1;
+		constexpr int32 TaskStride = NumPasses * RadixSize;
+
+		auto GetTaskBegin = [InCount, InNumTasks](int32 InTask)
+		{
+			return static_cast<int32>(static_cast<int64>(InCount) * InTask / InNumTasks);
+		};
+
+		InOutScratch.Counts.SetNumUninitialized(InNumTasks * TaskStride);
+		int32* Counts = InOutScratch.Counts.GetData();
+		memset(Counts, 0, sizeof(int32) * InNumTasks * TaskStride);
+
+		// 히스토그램 사전 패스: 키를 한 번만 읽고 모든 자릿수를 센다
+		RunTasks(InNumTasks, [&](int32 InTask)
+		{
+			int32* TaskCounts = Counts + InTask * TaskStride;
+			const int32 End = GetTaskBegin(InTask + 1);
+			for (int32 Index = GetTaskBegin(InTask); Index < End; ++Index)
+			{
+				const uint64 Key = InPackets[Index].SortKey;
+				for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+				{
+					++TaskCounts[Pass * RadixSize + ((Key >> (Pass * DigitBits)) & DigitMask)];
+				}
+			}
+		});
+
+		FDrawPacket* Source = InPackets;
+		FDrawPacket* Dest = InOutScratch.Packets.GetData();
+		bool bCountsMatchSource = true;
+
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			const int32 Shift = Pass * DigitBits;
+			const int32 PassOffset = Pass * RadixSize;
+
+			// 첫 키의 자릿수가 전체 개수를 차지하면 모든 키가 같은 값이므로 순서가 바뀌지 않음
+			if (bInSkipConstantDigits)
+			{
+				const int32 FirstDigit = static_cast<int32>((Source[0].SortKey >> Shift) & DigitMask);
+				int32 FirstDigitCount = 0;
+				for (int32 Task = 0; Task < InNumTasks; ++Task)
+				{
+					FirstDigitCount += Counts[Task * TaskStride + PassOffset + FirstDigit];
+				}
+
+				if (FirstDigitCount == InCount)
+				{
+					continue;
+				}
+			}
+
+			if (!bCountsMatchSource)
+			{
+				RunTasks(InNumTasks, [&](int32 InTask)
+				{
+					int32* TaskCounts = Counts + InTask * TaskStride + PassOffset;
+					memset(TaskCounts, 0, sizeof(int32) * RadixSize);
+
+					const int32 End = GetTaskBegin(InTask + 1);
+					for (int32 Index = GetTaskBegin(InTask); Index < End; ++Index)
+					{
+						++TaskCounts[(Source[Index].SortKey >> Shift) & DigitMask];
+					}
+				});
+			}
+
+			// 자릿수 / 작업 순서로 누적해 각 작업이 자기 구간을 흩뿌릴 시작 위치를 구함 (안정 정렬 유지)
+			int32 Total = 0;
+			for (int32 Digit = 0; Digit < RadixSize; ++Digit)
+			{
+				for (int32 Task = 0; Task < InNumTasks; ++Task)
+				{
+					int32& Count = Counts[Task * TaskStride + PassOffset + Digit];
+					const int32 DigitCount = Count;
+					Count = Total;
+					Total += DigitCount;
+				}
+			}
+
+			RunTasks(InNumTasks, [&](int32 InTask)
+			{
+				int32* Offsets = Counts + InTask * TaskStride + PassOffset;
+				const int32 End = GetTaskBegin(InTask + 1);
+				for (int32 Index = GetTaskBegin(InTask); Index < End; ++Index)
+				{
+					Dest[Offsets[(Source[Index].SortKey >> Shift) & DigitMask]++] = Source[Index];
+				}
+			});
+
+			std::swap(Source, Dest);
+
+			// 작업이 하나면 구간이 전체라 다른 패스의 개수가 그대로 유효함
+			bCountsMatchSource = InNumTasks == 1;
+		}
+
+		return Source != InPackets;
+	}
+}
+
+uint16 FDrawPacketBuffer::AddView(const FMatrix& InViewMatrix, const FMatrix& InProjMatrix)
+{
+	// 패스는 같은 뷰 행렬로 프록시를 연달아 제출하므로 직전 뷰와만 비교
+	if (!Views.IsEmpty())
+	{
+		const FDrawPacketView& LastView = Views.Last();
+		if (memcmp(&LastView.ViewMatrix, &InViewMatrix, sizeof(FMatrix)) == 0 &&
+			memcmp(&LastView.ProjMatrix, &InProjMatrix, sizeof(FMatrix)) == 0)
+		{
+			return static_cast<uint16>(Views.Num() - 1);
+		}
+	}
+
+	// 뷰가 MaxViews개를 넘으면 인덱스가 잘려 엉뚱한 뷰로 그려지므로 막음
+	if (Views.Num() >= MaxViews)
+	{
+		assert(!"FDrawPacketBuffer: 한 프레임의 뷰 수가 MaxViews를 넘었습니다");
+		UE_LOG_ERROR("DrawPacket: 뷰 수가 %d개를 넘어 마지막 뷰를 재사용합니다", MaxViews);
+		return static_cast<uint16>(MaxViews - 1);
+	}
+
+	Views.Add({InViewMatrix, InProjMatrix});
+	return static_cast<uint16>(Views.Num() - 1);
+}
+
+void FDrawPacketBuffer::SortPackets(TArray<FDrawPacket>& InOutPackets, FDrawPacketSortScratch& InOutScratch,
+                                    const FDrawPacketSortOptions& InOptions)
+{
+	const int32 Count = InOutPackets.Num();
+	if (Count <= 1)
+	{
+		return;
+	}
+
+	int32 NumTasks = InOptions.NumTasks;
+	if (NumTasks <= 0)
+	{
+		NumTasks = min(GetNumWorkers(), Count / MinPacketsPerSortTask);
+	}
+	NumTasks = clamp(NumTasks, 1, max(Count / MinPacketsPerTask, 1));
+
+	InOutScratch.Packets.SetNumUninitialized(Count);
+
+	const bool bSortedInScratch = InOptions.DigitBits == 11
+		                              ? RadixSortPackets<11>(InOutPackets.GetData(), InOutScratch, Count,
+		                                                     InOptions.bSkipConstantDigits, NumTasks)
+		                              : RadixSortPackets<8>(InOutPackets.GetData(), InOutScratch, Count,
+		                                                    InOptions.bSkipConstantDigits, NumTasks);
+
+	// 수행한 패스 수가 홀수면 결과가 정렬 공간에 있으므로 배열을 맞바꿈 (두 배열 모두 용량 유지)
+	if (bSortedInScratch)
+	{
+		Swap(InOutPackets, InOutScratch.Packets);
+	}
+}
+
+void FDrawPacketBuffer::Execute(const FDrawPacketFunction* InFunctions, FRHIDevice* InRHIDevice) const
+{
+	FDrawPacketContext Context;
+	Context.RHIDevice = InRHIDevice;
+	Context.Views = Views.GetData();
+
+	for (const FDrawPacket& Packet : Packets)
+	{
+		InFunctions[static_cast<uint8>(Packet.Type)](Context, Packet);
+	}
+}
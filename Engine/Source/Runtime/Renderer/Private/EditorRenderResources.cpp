@@ -28,6 +28,8 @@ void FEditorRenderResources::Initialize(FRHIDevice* InRHIDevice)
 		return;
 	}
 
+	FMemoryTagScope MemoryTagScope(EMemoryTag::Renderer);
+
 	LoadEditorShaders();
 	InitializeGrid();
 	InitializeGizmoResources();
@@ -204,15 +206,15 @@ void FEditorRenderResources::RenderPrimitiveIndexed(const FEditorPrimitive& Prim
 	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
 
 	// 셰이더 설정
-	DeviceContext->VSSetShader(Primitive.VertexShader, nullptr, 0);
-	DeviceContext->PSSetShader(Primitive.PixelShader, nullptr, 0);
-	DeviceContext->IASetInputLayout(Primitive.InputLayout);
+	FRHIStateCache& StateCache = RHIDevice->GetStateCache();
+	StateCache.SetVertexShader(Primitive.VertexShader);
+	StateCache.SetPixelShader(Primitive.PixelShader);
+	StateCache.SetInputLayout(Primitive.InputLayout);
 
 	// 버퍼 바인딩
-	UINT offset = 0;
-	DeviceContext->IASetVertexBuffers(0, 1, &Primitive.Vertexbuffer, &VertexStride, &offset);
-	DeviceContext->IASetIndexBuffer(Primitive.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-	DeviceContext->IASetPrimitiveTopology(Primitive.Topology);
+	StateCache.SetVertexBuffer(Primitive.Vertexbuffer, VertexStride);
+	StateCache.SetIndexBuffer(Primitive.IndexBuffer);
+	StateCache.SetPrimitiveTopology(Primitive.Topology);
 
 	// 블렌드 상태 설정
 	RHIDevice->OMSetBlendState(bIsBlendMode);
@@ -103,8 +103,9 @@ void FLineBatcher::EndBatch(FRHICommandList* CommandList, const FMatrix& ModelMa
 	}
 
 	// FVertexSimple로 변환 (Position + Color)
-	TArray<FVertexSimple> Vertices;
-	TArray<uint32> Indices;
+	// GPU 버퍼로 복사된 뒤에는 필요 없으므로 프레임 아레나를 사용
+	TFrameArray<FVertexSimple> Vertices;
+	TFrameArray<uint32> Indices;
 
 	Vertices.Reserve(BatchedLineStartPoints.Num() * 2);
 	Indices.Reserve(BatchedLineStartPoints.Num() * 2);
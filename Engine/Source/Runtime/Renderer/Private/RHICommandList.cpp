@@ -8,9 +8,31 @@
 #include "Runtime/Renderer/Public/SetDepthStencilStateCommand.h"
 #include "Runtime/Renderer/Public/UpdateConstantBufferCommand.h"
 #include "Runtime/Renderer/Public/PresentCommands.h"
+#include "Runtime/Renderer/Public/Scene.h"
 
 class FRHISetRenderTargetCommand;
 
+namespace
+{
+    /**
+     * @brief 패킷으로 감싼 드로우 Command 실행 (프레임 아레나에 있으므로 소멸자만 호출)
+     */
+    void ExecuteCommandPacket(const FDrawPacketContext& InContext, const FDrawPacket& InPacket)
+    {
+        InPacket.Command->Execute();
+        InPacket.Command->~IRHICommand();
+    }
+
+    // EDrawPacketType 순서와 같아야 함
+    constexpr FDrawPacketFunction DrawPacketFunctions[] = {
+        &FRHIDrawIndexedPrimitivesCommand::ExecuteSceneProxyPacket,
+        &FRHIDrawIndexedPrimitivesCommand::ExecuteSceneProxyDepthOnlyPacket,
+        &ExecuteCommandPacket,
+    };
+    static_assert(std::size(DrawPacketFunctions) == static_cast<size_t>(EDrawPacketType::Num),
+                  "DrawPacketFunctions must cover every EDrawPacketType");
+}
+
 FRHICommandList::FRHICommandList(FRHIDevice* InRHIDevice)
     : RHIDevice(InRHIDevice)
       , ExecutedCommandCount(0)
@@ -37,7 +59,7 @@ void FRHICommandList::Execute()
     }
 
     // 빈 큐에 대한 안전 체크
-    if (PendingCommands.empty())
+    if (IsEmpty())
     {
         return;
     }
@@ -46,83 +68,13 @@ void FRHICommandList::Execute()
     ExecutedCommandCount = 0;
     TotalDrawCalls = 0;
 
-    // 큐가 비어있지 않은 동안 계속 처리
-    while (!PendingCommands.empty())
-    {
-        IRHICommand* Command = PendingCommands.front();
-        PendingCommands.pop();
-
-        if (Command)
-        {
-            InternalExecuteCommand(Command);
-            delete Command;
-        }
-    }
+    // 추가된 순서대로 처리
+    ExecutePendingCommands();
+    ExecuteDrawPackets();
 
     bIsExecuting = false;
 }
 
-// Radix Sort 기능 구현
-void FRHICommandList::RadixSortDrawCommands(FRHIDrawIndexedPrimitivesCommand** Commands,
-                                            size_t Count) const
-{
-    if (Count <= 1)
-    {
-        return;
-    }
-
-    // 64-bit Sorting Key 기반 초고속 Radix Sort (Unreal Engine 스타일)
-    static constexpr size_t RADIX_BITS = 8;
-    static constexpr size_t RADIX_SIZE = 1 << RADIX_BITS;
-    static constexpr size_t PASSES = sizeof(uint64) * 8 / RADIX_BITS; // 64-bit = 8 passes
-
-    // 임시 버퍼 (대용량 대응)
-    thread_local FRHIDrawIndexedPrimitivesCommand* TempBuffer[65536];
-    FRHIDrawIndexedPrimitivesCommand** Source = Commands;
-    FRHIDrawIndexedPrimitivesCommand** Dest = TempBuffer;
-
-    // 8번의 pass로 64-bit key를 완전 정렬
-    for (size_t pass = 0; pass < PASSES; ++pass)
-    {
-        size_t CountArray[RADIX_SIZE] = {0};
-        size_t shift = pass * RADIX_BITS;
-
-        // Counting phase - 64-bit Sorting Key 사용
-        for (size_t i = 0; i < Count; ++i)
-        {
-            uint64 sortingKey = Source[i]->GetSortKey();
-            size_t digit = (sortingKey >> shift) & (RADIX_SIZE - 1);
-            CountArray[digit]++;
-        }
-
-        // Prefix sum
-        size_t total = 0;
-        for (size_t i = 0; i < RADIX_SIZE; ++i)
-        {
-            size_t temp = CountArray[i];
-            CountArray[i] = total;
-            total += temp;
-        }
-
-        // Distribution phase - 안정적인 정렬 (Stable Sort)
-        for (size_t i = 0; i < Count; ++i)
-        {
-            uint64 sortingKey = Source[i]->GetSortKey();
-            size_t digit = (sortingKey >> shift) & (RADIX_SIZE - 1);
-            Dest[CountArray[digit]++] = Source[i];
-        }
-
-        // 버퍼 스왑 (다음 pass에서 사용)
-        std::swap(Source, Dest);
-    }
-
-    // 최종 결과가 TempBuffer에 있으면 원본에 복사
-    if (Source != Commands)
-    {
-        memcpy(Commands, Source, Count * sizeof(FRHIDrawIndexedPrimitivesCommand*));
-    }
-}
-
 void FRHICommandList::ExecuteWithMaterialSorting()
 {
     if (!RHIDevice)
@@ -137,7 +89,7 @@ void FRHICommandList::ExecuteWithMaterialSorting()
     }
 
     // 빈 큐에 대한 안전 체크
-    if (PendingCommands.empty())
+    if (IsEmpty())
     {
         return;
     }
@@ -146,78 +98,58 @@ void FRHICommandList::ExecuteWithMaterialSorting()
     ExecutedCommandCount = 0;
     TotalDrawCalls = 0;
 
-    TArray<IRHICommand*> AllCommands;
-    TArray<FRHIDrawIndexedPrimitivesCommand*> DrawCommands;
-    TArray<IRHICommand*> OtherCommands;
+    // 정렬된 순서로 실행 (Context Switching 최소화)
+    // 먼저 기타 Command들 실행
+    ExecutePendingCommands();
 
-    while (!PendingCommands.empty())
-    {
-        IRHICommand* Command = PendingCommands.front();
-        PendingCommands.pop();
+    // 드로우 패킷을 64-bit Sorting Key로 Radix Sort 후 실행
+    DrawPackets.Sort();
+    ExecuteDrawPackets();
 
-        if (Command)
-        {
-            AllCommands.Add(Command);
-
-            // DrawIndexedPrimitives Command만 별도로 분리
-            if (Command->GetCommandType() == ERHICommandType::DrawIndexedPrimitives)
-            {
-                DrawCommands.Add(reinterpret_cast<FRHIDrawIndexedPrimitivesCommand*>(Command));
-            }
-            else
-            {
-                OtherCommands.Add(Command);
-            }
-        }
-    }
-
-    // Draw Command들을 64-bit Sorting Key로 Radix Sort
-    if (!DrawCommands.IsEmpty())
-    {
-        RadixSortDrawCommands(DrawCommands.GetData(), DrawCommands.Num());
-    }
+    bIsExecuting = false;
+}
 
-    // 정렬된 순서로 실행 (Context Switching 최소화)
-    // 먼저 기타 Command들 실행
-    for (IRHICommand* Command : OtherCommands)
+void FRHICommandList::ExecutePendingCommands()
+{
+    for (IRHICommand* Command : PendingCommands)
     {
         if (Command)
         {
             InternalExecuteCommand(Command);
-            delete Command;
+            DestroyCommand(Command);
         }
     }
+    PendingCommands.Reset();
+}
 
-    // Material별로 정렬된 Draw Command 실행
-    UMaterial* CurrentMaterial = reinterpret_cast<UMaterial*>(-1);
-    // 처음 설정도 카운트하기 위해 유효하지 않은 값으로 초기화
-    for (FRHIDrawIndexedPrimitivesCommand* DrawCommand : DrawCommands)
-    {
-        if (DrawCommand)
-        {
-            // Material이 변경된 경우
-            UMaterial* NewMaterial = DrawCommand->GetMaterial();
-            if (NewMaterial != CurrentMaterial)
-            {
-                CurrentMaterial = NewMaterial;
-            }
-
-            InternalExecuteCommand(DrawCommand);
-            delete DrawCommand;
-        }
-    }
+/**
+ * @brief 드로우 패킷을 종류별 함수 테이블로 실행하는 함수 (가상 호출 없이 패킷 배열을 순서대로 순회)
+ */
+void FRHICommandList::ExecuteDrawPackets()
+{
+    DrawPackets.Execute(DrawPacketFunctions, RHIDevice);
 
-    bIsExecuting = false;
+    ExecutedCommandCount += DrawPackets.Num();
+    TotalDrawCalls += DrawPackets.Num();
+    DrawPackets.Reset();
 }
 
 void FRHICommandList::Clear()
 {
-    while (!PendingCommands.empty())
+    for (IRHICommand* Command : PendingCommands)
     {
-        IRHICommand* Command = PendingCommands.front();
-        PendingCommands.pop();
-        delete Command;
+        DestroyCommand(Command);
     }
+    PendingCommands.Reset();
+
+    for (const FDrawPacket& Packet : DrawPackets.GetPackets())
+    {
+        if (Packet.Type == EDrawPacketType::Command)
+        {
+            DestroyCommand(Packet.Command);
+        }
+    }
+    DrawPackets.Reset();
 
     ExecutedCommandCount = 0;
     TotalDrawCalls = 0;
@@ -241,6 +173,18 @@ void FRHICommandList::InternalExecuteCommand(IRHICommand* Command)
     }
 }
 
+/**
+ * @brief 프레임 아레나에 생성된 Command를 소멸시키는 함수
+ * 메모리는 프레임 아레나가 재설정될 때 회수되므로 소멸자만 호출한다
+ */
+void FRHICommandList::DestroyCommand(IRHICommand* Command)
+{
+    if (Command)
+    {
+        Command->~IRHICommand();
+    }
+}
+
 // 래퍼 메서드들
 void FRHICommandList::SetRenderTarget(const FSceneView* View)
 {
@@ -269,6 +213,25 @@ void FRHICommandList::DrawIndexedPrimitive(UPrimitiveComponent* Component,
     EnqueueCommand<FRHIDrawIndexedPrimitivesCommand>(Component, ViewMatrix, ProjMatrix);
 }
 
+void FRHICommandList::DrawSceneProxy(const FScene* InScene, int32 InProxyIndex, const FMatrix& ViewMatrix,
+                                     const FMatrix& ProjMatrix)
+{
+    // Command 객체 없이 정렬 키와 프록시 인덱스, 파이프라인 상태 핸들만 패킷으로 기록
+    const FPrimitiveSceneProxy& Proxy = InScene->GetPrimitive(InProxyIndex);
+    const uint64 SortKey = FRHIDrawIndexedPrimitivesCommand::MakeSortingKey(
+        Proxy.MaterialID, static_cast<uint8>(Proxy.MeshIndex & 0xFF), false);
+
+    DrawPackets.AddSceneProxy(SortKey, InScene, InProxyIndex, Proxy.PipelineState,
+                              DrawPackets.AddView(ViewMatrix, ProjMatrix));
+}
+
+void FRHICommandList::DrawSceneProxyDepthOnly(const FScene* InScene, int32 InProxyIndex, const FMatrix& ViewMatrix,
+                                              const FMatrix& ProjMatrix)
+{
+    // 정렬 키 0 + 안정 정렬이므로 Depth Pre-Pass 패킷은 BasePass 드로우보다 먼저, 기록한 순서대로 실행됨
+    DrawPackets.AddSceneProxyDepthOnly(0, InScene, InProxyIndex, DrawPackets.AddView(ViewMatrix, ProjMatrix));
+}
+
 void FRHICommandList::DrawIndexedPrimitiveWithColor(UPrimitiveComponent* Component,
                                                     const FMatrix& ViewMatrix,
                                                     const FMatrix& ProjMatrix, const FVector& Color)
@@ -319,21 +282,10 @@ void FRHICommandList::ClearRenderTarget(float R, float G, float B, float A)
     }
 }
 
-void FRHICommandList::InitializeWorkerThreads()
-{
-    // 워커 스레드 초기화는 필요시만 수행
-    // 현재는 std::async로 동적 생성
-}
-
-void FRHICommandList::ShutdownWorkerThreads()
-{
-    // 비동기 작업 완료 대기
-    if (SortingTask.valid())
-    {
-        SortingTask.wait();
-    }
-}
-
+/**
+ * @brief 드로우 패킷을 작업 여러 개로 나눠 Radix Sort한 뒤 실행하는 함수
+ * 정렬 작업 0번은 호출 스레드가 맡으므로 별도 스레드의 완료를 기다리기만 하는 구간이 없다
+ */
 void FRHICommandList::ExecuteWithMultithreadedSorting()
 {
     if (!RHIDevice || bIsExecuting)
@@ -342,7 +294,7 @@ void FRHICommandList::ExecuteWithMultithreadedSorting()
     }
 
     // 빈 큐에 대한 안전 체크
-    if (PendingCommands.empty())
+    if (IsEmpty())
     {
 	    return;
     }
@@ -351,141 +303,16 @@ void FRHICommandList::ExecuteWithMultithreadedSorting()
     ExecutedCommandCount = 0;
     TotalDrawCalls = 0;
 
-    // Command 스냅샷 생성
-    TArray<IRHICommand*> CommandSnapshot;
-    CommandSnapshot.Reserve(static_cast<int32>(PendingCommands.size()));
+    ExecutePendingCommands();
 
-    while (!PendingCommands.empty())
-    {
-        CommandSnapshot.Add(PendingCommands.front());
-        PendingCommands.pop();
-    }
-
-    // 2. 백그라운드에서 정렬 시작
-    StartBackgroundSorting();
-
-    // 3. 비동기 정렬 시작
-    if (!bIsSorting.load())
-    {
-        bIsSorting.store(true);
-        bSortingComplete.store(false);
-
-        SortingTask = std::async(std::launch::async, [this, CommandSnapshot]() mutable {
-            BackgroundSortingTask(std::move(CommandSnapshot));
-        });
-    }
-
-    // 4. 정렬 완료 대기 (대기 시간 최소화)
-    if (SortingTask.valid())
-    {
-        SortingTask.wait(); // 최소 대기
-    }
-
-    // 5. 정렬된 Command 실행
-    ExecuteSortedCommandsMultithreaded();
+    FDrawPacketSortOptions SortOptions;
+    SortOptions.NumTasks = 0;
+    DrawPackets.Sort(SortOptions);
+    ExecuteDrawPackets();
 
     bIsExecuting = false;
 }
 
-void FRHICommandList::StartBackgroundSorting()
-{
-    // 비동기 정렬 시작 준비
-    bSortingComplete.store(false);
-}
-
-bool FRHICommandList::IsSortingComplete() const
-{
-    return bSortingComplete.load();
-}
-
-void FRHICommandList::BackgroundSortingTask(TArray<IRHICommand*> CommandSnapshot) const
-{
-    try
-    {
-        // Command 분류
-        SortedDrawCommands.Empty();
-        SortedOtherCommands.Empty();
-
-        int32 commandCount = CommandSnapshot.Num();
-        SortedDrawCommands.Reserve(commandCount);
-        SortedOtherCommands.Reserve(commandCount / 8);
-
-        // 고속 분류
-        for (IRHICommand* Command : CommandSnapshot)
-        {
-            if (!Command) continue;
-
-            if (Command->GetCommandType() == ERHICommandType::DrawIndexedPrimitives)
-            {
-                SortedDrawCommands.Add(static_cast<FRHIDrawIndexedPrimitivesCommand*>(Command));
-            }
-            else
-            {
-                SortedOtherCommands.Add(Command);
-            }
-        }
-
-        // Radix Sort
-        if (!SortedDrawCommands.IsEmpty())
-        {
-            RadixSortDrawCommands(SortedDrawCommands.GetData(), SortedDrawCommands.Num());
-        }
-
-        bSortingComplete.store(true);
-    }
-    catch (const std::exception&)
-    {
-        // 예외 처리
-        bSortingComplete.store(false);
-    }
-
-    bIsSorting.store(false);
-
-    // 정렬 완료 알림
-    SortingCV.notify_one();
-}
-
-void FRHICommandList::ExecuteSortedCommandsMultithreaded()
-{
-    // 기타 Command 실행
-    for (IRHICommand* Command : SortedOtherCommands)
-    {
-        if (Command)
-        {
-            InternalExecuteCommand(Command);
-            delete Command;
-        }
-    }
-
-    // Draw Command 실행
-    if (!SortedDrawCommands.IsEmpty())
-    {
-        UMaterial* CurrentMaterial = nullptr;
-
-        for (FRHIDrawIndexedPrimitivesCommand* DrawCommand : SortedDrawCommands)
-        {
-            if (!DrawCommand)
-            {
-	            continue;
-            }
-
-            // Material 변경 추적
-            UMaterial* NewMaterial = DrawCommand->GetMaterial();
-            if (NewMaterial != CurrentMaterial)
-            {
-                CurrentMaterial = NewMaterial;
-            }
-
-            InternalExecuteCommand(DrawCommand);
-            delete DrawCommand;
-        }
-    }
-
-    // 버퍼 정리
-    SortedDrawCommands.Empty();
-    SortedOtherCommands.Empty();
-}
-
 // Present 및 BackBuffer 접근 메서드들
 
 void FRHICommandList::Present()
@@ -28,28 +28,27 @@ void FRHIRenderGizmoPrimitiveCommand::Execute()
 	try
 	{
 		// 버텍스 버퍼 설정
-		UINT stride = sizeof(FVertex);
-		UINT offset = 0;
-		DeviceContext->IASetVertexBuffers(0, 1, &Primitive.Vertexbuffer, &stride, &offset);
+		FRHIStateCache& StateCache = RHIDevice->GetStateCache();
+		StateCache.SetVertexBuffer(Primitive.Vertexbuffer, sizeof(FVertex));
 
 		// 토폴로지 설정
-		DeviceContext->IASetPrimitiveTopology(Primitive.Topology);
+		StateCache.SetPrimitiveTopology(Primitive.Topology);
 
 		// 입력 레이아웃 설정
 		if (Primitive.InputLayout)
 		{
-			DeviceContext->IASetInputLayout(Primitive.InputLayout);
+			StateCache.SetInputLayout(Primitive.InputLayout);
 		}
 
 		// 셰이더 설정
 		if (Primitive.VertexShader)
 		{
-			DeviceContext->VSSetShader(Primitive.VertexShader, nullptr, 0);
+			StateCache.SetVertexShader(Primitive.VertexShader);
 		}
 
 		if (Primitive.PixelShader)
 		{
-			DeviceContext->PSSetShader(Primitive.PixelShader, nullptr, 0);
+			StateCache.SetPixelShader(Primitive.PixelShader);
 		}
 
 		// 래스터라이저 상태 설정 - 기즈모는 컬링 없이 렌더링
@@ -72,7 +71,7 @@ void FRHIRenderGizmoPrimitiveCommand::Execute()
 		// 드로우 콜
 		if (Primitive.IndexBuffer && Primitive.NumIndices > 0)
 		{
-			DeviceContext->IASetIndexBuffer(Primitive.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+			StateCache.SetIndexBuffer(Primitive.IndexBuffer);
 			DeviceContext->DrawIndexed(Primitive.NumIndices, 0, 0);
 		}
 		else
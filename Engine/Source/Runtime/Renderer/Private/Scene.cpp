@@ -0,0 +1,207 @@
+#include "pch.h"
+#include "Runtime/Renderer/Public/Scene.h"
+
+#include "Runtime/Core/Public/VertexTypes.h"
+#include "Runtime/Actor/Public/StaticMeshActor.h"
+#include "Runtime/Component/Public/PrimitiveComponent.h"
+#include "Runtime/Component/Public/StaticMeshComponent.h"
+#include "Runtime/Engine/Public/Engine.h"
+#include "Runtime/RHI/Public/RHIDevice.h"
+#include "Runtime/Renderer/Public/DrawIndexedPrimitivesCommand.h"
+#include "Runtime/Subsystem/Asset/Public/AssetSubsystem.h"
+
+FScene::~FScene()
+{
+	Reset();
+}
+
+void FScene::AddPrimitive(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive)
+	{
+		return;
+	}
+
+	if (InPrimitive->GetScene() == this)
+	{
+		UpdatePrimitive(InPrimitive);
+		return;
+	}
+
+	if (FScene* PreviousScene = InPrimitive->GetScene())
+	{
+		PreviousScene->RemovePrimitive(InPrimitive);
+	}
+
+	const int32 ProxyIndex = Primitives.Num();
+	Primitives.SetNum(ProxyIndex + 1);
+	InPrimitive->SetSceneProxy(this, ProxyIndex);
+	CaptureProxy(InPrimitive, Primitives[ProxyIndex]);
+}
+
+void FScene::UpdatePrimitive(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive || InPrimitive->GetScene() != this)
+	{
+		return;
+	}
+
+	CaptureProxy(InPrimitive, Primitives[InPrimitive->GetSceneProxyIndex()]);
+}
+
+/**
+ * @brief 마지막 프록시를 빈 자리로 옮겨 배열을 빈틈 없이 유지하는 함수
+ */
+void FScene::RemovePrimitive(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive || InPrimitive->GetScene() != this)
+	{
+		return;
+	}
+
+	const int32 ProxyIndex = InPrimitive->GetSceneProxyIndex();
+	const int32 LastIndex = Primitives.Num() - 1;
+	if (ProxyIndex != LastIndex)
+	{
+		Primitives[ProxyIndex] = Primitives[LastIndex];
+		Primitives[ProxyIndex].Primitive->SetSceneProxy(this, ProxyIndex);
+	}
+
+	Primitives.Pop();
+	InPrimitive->SetSceneProxy(nullptr, -1);
+}
+
+void FScene::Reset()
+{
+	for (const FPrimitiveSceneProxy& Proxy : Primitives)
+	{
+		Proxy.Primitive->SetSceneProxy(nullptr, -1);
+	}
+
+	Primitives.Reset();
+	Meshes.Reset();
+	MeshIndices.Empty();
+	Sections.Reset();
+	Materials.Reset();
+	MaterialIDs.Empty();
+}
+
+void FScene::CaptureProxy(UPrimitiveComponent* InPrimitive, FPrimitiveSceneProxy& OutProxy)
+{
+	AActor* Owner = InPrimitive->GetOwner();
+
+	OutProxy.Primitive = InPrimitive;
+	OutProxy.Owner = Owner;
+	OutProxy.WorldMatrix = InPrimitive->GetWorldTransformMatrix();
+	OutProxy.bHasBounds = InPrimitive->HasBounds();
+	OutProxy.WorldBounds = InPrimitive->GetWorldBounds();
+	OutProxy.WorldBoundingSphere = InPrimitive->GetWorldBoundingSphere();
+	OutProxy.bHidden = !InPrimitive->IsVisible() || !InPrimitive->IsActive() ||
+		(Owner && Owner->GetActorHiddenInGame());
+	OutProxy.bIsStaticMeshActor = Owner && Cast<AStaticMeshActor>(Owner);
+
+	OutProxy.MeshIndex = -1;
+	OutProxy.PipelineState = 0;
+	OutProxy.Material = nullptr;
+	OutProxy.MaterialID = 0;
+
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(InPrimitive))
+	{
+		if (UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh())
+		{
+			OutProxy.MeshIndex = FindOrAddMesh(StaticMesh);
+			OutProxy.PipelineState = Meshes[OutProxy.MeshIndex].PipelineState;
+			OutProxy.Material = StaticMeshComponent->GetMaterial();
+			OutProxy.MaterialID = FindOrAddMaterial(OutProxy.Material);
+		}
+	}
+}
+
+/**
+ * @brief 메시의 버퍼, 섹션별 머티리얼, 파이프라인 상태 핸들을 한 번만 기록하는 함수
+ * 버퍼가 아직 만들어지지 않았거나 RHI 초기화 전에 기록됐으면 다음 조회 때 다시 읽는다
+ */
+int32 FScene::FindOrAddMesh(UStaticMesh* InStaticMesh)
+{
+	if (const int32* Found = MeshIndices.Find(InStaticMesh))
+	{
+		FSceneMeshInfo& Mesh = Meshes[*Found];
+		if (!Mesh.VertexBuffer || !Mesh.IndexBuffer)
+		{
+			Mesh.VertexBuffer = InStaticMesh->GetVertexBuffer();
+			Mesh.IndexBuffer = InStaticMesh->GetIndexBuffer();
+		}
+		if (!Mesh.PipelineState)
+		{
+			Mesh.PipelineState = FRHIDrawIndexedPrimitivesCommand::GetStaticMeshPipelineState(GDynamicRHI, false);
+		}
+		return *Found;
+	}
+
+	FSceneMeshInfo Mesh;
+	Mesh.StaticMesh = InStaticMesh;
+	Mesh.VertexBuffer = InStaticMesh->GetVertexBuffer();
+	Mesh.IndexBuffer = InStaticMesh->GetIndexBuffer();
+	Mesh.VertexStride = InStaticMesh->GetVertexType() == EVertexLayoutType::PositionColor
+		                    ? sizeof(FVertexSimple)
+		                    : sizeof(FVertexDynamic);
+	Mesh.IndexCount = InStaticMesh->GetIndexCount();
+	Mesh.FirstSection = Sections.Num();
+	Mesh.PipelineState = FRHIDrawIndexedPrimitivesCommand::GetStaticMeshPipelineState(GDynamicRHI, false);
+
+	UAssetSubsystem* AssetSubsystem = GEngine ? GEngine->GetEngineSubsystem<UAssetSubsystem>() : nullptr;
+	UMaterialInterface* DefaultMaterial = AssetSubsystem ? AssetSubsystem->GetDefaultMaterial() : nullptr;
+
+	const TArray<UMaterialInterface*>& MaterialSlots = InStaticMesh->GetMaterialSlots();
+	for (const FStaticMeshSection& MeshSection : InStaticMesh->GetMeshGroupInfo())
+	{
+		FPrimitiveSceneSection Section;
+		Section.StartIndex = MeshSection.GetStartIndex();
+		Section.IndexCount = MeshSection.GetIndexCount();
+		if (MeshSection.MaterialSlotIndex >= 0 && MeshSection.MaterialSlotIndex < MaterialSlots.Num())
+		{
+			Section.Material = MaterialSlots[MeshSection.MaterialSlotIndex];
+		}
+		if (!Section.Material)
+		{
+			Section.Material = DefaultMaterial;
+		}
+		Section.MaterialID = FindOrAddMaterial(Section.Material);
+		Sections.Add(Section);
+	}
+	Mesh.NumSections = Sections.Num() - Mesh.FirstSection;
+
+	const int32 MeshIndex = Meshes.Num();
+	Meshes.Add(Mesh);
+	MeshIndices[InStaticMesh] = MeshIndex;
+	return MeshIndex;
+}
+
+uint16 FScene::FindOrAddMaterial(UMaterialInterface* InMaterial)
+{
+	if (!InMaterial)
+	{
+		return 0;
+	}
+
+	if (const uint16* Found = MaterialIDs.Find(InMaterial))
+	{
+		return *Found;
+	}
+
+	if (Materials.IsEmpty())
+	{
+		Materials.Add(nullptr);
+	}
+
+	// ID 공간을 다 쓰면 정렬만 덜 정확해지므로 0으로 묶음
+	if (Materials.Num() > UINT16_MAX)
+	{
+		return 0;
+	}
+
+	const uint16 MaterialID = static_cast<uint16>(Materials.Num());
+	Materials.Add(InMaterial);
+	MaterialIDs[InMaterial] = MaterialID;
+	return MaterialID;
+}
@@ -13,16 +13,9 @@
 #include "Global/CoreTypes.h"
 #include "Runtime/Renderer/Public/RenderGizmoPrimitiveCommand.h"
 
-FSceneRenderer* FSceneRenderer::CreateSceneRenderer(const FSceneViewFamily& InViewFamily)
+FSceneRenderer::FSceneRenderer()
 {
-	return new FSceneRenderer(InViewFamily);
-}
-
-FSceneRenderer::FSceneRenderer(const FSceneViewFamily& InViewFamily)
-	: ViewFamily(&InViewFamily)
-	  , CommandList(nullptr)
-{
-	// RenderCommandList 생성
+	// RenderCommandList 생성 (RHI가 아직 없으면 첫 Render에서 생성)
 	if (GDynamicRHI)
 	{
 		CommandList = new FRHICommandList(GDynamicRHI);
@@ -36,13 +29,20 @@ FSceneRenderer::~FSceneRenderer()
 	Cleanup();
 }
 
-void FSceneRenderer::Render()
+void FSceneRenderer::Render(const FSceneViewFamily& InViewFamily)
 {
-	if (!ViewFamily || !ViewFamily->IsValid() || !GDynamicRHI)
+	if (!InViewFamily.IsValid() || !GDynamicRHI)
 	{
 		return;
 	}
 
+	if (!CommandList)
+	{
+		CommandList = new FRHICommandList(GDynamicRHI);
+	}
+
+	ViewFamily = &InViewFamily;
+
 	// ViewFamily에서 Views 추출
 	const TArray<FSceneView*>& Views = ViewFamily->GetViews();
 
@@ -53,6 +53,8 @@ void FSceneRenderer::Render()
 			RenderView(SceneView);
 		}
 	}
+
+	ViewFamily = nullptr;
 }
 
 void FSceneRenderer::RenderView(const FSceneView* InSceneView)
@@ -62,7 +64,7 @@ void FSceneRenderer::RenderView(const FSceneView* InSceneView)
 		return;
 	}
 
-	// CommandList 초기화
+	// CommandList 초기화 (이전 프레임에 남은 Command만 정리하고 용량은 유지)
 	CommandList->Clear();
 
 	// 렌더링 시작 전, 뷰포트 설정 및 덷스/스텐실 클리어
@@ -76,6 +78,9 @@ void FSceneRenderer::RenderView(const FSceneView* InSceneView)
 
 	GDynamicRHI->ClearDepthStencilView(1.0f, 0);
 
+	// DepthPrePass와 BasePass가 공유할 컬링 결과
+	ViewVisibility.Compute(InSceneView);
+
 	// 각 렌더 패스 실행
 	for (IRenderPass* Pass : RenderPasses)
 	{
@@ -165,6 +170,8 @@ void FSceneRenderer::RenderWithCommandList(const FSceneView* SceneView, FRHIComm
 	FRHICommandList* OriginalCommandList = CommandList;
 	CommandList = ExternalCommandList;
 
+	ViewVisibility.Compute(SceneView);
+
 	// 각 렌더 패스 실행
 	for (IRenderPass* Pass : RenderPasses)
 	{
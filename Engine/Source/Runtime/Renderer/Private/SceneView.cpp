@@ -88,7 +88,9 @@ void FSceneView::InitializeWithMatrices(
     // 행렬 설정
     ViewMatrix = InViewMatrix;
     ProjectionMatrix = InProjectionMatrix;
-    ViewProjectionMatrix = ViewMatrix * ProjectionMatrix;
+
+    // 셰이더는 Transpose해 올린 행렬로 열 벡터 변환(Projection * View * P)을 하므로 같은 순서로 결합
+    ViewProjectionMatrix = ProjectionMatrix * ViewMatrix;
 
     // 뷰 위치/회전 설정
     ViewLocation = InViewLocation;
@@ -168,9 +170,6 @@ void FSceneView::UpdateViewMatrices()
     const FViewProjConstants& ViewProjConstants = CameraComponent->GetFViewProjConstants();
     ViewMatrix = ViewProjConstants.View;
     ProjectionMatrix = ViewProjConstants.Projection;
-    ViewProjectionMatrix = ViewMatrix * ProjectionMatrix;
-
-    // Frustum 업데이트
-    // ViewFrustum.Update(ViewProjectionMatrix);
+    ViewProjectionMatrix = ProjectionMatrix * ViewMatrix;
 }
 
@@ -0,0 +1,206 @@
+#include "pch.h"
+#include "Runtime/Renderer/Public/SceneVisibility.h"
+
+#include "Runtime/Renderer/Public/Scene.h"
+#include "Runtime/Renderer/Public/SceneView.h"
+#include "Asset/Public/StaticMesh.h"
+#include "Runtime/Engine/Public/World.h"
+
+namespace
+{
+	/**
+	 * @brief 가림체 선정 기준
+	 * 경계 구 반지름 / 카메라 거리가 MinOccluderScreenRatio 이상인 스태틱 메시를 큰 순서로 고르고,
+	 * 개수와 삼각형 수가 상한을 넘지 않도록 한다 (래스터화 비용을 프레임마다 일정하게 유지)
+	 */
+	constexpr float MinOccluderScreenRatio = 0.05f;
+	constexpr int32 MaxOccluders = 32;
+	constexpr int32 MaxOccluderTriangles = 16384;
+}
+
+bool FSceneVisibility::bOcclusionCullingEnabled = true;
+
+/**
+ * @brief 범위가 있는 프록시는 SoA 묶음으로 한 번에 판정하고, 범위가 없는 프록시는 항상 보이는 것으로 둔다
+ * 프록시 배열만 순회하므로 Actor / 컴포넌트 UObject는 건드리지 않는다
+ */
+void FSceneVisibility::Compute(const FSceneView* InView)
+{
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	Candidates.Reset();
+	CandidateHasBounds.Reset();
+	CandidateBounds.Reset();
+	VisiblePrimitives.Reset();
+	Stats = FViewCullingStats();
+	Scene = nullptr;
+
+	TObjectPtr<UWorld> World = InView ? InView->GetWorld() : nullptr;
+	ULevel* Level = World ? World->GetLevel() : nullptr;
+	if (!Level)
+	{
+		return;
+	}
+
+	// Tick 이후의 에디터 조작도 이번 프레임 프록시에 반영 (바뀐 것이 없으면 Dirty 비트만 확인)
+	Level->UpdateComponentTransforms();
+
+	Scene = &Level->GetScene();
+	const TArray<FPrimitiveSceneProxy>& Proxies = Scene->GetPrimitives();
+	for (int32 ProxyIndex = 0; ProxyIndex < Proxies.Num(); ++ProxyIndex)
+	{
+		const FPrimitiveSceneProxy& Proxy = Proxies[ProxyIndex];
+		if (Proxy.bHidden)
+		{
+			continue;
+		}
+
+		Candidates.Add(ProxyIndex);
+		CandidateHasBounds.Add(Proxy.bHasBounds);
+		if (Proxy.bHasBounds)
+		{
+			CandidateBounds.Add(Proxy.WorldBounds);
+		}
+	}
+
+	CandidateBounds.Cull(FFrustum(InView->GetViewProjectionMatrix()), BoundsVisibility);
+
+	VisiblePrimitives.Reserve(Candidates.Num());
+	int32 BoundsIndex = 0;
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		if (!CandidateHasBounds[Index] || BoundsVisibility[BoundsIndex++])
+		{
+			VisiblePrimitives.Add(Candidates[Index]);
+		}
+	}
+
+	Stats.NumPrimitives = Candidates.Num();
+	Stats.NumFrustumCulled = Stats.NumPrimitives - VisiblePrimitives.Num();
+
+	if (bOcclusionCullingEnabled && !VisiblePrimitives.IsEmpty())
+	{
+		CullOccludedPrimitives(InView);
+	}
+
+	Stats.NumVisible = VisiblePrimitives.Num();
+	Stats.CullMilliseconds = std::chrono::duration<double, std::milli>(
+		std::chrono::high_resolution_clock::now() - StartTime).count();
+}
+
+/**
+ * @brief 가림체를 저해상도 깊이 버퍼에 그리고, 절두체를 통과한 범위 있는 프리미티브를 HiZ로 판정하는 함수
+ * 래스터화와 판정은 워커 스레드로 나눠 수행되며, 패스가 드로우 명령을 만들기 전에 끝난다
+ */
+void FSceneVisibility::CullOccludedPrimitives(const FSceneView* InView)
+{
+	const auto StartTime = std::chrono::high_resolution_clock::now();
+
+	// 뷰포트 종횡비에 맞춘 해상도 (가로 고정)
+	const FVector2 ViewportSize = InView->GetViewportSize();
+	if (ViewportSize.X > 0.0f && ViewportSize.Y > 0.0f)
+	{
+		const int32 BufferHeight = static_cast<int32>(FSoftwareOcclusionBuffer::DefaultWidth * ViewportSize.Y /
+			ViewportSize.X);
+		OcclusionBuffer.Resize(FSoftwareOcclusionBuffer::DefaultWidth,
+		                       clamp(BufferHeight, FSoftwareOcclusionBuffer::TileHeight,
+		                             FSoftwareOcclusionBuffer::DefaultWidth));
+	}
+
+	// 화면에서 크게 보이는 스태틱 메시를 가림체 후보로 수집
+	const FVector ViewLocation = InView->GetViewLocation();
+	OccluderCandidates.Reset();
+	for (const int32 ProxyIndex : VisiblePrimitives)
+	{
+		const FPrimitiveSceneProxy& Proxy = Scene->GetPrimitive(ProxyIndex);
+		if (!Proxy.HasMesh() || !Proxy.bHasBounds)
+		{
+			continue;
+		}
+
+		const FBoundingSphere& Sphere = Proxy.WorldBoundingSphere;
+		const float Distance = (Sphere.Center - ViewLocation).Length();
+		if (Distance <= Sphere.Radius)
+		{
+			continue;
+		}
+
+		const float ScreenRatio = Sphere.Radius / Distance;
+		if (ScreenRatio >= MinOccluderScreenRatio)
+		{
+			OccluderCandidates.Add({ScreenRatio, ProxyIndex});
+		}
+	}
+
+	std::sort(OccluderCandidates.begin(), OccluderCandidates.end(),
+	          [](const TPair<float, int32>& InA, const TPair<float, int32>& InB)
+	          {
+		          return InA.first > InB.first;
+	          });
+
+	OcclusionBuffer.BeginFrame(InView->GetViewProjectionMatrix());
+	int32 NumTriangles = 0;
+	for (const TPair<float, int32>& Candidate : OccluderCandidates)
+	{
+		if (Stats.NumOccluders >= MaxOccluders)
+		{
+			break;
+		}
+
+		const FPrimitiveSceneProxy& Proxy = Scene->GetPrimitive(Candidate.second);
+		const UStaticMesh* Mesh = Scene->GetMesh(Proxy.MeshIndex).StaticMesh;
+		const int32 NumMeshTriangles = Mesh->GetIndices().Num() / 3;
+		if (NumTriangles + NumMeshTriangles > MaxOccluderTriangles)
+		{
+			continue;
+		}
+
+		NumTriangles += NumMeshTriangles;
+		Stats.NumOccluderTriangles += OcclusionBuffer.AddOccluder(Mesh->GetVertices(), Mesh->GetIndices(),
+		                                                          Proxy.WorldMatrix);
+		++Stats.NumOccluders;
+	}
+
+	if (Stats.NumOccluderTriangles > 0)
+	{
+		OcclusionBuffer.Rasterize();
+
+		OccludeeIndices.Reset();
+		OccludeeBounds.Reset();
+		for (int32 Index = 0; Index < VisiblePrimitives.Num(); ++Index)
+		{
+			const FPrimitiveSceneProxy& Proxy = Scene->GetPrimitive(VisiblePrimitives[Index]);
+			if (Proxy.bHasBounds)
+			{
+				OccludeeIndices.Add(Index);
+				OccludeeBounds.Add(Proxy.WorldBounds);
+			}
+		}
+
+		Stats.NumOccluded = OcclusionBuffer.TestOccludees(OccludeeBounds, OccludeeVisibility);
+
+		// 가려진 프리미티브를 순서를 유지한 채 제거
+		if (Stats.NumOccluded > 0)
+		{
+			int32 WriteIndex = 0;
+			int32 OccludeeIndex = 0;
+			for (int32 Index = 0; Index < VisiblePrimitives.Num(); ++Index)
+			{
+				bool bVisible = true;
+				if (OccludeeIndex < OccludeeIndices.Num() && OccludeeIndices[OccludeeIndex] == Index)
+				{
+					bVisible = OccludeeVisibility[OccludeeIndex++] != 0;
+				}
+
+				if (bVisible)
+				{
+					VisiblePrimitives[WriteIndex++] = VisiblePrimitives[Index];
+				}
+			}
+			VisiblePrimitives.SetNum(WriteIndex);
+		}
+	}
+
+	Stats.OcclusionMilliseconds = std::chrono::duration<double, std::milli>(
+		std::chrono::high_resolution_clock::now() - StartTime).count();
+}
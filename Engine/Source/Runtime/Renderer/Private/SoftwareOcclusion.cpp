@@ -0,0 +1,590 @@
+#include "pch.h"
+#include "Runtime/Renderer/Public/SoftwareOcclusion.h"
+#include "Global/MatrixMath.h"
+
+#include <cfloat>
+#include <future>
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	/**
+	 * @brief 화면 밖으로 허용하는 좌표 범위 (해상도 배수), 이보다 멀면 에지 함수 정밀도가 떨어지므로 삼각형을 버린다
+	 */
+	constexpr float GuardBandScale = 8.0f;
+
+	// 띠 하나에 맡길 최소 삼각형 수와 작업 하나에 맡길 최소 후보 수
+	constexpr int32 MinTrianglesForParallel = 64;
+	constexpr int32 MinOccludeesPerTask = 1024;
+
+	/**
+	 * @brief 밉 한 단계에서 후보 사각형이 한 축으로 덮을 수 있는 최대 텍셀 수
+	 */
+	constexpr int32 MaxHiZTexelsPerAxis = 4;
+
+	FVector4 TransformPoint(const FMatrix& InMatrix, float InX, float InY, float InZ)
+	{
+		const float* Row0 = InMatrix.Data[0];
+		const float* Row1 = InMatrix.Data[1];
+		const float* Row2 = InMatrix.Data[2];
+		const float* Row3 = InMatrix.Data[3];
+		return FVector4(Row0[0] * InX + Row0[1] * InY + Row0[2] * InZ + Row0[3],
+		                Row1[0] * InX + Row1[1] * InY + Row1[2] * InZ + Row1[3],
+		                Row2[0] * InX + Row2[1] * InY + Row2[2] * InZ + Row2[3],
+		                Row3[0] * InX + Row3[1] * InY + Row3[2] * InZ + Row3[3]);
+	}
+
+	int32 GetNumWorkers()
+	{
+		return max(static_cast<int32>(std::thread::hardware_concurrency()), 1);
+	}
+}
+
+FSoftwareOcclusionBuffer::FSoftwareOcclusionBuffer(int32 InWidth, int32 InHeight)
+{
+	Resize(InWidth, InHeight);
+}
+
+void FSoftwareOcclusionBuffer::Resize(int32 InWidth, int32 InHeight)
+{
+	const int32 NewNumTilesX = max((InWidth + TileWidth - 1) / TileWidth, 1);
+	const int32 NewNumTilesY = max((InHeight + TileHeight - 1) / TileHeight, 1);
+	if (NewNumTilesX == NumTilesX && NewNumTilesY == NumTilesY)
+	{
+		return;
+	}
+
+	NumTilesX = NewNumTilesX;
+	NumTilesY = NewNumTilesY;
+	Width = NumTilesX * TileWidth;
+	Height = NumTilesY * TileHeight;
+
+	Depth.SetNum(Width * Height);
+
+	// 1x1이 될 때까지 절반씩 (홀수는 올림)
+	HiZLevels.Reset();
+	HiZWidths.Reset();
+	HiZHeights.Reset();
+	int32 LevelWidth = Width;
+	int32 LevelHeight = Height;
+	while (true)
+	{
+		HiZWidths.Add(LevelWidth);
+		HiZHeights.Add(LevelHeight);
+		HiZLevels.Add(TArray<float>());
+		HiZLevels.Last().SetNum(LevelWidth * LevelHeight);
+
+		if (LevelWidth == 1 && LevelHeight == 1)
+		{
+			break;
+		}
+		LevelWidth = (LevelWidth + 1) / 2;
+		LevelHeight = (LevelHeight + 1) / 2;
+	}
+}
+
+void FSoftwareOcclusionBuffer::BeginFrame(const FMatrix& InViewProjection)
+{
+	ViewProjection = InViewProjection;
+	Triangles.Reset();
+	std::fill(Depth.begin(), Depth.end(), 1.0f);
+}
+
+int32 FSoftwareOcclusionBuffer::AddOccluder(const TArray<FVertex>& InVertices, const TArray<uint32>& InIndices,
+                                            const FMatrix& InWorldMatrix)
+{
+	FMatrix WorldViewProjection;
+	MatrixMath::Multiply(WorldViewProjection, ViewProjection, InWorldMatrix);
+
+	int32 NumAdded = 0;
+	const int32 NumVertices = InVertices.Num();
+	for (int32 Index = 0; Index + 2 < InIndices.Num(); Index += 3)
+	{
+		const uint32 I0 = InIndices[Index];
+		const uint32 I1 = InIndices[Index + 1];
+		const uint32 I2 = InIndices[Index + 2];
+		if (I0 >= static_cast<uint32>(NumVertices) || I1 >= static_cast<uint32>(NumVertices) ||
+			I2 >= static_cast<uint32>(NumVertices))
+		{
+			continue;
+		}
+
+		const FVector& P0 = InVertices[I0].Position;
+		const FVector& P1 = InVertices[I1].Position;
+		const FVector& P2 = InVertices[I2].Position;
+		NumAdded += AddTriangle(TransformPoint(WorldViewProjection, P0.X, P0.Y, P0.Z),
+		                        TransformPoint(WorldViewProjection, P1.X, P1.Y, P1.Z),
+		                        TransformPoint(WorldViewProjection, P2.X, P2.Y, P2.Z));
+	}
+
+	return NumAdded;
+}
+
+int32 FSoftwareOcclusionBuffer::AddOccluderBox(const FAABB& InWorldBox)
+{
+	FVector4 Corners[8];
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		Corners[Corner] = TransformPoint(ViewProjection, (Corner & 1) ? InWorldBox.Max.X : InWorldBox.Min.X,
+		                                 (Corner & 2) ? InWorldBox.Max.Y : InWorldBox.Min.Y,
+		                                 (Corner & 4) ? InWorldBox.Max.Z : InWorldBox.Min.Z);
+	}
+
+	// 면마다 삼각형 2개 (감기 순서는 래스터화에서 맞추므로 상관없음)
+	static constexpr int32 Faces[6][4] = {
+		{0, 2, 6, 4}, {1, 3, 7, 5}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 5, 7, 6}
+	};
+
+	int32 NumAdded = 0;
+	for (const auto& Face : Faces)
+	{
+		NumAdded += AddTriangle(Corners[Face[0]], Corners[Face[1]], Corners[Face[2]]);
+		NumAdded += AddTriangle(Corners[Face[0]], Corners[Face[2]], Corners[Face[3]]);
+	}
+
+	return NumAdded;
+}
+
+/**
+ * @brief 클립 좌표 삼각형을 화면 좌표로 옮겨 에지 함수와 깊이 평면을 미리 계산하는 함수
+ * 근평면 앞에 꼭짓점이 있으면 잘라내는 대신 버린다 (가림체가 줄어들 뿐이므로 판정은 보수적으로 유지됨)
+ */
+int32 FSoftwareOcclusionBuffer::AddTriangle(const FVector4& InClip0, const FVector4& InClip1, const FVector4& InClip2)
+{
+	const FVector4* Clips[3] = {&InClip0, &InClip1, &InClip2};
+
+	float X[3];
+	float Y[3];
+	float Z[3];
+	for (int32 Vertex = 0; Vertex < 3; ++Vertex)
+	{
+		const FVector4& Clip = *Clips[Vertex];
+		if (Clip.W <= 0.0f || Clip.Z < 0.0f)
+		{
+			return 0;
+		}
+
+		const float InvW = 1.0f / Clip.W;
+		X[Vertex] = (Clip.X * InvW * 0.5f + 0.5f) * static_cast<float>(Width);
+		Y[Vertex] = (0.5f - Clip.Y * InvW * 0.5f) * static_cast<float>(Height);
+		Z[Vertex] = Clip.Z * InvW;
+
+		if (std::abs(X[Vertex]) > GuardBandScale * Width || std::abs(Y[Vertex]) > GuardBandScale * Height)
+		{
+			return 0;
+		}
+	}
+
+	float Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (X[2] - X[0]);
+	if (std::abs(Area) < 1e-6f)
+	{
+		return 0;
+	}
+
+	// 넓이가 양수가 되도록 감기 순서를 맞춤 (양면 모두 그림)
+	if (Area < 0.0f)
+	{
+		std::swap(X[1], X[2]);
+		std::swap(Y[1], Y[2]);
+		std::swap(Z[1], Z[2]);
+		Area = -Area;
+	}
+
+	FTriangleSetup Setup;
+	Setup.MinX = max(static_cast<int32>(std::floor(min(min(X[0], X[1]), X[2]))), 0);
+	Setup.MinY = max(static_cast<int32>(std::floor(min(min(Y[0], Y[1]), Y[2]))), 0);
+	Setup.MaxX = min(static_cast<int32>(std::ceil(max(max(X[0], X[1]), X[2]))), Width - 1);
+	Setup.MaxY = min(static_cast<int32>(std::ceil(max(max(Y[0], Y[1]), Y[2]))), Height - 1);
+	if (Setup.MinX > Setup.MaxX || Setup.MinY > Setup.MaxY)
+	{
+		return 0;
+	}
+
+	// 에지 i는 꼭짓점 i의 맞은편 (i + 1 -> i + 2), 안쪽에서 양수
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const int32 From = (Edge + 1) % 3;
+		const int32 To = (Edge + 2) % 3;
+		Setup.EdgeA[Edge] = Y[From] - Y[To];
+		Setup.EdgeB[Edge] = X[To] - X[From];
+		Setup.EdgeC[Edge] = -(Setup.EdgeA[Edge] * X[From] + Setup.EdgeB[Edge] * Y[From]);
+	}
+
+	// Z / W는 화면 공간에서 선형이므로 무게중심 좌표(에지 함수 / 넓이)로 보간
+	const float InvArea = 1.0f / Area;
+	Setup.DepthX = (Setup.EdgeA[0] * Z[0] + Setup.EdgeA[1] * Z[1] + Setup.EdgeA[2] * Z[2]) * InvArea;
+	Setup.DepthY = (Setup.EdgeB[0] * Z[0] + Setup.EdgeB[1] * Z[1] + Setup.EdgeB[2] * Z[2]) * InvArea;
+	Setup.DepthC = (Setup.EdgeC[0] * Z[0] + Setup.EdgeC[1] * Z[1] + Setup.EdgeC[2] * Z[2]) * InvArea;
+
+	Triangles.Add(Setup);
+	return 1;
+}
+
+void FSoftwareOcclusionBuffer::Rasterize(bool bInParallel)
+{
+	const int32 NumBands = bInParallel && Triangles.Num() >= MinTrianglesForParallel
+		                       ? min(GetNumWorkers(), NumTilesY)
+		                       : 1;
+
+	if (NumBands <= 1)
+	{
+		RasterizeTileRows(0, NumTilesY);
+	}
+	else
+	{
+		TArray<std::future<void>> Tasks;
+		Tasks.Reserve(NumBands - 1);
+		for (int32 Band = 1; Band < NumBands; ++Band)
+		{
+			const int32 Begin = NumTilesY * Band / NumBands;
+			const int32 End = NumTilesY * (Band + 1) / NumBands;
+			Tasks.Add(std::async(std::launch::async, [this, Begin, End]
+			{
+				RasterizeTileRows(Begin, End);
+			}));
+		}
+
+		RasterizeTileRows(0, NumTilesY / NumBands);
+		for (std::future<void>& Task : Tasks)
+		{
+			Task.get();
+		}
+	}
+
+	BuildHiZ();
+}
+
+/**
+ * @brief 타일 행 [InTileRowBegin, InTileRowEnd)에 걸친 삼각형을 타일마다 픽셀 64개씩 판정해 가까운 깊이를 기록하는 함수
+ * SIMD가 가능하면 한 행의 픽셀 4개를 한 번에 처리한다 (식의 계산 순서는 스칼라 경로와 같음)
+ */
+void FSoftwareOcclusionBuffer::RasterizeTileRows(int32 InTileRowBegin, int32 InTileRowEnd)
+{
+	const int32 BandMinY = InTileRowBegin * TileHeight;
+	const int32 BandMaxY = InTileRowEnd * TileHeight - 1;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	const __m128 LaneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 Zero = _mm_setzero_ps();
+#endif
+
+	for (const FTriangleSetup& Triangle : Triangles)
+	{
+		const int32 MinY = max(Triangle.MinY, BandMinY);
+		const int32 MaxY = min(Triangle.MaxY, BandMaxY);
+		if (MinY > MaxY)
+		{
+			continue;
+		}
+
+		const int32 TileMinX = Triangle.MinX / TileWidth;
+		const int32 TileMaxX = Triangle.MaxX / TileWidth;
+		const int32 TileMinY = MinY / TileHeight;
+		const int32 TileMaxY = MaxY / TileHeight;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+		const __m128 EdgeA0 = _mm_set1_ps(Triangle.EdgeA[0]);
+		const __m128 EdgeA1 = _mm_set1_ps(Triangle.EdgeA[1]);
+		const __m128 EdgeA2 = _mm_set1_ps(Triangle.EdgeA[2]);
+		const __m128 EdgeC0 = _mm_set1_ps(Triangle.EdgeC[0]);
+		const __m128 EdgeC1 = _mm_set1_ps(Triangle.EdgeC[1]);
+		const __m128 EdgeC2 = _mm_set1_ps(Triangle.EdgeC[2]);
+		const __m128 DepthX = _mm_set1_ps(Triangle.DepthX);
+		const __m128 DepthC = _mm_set1_ps(Triangle.DepthC);
+#endif
+
+		for (int32 TileY = TileMinY; TileY <= TileMaxY; ++TileY)
+		{
+			for (int32 TileX = TileMinX; TileX <= TileMaxX; ++TileX)
+			{
+				float* TileDepth = &Depth[(TileY * NumTilesX + TileX) * TileSize];
+
+				for (int32 Row = 0; Row < TileHeight; ++Row)
+				{
+					const float PixelY = static_cast<float>(TileY * TileHeight + Row) + 0.5f;
+					float* RowDepth = TileDepth + Row * TileWidth;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+					const __m128 EdgeY0 = _mm_set1_ps(Triangle.EdgeB[0] * PixelY);
+					const __m128 EdgeY1 = _mm_set1_ps(Triangle.EdgeB[1] * PixelY);
+					const __m128 EdgeY2 = _mm_set1_ps(Triangle.EdgeB[2] * PixelY);
+					const __m128 DepthYTerm = _mm_set1_ps(Triangle.DepthY * PixelY);
+
+					for (int32 Column = 0; Column < TileWidth; Column += 4)
+					{
+						const __m128 PixelX = _mm_add_ps(
+							_mm_set1_ps(static_cast<float>(TileX * TileWidth + Column)), LaneOffsets);
+
+						const __m128 Edge0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(EdgeA0, PixelX), EdgeY0), EdgeC0);
+						const __m128 Edge1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(EdgeA1, PixelX), EdgeY1), EdgeC1);
+						const __m128 Edge2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(EdgeA2, PixelX), EdgeY2), EdgeC2);
+						const __m128 Inside = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(Edge0, Zero), _mm_cmpgt_ps(Edge1, Zero)),
+						                                 _mm_cmpgt_ps(Edge2, Zero));
+						if (_mm_movemask_ps(Inside) == 0)
+						{
+							continue;
+						}
+
+						const __m128 PixelDepth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(DepthX, PixelX), DepthYTerm), DepthC);
+						const __m128 OldDepth = _mm_loadu_ps(RowDepth + Column);
+						const __m128 NewDepth = _mm_min_ps(OldDepth, PixelDepth);
+						_mm_storeu_ps(RowDepth + Column,
+						              _mm_or_ps(_mm_and_ps(Inside, NewDepth), _mm_andnot_ps(Inside, OldDepth)));
+					}
+#else
+					for (int32 Column = 0; Column < TileWidth; ++Column)
+					{
+						const float PixelX = static_cast<float>(TileX * TileWidth + Column) + 0.5f;
+						const float Edge0 = (Triangle.EdgeA[0] * PixelX + Triangle.EdgeB[0] * PixelY) + Triangle.EdgeC[0];
+						const float Edge1 = (Triangle.EdgeA[1] * PixelX + Triangle.EdgeB[1] * PixelY) + Triangle.EdgeC[1];
+						const float Edge2 = (Triangle.EdgeA[2] * PixelX + Triangle.EdgeB[2] * PixelY) + Triangle.EdgeC[2];
+						if (Edge0 > 0.0f && Edge1 > 0.0f && Edge2 > 0.0f)
+						{
+							const float PixelDepth = (Triangle.DepthX * PixelX + Triangle.DepthY * PixelY) +
+								Triangle.DepthC;
+							RowDepth[Column] = min(RowDepth[Column], PixelDepth);
+						}
+					}
+#endif
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief 타일 배치를 행 우선으로 풀어 0번 밉을 만들고, 2x2 최대 깊이로 나머지 밉을 만드는 함수
+ */
+void FSoftwareOcclusionBuffer::BuildHiZ()
+{
+	TArray<float>& Level0 = HiZLevels[0];
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		for (int32 X = 0; X < Width; X += TileWidth)
+		{
+			const float* Source = &Depth[GetPixelIndex(X, Y)];
+			std::copy(Source, Source + TileWidth, &Level0[Y * Width + X]);
+		}
+	}
+
+	for (int32 Level = 1; Level < HiZLevels.Num(); ++Level)
+	{
+		const TArray<float>& Source = HiZLevels[Level - 1];
+		const int32 SourceWidth = HiZWidths[Level - 1];
+		const int32 SourceHeight = HiZHeights[Level - 1];
+		TArray<float>& Destination = HiZLevels[Level];
+
+		for (int32 Y = 0; Y < HiZHeights[Level]; ++Y)
+		{
+			const int32 Y0 = Y * 2;
+			const int32 Y1 = min(Y0 + 1, SourceHeight - 1);
+			for (int32 X = 0; X < HiZWidths[Level]; ++X)
+			{
+				const int32 X0 = X * 2;
+				const int32 X1 = min(X0 + 1, SourceWidth - 1);
+				Destination[Y * HiZWidths[Level] + X] = max(
+					max(Source[Y0 * SourceWidth + X0], Source[Y0 * SourceWidth + X1]),
+					max(Source[Y1 * SourceWidth + X0], Source[Y1 * SourceWidth + X1]));
+			}
+		}
+	}
+}
+
+bool FSoftwareOcclusionBuffer::ProjectBounds(const FAABB& InWorldBounds, int32& OutMinX, int32& OutMinY,
+                                             int32& OutMaxX, int32& OutMaxY, float& OutNearestDepth) const
+{
+	float ScreenMinX = FLT_MAX;
+	float ScreenMinY = FLT_MAX;
+	float ScreenMaxX = -FLT_MAX;
+	float ScreenMaxY = -FLT_MAX;
+	OutNearestDepth = FLT_MAX;
+
+	// 꼭짓점 8개의 클립 좌표는 최소 꼭짓점에 축별 변화량을 더해 구함
+	const FVector Size = InWorldBounds.Max - InWorldBounds.Min;
+	float Base[4];
+	float AxisDeltas[3][4];
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		const float* M = ViewProjection.Data[Row];
+		Base[Row] = M[0] * InWorldBounds.Min.X + M[1] * InWorldBounds.Min.Y + M[2] * InWorldBounds.Min.Z + M[3];
+		AxisDeltas[0][Row] = M[0] * Size.X;
+		AxisDeltas[1][Row] = M[1] * Size.Y;
+		AxisDeltas[2][Row] = M[2] * Size.Z;
+	}
+
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		float Clip[4] = {Base[0], Base[1], Base[2], Base[3]};
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (Corner & (1 << Axis))
+			{
+				for (int32 Row = 0; Row < 4; ++Row)
+				{
+					Clip[Row] += AxisDeltas[Axis][Row];
+				}
+			}
+		}
+
+		// 근평면을 넘는 후보는 화면 사각형을 구할 수 없으므로 보이는 것으로 둠
+		if (Clip[3] <= 0.0f || Clip[2] < 0.0f)
+		{
+			return false;
+		}
+
+		const float InvW = 1.0f / Clip[3];
+		const float ScreenX = (Clip[0] * InvW * 0.5f + 0.5f) * static_cast<float>(Width);
+		const float ScreenY = (0.5f - Clip[1] * InvW * 0.5f) * static_cast<float>(Height);
+		ScreenMinX = min(ScreenMinX, ScreenX);
+		ScreenMinY = min(ScreenMinY, ScreenY);
+		ScreenMaxX = max(ScreenMaxX, ScreenX);
+		ScreenMaxY = max(ScreenMaxY, ScreenY);
+		OutNearestDepth = min(OutNearestDepth, Clip[2] * InvW);
+	}
+
+	const float ScreenWidth = static_cast<float>(Width);
+	const float ScreenHeight = static_cast<float>(Height);
+	if (ScreenMaxX <= 0.0f || ScreenMaxY <= 0.0f || ScreenMinX >= ScreenWidth || ScreenMinY >= ScreenHeight)
+	{
+		return false;
+	}
+
+	// 사각형이 걸친 픽셀 전체 (경계가 픽셀 안에 있으면 그 픽셀도 포함)
+	OutMinX = static_cast<int32>(std::floor(max(ScreenMinX, 0.0f)));
+	OutMinY = static_cast<int32>(std::floor(max(ScreenMinY, 0.0f)));
+	OutMaxX = max(static_cast<int32>(std::ceil(min(ScreenMaxX, ScreenWidth))) - 1, OutMinX);
+	OutMaxY = max(static_cast<int32>(std::ceil(min(ScreenMaxY, ScreenHeight))) - 1, OutMinY);
+	return true;
+}
+
+/**
+ * @brief 사각형이 한 축으로 MaxHiZTexelsPerAxis 이하를 덮는 밉을 골라, 덮는 텍셀이 모두 후보보다 가까우면 가려진 것으로 판정
+ */
+bool FSoftwareOcclusionBuffer::IsOccluded(const FAABB& InWorldBounds) const
+{
+	int32 MinX, MinY, MaxX, MaxY;
+	float NearestDepth;
+	if (!ProjectBounds(InWorldBounds, MinX, MinY, MaxX, MaxY, NearestDepth))
+	{
+		return false;
+	}
+
+	int32 Level = 0;
+	while (Level + 1 < HiZLevels.Num() &&
+		max((MaxX >> Level) - (MinX >> Level), (MaxY >> Level) - (MinY >> Level)) >= MaxHiZTexelsPerAxis)
+	{
+		++Level;
+	}
+
+	const TArray<float>& LevelDepth = HiZLevels[Level];
+	const int32 LevelWidth = HiZWidths[Level];
+	for (int32 Y = MinY >> Level; Y <= MaxY >> Level; ++Y)
+	{
+		for (int32 X = MinX >> Level; X <= MaxX >> Level; ++X)
+		{
+			if (LevelDepth[Y * LevelWidth + X] >= NearestDepth)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+int32 FSoftwareOcclusionBuffer::TestOccludees(const TArray<FAABB>& InBounds, TArray<uint8>& OutVisibility,
+                                              bool bInParallel) const
+{
+	const int32 NumBounds = InBounds.Num();
+	OutVisibility.SetNum(NumBounds);
+
+	auto TestRange = [this, &InBounds, &OutVisibility](int32 InBegin, int32 InEnd)
+	{
+		int32 NumOccluded = 0;
+		for (int32 Index = InBegin; Index < InEnd; ++Index)
+		{
+			const bool bOccluded = IsOccluded(InBounds[Index]);
+			OutVisibility[Index] = !bOccluded;
+			NumOccluded += bOccluded;
+		}
+		return NumOccluded;
+	};
+
+	const int32 NumTasks = bInParallel ? min(GetNumWorkers(), NumBounds / MinOccludeesPerTask) : 1;
+	if (NumTasks <= 1)
+	{
+		return TestRange(0, NumBounds);
+	}
+
+	TArray<std::future<int32>> Tasks;
+	Tasks.Reserve(NumTasks - 1);
+	for (int32 Task = 1; Task < NumTasks; ++Task)
+	{
+		Tasks.Add(std::async(std::launch::async, TestRange, NumBounds * Task / NumTasks,
+		                     NumBounds * (Task + 1) / NumTasks));
+	}
+
+	int32 NumOccluded = TestRange(0, NumBounds / NumTasks);
+	for (std::future<int32>& Task : Tasks)
+	{
+		NumOccluded += Task.get();
+	}
+
+	return NumOccluded;
+}
+
+float FSoftwareOcclusionBuffer::GetDepth(int32 InX, int32 InY) const
+{
+	return Depth[GetPixelIndex(InX, InY)];
+}
+
+void FSoftwareOcclusionBuffer::RasterizeReference()
+{
+	for (const FTriangleSetup& Triangle : Triangles)
+	{
+		for (int32 Y = Triangle.MinY; Y <= Triangle.MaxY; ++Y)
+		{
+			const float PixelY = static_cast<float>(Y) + 0.5f;
+			for (int32 X = Triangle.MinX; X <= Triangle.MaxX; ++X)
+			{
+				const float PixelX = static_cast<float>(X) + 0.5f;
+				const float Edge0 = (Triangle.EdgeA[0] * PixelX + Triangle.EdgeB[0] * PixelY) + Triangle.EdgeC[0];
+				const float Edge1 = (Triangle.EdgeA[1] * PixelX + Triangle.EdgeB[1] * PixelY) + Triangle.EdgeC[1];
+				const float Edge2 = (Triangle.EdgeA[2] * PixelX + Triangle.EdgeB[2] * PixelY) + Triangle.EdgeC[2];
+				if (Edge0 > 0.0f && Edge1 > 0.0f && Edge2 > 0.0f)
+				{
+					float& PixelDepth = Depth[GetPixelIndex(X, Y)];
+					PixelDepth = min(PixelDepth, (Triangle.DepthX * PixelX + Triangle.DepthY * PixelY) + Triangle.DepthC);
+				}
+			}
+		}
+	}
+
+	BuildHiZ();
+}
+
+bool FSoftwareOcclusionBuffer::IsOccludedReference(const FAABB& InWorldBounds) const
+{
+	int32 MinX, MinY, MaxX, MaxY;
+	float NearestDepth;
+	if (!ProjectBounds(InWorldBounds, MinX, MinY, MaxX, MaxY, NearestDepth))
+	{
+		return false;
+	}
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			if (GetDepth(X, Y) >= NearestDepth)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
@@ -1,8 +1,7 @@
 #pragma once
 #include "RenderPass.h"
 
-class UPrimitiveComponent;
-class AActor;
+class FScene;
 
 /**
  * @brief Geometry Render Pass
@@ -22,9 +21,6 @@ public:
 	void Cleanup() override;
 
 private:
-	bool RenderActor(AActor* Actor, const FSceneView* View, class FRHICommandList* RHICmdList,
-	                 const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix, const FVector& HighlightColor);
-	void RenderPrimitiveComponent(UPrimitiveComponent* Component, const FSceneView* View,
-	                              FRHICommandList* RHICmdList, const FMatrix& ViewMatrix,
-	                              const FMatrix& ProjectionMatrix);
+	void RenderSceneProxy(const FScene* InScene, int32 InProxyIndex, class FRHICommandList* RHICmdList,
+	                      const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix);
 };
@@ -1,10 +1,12 @@
 ﻿#pragma once
 #include "RenderPass.h"
 
-class AActor;
+class FScene;
+class FRHICommandList;
 
 /**
  * @brief Depth 우선 처리하는 전처리 Pass
+ * 보이는 씬 프록시의 깊이만 먼저 기록해 BasePass의 가려진 픽셀 셰이딩을 줄인다
  */
 class FDepthPrePass :
     public IRenderPass
@@ -17,5 +19,6 @@ public:
     void Execute(const FSceneView* View, FSceneRenderer* SceneRenderer) override;
 
 private:
-    void RenderActorDepth(AActor* Actor, const FSceneView* View, FSceneRenderer* SceneRenderer);
+    void RenderPrimitiveDepth(const FScene* InScene, int32 InProxyIndex, FRHICommandList* RHICmdList,
+                              const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix);
 };
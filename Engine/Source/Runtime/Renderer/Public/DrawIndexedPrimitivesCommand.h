@@ -2,9 +2,13 @@
 #include "RenderCommand.h"
 
 #include "SetRenderTargetCommand.h"
+#include "Runtime/RHI/Public/RHIPipelineState.h"
 
 class UPrimitiveComponent;
 class UMaterial;
+class UMaterialInterface;
+struct FDrawPacket;
+struct FDrawPacketContext;
 
 /**
  * @brief 메시 렌더링 Command를 정의한 함수
@@ -48,10 +52,40 @@ public:
     void Execute() override;
 
     void SetupShaderForComponent(UPrimitiveComponent* InComponent);
+    static void SetupShaderForMaterial(FRHIDevice* InRHIDevice, FRHIPipelineStateHandle InPipelineState,
+                                       UMaterial* InMaterial);
     void RenderComponent(UPrimitiveComponent* InComponent);
     void RenderStaticMeshComponent(class UStaticMeshComponent* StaticMeshComp);
     void RenderGizmoComponent(class UStaticMeshComponent* StaticMeshComp);
 
+    /**
+     * @brief 씬 프록시 드로우 패킷의 실행 함수 (Command 객체 없이 FScene에 복사된 행렬 / 메시 / 머티리얼로 그림)
+     */
+    static void ExecuteSceneProxyPacket(const FDrawPacketContext& InContext, const FDrawPacket& InPacket);
+
+    /**
+     * @brief 씬 프록시 깊이 전용 패킷의 실행 함수 (머티리얼 바인딩 없이 메시 전체를 한 번에 그려 깊이만 기록)
+     */
+    static void ExecuteSceneProxyDepthOnlyPacket(const FDrawPacketContext& InContext, const FDrawPacket& InPacket);
+
+    /**
+     * @brief 스태틱 메시 셰이더와 래스터 / 블렌드(기즈모는 깊이 포함) 조합의 파이프라인 상태 핸들을 반환하는 함수
+     * 셰이더 경로 조회와 등록은 처음 한 번만 하고 이후에는 기억한 핸들을 반환한다
+     * @return RHI 초기화 전이면 0
+     */
+    static FRHIPipelineStateHandle GetStaticMeshPipelineState(FRHIDevice* InRHIDevice, bool bInIsGizmo);
+
+    /**
+     * @brief 일반 스태틱 메시 조합에서 픽셀 셰이더와 컬러 쓰기를 뺀 깊이 전용 조합의 핸들을 반환하는 함수
+     * @return RHI 초기화 전이면 0
+     */
+    static FRHIPipelineStateHandle GetStaticMeshDepthOnlyPipelineState(FRHIDevice* InRHIDevice);
+
+    /**
+     * @brief Command와 드로우 패킷이 같은 순서로 정렬되도록 공유하는 Sorting Key 생성 함수
+     */
+    static uint64 MakeSortingKey(uint16 InMaterialID, uint8 InMeshID, bool bInIsGizmo);
+
     ERHICommandType GetCommandType() const override
     {
         return ERHICommandType::DrawIndexedPrimitives;
@@ -74,6 +108,7 @@ public:
 private:
     FRHIDevice* RHIDevice;
     UPrimitiveComponent* Component;
+
     FMatrix ViewMatrix;
     FMatrix ProjMatrix;
 
@@ -87,4 +122,12 @@ private:
 
     // Sorting Key 초기화 헬퍼 메소드
     void InitializeSortingKey(UPrimitiveComponent* InComponent, const FMatrix& InViewMatrix);
+    void SetSortingKeyFromIDs(uint16 InMaterialID, uint8 InMeshID);
+
+    // 파이프라인 상태와 기본 샘플러를 바인딩 (텍스처는 섹션마다 바인딩)
+    static void BindPipelineState(FRHIDevice* InRHIDevice, FRHIPipelineStateHandle InPipelineState);
+
+    // 섹션 머티리얼의 텍스처와 상수 버퍼를 바인딩 (머티리얼이 없으면 흰색 기본 머티리얼)
+    static void BindSectionMaterial(FRHIDevice* InRHIDevice, UMaterialInterface* InMaterialInterface);
+    static void BindDefaultMaterial(FRHIDevice* InRHIDevice);
 };
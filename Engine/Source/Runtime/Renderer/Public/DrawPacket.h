@@ -0,0 +1,184 @@
+#pragma once
+
+class FRHIDevice;
+class FScene;
+class IRHICommand;
+
+/**
+ * @brief 드로우 패킷 종류 (실행 함수 테이블의 인덱스)
+ * SceneProxy는 FScene 프록시를 그리는 패킷이고, SceneProxyDepthOnly는 같은 프록시의 깊이만 기록하는 Depth Pre-Pass 패킷,
+ * Command는 아직 패킷으로 옮기지 않은 드로우 Command를 감싼다
+ */
+enum class EDrawPacketType : uint8
+{
+	SceneProxy,
+	SceneProxyDepthOnly,
+	Command,
+
+	Num
+};
+
+/**
+ * @brief 씬 프록시 패킷의 실행 데이터 (명령 실행 전까지 씬이 바뀌지 않음)
+ * @param PipelineState 프록시를 만들 때 등록한 파이프라인 상태 핸들 (FRHIPipelineStateHandle)
+ */
+struct FSceneProxyDrawPayload
+{
+	const FScene* Scene;
+	int32 ProxyIndex;
+	uint16 PipelineState;
+};
+
+/**
+ * @brief 정렬 키와 실행에 필요한 값을 그대로 담는 POD 드로우 패킷
+ * 개별 할당 없이 FDrawPacketBuffer의 연속 배열에 값으로 저장되며, 정렬도 패킷을 직접 옮긴다
+ * View / Projection 행렬은 패킷마다 복사하지 않고 버퍼의 뷰 테이블 인덱스로 참조한다
+ */
+struct FDrawPacket
+{
+	uint64 SortKey;
+
+	union
+	{
+		FSceneProxyDrawPayload SceneProxy;
+		IRHICommand* Command;
+	};
+
+	EDrawPacketType Type;
+	uint16 ViewIndex;
+};
+
+static_assert(std::is_trivially_copyable_v<FDrawPacket>, "FDrawPacket must stay POD");
+
+/**
+ * @brief 패킷들이 공유하는 View / Projection 행렬
+ */
+struct FDrawPacketView
+{
+	FMatrix ViewMatrix;
+	FMatrix ProjMatrix;
+};
+
+/**
+ * @brief 패킷 실행 시 함께 전달되는 값
+ */
+struct FDrawPacketContext
+{
+	FRHIDevice* RHIDevice = nullptr;
+	const FDrawPacketView* Views = nullptr;
+};
+
+using FDrawPacketFunction = void (*)(const FDrawPacketContext& InContext, const FDrawPacket& InPacket);
+
+/**
+ * @brief 드로우 패킷 Radix Sort 방식
+ * @param DigitBits 패스 하나가 처리할 키 비트 수 (8이면 최대 8패스, 11이면 최대 6패스)
+ * @param bSkipConstantDigits 히스토그램 사전 패스에서 모든 키의 값이 같은 자릿수의 패스를 건너뛸지 여부
+ * @param NumTasks 패킷 구간을 나눠 맡을 작업 수 (1이면 호출 스레드에서만 정렬, 0이면 패킷 수와 코어 수로 결정)
+ */
+struct FDrawPacketSortOptions
+{
+	int32 DigitBits = 8;
+	bool bSkipConstantDigits = true;
+	int32 NumTasks = 1;
+};
+
+/**
+ * @brief 정렬 중에만 쓰는 공간 (프레임 사이에 재사용)
+ * @param Packets 패스마다 패킷을 번갈아 옮길 배열
+ * @param Counts 작업 / 패스 / 자릿수별 개수와 흩뿌릴 위치
+ */
+struct FDrawPacketSortScratch
+{
+	TArray<FDrawPacket> Packets;
+	TArray<int32> Counts;
+};
+
+/**
+ * @brief 드로우 패킷을 선형으로 쌓고, 정렬 키로 정렬한 뒤 종류별 함수 테이블로 실행하는 버퍼
+ * Reset은 개수만 0으로 되돌리므로 패킷 / 뷰 / 정렬용 배열의 용량은 프레임 사이에 그대로 재사용된다
+ * RHI에 의존하지 않으므로 실행 함수 테이블만 바꾸면 렌더러 없이도 측정할 수 있다
+ */
+class FDrawPacketBuffer
+{
+public:
+	// 패킷의 ViewIndex가 uint16이므로 한 프레임에 등록할 수 있는 최대 뷰 수
+	static constexpr int32 MaxViews = UINT16_MAX + 1;
+
+	/**
+	 * @brief 뷰 행렬을 등록하고 인덱스를 반환하는 함수 (직전에 등록한 뷰와 같으면 그 인덱스를 재사용)
+	 * MaxViews를 넘으면 assert 후 마지막 뷰의 인덱스를 반환한다 (조용히 잘리지 않음)
+	 */
+	uint16 AddView(const FMatrix& InViewMatrix, const FMatrix& InProjMatrix);
+
+	void AddSceneProxy(uint64 InSortKey, const FScene* InScene, int32 InProxyIndex, uint16 InPipelineState,
+	                   uint16 InViewIndex)
+	{
+		FDrawPacket& Packet = Packets[Packets.AddUninitialized()];
+		Packet.SortKey = InSortKey;
+		Packet.SceneProxy.Scene = InScene;
+		Packet.SceneProxy.ProxyIndex = InProxyIndex;
+		Packet.SceneProxy.PipelineState = InPipelineState;
+		Packet.Type = EDrawPacketType::SceneProxy;
+		Packet.ViewIndex = InViewIndex;
+	}
+
+	void AddSceneProxyDepthOnly(uint64 InSortKey, const FScene* InScene, int32 InProxyIndex, uint16 InViewIndex)
+	{
+		FDrawPacket& Packet = Packets[Packets.AddUninitialized()];
+		Packet.SortKey = InSortKey;
+		Packet.SceneProxy.Scene = InScene;
+		Packet.SceneProxy.ProxyIndex = InProxyIndex;
+		Packet.SceneProxy.PipelineState = 0;
+		Packet.Type = EDrawPacketType::SceneProxyDepthOnly;
+		Packet.ViewIndex = InViewIndex;
+	}
+
+	void AddCommand(uint64 InSortKey, IRHICommand* InCommand)
+	{
+		FDrawPacket& Packet = Packets[Packets.AddUninitialized()];
+		Packet.SortKey = InSortKey;
+		Packet.Command = InCommand;
+		Packet.Type = EDrawPacketType::Command;
+		Packet.ViewIndex = 0;
+	}
+
+	/**
+	 * @brief 패킷을 정렬 키 오름차순으로 정렬하는 함수 (같은 키는 추가된 순서 유지)
+	 */
+	void Sort(const FDrawPacketSortOptions& InOptions = FDrawPacketSortOptions())
+	{
+		SortPackets(Packets, SortScratch, InOptions);
+	}
+
+	/**
+	 * @brief 패킷 배열을 LSD Radix Sort로 안정 정렬하는 함수
+	 * 키를 한 번 읽어 모든 자릿수의 히스토그램을 만든 뒤, 값이 하나뿐인 자릿수는 건너뛰고 나머지 패스만 수행한다
+	 * 작업이 여럿이면 패스마다 구간별 히스토그램을 세고, 자릿수 / 구간 순서의 위치로 각 작업이 자기 구간을 흩뿌린다
+	 * 정렬 공간은 필요한 만큼 늘어나며 줄지 않는다 (패킷 수 제한 없음)
+	 */
+	static void SortPackets(TArray<FDrawPacket>& InOutPackets, FDrawPacketSortScratch& InOutScratch,
+	                        const FDrawPacketSortOptions& InOptions = FDrawPacketSortOptions());
+
+	/**
+	 * @brief 현재 순서대로 패킷을 실행하는 함수
+	 * @param InFunctions EDrawPacketType마다 하나씩 있는 실행 함수 테이블
+	 */
+	void Execute(const FDrawPacketFunction* InFunctions, FRHIDevice* InRHIDevice) const;
+
+	void Reset()
+	{
+		Packets.Reset();
+		Views.Reset();
+	}
+
+	int32 Num() const { return Packets.Num(); }
+	bool IsEmpty() const { return Packets.IsEmpty(); }
+	const TArray<FDrawPacket>& GetPackets() const { return Packets; }
+
+private:
+	TArray<FDrawPacket> Packets;
+	TArray<FDrawPacketView> Views;
+
+	FDrawPacketSortScratch SortScratch;
+};
@@ -1,14 +1,19 @@
 ﻿#pragma once
-#include <future>
-
 #include "RenderCommand.h"
+#include "Runtime/Core/Public/FrameArena.h"
+#include "Runtime/Renderer/Public/DrawPacket.h"
 
 class UPrimitiveComponent;
 class FRHIDevice;
+class FScene;
 
 /**
  * @brief RenderCommand들을 수집하고 일괄 실행하는 클래스
  * 여러 패스에서 생성된 RenderCommand들을 모아서 효율적으로 GPU에 제출
+ * FSceneRenderer가 프레임 사이에 유지하며, 실행 / Clear는 배열을 비우기만 하므로 용량이 그대로 재사용된다
+ *
+ * 드로우는 FDrawPacketBuffer의 POD 패킷으로 쌓이고, 상태 변경 Command는 추가된 순서대로 먼저 실행된다
+ * 씬 프록시 드로우는 Command 객체 없이 패킷만 만들며, 그 밖의 드로우 Command는 패킷으로 감싸 함께 정렬한다
  */
 class FRHICommandList
 {
@@ -17,36 +22,37 @@ public:
 	~FRHICommandList();
 
 	// RenderCommand 추가
+	// Command는 실행 직후 버려지므로 개별 힙 할당 대신 프레임 아레나에 생성한다
 	template <typename TCommand, typename... TArgs>
 	void EnqueueCommand(TArgs&&... Args)
 	{
-		TCommand* Command = new TCommand(RHIDevice, std::forward<TArgs>(Args)...);
-		PendingCommands.push(Command);
+		TCommand* Command = FFrameArena::GetInstance().New<TCommand>(RHIDevice, std::forward<TArgs>(Args)...);
+		if (Command->GetCommandType() == ERHICommandType::DrawIndexedPrimitives)
+		{
+			DrawPackets.AddCommand(Command->GetSortingKey(), Command);
+		}
+		else
+		{
+			PendingCommands.Add(Command);
+		}
 	}
 
-	// 모든 Command 실행
+	// 모든 Command 실행 (상태 변경 Command 다음에 드로우 패킷을 추가된 순서대로 실행)
 	void Execute();
 
 	// Material별 정렬 후 실행
 	void ExecuteWithMaterialSorting();
 
-	// 멀티스레드 실행
+	// 드로우 패킷을 여러 스레드로 나눠 정렬 후 실행 (드로우가 많은 경우)
 	void ExecuteWithMultithreadedSorting();
 
-	// 비동기 정렬 시작
-	void StartBackgroundSorting();
-	bool IsSortingComplete() const;
-
-	// 워커 스레드 초기화 정리
-	void InitializeWorkerThreads();
-	void ShutdownWorkerThreads();
-
 	// Command 큐 비우기
 	void Clear();
 
 	// 통계
-	int32 GetCommandCount() const { return static_cast<int32>(PendingCommands.size()); }
-	bool IsEmpty() const { return PendingCommands.empty(); }
+	int32 GetCommandCount() const { return PendingCommands.Num() + DrawPackets.Num(); }
+	int32 GetDrawPacketCount() const { return DrawPackets.Num(); }
+	bool IsEmpty() const { return PendingCommands.IsEmpty() && DrawPackets.IsEmpty(); }
 
 	// RHI Device 접근자
 	FRHIDevice* GetRHIDevice() const { return RHIDevice; }
@@ -59,6 +65,9 @@ public:
 	void SetBlendState(bool bEnableBlending);
 	void UpdateConstantBuffers(const FMatrix& Model, const FMatrix& View, const FMatrix& Projection);
 	void DrawIndexedPrimitive(UPrimitiveComponent* Component, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+	void DrawSceneProxy(const FScene* InScene, int32 InProxyIndex, const FMatrix& ViewMatrix, const FMatrix& ProjMatrix);
+	void DrawSceneProxyDepthOnly(const FScene* InScene, int32 InProxyIndex, const FMatrix& ViewMatrix,
+	                             const FMatrix& ProjMatrix);
 	void DrawIndexedPrimitiveWithColor(UPrimitiveComponent* Component, const FMatrix& ViewMatrix,
 	                                   const FMatrix& ProjMatrix, const FVector& Color);
 	void DrawIndexedPrimitiveWithColorAndHovering(UPrimitiveComponent* Component, const FMatrix& ViewMatrix,
@@ -74,7 +83,12 @@ public:
 
 private:
 	FRHIDevice* RHIDevice;
-	TQueue<IRHICommand*> PendingCommands;
+
+	// 드로우가 아닌 Command (추가된 순서대로 실행, 프레임마다 Reset만 하므로 용량 유지)
+	TArray<IRHICommand*> PendingCommands;
+
+	// 드로우 패킷 (Sorting Key로 정렬한 뒤 실행)
+	FDrawPacketBuffer DrawPackets;
 
 	// 통계 추적
 	int32 ExecutedCommandCount = 0;
@@ -83,26 +97,10 @@ private:
 	// 실행 상태 추적 (중복 실행 방지)
 	bool bIsExecuting = false;
 
-	// 멀티스레드 지원
-	mutable mutex CommandMutex;
-	mutable std::condition_variable SortingCV;
-	mutable atomic<bool> bIsSorting{false};
-	mutable atomic<bool> bSortingComplete{false};
-
-	// 정렬된 Command 버퍼
-	mutable TArray<class FRHIDrawIndexedPrimitivesCommand*> SortedDrawCommands;
-	mutable TArray<IRHICommand*> SortedOtherCommands;
-
-	// 비동기 작업 스레드
-	mutable std::future<void> SortingTask;
-	static constexpr size_t MAX_WORKER_THREADS = 2;
-
 	void InternalExecuteCommand(IRHICommand* Command);
+	static void DestroyCommand(IRHICommand* Command);
 
-	// Sorting Key 기반 정렬
-	void RadixSortDrawCommands(FRHIDrawIndexedPrimitivesCommand** Commands, size_t Count) const;
-
-	// 멀티스레드 헬퍼
-	void BackgroundSortingTask(TArray<IRHICommand*> CommandSnapshot) const;
-	void ExecuteSortedCommandsMultithreaded();
+	// 상태 변경 Command와 드로우 패킷 실행 (실행 후 비움)
+	void ExecutePendingCommands();
+	void ExecuteDrawPackets();
 };
@@ -0,0 +1,136 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+class AActor;
+class UPrimitiveComponent;
+class UStaticMesh;
+class UMaterial;
+class UMaterialInterface;
+struct ID3D11Buffer;
+
+/**
+ * @brief 메시 섹션 하나의 드로우 범위와 머티리얼
+ * @param MaterialID 씬에서 머티리얼마다 하나씩 매긴 조밀한 ID (정렬 키에 사용)
+ */
+struct FPrimitiveSceneSection
+{
+	uint32 StartIndex = 0;
+	uint32 IndexCount = 0;
+	UMaterialInterface* Material = nullptr;
+	uint16 MaterialID = 0;
+};
+
+/**
+ * @brief 여러 프록시가 공유하는 스태틱 메시의 렌더 데이터 (메시 애셋마다 한 번만 만든다)
+ * 섹션은 FScene의 섹션 배열에서 [FirstSection, FirstSection + NumSections) 구간이다
+ * @param PipelineState 메시를 그릴 셰이더 / 래스터 / 블렌드 조합의 핸들 (RHI 초기화 전에 기록됐으면 0)
+ */
+struct FSceneMeshInfo
+{
+	UStaticMesh* StaticMesh = nullptr;
+	ID3D11Buffer* VertexBuffer = nullptr;
+	ID3D11Buffer* IndexBuffer = nullptr;
+	uint32 VertexStride = 0;
+	uint32 IndexCount = 0;
+	int32 FirstSection = 0;
+	int32 NumSections = 0;
+	uint16 PipelineState = 0;
+};
+
+/**
+ * @brief 렌더 패스가 읽는 프리미티브 하나의 요약본
+ * 컴포넌트의 상태가 바뀔 때만 다시 채워지며, 패스는 UObject 대신 이 값만 읽는다
+ * Primitive / Owner는 피킹이나 디버그 표시처럼 UObject가 꼭 필요한 곳에서만 사용한다
+ */
+struct FPrimitiveSceneProxy
+{
+	FMatrix WorldMatrix;
+	FAABB WorldBounds;
+	FBoundingSphere WorldBoundingSphere;
+
+	UPrimitiveComponent* Primitive = nullptr;
+	AActor* Owner = nullptr;
+
+	// 대표 머티리얼 (셰이더 텍스처 바인딩과 정렬용)
+	UMaterial* Material = nullptr;
+	uint16 MaterialID = 0;
+
+	// FScene 메시 테이블 인덱스 (그릴 메시가 없으면 -1)
+	int32 MeshIndex = -1;
+
+	// 메시의 파이프라인 상태 핸들 (드로우 패킷에 그대로 복사)
+	uint16 PipelineState = 0;
+
+	bool bHasBounds = false;
+
+	// Actor가 숨겨졌거나 컴포넌트가 보이지 않음 / 비활성
+	bool bHidden = false;
+
+	// StaticMesh Show Flag 대상 Actor
+	bool bIsStaticMeshActor = false;
+
+	bool HasMesh() const { return MeshIndex >= 0; }
+};
+
+/**
+ * @brief 레벨의 프리미티브를 렌더링용 프록시로 보관하는 영속 씬
+ * 프록시는 연속된 배열에 빈틈 없이 저장되며, 제거하면 마지막 프록시를 빈 자리로 옮긴다
+ * 따라서 프록시 인덱스는 컴포넌트가 들고 있는 값으로만 신뢰하고, 프레임 사이에 외부에서 보관하지 않는다
+ *
+ * ULevel이 Transform 갱신 직후 바뀐 컴포넌트에 대해서만 AddPrimitive / UpdatePrimitive를 호출하고,
+ * 컴포넌트가 삭제되거나 Actor가 레벨에서 빠지면 RemovePrimitive를 호출한다
+ */
+class FScene
+{
+public:
+	FScene() = default;
+	~FScene();
+
+	FScene(const FScene&) = delete;
+	FScene& operator=(const FScene&) = delete;
+
+	/**
+	 * @brief 컴포넌트의 프록시를 만들고 컴포넌트에 인덱스를 기록하는 함수 (이미 있으면 갱신)
+	 */
+	void AddPrimitive(UPrimitiveComponent* InPrimitive);
+
+	/**
+	 * @brief 컴포넌트의 현재 상태(행렬, 범위, 메시, 머티리얼, 표시 여부)로 프록시를 다시 채우는 함수
+	 */
+	void UpdatePrimitive(UPrimitiveComponent* InPrimitive);
+
+	void RemovePrimitive(UPrimitiveComponent* InPrimitive);
+
+	/**
+	 * @brief 모든 컴포넌트의 등록을 해제하고 프록시와 메시 / 머티리얼 테이블을 비우는 함수
+	 */
+	void Reset();
+
+	int32 GetNumPrimitives() const { return Primitives.Num(); }
+	const TArray<FPrimitiveSceneProxy>& GetPrimitives() const { return Primitives; }
+	const FPrimitiveSceneProxy& GetPrimitive(int32 InIndex) const { return Primitives[InIndex]; }
+
+	const FSceneMeshInfo& GetMesh(int32 InMeshIndex) const { return Meshes[InMeshIndex]; }
+	const FPrimitiveSceneSection* GetSections(const FSceneMeshInfo& InMesh) const
+	{
+		return InMesh.NumSections > 0 ? &Sections[InMesh.FirstSection] : nullptr;
+	}
+
+	int32 GetNumMeshes() const { return Meshes.Num(); }
+	int32 GetNumMaterials() const { return Materials.Num(); }
+
+private:
+	void CaptureProxy(UPrimitiveComponent* InPrimitive, FPrimitiveSceneProxy& OutProxy);
+	int32 FindOrAddMesh(UStaticMesh* InStaticMesh);
+	uint16 FindOrAddMaterial(UMaterialInterface* InMaterial);
+
+	TArray<FPrimitiveSceneProxy> Primitives;
+
+	TArray<FSceneMeshInfo> Meshes;
+	TMap<UStaticMesh*, int32> MeshIndices;
+	TArray<FPrimitiveSceneSection> Sections;
+
+	// MaterialID는 이 배열의 인덱스 (0은 머티리얼 없음)
+	TArray<UMaterialInterface*> Materials;
+	TMap<UMaterialInterface*, uint16> MaterialIDs;
+};
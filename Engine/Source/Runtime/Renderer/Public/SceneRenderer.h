@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "Runtime/Renderer/Public/SceneVisibility.h"
 
 class IRHICommand;
 class IRenderPass;
@@ -14,34 +15,43 @@ class FRHIDevice;
 /**
 * @brief Scene 기반 렌더링을 제공하는 클래스
 * SceneView와 World 정보를 바탕으로 여러 렌더 패스를 조율하여 최종 이미지를 생성
+* 뷰포트마다 하나씩 소유되어 프레임 사이에 재사용되며, 렌더 패스 / CommandList / 컬링 결과 버퍼는 한 번만 만든다
 */
 class FSceneRenderer
 {
 public:
-    // 정적 팩토리 메소드로 생성 (Viewport Draw마다 새로 생성)
-    static FSceneRenderer* CreateSceneRenderer(const FSceneViewFamily& InViewFamily);
+    FSceneRenderer();
     ~FSceneRenderer();
 
-    void Render();
+    FSceneRenderer(const FSceneRenderer&) = delete;
+    FSceneRenderer& operator=(const FSceneRenderer&) = delete;
+
+    /**
+     * @brief 이번 프레임의 ViewFamily에 속한 뷰들을 차례로 렌더링하는 함수
+     * ViewFamily는 호출 동안에만 참조하며, 끝나면 보관하지 않는다
+     */
+    void Render(const FSceneViewFamily& InViewFamily);
     void RenderWithCommandList(const FSceneView* SceneView, class FRHICommandList* CommandList);
     void Cleanup();
 
     // RenderCommandList 접근자
     FRHICommandList* GetCommandList() const { return CommandList; }
 
+    // 현재 렌더링 중인 뷰의 컬링 결과 (패스 실행 전에 뷰마다 한 번 계산)
+    const FSceneVisibility& GetViewVisibility() const { return ViewVisibility; }
+
     // 기즈모 렌더링 RenderCommand 추가 메서드
     void EnqueueGizmoPrimitive(const struct FEditorPrimitive& Primitive, const struct FRenderState& RenderState, 
                               const FVector& CameraLocation, float ViewportWidth, float ViewportHeight);
 
 private:
-    const FSceneViewFamily* ViewFamily;
+    const FSceneViewFamily* ViewFamily = nullptr;
     TArray<IRenderPass*> RenderPasses;
-    FRHICommandList* CommandList;
+    FRHICommandList* CommandList = nullptr;
+    FSceneVisibility ViewVisibility;
 
     static FRHIDevice* GlobalRHI;
 
-    FSceneRenderer(const FSceneViewFamily& InViewFamily);
-
     void CreateDefaultRenderPasses();
     void RenderView(const FSceneView* InSceneView);
 };
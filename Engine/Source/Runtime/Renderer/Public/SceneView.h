@@ -13,7 +13,7 @@ class UWorld;
  * @param World 뷰가 속한 게임 월드 또는 레벨
  * @param ViewMatrix 월드 공간을 뷰 공간으로 변환하는 행렬
  * @param ProjectionMatrix 뷰 공간을 클립 공간으로 변환하는 행렬
- * @param ViewProjectionMatrix ViewMatrix와 ProjectionMatrix를 결합한 행렬 (최종 월드-클립 공간 변환)
+ * @param ViewProjectionMatrix ProjectionMatrix * ViewMatrix (열 벡터 기준 최종 월드-클립 공간 변환, 절두체 추출에 사용)
  * @param ViewLocation 뷰의 월드 공간 위치
  * @param ViewRotation 뷰의 월드 공간 회전 (쿼터니언)
  * @param FOV 시야각 (Field of View)
@@ -66,8 +66,6 @@ public:
     float GetNearClippingPlane() const { return NearClip; }
     float GetFarClippingPlane() const { return FarClip; }
 
-    // const FFrustum& GetFrustum() const { return ViewFrustum; }
-
 private:
     TObjectPtr<ACameraActor> Camera = nullptr;
     TObjectPtr<FViewport> Viewport = nullptr;
@@ -88,6 +86,4 @@ private:
     EViewMode ViewModeIndex = EViewMode::Lit;
     FVector2 ViewportSize;
     FRect ViewRect;
-
-    // FFrustum ViewFrustum;
 };
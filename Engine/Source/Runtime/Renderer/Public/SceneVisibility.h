@@ -0,0 +1,76 @@
+#pragma once
+#include "Physics/Public/Frustum.h"
+#include "Runtime/Renderer/Public/SoftwareOcclusion.h"
+
+class FScene;
+class FSceneView;
+
+/**
+ * @brief 뷰 하나의 컬링 통계
+ * @param NumPrimitives 컬링 대상 프리미티브 수 (숨김 Actor / 비활성 컴포넌트 제외)
+ * @param NumVisible 절두체 안에 있거나 범위가 없어 항상 그리는 프리미티브 수
+ * @param NumFrustumCulled 절두체 밖으로 판정된 프리미티브 수
+ * @param NumOccluded 절두체 안에 있지만 가림체 뒤에 가려진 프리미티브 수
+ * @param NumOccluders / NumOccluderTriangles 깊이 버퍼에 그린 가림체와 삼각형 수
+ * @param CullMilliseconds 수집과 판정에 걸린 전체 시간
+ * @param OcclusionMilliseconds 그중 가림체 래스터화와 가림 판정에 걸린 시간
+ */
+struct FViewCullingStats
+{
+	int32 NumPrimitives = 0;
+	int32 NumVisible = 0;
+	int32 NumFrustumCulled = 0;
+	int32 NumOccluded = 0;
+	int32 NumOccluders = 0;
+	int32 NumOccluderTriangles = 0;
+	double CullMilliseconds = 0.0;
+	double OcclusionMilliseconds = 0.0;
+};
+
+/**
+ * @brief 뷰마다 한 번 절두체 / 가림 컬링을 수행하고 결과를 렌더 패스들이 공유하도록 보관하는 클래스
+ * 레벨의 FScene 프록시 배열을 순회하며, DepthPrePass와 BasePass는 보이는 프록시 인덱스만 순회한다
+ */
+class FSceneVisibility
+{
+public:
+	/**
+	 * @brief 뷰 월드의 씬 프록시를 프록시에 복사된 월드 AABB로 절두체 컬링하는 함수
+	 * 가림 컬링이 켜져 있으면 화면에 크게 보이는 스태틱 메시를 가림체로 그린 뒤 나머지를 HiZ로 판정한다
+	 */
+	void Compute(const FSceneView* InView);
+
+	/**
+	 * @brief 컬링에 사용한 씬과 보이는 프록시 인덱스 (프록시 배열 순서 유지)
+	 */
+	const FScene* GetScene() const { return Scene; }
+	const TArray<int32>& GetVisiblePrimitives() const { return VisiblePrimitives; }
+	const FViewCullingStats& GetStats() const { return Stats; }
+
+	static bool IsOcclusionCullingEnabled() { return bOcclusionCullingEnabled; }
+	static void SetOcclusionCullingEnabled(bool bInEnabled) { bOcclusionCullingEnabled = bInEnabled; }
+
+private:
+	/**
+	 * @brief 절두체를 통과한 프리미티브 중 가려진 것을 VisiblePrimitives에서 빼는 함수
+	 */
+	void CullOccludedPrimitives(const FSceneView* InView);
+
+	static bool bOcclusionCullingEnabled;
+
+	FSoftwareOcclusionBuffer OcclusionBuffer;
+	TArray<TPair<float, int32>> OccluderCandidates;
+	TArray<int32> OccludeeIndices;
+	TArray<FAABB> OccludeeBounds;
+	TArray<uint8> OccludeeVisibility;
+
+	// 매 프레임 메모리 재사용
+	TArray<int32> Candidates;
+	TArray<uint8> CandidateHasBounds;
+	FCullingBoundsBatch CandidateBounds;
+	TArray<uint8> BoundsVisibility;
+
+	const FScene* Scene = nullptr;
+	TArray<int32> VisiblePrimitives;
+	FViewCullingStats Stats;
+};
@@ -0,0 +1,133 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+/**
+ * @brief 가림체(Occluder)를 저해상도 깊이 버퍼에 CPU로 래스터화하고, 후보 프리미티브를 계층 Z(HiZ)로 판정하는 클래스
+ *
+ * 깊이 버퍼는 8x8 타일 단위로 저장해 타일 하나가 캐시 몇 줄에 들어가도록 하고, 한 행의 픽셀 4개를 SIMD로 처리한다
+ * 래스터화는 타일 행을 띠(Band)로 나눠 워커 스레드에서 동시에 수행하며, 띠끼리는 쓰는 메모리가 겹치지 않는다
+ * 끝나면 2x2 최대 깊이로 줄인 밉 체인을 만들고, 후보의 화면 사각형을 몇 개의 텍셀로 덮는 밉에서 판정한다
+ *
+ * 판정은 보수적이다
+ * - 가림체 삼각형은 픽셀 중심이 안쪽에 있을 때만 깊이를 기록하고, 근평면을 넘거나 가드 밴드를 벗어나면 건너뛴다
+ * - 후보는 AABB 꼭짓점 중 가장 가까운 깊이가 덮는 모든 텍셀의 최대 깊이보다 멀 때만 가려진 것으로 본다
+ *
+ * 깊이는 D3D 규약의 Z / W (근평면 0, 원평면 1)이며, 행렬은 FFrustum과 같은 열 벡터 규약(Projection * View)이다
+ */
+class FSoftwareOcclusionBuffer
+{
+public:
+	static constexpr int32 TileWidth = 8;
+	static constexpr int32 TileHeight = 8;
+	static constexpr int32 TileSize = TileWidth * TileHeight;
+
+	// 기본 해상도 (16:9, 타일 배수)
+	static constexpr int32 DefaultWidth = 256;
+	static constexpr int32 DefaultHeight = 144;
+
+	FSoftwareOcclusionBuffer(int32 InWidth = DefaultWidth, int32 InHeight = DefaultHeight);
+
+	/**
+	 * @brief 해상도를 바꾸는 함수 (타일 배수로 올림)
+	 */
+	void Resize(int32 InWidth, int32 InHeight);
+
+	/**
+	 * @brief 새 뷰의 가림체 수집을 시작하는 함수 (이전 삼각형과 깊이를 비움)
+	 */
+	void BeginFrame(const FMatrix& InViewProjection);
+
+	/**
+	 * @brief 메시 삼각형을 가림체로 추가하는 함수 (월드 변환 후 화면 공간 삼각형으로 설정만 해 둠)
+	 * @return 추가된 삼각형 수 (근평면 / 가드 밴드 / 면적 0으로 제외된 삼각형은 빠짐)
+	 */
+	int32 AddOccluder(const TArray<FVertex>& InVertices, const TArray<uint32>& InIndices, const FMatrix& InWorldMatrix);
+
+	/**
+	 * @brief 월드 AABB를 닫힌 상자 가림체로 추가하는 함수 (상자 안이 꽉 찬 물체에만 사용)
+	 */
+	int32 AddOccluderBox(const FAABB& InWorldBox);
+
+	/**
+	 * @brief 수집한 가림체를 깊이 버퍼에 그리고 HiZ 밉 체인을 만드는 함수
+	 * @param bInParallel 타일 행 띠를 워커 스레드로 나눠 그릴지 여부
+	 */
+	void Rasterize(bool bInParallel = true);
+
+	/**
+	 * @brief 월드 AABB가 가림체 뒤에 완전히 가려졌는지 판정하는 함수 (Rasterize 이후 호출)
+	 */
+	bool IsOccluded(const FAABB& InWorldBounds) const;
+
+	/**
+	 * @brief 여러 후보를 한 번에 판정하는 함수 (후보가 많으면 워커 스레드로 나눔)
+	 * @param OutVisibility 후보별 결과 (가려지면 0)
+	 * @return 가려진 후보 수
+	 */
+	int32 TestOccludees(const TArray<FAABB>& InBounds, TArray<uint8>& OutVisibility, bool bInParallel = true) const;
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+	int32 GetNumTriangles() const { return Triangles.Num(); }
+	int32 GetNumHiZLevels() const { return HiZLevels.Num(); }
+
+	/**
+	 * @brief 검증용 함수들
+	 * GetDepth는 타일 배치를 풀어 픽셀 하나의 깊이를 읽고, RasterizeReference는 같은 식을 픽셀마다 스칼라로 계산한다
+	 * IsOccludedReference는 밉을 쓰지 않고 최고 해상도 픽셀 전체와 비교한다 (IsOccluded가 true면 반드시 true)
+	 */
+	float GetDepth(int32 InX, int32 InY) const;
+	void RasterizeReference();
+	bool IsOccludedReference(const FAABB& InWorldBounds) const;
+
+private:
+	/**
+	 * @brief 화면 공간 삼각형의 에지 함수(A * X + B * Y + C > 0 이면 안쪽)와 깊이 평면, 픽셀 범위
+	 */
+	struct FTriangleSetup
+	{
+		float EdgeA[3];
+		float EdgeB[3];
+		float EdgeC[3];
+		float DepthX;
+		float DepthY;
+		float DepthC;
+		int32 MinX;
+		int32 MinY;
+		int32 MaxX;
+		int32 MaxY;
+	};
+
+	/**
+	 * @brief 후보 AABB의 화면 사각형(픽셀, 양 끝 포함)과 가장 가까운 깊이
+	 * @return 근평면을 넘거나 화면 밖이라 판정할 수 없으면 false
+	 */
+	bool ProjectBounds(const FAABB& InWorldBounds, int32& OutMinX, int32& OutMinY, int32& OutMaxX, int32& OutMaxY,
+	                   float& OutNearestDepth) const;
+
+	int32 AddTriangle(const FVector4& InClip0, const FVector4& InClip1, const FVector4& InClip2);
+	void RasterizeTileRows(int32 InTileRowBegin, int32 InTileRowEnd);
+	void BuildHiZ();
+
+	int32 GetPixelIndex(int32 InX, int32 InY) const
+	{
+		return ((InY / TileHeight) * NumTilesX + InX / TileWidth) * TileSize + (InY % TileHeight) * TileWidth +
+			InX % TileWidth;
+	}
+
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 NumTilesX = 0;
+	int32 NumTilesY = 0;
+
+	FMatrix ViewProjection;
+	TArray<FTriangleSetup> Triangles;
+
+	// 타일 순서로 저장한 깊이 (타일 안은 행 우선)
+	TArray<float> Depth;
+
+	// 행 우선 최대 깊이 밉 체인 (0번이 최고 해상도)
+	TArray<TArray<float>> HiZLevels;
+	TArray<int32> HiZWidths;
+	TArray<int32> HiZHeights;
+};
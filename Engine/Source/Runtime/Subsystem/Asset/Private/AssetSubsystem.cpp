@@ -24,6 +24,8 @@ void UAssetSubsystem::Initialize()
 
 TObjectPtr<UTexture> UAssetSubsystem::LoadTexture(const FString& TexturePath)
 {
+	FMemoryTagScope MemoryTagScope(EMemoryTag::Texture);
+
 	// 이미 생성된 UTexture 객체가 있는지 확인 (언리얼 방식)
 	if (TObjectPtr<UTexture>* Found = TextureCache.Find(TexturePath))
 	{
@@ -70,6 +72,8 @@ void UAssetSubsystem::InitializeDefaultMaterial() const
 		return;
 	}
 
+	FMemoryTagScope MemoryTagScope(EMemoryTag::Asset);
+
 	// CPU 데이터만 생성 (텍스처 GPU 업로드는 Renderer에서 처리)
 	FObjMaterialInfo DefaultMaterialInfo(FString("DefaultMaterial"));
 	DefaultMaterialInfo.DiffuseTexturePath = "Data\\Texture\\DefaultTexture.png";
@@ -103,6 +107,8 @@ void UAssetSubsystem::ReleaseDefaultMaterial()
 
 TObjectPtr<UStaticMesh> UAssetSubsystem::LoadStaticMesh(const FString& InFilePath)
 {
+	FMemoryTagScope MemoryTagScope(EMemoryTag::StaticMesh);
+
 	// 이미 로드된 StaticMesh인지 확인
 	for (TObjectIterator<UStaticMesh> Iter; Iter; ++Iter)
 	{
@@ -470,6 +476,8 @@ FString UAssetSubsystem::FindTextureFilePath(const FString& InFileName) const
 
 TObjectPtr<UShader> UAssetSubsystem::LoadShader(const FString& InFilePath, const TArray<D3D11_INPUT_ELEMENT_DESC>& InLayoutDesc)
 {
+	FMemoryTagScope MemoryTagScope(EMemoryTag::Asset);
+
 	// 캐시 확인
 	if (ShaderCache.Contains(InFilePath))
 	{
@@ -4,6 +4,7 @@
 #include "Runtime/RHI/Public/RHIDevice.h"
 #include "Runtime/Core/Public/EngineStatics.h"
 #include "Global/Memory.h"
+#include "Runtime/Core/Public/FrameArena.h"
 #include "Runtime/Engine/Public/Engine.h"
 
 #include <psapi.h>
@@ -372,10 +373,16 @@ void UDebugRenderingSubsystem::UpdateMemoryStats()
             PeakMemoryUsage = std::max(PeakMemoryUsage, CurrentMemoryUsage);
         }
 
-        // 커스텀 메모리 할당 정보 (FMemory 클래스가 없으므로 임시로 0으로 설정)
-        // TODO: 실제 메모리 할당 추적 시스템 구현 필요
+        // 커스텀 메모리 할당 정보
+        FMemory::GetTagStats(MemoryTagStats);
+
         CurrentAllocationCount = 0;
         CurrentAllocationBytes = 0;
+        for (const FMemoryTagStat& TagStat : MemoryTagStats)
+        {
+            CurrentAllocationCount += TagStat.AllocationCount;
+            CurrentAllocationBytes += TagStat.AllocatedBytes;
+        }
     }
 }
 
@@ -417,10 +424,43 @@ void UDebugRenderingSubsystem::RenderMemoryOverlay() const
     FString AllocBytesStr = GetMemorySizeString(CurrentAllocationBytes);
 
     wchar_t AllocText[512];
-    (void)swprintf_s(AllocText, L"Allocations: %u (%hs)",
+    (void)swprintf_s(AllocText, L"Allocations: %llu (%hs)",
                CurrentAllocationCount, AllocBytesStr.data());
 
     DrawText(AllocText, OVERLAY_MARGIN_X, YOffset, 0xFFAAAAAA);
+
+    // 프레임 아레나 (직전 프레임 사용량 / 최대 사용량 / 확보한 페이지)
+    YOffset += OVERLAY_LINE_HEIGHT;
+    const FFrameArena& FrameArena = FFrameArena::GetInstance();
+    FString FrameUsedStr = GetMemorySizeString(FrameArena.GetLastFrameUsedBytes());
+    FString FrameHighWaterStr = GetMemorySizeString(FrameArena.GetHighWaterMark());
+    FString FrameReservedStr = GetMemorySizeString(FrameArena.GetReservedBytes());
+
+    wchar_t FrameArenaText[512];
+    (void)swprintf_s(FrameArenaText, L"Frame Arena: %hs (High: %hs, Reserved: %hs)",
+               FrameUsedStr.data(), FrameHighWaterStr.data(), FrameReservedStr.data());
+
+    DrawText(FrameArenaText, OVERLAY_MARGIN_X, YOffset, 0xFFAAAAAA);
+
+    // 메모리 태그별 할당 정보 (할당이 남아있는 태그만 표시)
+    for (uint32 TagIndex = 0; TagIndex < NumMemoryTags; ++TagIndex)
+    {
+        const FMemoryTagStat& TagStat = MemoryTagStats[TagIndex];
+        if (TagStat.AllocationCount == 0)
+        {
+            continue;
+        }
+
+        YOffset += OVERLAY_LINE_HEIGHT;
+        FString TagBytesStr = GetMemorySizeString(TagStat.AllocatedBytes);
+
+        wchar_t TagText[512];
+        (void)swprintf_s(TagText, L"  %hs: %llu (%hs)",
+                   FMemory::GetTagName(static_cast<EMemoryTag>(TagIndex)), TagStat.AllocationCount,
+                   TagBytesStr.data());
+
+        DrawText(TagText, OVERLAY_MARGIN_X, YOffset, 0xFF88CCFF);
+    }
 }
 
 void UDebugRenderingSubsystem::DrawText(const wchar_t* InText, float InX, float InY, uint32 InColor) const
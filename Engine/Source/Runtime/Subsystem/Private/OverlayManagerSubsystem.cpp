@@ -444,8 +444,8 @@ void UOverlayManagerSubsystem::UpdateMemoryInfo()
 		}
 
 		// 동적 할당 정보 업데이트
-		CurrentAllocationCount = TotalAllocationCount;
-		CurrentAllocationBytes = TotalAllocationBytes;
+		CurrentAllocationCount = FMemory::GetTotalAllocationCount();
+		CurrentAllocationBytes = FMemory::GetTotalAllocationBytes();
 
 		MemoryUpdateTimer = 0.0f;
 	}
@@ -503,11 +503,11 @@ void UOverlayManagerSubsystem::RenderMemoryOverlay() const
 	DrawText(ProcessMemoryInfoText, OVERLAY_MARGIN_X, yOffset, 0xFF00FF00); // 초록색
 
 	// 동적 할당 정보
-	float AllocationKB = static_cast<float>(CurrentAllocationBytes / KILO);
+	float AllocationKB = static_cast<float>(CurrentAllocationBytes) / KILO;
 
 	wchar_t HeapAllocText[128];
 	(void)swprintf_s(HeapAllocText,
-	                 L"동적할당 정보: %u objs, %.1f KB", CurrentAllocationCount, AllocationKB);
+	                 L"동적할당 정보: %llu objs, %.1f KB", CurrentAllocationCount, AllocationKB);
 
 	// 청록색
 	DrawText(HeapAllocText, OVERLAY_MARGIN_X, yOffset + OVERLAY_LINE_HEIGHT, 0xFF00FFFF);
@@ -69,8 +69,9 @@ private:
     // Memory statistics
     SIZE_T CurrentMemoryUsage = 0;
     SIZE_T PeakMemoryUsage = 0;
-    uint32 CurrentAllocationCount = 0;
-    uint32 CurrentAllocationBytes = 0;
+    uint64 CurrentAllocationCount = 0;
+    uint64 CurrentAllocationBytes = 0;
+    FMemoryTagStat MemoryTagStats[NumMemoryTags] = {};
     float MemoryUpdateTimer = 0.0f;
 
     // RHI-based initialization
@@ -70,8 +70,8 @@ private:
 	// memory variable
 	SIZE_T CurrentMemoryUsage = 0;
 	SIZE_T PeakMemoryUsage = 0;
-	uint32 CurrentAllocationCount = 0;
-	uint32 CurrentAllocationBytes = 0;
+	uint64 CurrentAllocationCount = 0;
+	uint64 CurrentAllocationBytes = 0;
 	float MemoryUpdateTimer = 0.0f;
 
 	// DX function
@@ -125,10 +125,11 @@ void FSubsystemCollection<TBaseSubsystem>::Initialize(TObjectPtr<UObject> InOute
 	// 모든 서브시스템 1단계 초기화
 	for (const FName& ClassName : InitializationOrder)
 	{
-		TObjectPtr<TBaseSubsystem>* Found = SubsystemInstances.Find(ClassName);
-		if (Found && *Found)
+		// 초기화 중 맵이 바뀌어도 안전하도록 맵 안의 포인터 대신 값을 복사해 호출
+		const TObjectPtr<TBaseSubsystem> Subsystem = SubsystemInstances.FindRef(ClassName);
+		if (Subsystem)
 		{
-			(*Found)->Initialize();
+			Subsystem->Initialize();
 			UE_LOG("SubsystemCollection: %s 1단계 초기화 완료", ClassName.ToString().data());
 		}
 	}
@@ -136,10 +137,10 @@ void FSubsystemCollection<TBaseSubsystem>::Initialize(TObjectPtr<UObject> InOute
 	// 모든 서브시스템 2단계 초기화
 	for (const FName& ClassName : InitializationOrder)
 	{
-		TObjectPtr<TBaseSubsystem>* Found = SubsystemInstances.Find(ClassName);
-		if (Found && *Found)
+		const TObjectPtr<TBaseSubsystem> Subsystem = SubsystemInstances.FindRef(ClassName);
+		if (Subsystem)
 		{
-			(*Found)->PostInitialize();
+			Subsystem->PostInitialize();
 			UE_LOG("SubsystemCollection: %s 2단계 초기화 완료", ClassName.ToString().data());
 		}
 	}
@@ -155,11 +156,10 @@ void FSubsystemCollection<TBaseSubsystem>::Deinitialize()
 	for (int32 i = InitializationOrder.Num() - 1; i >= 0; --i)
 	{
 		FName ClassName = InitializationOrder[i];
-		TObjectPtr<TBaseSubsystem>* Found = SubsystemInstances.Find(ClassName);
-
-		if (Found && *Found)
+		const TObjectPtr<TBaseSubsystem> Subsystem = SubsystemInstances.FindRef(ClassName);
+		if (Subsystem)
 		{
-			(*Found)->Deinitialize();
+			Subsystem->Deinitialize();
 		}
 	}
 
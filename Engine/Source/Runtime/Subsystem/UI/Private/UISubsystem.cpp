@@ -95,6 +95,8 @@ void UUISubsystem::Deinitialize()
  */
 void UUISubsystem::Tick(float DeltaSeconds)
 {
+	FMemoryTagScope MemoryTagScope(EMemoryTag::UI);
+
 	TotalTime += DeltaSeconds;
 
 	// 모든 UI 윈도우 업데이트
@@ -131,6 +133,8 @@ void UUISubsystem::Render()
 		return;
 	}
 
+	FMemoryTagScope MemoryTagScope(EMemoryTag::UI);
+
 	// ImGui 프레임 시작
 	ImGuiHelper->BeginFrame();
 
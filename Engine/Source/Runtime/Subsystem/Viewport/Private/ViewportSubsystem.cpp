@@ -529,6 +529,8 @@ void UViewportSubsystem::RenderViewports()
 		return;
 	}
 
+	FMemoryTagScope MemoryTagScope(EMemoryTag::Renderer);
+
 	// 프레임 시작
 	if (!GDynamicRHI->BeginFrame())
 	{
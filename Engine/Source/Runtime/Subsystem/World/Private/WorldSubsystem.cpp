@@ -91,6 +91,12 @@ void UWorldSubsystem::Tick(float DeltaSeconds)
 	{
 		Editor->Update();
 	}
+
+	// 에디터 조작으로 변경된 Transform을 렌더링 전에 한 번에 갱신
+	if (CurrentLevel)
+	{
+		CurrentLevel->UpdateComponentTransforms();
+	}
 }
 
 void UWorldSubsystem::RegisterLevel(const FName& InName, TObjectPtr<ULevel> InLevel)
@@ -405,11 +411,18 @@ FLevelMetadata UWorldSubsystem::ConvertLevelToMetadata(TObjectPtr<ULevel> InLeve
 
 		FPrimitiveMetadata PrimitiveMeta;
 		PrimitiveMeta.ID = CurrentID++;
-		PrimitiveMeta.Location = Actor->GetActorLocation();
-		PrimitiveMeta.Rotation = Actor->GetActorRotation();
-		PrimitiveMeta.Scale = Actor->GetActorScale3D();
 		PrimitiveMeta.Type = EPrimitiveType::StaticMeshComp;
 
+		// RootComponent 클래스의 프로퍼티 테이블에서 이름이 같은 Transform 값을 옮겨 담음
+		if (USceneComponent* RootComponent = Actor->GetRootComponent())
+		{
+			if (const FPropertyTable* ComponentTable = RootComponent->GetClass()->GetPropertyTable())
+			{
+				FPropertyTable::CopyMatchingProperties(*ComponentTable, RootComponent,
+				                                       FPrimitiveMetadata::StaticPropertyTable(), &PrimitiveMeta);
+			}
+		}
+
 		// StaticMeshActor에서 OBJ 파일 경로 가져오기
 		if (AStaticMeshActor* StaticMeshActor = Cast<AStaticMeshActor>(Actor))
 		{
@@ -450,65 +463,98 @@ bool UWorldSubsystem::LoadLevelFromMetadata(TObjectPtr<ULevel> InLevel, const FL
 
 	UE_LOG("WorldSubsystem: Loading %d Primitives From Metadata", InMetadata.Primitives.Num());
 
-	// Metadata의 각 Primitive를 Actor로 생성
+	// Primitives는 해시 순서로 순회되므로 ID를 정렬해 저장된 순서대로 Actor를 생성
+	TArray<uint32> SortedIDs;
+	SortedIDs.Reserve(InMetadata.Primitives.Num());
 	for (const auto& [ID, PrimitiveMeta] : InMetadata.Primitives)
 	{
-		TObjectPtr<AActor> NewActor = nullptr;
+		SortedIDs.Add(ID);
+	}
+	SortedIDs.Sort();
 
-		// 타입에 따라 적절한 액터 생성
-		switch (PrimitiveMeta.Type)
+	// 같은 StaticMesh를 쓰는 Primitive를 ID 순서 위치로 묶음 (메시마다 한 번만 로드하고 한 번에 생성)
+	TMap<FString, int32> MeshGroupIndices;
+	TArray<FString> MeshPaths;
+	TArray<TArray<int32>> MeshGroupPositions;
+	for (int32 Position = 0; Position < SortedIDs.Num(); ++Position)
+	{
+		const FPrimitiveMetadata& PrimitiveMeta = *InMetadata.Primitives.Find(SortedIDs[Position]);
+		if (PrimitiveMeta.Type != EPrimitiveType::StaticMeshComp)
 		{
-		case EPrimitiveType::StaticMeshComp:
-			NewActor = InLevel->SpawnActor<AStaticMeshActor>();
-			break;
-		default:
 			UE_LOG("WorldSubsystem: Unknown Primitive Type: %d", static_cast<int32>(PrimitiveMeta.Type));
 			assert(!"고려하지 않은 Actor 타입");
 			continue;
 		}
 
-		if (NewActor)
+		int32 GroupIndex;
+		if (const int32* FoundGroupIndex = MeshGroupIndices.Find(PrimitiveMeta.ObjStaticMeshAsset))
 		{
-			// StaticMeshActor의 경우 OBJ 파일 로드
-			if (PrimitiveMeta.Type == EPrimitiveType::StaticMeshComp)
-			{
-				if (TObjectPtr<AStaticMeshActor> StaticMeshActor = Cast<AStaticMeshActor>(NewActor))
-				{
-					UAssetSubsystem* AssetSubsystem = GEngine->GetEngineSubsystem<UAssetSubsystem>();
-					UStaticMesh* StaticMesh = nullptr;
-					if (AssetSubsystem)
-					{
-						StaticMesh = AssetSubsystem->LoadStaticMesh(PrimitiveMeta.ObjStaticMeshAsset);
-					}
-					if (StaticMesh)
-					{
-						StaticMeshActor->SetStaticMesh(StaticMesh);
-					}
-					else
-					{
-						UE_LOG("WorldSubsystem: Failed To Load StaticMesh From: %s",
-						       PrimitiveMeta.ObjStaticMeshAsset.c_str());
-						InLevel->DestroyActor(StaticMeshActor);
-					}
-				}
-			}
+			GroupIndex = *FoundGroupIndex;
+		}
+		else
+		{
+			GroupIndex = MeshPaths.Num();
+			MeshGroupIndices.Add(PrimitiveMeta.ObjStaticMeshAsset, GroupIndex);
+			MeshPaths.Add(PrimitiveMeta.ObjStaticMeshAsset);
+			MeshGroupPositions.Emplace();
+		}
+		MeshGroupPositions[GroupIndex].Add(Position);
+	}
 
-			// Transform 정보 적용
-			NewActor->SetActorLocation(PrimitiveMeta.Location);
-			NewActor->SetActorRotation(PrimitiveMeta.Rotation);
-			NewActor->SetActorScale3D(PrimitiveMeta.Scale);
+	UAssetSubsystem* AssetSubsystem = GEngine->GetEngineSubsystem<UAssetSubsystem>();
 
-			UE_LOG("WorldSubsystem: (%.2f, %.2f, %.2f) 지점에 %s (을)를 생성했습니다 ",
-			       PrimitiveMeta.Location.X, PrimitiveMeta.Location.Y, PrimitiveMeta.Location.Z,
-			       FJsonSerializer::PrimitiveTypeToWideString(PrimitiveMeta.Type).c_str());
+	// 생성된 Actor를 ID 순서 위치에 기록해 두었다가 모든 메시를 생성한 뒤 그 순서로 레벨에 등록
+	TArray<TObjectPtr<AActor>> ActorSlots;
+	ActorSlots.SetNum(SortedIDs.Num());
+
+	// 원형 Actor는 하나만 만들어 메시만 바꿔 가며 복제
+	TObjectPtr<AStaticMeshActor> Archetype;
+	TArray<FTransform> BatchTransforms;
+	for (int32 GroupIndex = 0; GroupIndex < MeshPaths.Num(); ++GroupIndex)
+	{
+		UStaticMesh* StaticMesh = AssetSubsystem ? AssetSubsystem->LoadStaticMesh(MeshPaths[GroupIndex]) : nullptr;
+		if (!StaticMesh)
+		{
+			UE_LOG("WorldSubsystem: Failed To Load StaticMesh From: %s", MeshPaths[GroupIndex].c_str());
+			continue;
 		}
-		else
+
+		const TArray<int32>& Positions = MeshGroupPositions[GroupIndex];
+		BatchTransforms.Reset();
+		BatchTransforms.Reserve(Positions.Num());
+		for (const int32 Position : Positions)
 		{
-			UE_LOG("WorldSubsystem: Actor 생성에 실패했습니다 (Primitive ID: %d)", ID);
+			const FPrimitiveMetadata& PrimitiveMeta = *InMetadata.Primitives.Find(SortedIDs[Position]);
+			BatchTransforms.Add(FTransform(PrimitiveMeta.Location, PrimitiveMeta.Rotation, PrimitiveMeta.Scale));
+		}
+
+		if (!Archetype)
+		{
+			Archetype = Cast<AStaticMeshActor>(AStaticMeshActor::CreateDefaultObjectAStaticMeshActor());
+		}
+		Archetype->SetStaticMesh(StaticMesh);
+
+		const TArray<TObjectPtr<AActor>> SpawnedActors = InLevel->SpawnActors(Archetype, BatchTransforms, false);
+		for (int32 Index = 0; Index < SpawnedActors.Num(); ++Index)
+		{
+			ActorSlots[Positions[Index]] = SpawnedActors[Index];
 		}
 	}
 
-	UE_LOG("WorldSubsystem: 레벨이 메타데이터로부터 성공적으로 로드되었습니다");
+	SafeDelete(Archetype);
+
+	int32 NumSpawned = 0;
+	for (const TObjectPtr<AActor>& Actor : ActorSlots)
+	{
+		if (Actor)
+		{
+			InLevel->AddLevelActor(Actor);
+			++NumSpawned;
+		}
+	}
+
+	UE_LOG("WorldSubsystem: 레벨이 메타데이터로부터 성공적으로 로드되었습니다 (StaticMesh %d개, Actor %d개)", MeshPaths.Num(),
+	       NumSpawned);
 	return true;
 }
 
@@ -519,7 +565,10 @@ void UWorldSubsystem::ClearCurrentLevel()
 		// Outer 관계를 끊어서 GC에서 자연스럽게 정리되도록 함
 		CurrentLevel->Release();
 		CurrentLevel = nullptr;
-		UE_LOG("WorldSubsystem: Current level cleared successfully");
+
+		// 레벨 액터들이 쓰던 작은 할당용 청크를 다음 레벨 로드 전에 OS로 돌려줌
+		const uint64 TrimmedBytes = FMemory::Trim();
+		UE_LOG("WorldSubsystem: Current level cleared successfully (%llu KB trimmed)", TrimmedBytes / 1024);
 	}
 }
 
@@ -8,6 +8,24 @@
 
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hwnd, uint32 msg, WPARAM wParam, LPARAM lParam);
 
+namespace
+{
+	/**
+	 * @brief ImGui 내부 할당을 엔진 할당자로 연결하는 함수
+	 * ImGui는 기본적으로 malloc을 직접 사용하므로 연결하지 않으면 UI 메모리가 통계에서 빠진다
+	 */
+	void* ImGuiMalloc(size_t InSize, void* InUserData)
+	{
+		FMemoryTagScope MemoryTagScope(EMemoryTag::UI);
+		return FMemory::Malloc(InSize);
+	}
+
+	void ImGuiFree(void* InMemory, void* InUserData)
+	{
+		FMemory::Free(InMemory);
+	}
+}
+
 UImGuiHelper::UImGuiHelper() = default;
 
 UImGuiHelper::~UImGuiHelper() = default;
@@ -23,6 +41,7 @@ void UImGuiHelper::Initialize(HWND InWindowHandle)
 	}
 
 	IMGUI_CHECKVERSION();
+	ImGui::SetAllocatorFunctions(ImGuiMalloc, ImGuiFree);
 	ImGui::CreateContext();
 	ImGui_ImplWin32_Init(InWindowHandle);
 
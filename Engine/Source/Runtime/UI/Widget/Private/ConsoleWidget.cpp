@@ -2,6 +2,12 @@
 #include "Runtime/UI/Widget/Public/ConsoleWidget.h"
 #include "Runtime/Subsystem/Public/DebugRenderingSubsystem.h"
 #include "Utility/Public/UELogParser.h"
+#include "Utility/Public/Benchmark.h"
+#include "Runtime/Subsystem/Viewport/Public/ViewportSubsystem.h"
+#include "Window/Public/ViewportClient.h"
+#include "Runtime/RHI/Public/RHIDevice.h"
+
+#include <thread>
 
 IMPLEMENT_SINGLETON_CLASS(UConsoleWidget, UWidget)
 
@@ -222,6 +228,8 @@ void UConsoleWidget::AddLog(ELogType InType, const char* fmt, ...)
  */
 void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list InArguments)
 {
+	FMemoryTagScope MemoryTagScope(EMemoryTag::Logger);
+
 	va_list ArgumentsCopy;
 
 	// Get log length
@@ -258,6 +266,52 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 	bIsScrollToBottom = true;
 }
 
+/**
+ * @brief 바인딩 종류별 전달 / 생략 횟수와 합계를 출력하는 함수
+ */
+void UConsoleWidget::PrintStateCacheStats(const char* InTitle, const FRHIStateCacheStats& InStats)
+{
+	AddLog(ELogType::System, "%s", InTitle);
+	for (uint8 Type = 0; Type < static_cast<uint8>(ERHIStateType::Num); ++Type)
+	{
+		AddLog(ELogType::Info, "  %-18s %8u / %8u", EnumToString(static_cast<ERHIStateType>(Type)),
+		       InStats.NumSubmitted[Type], InStats.NumFiltered[Type]);
+	}
+
+	const uint32 NumSubmitted = InStats.GetTotalSubmitted();
+	const uint32 NumFiltered = InStats.GetTotalFiltered();
+	AddLog(ELogType::Info, "  %-18s %8u / %8u (%.1f%% filtered)", "Total", NumSubmitted, NumFiltered,
+	       NumSubmitted + NumFiltered > 0 ? NumFiltered * 100.0f / (NumSubmitted + NumFiltered) : 0.0f);
+}
+
+/**
+ * @brief 벤치마크 결과를 제목과 함께 한 줄씩 출력하는 함수
+ */
+void UConsoleWidget::PrintBenchmarkResults(const FString& InTitle, const TArray<FBenchmarkResult>& InResults)
+{
+	AddLog(ELogType::System, "%s", InTitle.c_str());
+	for (const FString& Line : FBenchmark::FormatResults(InResults))
+	{
+		AddLog(ELogType::Info, "  %s", Line.c_str());
+	}
+}
+
+/**
+ * @brief 벤치마크 검증 결과를 출력하는 함수 (불일치가 없으면 성공 메시지, 있으면 항목마다 에러)
+ */
+void UConsoleWidget::PrintBenchmarkMismatches(const char* InCheckName, const TArray<FString>& InMismatches,
+                                              const char* InSuccessMessage)
+{
+	if (InMismatches.IsEmpty())
+	{
+		AddLog(ELogType::Success, "%s", InSuccessMessage);
+	}
+	for (const FString& Mismatch : InMismatches)
+	{
+		AddLog(ELogType::Error, "%s mismatch - %s", InCheckName, Mismatch.c_str());
+	}
+}
+
 /**
  * @brief 시스템 로그들을 처리하기 위한 멤버 함수
  * @param InText log text
@@ -454,6 +508,27 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT MEMORY - Show Memory overlay");
 		AddLog(ELogType::Info, "  STAT ALL - Show all overlays");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  STAT CULLING - Print per-viewport frustum / occlusion culling stats");
+		AddLog(ELogType::Info, "  STAT RHI - Print last frame's submitted / filtered RHI state binds");
+		AddLog(ELogType::Info, "  OCCLUSION ON|OFF - Toggle CPU occlusion culling");
+		AddLog(ELogType::Info, "");
+		AddLog(ELogType::System, "Benchmark Commands:");
+		AddLog(ELogType::Info, "  BENCH CONTAINERS [Count] - Compare TMap / TSet with std hash containers");
+		AddLog(ELogType::Info, "  BENCH MEMORY [Threads] - Compare FMemory with CRT malloc under multithreaded load");
+		AddLog(ELogType::Info, "  BENCH CORE [Count] - Run hash container and core type benchmarks, save JSON / CSV");
+		AddLog(ELogType::Info, "  BENCH MATRIX [Count] - Validate and benchmark SIMD FMatrix kernels against scalar");
+		AddLog(ELogType::Info, "  BENCH TRANSFORM [Count] - Compare per-component world matrices / inverses / bounds with cached paths (10k / 100k)");
+		AddLog(ELogType::Info, "  BENCH CULLING [Count] - Validate frustum planes and compare scalar / SIMD AABB culling (10k / 100k)");
+		AddLog(ELogType::Info, "  BENCH SPATIAL [Count] - Compare linear scan / AABB tree queries on DefaultPUBG_mini and a synthetic level (100k)");
+		AddLog(ELogType::Info, "  BENCH OCCLUSION [Count] - Validate the software occlusion rasterizer / HiZ test and compare with per-pixel paths (100k)");
+		AddLog(ELogType::Info, "  BENCH DRAWPACKET [Count] - Compare per-command virtual draws with POD draw packets: enqueue / sort / execute (100k)");
+		AddLog(ELogType::Info, "  BENCH RADIXSORT [Count] - Validate draw packet radix sort variants beyond 65536 entries and compare with std::stable_sort (1M)");
+		AddLog(ELogType::Info, "  BENCH STATECACHE [Count] - Validate the RHI shadow state cache against a recording backend and count filtered binds (10k)");
+		AddLog(ELogType::Info, "  BENCH PSO [Count] - Validate pipeline state handles and compare with per-draw shader / state lookups (10k)");
+		AddLog(ELogType::Info, "");
+		AddLog(ELogType::System, "Memory Commands:");
+		AddLog(ELogType::Info, "  MEMREPORT - Print live allocations per memory tag");
+		AddLog(ELogType::Info, "  MEMTRIM - Return fully free small-block chunks to the OS");
 		AddLog(ELogType::Info, "");
 		AddLog(ELogType::System, "Camera Controls:");
 		AddLog(ELogType::Info, "  우클릭 + WASD - 카메라 이동");
@@ -465,6 +540,66 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  Any Windows command will be executed directly");
 	}
 
+	// 컬링 통계 출력 (오버레이가 아닌 로그로 출력)
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "stat culling")
+	{
+		UViewportSubsystem* ViewportSubsystem = GEngine->GetEngineSubsystem<UViewportSubsystem>();
+		if (!ViewportSubsystem)
+		{
+			AddLog(ELogType::Error, "ViewportSubsystem: Not available");
+		}
+		else
+		{
+			AddLog(ELogType::System, "Culling: per viewport (primitives / visible / frustum culled / occluded, ms)");
+			const TArray<FViewportClient*>& Clients = ViewportSubsystem->GetClients();
+			for (int32 Index = 0; Index < Clients.Num(); ++Index)
+			{
+				if (!Clients[Index])
+				{
+					continue;
+				}
+
+				const FViewCullingStats& Stats = Clients[Index]->GetCullingStats();
+				AddLog(ELogType::Info, "  Viewport %d: %6d / %6d / %6d / %6d (%.1f%% culled, %.3f ms)", Index,
+				       Stats.NumPrimitives, Stats.NumVisible, Stats.NumFrustumCulled, Stats.NumOccluded,
+				       Stats.NumPrimitives > 0
+					       ? (Stats.NumFrustumCulled + Stats.NumOccluded) * 100.0f / Stats.NumPrimitives
+					       : 0.0f,
+				       Stats.CullMilliseconds);
+				AddLog(ELogType::Info, "    Occlusion: %d occluders, %d triangles, %.3f ms%s", Stats.NumOccluders,
+				       Stats.NumOccluderTriangles, Stats.OcclusionMilliseconds,
+				       FSceneVisibility::IsOcclusionCullingEnabled() ? "" : " (disabled)");
+			}
+		}
+	}
+
+	// RHI 상태 바인딩 통계 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "stat rhi")
+	{
+		if (!GDynamicRHI)
+		{
+			AddLog(ELogType::Error, "RHIDevice: Not available");
+		}
+		else
+		{
+			PrintStateCacheStats("RHI State: last frame (submitted / filtered)", GDynamicRHI->GetLastFrameStateStats());
+		}
+	}
+
+	// 가림 컬링 토글 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "occlusion on" || CommandLower == "occlusion off")
+	{
+		FSceneVisibility::SetOcclusionCullingEnabled(CommandLower == "occlusion on");
+		AddLog(ELogType::Success, "Occlusion Culling: %s",
+		       FSceneVisibility::IsOcclusionCullingEnabled() ? "Enabled" : "Disabled");
+	}
+
 	// stat 명령어 입력
 	// 오버레이 매니저 서브시스템 가져와서 처리
 	else if (FString CommandLower = InCommand;
@@ -481,6 +616,276 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 			AddLog(ELogType::Error, "DebugRenderingSubsystem: Not available");
 		}
 	}
+
+	// 컨테이너 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 16) == "bench containers")
+	{
+		int32 NumElements = 100000;
+		if (CommandLower.size() > 16)
+		{
+			NumElements = max(atoi(CommandLower.c_str() + 16), 1);
+		}
+
+		PrintBenchmarkResults("Container Benchmark: " + std::to_string(NumElements) + " elements (std / engine, ms)",
+		                      FBenchmark::RunHashContainerBenchmarks(NumElements));
+	}
+
+	// 코어 타입 벤치마크 명령어 입력 (결과를 파일로 저장해 빌드 간 비교에 사용)
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 10) == "bench core")
+	{
+		// 기본값은 예제 씬 규모 (수백 개의 Actor와 그 컴포넌트)
+		int32 NumElements = 1024;
+		if (CommandLower.size() > 10)
+		{
+			NumElements = max(atoi(CommandLower.c_str() + 10), 2);
+		}
+
+		TArray<FBenchmarkResult> Results = FBenchmark::RunHashContainerBenchmarks(NumElements);
+		Results.Append(FBenchmark::RunCoreBenchmarks(NumElements));
+		Results.Append(FBenchmark::RunObjectIteratorBenchmarks());
+
+		PrintBenchmarkResults("Core Benchmark: " + std::to_string(NumElements) + " elements (baseline / engine, ms)",
+		                      Results);
+
+		const path OutputDirectory = FPaths::GetProjectRootDir() / "Saved" / "Benchmark";
+		std::error_code ErrorCode;
+		std::filesystem::create_directories(OutputDirectory, ErrorCode);
+
+		const FString BaseName = "CoreBenchmark_" + std::to_string(time(nullptr));
+		const FString JsonPath = (OutputDirectory / (BaseName + ".json")).string();
+		const FString CsvPath = (OutputDirectory / (BaseName + ".csv")).string();
+		if (FBenchmark::SaveResultsToJson(Results, JsonPath) && FBenchmark::SaveResultsToCsv(Results, CsvPath))
+		{
+			AddLog(ELogType::Success, "Benchmark results saved: %s (.csv)", JsonPath.c_str());
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Failed to save benchmark results: %s", OutputDirectory.string().c_str());
+		}
+	}
+
+	// 메모리 태그 리포트 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "memreport")
+	{
+		AddLog(ELogType::System, "Memory Report:");
+
+		std::istringstream ReportStream(FMemory::DumpTagStats());
+		for (FString Line; std::getline(ReportStream, Line);)
+		{
+			AddLog(ELogType::Info, "  %s", Line.c_str());
+		}
+		AddLog(ELogType::Info, "  Committed small-block chunks: %llu KB", FMemory::GetCommittedSmallBytes() / 1024);
+	}
+
+	// 비어 있는 소형 블록 청크 반환 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "memtrim")
+	{
+		const uint64 TrimmedBytes = FMemory::Trim();
+		AddLog(ELogType::Success, "Memory Trim: %llu KB released, %llu KB committed", TrimmedBytes / 1024,
+		       FMemory::GetCommittedSmallBytes() / 1024);
+	}
+
+	// 할당자 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 12) == "bench memory")
+	{
+		int32 NumThreads = static_cast<int32>(max(std::thread::hardware_concurrency(), 1u));
+		if (CommandLower.size() > 12)
+		{
+			NumThreads = max(atoi(CommandLower.c_str() + 12), 1);
+		}
+
+		PrintBenchmarkResults("Allocator Benchmark: " + std::to_string(NumThreads) + " thread(s) (CRT / FMemory, ms)",
+		                      FBenchmark::RunAllocatorBenchmarks(NumThreads, 1000000));
+	}
+	// 행렬 커널 검증 / 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 12) == "bench matrix")
+	{
+		int32 NumMatrices = 1024;
+		if (CommandLower.size() > 12)
+		{
+			NumMatrices = max(atoi(CommandLower.c_str() + 12), 2);
+		}
+
+		TArray<FString> Mismatches;
+		const TArray<FBenchmarkResult> Results = FBenchmark::RunMatrixBenchmarks(NumMatrices, Mismatches);
+
+		PrintBenchmarkResults("Matrix Benchmark: " + std::to_string(NumMatrices) + " matrices (scalar / selected, ms)",
+		                      Results);
+		PrintBenchmarkMismatches("Matrix kernel", Mismatches, "Matrix kernels match the scalar implementation");
+	}
+	// 변환 일괄 계산 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 15) == "bench transform")
+	{
+		// 개수를 지정하지 않으면 씬 규모 두 가지(1만 / 10만)를 모두 측정
+		TArray<int32> TransformCounts = {10000, 100000};
+		if (CommandLower.size() > 15)
+		{
+			TransformCounts = {max(atoi(CommandLower.c_str() + 15), 1)};
+		}
+
+		TArray<FBenchmarkResult> Results;
+		TArray<FString> Mismatches;
+		for (const int32 NumTransforms : TransformCounts)
+		{
+			Results.Append(FBenchmark::RunTransformBenchmarks(NumTransforms, Mismatches));
+		}
+
+		PrintBenchmarkResults("Transform Benchmark: per frame (per-component / batch, ms)", Results);
+		PrintBenchmarkMismatches("Transform batch", Mismatches, "Batched world matrices match the per-component path");
+	}
+	// 절두체 컬링 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 13) == "bench culling")
+	{
+		TArray<int32> BoundsCounts = {10000, 100000};
+		if (CommandLower.size() > 13)
+		{
+			BoundsCounts = {max(atoi(CommandLower.c_str() + 13), 1)};
+		}
+
+		TArray<FBenchmarkResult> Results;
+		TArray<FString> Mismatches;
+		for (const int32 NumBounds : BoundsCounts)
+		{
+			Results.Append(FBenchmark::RunCullingBenchmarks(NumBounds, Mismatches));
+		}
+
+		PrintBenchmarkResults("Culling Benchmark: per view (scalar / batch, ms)", Results);
+		PrintBenchmarkMismatches("Culling", Mismatches, "Frustum planes and batched culling match the reference tests");
+	}
+	// 공간 인덱스 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 13) == "bench spatial")
+	{
+		int32 NumSyntheticBounds = 100000;
+		if (CommandLower.size() > 13)
+		{
+			NumSyntheticBounds = max(atoi(CommandLower.c_str() + 13), 0);
+		}
+
+		TArray<FString> Mismatches;
+		const TArray<FBenchmarkResult> Results = FBenchmark::RunSpatialIndexBenchmarks(NumSyntheticBounds, Mismatches);
+		PrintBenchmarkResults("Spatial Index Benchmark: per workload (linear / tree, ms)", Results);
+		PrintBenchmarkMismatches("Spatial index", Mismatches,
+		                         "AABB tree queries match the linear scan and the tree structure is valid");
+	}
+	// 가림 컬링 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 15) == "bench occlusion")
+	{
+		int32 NumOccludees = 100000;
+		if (CommandLower.size() > 15)
+		{
+			NumOccludees = max(atoi(CommandLower.c_str() + 15), 1);
+		}
+
+		TArray<FString> Mismatches;
+		const TArray<FBenchmarkResult> Results = FBenchmark::RunOcclusionBenchmarks(32, NumOccludees, Mismatches);
+		PrintBenchmarkResults("Occlusion Benchmark: (per-pixel scalar / tiled SIMD + HiZ, ms)", Results);
+		PrintBenchmarkMismatches("Occlusion", Mismatches, "Occlusion rasterizer and HiZ test pass all checks");
+	}
+	// 드로우 패킷 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 16) == "bench drawpacket")
+	{
+		int32 NumDraws = 100000;
+		if (CommandLower.size() > 16)
+		{
+			NumDraws = max(atoi(CommandLower.c_str() + 16), 1);
+		}
+
+		TArray<FString> Mismatches;
+		const TArray<FBenchmarkResult> Results = FBenchmark::RunDrawPacketBenchmarks(NumDraws, Mismatches);
+		PrintBenchmarkResults("Draw Packet Benchmark: per frame (virtual commands / draw packets, ms)", Results);
+		PrintBenchmarkMismatches("Draw packet", Mismatches,
+		                         "Virtual commands and draw packets execute in the same sorted order");
+	}
+	// 드로우 패킷 Radix Sort 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 15) == "bench radixsort")
+	{
+		int32 MaxPackets = 1000000;
+		if (CommandLower.size() > 15)
+		{
+			MaxPackets = max(atoi(CommandLower.c_str() + 15), 1000);
+		}
+
+		TArray<FString> Mismatches;
+		const TArray<FBenchmarkResult> Results = FBenchmark::RunRadixSortBenchmarks(MaxPackets, Mismatches);
+		PrintBenchmarkResults("Radix Sort Benchmark: per sort (std::stable_sort / radix, ms)", Results);
+		PrintBenchmarkMismatches("Radix sort", Mismatches,
+		                         "All radix sort variants match std::stable_sort up to 262144 packets");
+	}
+	// RHI 상태 캐시 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 16) == "bench statecache")
+	{
+		int32 NumPrimitives = 10000;
+		if (CommandLower.size() > 16)
+		{
+			NumPrimitives = max(atoi(CommandLower.c_str() + 16), 1);
+		}
+
+		TArray<FRHIStateCacheStats> Stats;
+		TArray<FString> Mismatches;
+		const TArray<FBenchmarkResult> Results = FBenchmark::RunStateCacheBenchmarks(NumPrimitives, Stats, Mismatches);
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FBenchmarkResult& Result = Results[Index];
+			PrintStateCacheStats(("State Cache Benchmark: " + Result.Workload + " (submitted / filtered)").c_str(),
+			                     Stats[Index]);
+			AddLog(ELogType::Info, "  Frame: %.3f ms without cache / %.3f ms with cache (x%.2f)",
+			       Result.BaselineMilliseconds, Result.EngineMilliseconds, Result.GetSpeedup());
+		}
+
+		PrintBenchmarkMismatches("State cache", Mismatches,
+		                         "Cached binds leave the same state at every draw as unfiltered binds");
+	}
+	// 파이프라인 상태 핸들 벤치마크 명령어 입력
+	else if (FString CommandLower = InCommand;
+		transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 9) == "bench pso")
+	{
+		int32 NumDraws = 10000;
+		if (CommandLower.size() > 9)
+		{
+			NumDraws = max(atoi(CommandLower.c_str() + 9), 1);
+		}
+
+		TArray<int32> NumStates;
+		TArray<FString> Mismatches;
+		const TArray<FBenchmarkResult> Results = FBenchmark::RunPipelineStateBenchmarks(NumDraws, NumStates, Mismatches);
+		for (int32 Index = 0; Index < Results.Num(); ++Index)
+		{
+			const FBenchmarkResult& Result = Results[Index];
+			AddLog(ELogType::Info, "Pipeline State Benchmark: %s - %d registered, %.3f ms lookup / %.3f ms handle (x%.2f)",
+			       Result.Workload.c_str(), NumStates[Index], Result.BaselineMilliseconds, Result.EngineMilliseconds,
+			       Result.GetSpeedup());
+		}
+
+		PrintBenchmarkMismatches("Pipeline state", Mismatches,
+		                         "Pipeline state handles bind the same state at every draw as per-draw lookups");
+	}
 	else
 	{
 		// 실제 터미널 명령어 실행
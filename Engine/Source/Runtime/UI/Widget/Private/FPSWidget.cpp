@@ -83,8 +83,8 @@ void UFPSWidget::RenderWidget()
 	if (bShowGraph)
 	{
 		ImGui::Text("동적 할당된 메모리 정보");
-		ImGui::Text("Overall Object Count: %u", TotalAllocationCount);
-		ImGui::Text("Overall Memory: %.3f KB", static_cast<float>(TotalAllocationBytes) / KILO);
+		ImGui::Text("Overall Object Count: %llu", FMemory::GetTotalAllocationCount());
+		ImGui::Text("Overall Memory: %.3f KB", static_cast<float>(FMemory::GetTotalAllocationBytes()) / KILO);
 		ImGui::Separator();
 
 		ImGui::Text("Frame Time History:");
@@ -61,7 +61,7 @@ void USceneHierarchyWidget::RenderWidget()
 	// 검색창 렌더링
 	RenderSearchBar();
 
-	const TArray<TObjectPtr<AActor>>& LevelActors = CurrentLevel->GetLevelActors();
+	const TSparseArray<TObjectPtr<AActor>>& LevelActors = CurrentLevel->GetLevelActors();
 
 	if (LevelActors.IsEmpty())
 	{
@@ -94,11 +94,11 @@ void USceneHierarchyWidget::RenderWidget()
 		if (SearchFilter.empty())
 		{
 			// 검색어가 없으면 모든 Actor 표시
-			for (int32 i = 0; i < static_cast<int32>(LevelActors.Num()); ++i)
+			for (auto It = LevelActors.begin(); It != LevelActors.end(); ++It)
 			{
-				if (LevelActors[i])
+				if (*It)
 				{
-					RenderActorInfo(LevelActors[i], i);
+					RenderActorInfo(*It, It.GetIndex());
 				}
 			}
 		}
@@ -107,7 +107,7 @@ void USceneHierarchyWidget::RenderWidget()
 			// 필터링된 Actor들만 표시
 			for (int32 FilteredIndex : FilteredIndices)
 			{
-				if (FilteredIndex < LevelActors.Num() && LevelActors[FilteredIndex])
+				if (LevelActors.IsAllocated(FilteredIndex) && LevelActors[FilteredIndex])
 				{
 					RenderActorInfo(LevelActors[FilteredIndex], FilteredIndex);
 				}
@@ -545,7 +545,7 @@ void USceneHierarchyWidget::RenderSearchBar()
  * @brief 필터링된 Actor 인덱스 리스트를 업데이트하는 함수
  * @param InLevelActors 레벨의 모든 Actor 리스트
  */
-void USceneHierarchyWidget::UpdateFilteredActors(const TArray<TObjectPtr<AActor>>& InLevelActors)
+void USceneHierarchyWidget::UpdateFilteredActors(const TSparseArray<TObjectPtr<AActor>>& InLevelActors)
 {
 	FilteredIndices.Empty();
 
@@ -561,17 +561,18 @@ void USceneHierarchyWidget::UpdateFilteredActors(const TArray<TObjectPtr<AActor>
 	// UE_LOG("SceneHierarchy: 검색어 = '%s', 변환된 검색어 = '%s'", SearchFilter.data(), SearchLower.data());
 	// UE_LOG("SceneHierarchy: Level에 %zu개의 Actor가 있습니다", InLevelActors.Num());
 
-	for (int32 i = 0; i < InLevelActors.Num(); ++i)
+	for (auto It = InLevelActors.begin(); It != InLevelActors.end(); ++It)
 	{
-		if (InLevelActors[i])
+		if (*It)
 		{
-			FString ActorName = InLevelActors[i]->GetName().ToString();
+			FString ActorName = (*It)->GetName().ToString();
 			bool bMatches = IsActorMatchingSearch(ActorName, SearchLower);
-			// UE_LOG("SceneHierarchy: Actor[%d] = '%s', 매치 = %s", i, ActorName.c_str(), bMatches ? "Yes" : "No");
+			// UE_LOG("SceneHierarchy: Actor[%d] = '%s', 매치 = %s", It.GetIndex(), ActorName.c_str(), bMatches ? "Yes" : "No");
 
+			// Level의 Actor 인덱스는 제거 후에도 유지되므로 캐시된 인덱스가 다른 Actor를 가리키지 않는다
 			if (bMatches)
 			{
-				FilteredIndices.Add(i);
+				FilteredIndices.Add(It.GetIndex());
 			}
 		}
 	}
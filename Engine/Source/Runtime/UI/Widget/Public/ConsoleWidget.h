@@ -5,6 +5,8 @@ using std::streambuf;
 
 class UConsoleWidget;
 struct ImGuiInputTextCallbackData;
+struct FBenchmarkResult;
+struct FRHIStateCacheStats;
 
 struct FLogEntry
 {
@@ -90,4 +92,8 @@ private:
 	static ImVec4 GetColorByLogType(ELogType InType);
 
 	void AddLogInternal(ELogType InType, const char* fmt, va_list InArguments);
+	void PrintStateCacheStats(const char* InTitle, const FRHIStateCacheStats& InStats);
+	void PrintBenchmarkResults(const FString& InTitle, const TArray<FBenchmarkResult>& InResults);
+	void PrintBenchmarkMismatches(const char* InCheckName, const TArray<FString>& InMismatches,
+	                              const char* InSuccessMessage);
 };
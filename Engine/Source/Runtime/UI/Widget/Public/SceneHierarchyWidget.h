@@ -1,5 +1,6 @@
 #pragma once
 #include "Widget.h"
+#include "Runtime/Core/Public/Containers/TSparseArray.h"
 
 class AActor;
 class ULevel;
@@ -63,7 +64,7 @@ private:
 
 	// 검색 기능
 	void RenderSearchBar();
-	void UpdateFilteredActors(const TArray<TObjectPtr<AActor>>& InLevelActors);
+	void UpdateFilteredActors(const TSparseArray<TObjectPtr<AActor>>& InLevelActors);
 	static bool IsActorMatchingSearch(const FString& InActorName, const FString& InSearchTerm);
 
 	// 이름 변경 기능
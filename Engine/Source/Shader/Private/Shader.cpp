@@ -78,21 +78,19 @@ void UShader::Release()
 void UShader::Bind()
 {
     if (!bIsValid || !GDynamicRHI) return;
-    ID3D11DeviceContext* Context = GDynamicRHI->GetDeviceContext();
-    if (!Context) return;
 
-    Context->VSSetShader(VertexShader, nullptr, 0);
-    Context->PSSetShader(PixelShader, nullptr, 0);
-    Context->IASetInputLayout(InputLayout);
+    FRHIStateCache& StateCache = GDynamicRHI->GetStateCache();
+    StateCache.SetVertexShader(VertexShader);
+    StateCache.SetPixelShader(PixelShader);
+    StateCache.SetInputLayout(InputLayout);
 }
 
 void UShader::Unbind()
 {
     if (!bIsValid || !GDynamicRHI) return;
-    ID3D11DeviceContext* Context = GDynamicRHI->GetDeviceContext();
-    if (!Context) return;
 
-    Context->VSSetShader(nullptr, nullptr, 0);
-    Context->PSSetShader(nullptr, nullptr, 0);
-    Context->IASetInputLayout(nullptr);
+    FRHIStateCache& StateCache = GDynamicRHI->GetStateCache();
+    StateCache.SetVertexShader(nullptr);
+    StateCache.SetPixelShader(nullptr);
+    StateCache.SetInputLayout(nullptr);
 }
@@ -0,0 +1,104 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <thread>
+
+namespace
+{
+	constexpr uint32 NumLiveSlots = 1024;
+
+	struct FCrtAllocator
+	{
+		static void* Allocate(size_t InSize) { return malloc(InSize); }
+		static void Free(void* InMemory) { free(InMemory); }
+	};
+
+	struct FEngineAllocator
+	{
+		static void* Allocate(size_t InSize) { return FMemory::Malloc(InSize); }
+		static void Free(void* InMemory) { FMemory::Free(InMemory); }
+	};
+
+	/**
+	 * @brief 스레드 하나의 할당 / 해제 패턴
+	 * 고정된 수의 슬롯을 무작위로 골라 해제 후 재할당하므로 할당 수명이 섞이고, 크기는 작은 객체 위주로 분포한다
+	 */
+	template <typename AllocatorType>
+	void RunAllocationPattern(uint32 InSeed, int32 InNumOperations)
+	{
+		void* LiveSlots[NumLiveSlots] = {};
+		uint32 State = InSeed * 2654435761u + 1;
+
+		for (int32 Operation = 0; Operation < InNumOperations; ++Operation)
+		{
+			State = State * 1664525u + 1013904223u;
+			const uint32 SlotIndex = (State >> 8) % NumLiveSlots;
+
+			// 75%는 128바이트 이하, 나머지는 1KB 이하
+			const uint32 SizeBits = State >> 20;
+			const size_t Size = (SizeBits & 3) != 0 ? 8 + (SizeBits >> 2) % 120 : 128 + (SizeBits >> 2) % 896;
+
+			AllocatorType::Free(LiveSlots[SlotIndex]);
+			LiveSlots[SlotIndex] = AllocatorType::Allocate(Size);
+			static_cast<uint8*>(LiveSlots[SlotIndex])[0] = static_cast<uint8>(Size);
+		}
+
+		for (void* Memory : LiveSlots)
+		{
+			AllocatorType::Free(Memory);
+		}
+	}
+
+	template <typename AllocatorType>
+	double MeasureThreadedAllocation(int32 InNumThreads, int32 InOperationsPerThread)
+	{
+		TArray<std::thread> Threads;
+		Threads.Reserve(InNumThreads);
+
+		const auto StartTime = std::chrono::high_resolution_clock::now();
+		for (int32 ThreadIndex = 0; ThreadIndex < InNumThreads; ++ThreadIndex)
+		{
+			Threads.Emplace([ThreadIndex, InOperationsPerThread]
+			{
+				RunAllocationPattern<AllocatorType>(static_cast<uint32>(ThreadIndex), InOperationsPerThread);
+			});
+		}
+
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+		const auto EndTime = std::chrono::high_resolution_clock::now();
+
+		return std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunAllocatorBenchmarks(int32 InNumThreads, int32 InOperationsPerThread)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumThreads <= 0 || InOperationsPerThread <= 0)
+	{
+		return Results;
+	}
+
+	// 단일 스레드 기준값과 요청한 스레드 수를 함께 측정해 스레드 증가에 따른 확장성을 비교
+	TArray<int32> ThreadCounts = {1};
+	if (InNumThreads > 1)
+	{
+		ThreadCounts.Add(InNumThreads);
+	}
+
+	for (int32 NumThreads : ThreadCounts)
+	{
+		FBenchmarkResult Result;
+		Result.Workload = "Alloc/Free x" + std::to_string(InOperationsPerThread) + ", " + std::to_string(NumThreads) +
+			" thread(s)";
+		Result.Operation = "Mixed";
+		Result.BaselineMilliseconds = MeasureThreadedAllocation<FCrtAllocator>(NumThreads, InOperationsPerThread);
+		Result.EngineMilliseconds = MeasureThreadedAllocation<FEngineAllocator>(NumThreads, InOperationsPerThread);
+		Results.Add(Result);
+	}
+
+	return Results;
+}
@@ -3,15 +3,50 @@
 #include "Global/CoreTypes.h"
 #include <filesystem>
 
+BEGIN_PROPERTY_TABLE(FVertex)
+	PROPERTY(Position)
+	PROPERTY(Color)
+	PROPERTY(TextureCoord)
+	PROPERTY(Normal)
+END_PROPERTY_TABLE()
+
 FArchive& FArchive::operator<<(FVertex& Value)
 {
-	*this << Value.Position;
-	*this << Value.Color;
-	*this << Value.Normal;
-	*this << Value.TextureCoord;
+	::SerializeProperties(*this, Value);
 	return *this;
 }
 
+/**
+ * @brief 프로퍼티 테이블을 순회하며 객체를 직렬화하는 함수
+ * 통째 복사 구간은 Serialize 한 번으로 처리하고, 문자열 등 나머지 프로퍼티만 타입별 operator<<로 처리한다
+ * @param InTable 객체 타입의 프로퍼티 테이블
+ * @param InObject 직렬화할 객체의 시작 주소
+ */
+void FArchive::SerializeProperties(const FPropertyTable& InTable, void* InObject)
+{
+	const TArray<FProperty>& Properties = InTable.GetProperties();
+
+	for (const FPropertyRun& Run : InTable.GetSerializeRuns())
+	{
+		if (Run.IsBulkRun())
+		{
+			Serialize(static_cast<uint8*>(InObject) + Run.Offset, Run.Size);
+			continue;
+		}
+
+		const FProperty& Property = Properties[Run.PropertyIndex];
+		switch (Property.Type)
+		{
+		case EPropertyType::String:
+			*this << Property.GetValue<FString>(InObject);
+			break;
+		default:
+			Serialize(Property.GetValuePtr(InObject), Property.Size);
+			break;
+		}
+	}
+}
+
 FBinaryWriter::FBinaryWriter(const FString& FilePath)
 	: File(FilePath, std::ios::binary)
 {
@@ -87,6 +122,11 @@ FArchive& FBinaryWriter::operator<<(FVector4& Value)
 	return *this;
 }
 
+void FBinaryWriter::Serialize(void* Data, size_t Size)
+{
+	File.write(static_cast<const char*>(Data), static_cast<streamsize>(Size));
+}
+
 // FBinaryReader 구현
 FBinaryReader::FBinaryReader(const FString& FilePath)
 	: File(FilePath, std::ios::binary)
@@ -168,6 +208,11 @@ FArchive& FBinaryReader::operator<<(FVector4& Value)
 	return *this;
 }
 
+void FBinaryReader::Serialize(void* Data, size_t Size)
+{
+	File.read(static_cast<char*>(Data), static_cast<streamsize>(Size));
+}
+
 // 헬퍼 함수들
 namespace FArchiveHelpers
 {
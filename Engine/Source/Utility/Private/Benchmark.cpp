@@ -0,0 +1,154 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "json.hpp"
+
+#include <ctime>
+
+using JSON = json::JSON;
+
+namespace
+{
+	const char* GetBuildConfiguration()
+	{
+#ifdef _DEBUG
+		return "Debug";
+#else
+		return "Release";
+#endif
+	}
+
+	FString GetTimestamp()
+	{
+		const time_t Now = time(nullptr);
+		tm LocalTime = {};
+#ifdef _WIN32
+		(void)localtime_s(&LocalTime, &Now);
+#else
+		(void)localtime_r(&Now, &LocalTime);
+#endif
+
+		char Buffer[32];
+		(void)strftime(Buffer, sizeof(Buffer), "%Y-%m-%dT%H:%M:%S", &LocalTime);
+		return Buffer;
+	}
+
+	/**
+	 * @brief CSV 필드에 쉼표나 따옴표가 들어있을 수 있으므로 따옴표로 감싸고 내부 따옴표는 두 번 쓴다
+	 */
+	FString EscapeCsvField(const FString& InField)
+	{
+		FString Result = "\"";
+		for (char Character : InField)
+		{
+			if (Character == '"')
+			{
+				Result += '"';
+			}
+			Result += Character;
+		}
+		Result += '"';
+		return Result;
+	}
+}
+
+bool FBenchmark::Check(bool bInPassed, const FString& InCheck, const FString& InDescription,
+                       TArray<FString>& OutMismatches)
+{
+	if (!bInPassed)
+	{
+		OutMismatches.Add(InCheck + ": " + InDescription);
+	}
+	return bInPassed;
+}
+
+bool FBenchmark::CheckCount(const FString& InCheck, int64 InNumMismatches, const FString& InDescription,
+                            TArray<FString>& OutMismatches)
+{
+	return Check(InNumMismatches == 0, InCheck, std::to_string(InNumMismatches) + " " + InDescription, OutMismatches);
+}
+
+bool FBenchmark::CheckTolerance(const FString& InCheck, double InMaxError, double InTolerance,
+                                TArray<FString>& OutMismatches)
+{
+	char Buffer[128];
+	(void)snprintf(Buffer, sizeof(Buffer), "max error %g (tolerance %g)", InMaxError, InTolerance);
+	return Check(InMaxError <= InTolerance, InCheck, Buffer, OutMismatches);
+}
+
+TArray<FString> FBenchmark::FormatResults(const TArray<FBenchmarkResult>& InResults)
+{
+	size_t WorkloadWidth = 0;
+	size_t OperationWidth = 0;
+	for (const FBenchmarkResult& Result : InResults)
+	{
+		WorkloadWidth = max(WorkloadWidth, Result.Workload.size());
+		OperationWidth = max(OperationWidth, Result.Operation.size());
+	}
+
+	TArray<FString> Lines;
+	Lines.Reserve(InResults.Num());
+	for (const FBenchmarkResult& Result : InResults)
+	{
+		char Buffer[512];
+		(void)snprintf(Buffer, sizeof(Buffer), "%-*s %-*s %9.3f / %9.3f (x%.2f)", static_cast<int>(WorkloadWidth),
+		               Result.Workload.c_str(), static_cast<int>(OperationWidth), Result.Operation.c_str(),
+		               Result.BaselineMilliseconds, Result.EngineMilliseconds, Result.GetSpeedup());
+		Lines.Add(Buffer);
+	}
+	return Lines;
+}
+
+bool FBenchmark::SaveResultsToJson(const TArray<FBenchmarkResult>& InResults, const FString& InFilePath)
+{
+	JSON ResultsJson = JSON::Make(JSON::Class::Array);
+	for (const FBenchmarkResult& Result : InResults)
+	{
+		JSON ResultJson = JSON::Make(JSON::Class::Object);
+		ResultJson["Workload"] = Result.Workload;
+		ResultJson["Operation"] = Result.Operation;
+		ResultJson["BaselineMs"] = Result.BaselineMilliseconds;
+		ResultJson["EngineMs"] = Result.EngineMilliseconds;
+		ResultJson["Speedup"] = Result.GetSpeedup();
+		ResultsJson.append(ResultJson);
+	}
+
+	JSON RootJson = JSON::Make(JSON::Class::Object);
+	RootJson["Configuration"] = GetBuildConfiguration();
+	RootJson["Timestamp"] = GetTimestamp();
+	RootJson["Results"] = ResultsJson;
+
+	ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << RootJson << "\n";
+	return File.good();
+}
+
+bool FBenchmark::SaveResultsToCsv(const TArray<FBenchmarkResult>& InResults, const FString& InFilePath)
+{
+	ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	File << "Configuration,Timestamp,Workload,Operation,BaselineMs,EngineMs,Speedup\n";
+
+	const FString Configuration = GetBuildConfiguration();
+	const FString Timestamp = GetTimestamp();
+	for (const FBenchmarkResult& Result : InResults)
+	{
+		char Numbers[128];
+		(void)snprintf(Numbers, sizeof(Numbers), "%.6f,%.6f,%.4f", Result.BaselineMilliseconds,
+		               Result.EngineMilliseconds, Result.GetSpeedup());
+
+		File << Configuration << ',' << Timestamp << ',' << EscapeCsvField(Result.Workload) << ','
+			<< EscapeCsvField(Result.Operation) << ',' << Numbers << '\n';
+	}
+
+	return File.good();
+}
@@ -0,0 +1,231 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <chrono>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+	/**
+	 * @brief 최적화로 측정 대상 연산이 제거되지 않도록 결과를 누적하는 변수
+	 */
+	volatile uint64 GBenchmarkSink = 0;
+
+	uint64 HashForSink(uint32 InKey) { return InKey; }
+	uint64 HashForSink(const FString& InKey) { return InKey.size(); }
+
+	/**
+	 * @brief std::unordered_map과 TMap을 같은 인터페이스로 다루기 위한 어댑터
+	 */
+	template <typename KeyType>
+	struct FStdMapAdapter
+	{
+		std::unordered_map<KeyType, uint32> Map;
+
+		void Add(const KeyType& InKey, uint32 InValue) { Map[InKey] = InValue; }
+
+		const uint32* Find(const KeyType& InKey) const
+		{
+			auto It = Map.find(InKey);
+			return It != Map.end() ? &It->second : nullptr;
+		}
+
+		void Remove(const KeyType& InKey) { Map.erase(InKey); }
+
+		uint64 Iterate() const
+		{
+			uint64 Sum = 0;
+			for (const auto& Pair : Map)
+			{
+				Sum += Pair.second;
+			}
+			return Sum;
+		}
+	};
+
+	template <typename KeyType>
+	struct FEngineMapAdapter
+	{
+		TMap<KeyType, uint32> Map;
+
+		void Add(const KeyType& InKey, uint32 InValue) { Map.Add(InKey, InValue); }
+		const uint32* Find(const KeyType& InKey) const { return Map.Find(InKey); }
+		void Remove(const KeyType& InKey) { Map.Remove(InKey); }
+
+		uint64 Iterate() const
+		{
+			uint64 Sum = 0;
+			for (const auto& Pair : Map)
+			{
+				Sum += Pair.second;
+			}
+			return Sum;
+		}
+	};
+
+	/**
+	 * @brief 한 맵 구현에 대해 Insert / FindHit / FindMiss / Iterate / Remove 순서로 측정하는 함수
+	 * @param InKeys 삽입할 키
+	 * @param InMissingKeys 맵에 없는 키
+	 * @param OutMilliseconds 연산별 소요 시간
+	 */
+	template <typename AdapterType, typename KeyType>
+	void RunMapOperations(const TArray<KeyType>& InKeys, const TArray<KeyType>& InMissingKeys,
+	                      double (&OutMilliseconds)[5])
+	{
+		AdapterType Adapter;
+
+		OutMilliseconds[0] = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Index = 0; Index < InKeys.Num(); ++Index)
+			{
+				Adapter.Add(InKeys[Index], static_cast<uint32>(Index));
+			}
+		});
+
+		OutMilliseconds[1] = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (const KeyType& Key : InKeys)
+			{
+				if (const uint32* Value = Adapter.Find(Key))
+				{
+					Sum += *Value;
+				}
+			}
+			GBenchmarkSink = GBenchmarkSink + Sum;
+		});
+
+		OutMilliseconds[2] = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (const KeyType& Key : InMissingKeys)
+			{
+				Sum += Adapter.Find(Key) ? HashForSink(Key) : 0;
+			}
+			GBenchmarkSink = GBenchmarkSink + Sum;
+		});
+
+		OutMilliseconds[3] = FBenchmark::MeasureMilliseconds([&]
+		{
+			GBenchmarkSink = GBenchmarkSink + Adapter.Iterate();
+		});
+
+		OutMilliseconds[4] = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (const KeyType& Key : InKeys)
+			{
+				Adapter.Remove(Key);
+			}
+		});
+	}
+
+	template <typename KeyType>
+	void RunMapWorkload(const FString& InWorkload, const TArray<KeyType>& InKeys, const TArray<KeyType>& InMissingKeys,
+	                    TArray<FBenchmarkResult>& OutResults)
+	{
+		static const char* OperationNames[5] = {"Insert", "FindHit", "FindMiss", "Iterate", "Remove"};
+
+		double BaselineMilliseconds[5] = {};
+		double EngineMilliseconds[5] = {};
+		RunMapOperations<FStdMapAdapter<KeyType>>(InKeys, InMissingKeys, BaselineMilliseconds);
+		RunMapOperations<FEngineMapAdapter<KeyType>>(InKeys, InMissingKeys, EngineMilliseconds);
+
+		for (int32 Index = 0; Index < 5; ++Index)
+		{
+			OutResults.Add(FBenchmarkResult{
+				InWorkload, OperationNames[Index], BaselineMilliseconds[Index], EngineMilliseconds[Index]
+			});
+		}
+	}
+
+	void RunSetWorkload(const FString& InWorkload, const TArray<uint32>& InKeys,
+	                    TArray<FBenchmarkResult>& OutResults)
+	{
+		FBenchmarkResult AddResult{InWorkload, "Insert"};
+		FBenchmarkResult ContainsResult{InWorkload, "FindHit"};
+
+		std::unordered_set<uint32> StdSet;
+		AddResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (uint32 Key : InKeys)
+			{
+				StdSet.insert(Key);
+			}
+		});
+		ContainsResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Count = 0;
+			for (uint32 Key : InKeys)
+			{
+				Count += StdSet.count(Key);
+			}
+			GBenchmarkSink = GBenchmarkSink + Count;
+		});
+
+		TSet<uint32> EngineSet;
+		AddResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (uint32 Key : InKeys)
+			{
+				EngineSet.Add(Key);
+			}
+		});
+		ContainsResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Count = 0;
+			for (uint32 Key : InKeys)
+			{
+				Count += EngineSet.Contains(Key) ? 1 : 0;
+			}
+			GBenchmarkSink = GBenchmarkSink + Count;
+		});
+
+		OutResults.Add(AddResult);
+		OutResults.Add(ContainsResult);
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunHashContainerBenchmarks(int32 InNumElements)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumElements <= 0)
+	{
+		return Results;
+	}
+
+	// 고정 시드를 사용해 실행할 때마다 같은 키 시퀀스로 비교
+	std::mt19937 Random(0x47544C);
+
+	// 짝수 키는 삽입, 홀수 키는 Miss 조회용으로 나누어 두 집합이 겹치지 않도록 구성
+	TArray<uint32> IntegerKeys;
+	TArray<uint32> MissingIntegerKeys;
+	IntegerKeys.Reserve(InNumElements);
+	MissingIntegerKeys.Reserve(InNumElements);
+	for (int32 Index = 0; Index < InNumElements; ++Index)
+	{
+		const uint32 Base = Random() & ~1u;
+		IntegerKeys.Add(Base);
+		MissingIntegerKeys.Add(Base | 1u);
+	}
+
+	// 에셋 경로와 비슷한 길이의 문자열 키
+	TArray<FString> StringKeys;
+	TArray<FString> MissingStringKeys;
+	StringKeys.Reserve(InNumElements);
+	MissingStringKeys.Reserve(InNumElements);
+	for (int32 Index = 0; Index < InNumElements; ++Index)
+	{
+		const FString Path = "Data/Assets/Mesh_" + std::to_string(IntegerKeys[Index]);
+		StringKeys.Add(Path + ".obj");
+		MissingStringKeys.Add(Path + ".mtl");
+	}
+
+	const FString CountSuffix = " x" + std::to_string(InNumElements);
+	RunMapWorkload("TMap<uint32>" + CountSuffix, IntegerKeys, MissingIntegerKeys, Results);
+	RunMapWorkload("TMap<FString>" + CountSuffix, StringKeys, MissingStringKeys, Results);
+	RunSetWorkload("TSet<uint32>" + CountSuffix, IntegerKeys, Results);
+
+	return Results;
+}
@@ -0,0 +1,420 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Runtime/Core/Public/Name.h"
+#include "Runtime/Core/Public/Containers/TSparseArray.h"
+
+#include <random>
+
+namespace
+{
+	/**
+	 * @brief 최적화로 측정 대상 연산이 제거되지 않도록 결과를 누적하는 변수
+	 */
+	volatile uint64 GCoreBenchmarkSink = 0;
+
+	/**
+	 * @brief 씬 규모의 작은 원소 수에서도 측정 시간이 충분하도록 반복 횟수를 정하는 함수
+	 * 워크로드당 약 백만 번의 연산이 되도록 맞춘다
+	 */
+	int32 GetRepeatCount(int32 InNumElements)
+	{
+		return max(1, 1000000 / InNumElements);
+	}
+
+	/**
+	 * @brief TArray와 std::vector의 추가 / 순회 비교 (TArray 래퍼 비용 확인용)
+	 */
+	void RunArrayWorkload(int32 InNumElements, int32 InRepeatCount, const FString& InSuffix,
+	                      TArray<FBenchmarkResult>& OutResults)
+	{
+		FBenchmarkResult AddResult{"TArray<int32> vs std::vector" + InSuffix, "Add"};
+		FBenchmarkResult IterateResult{"TArray<int32> vs std::vector" + InSuffix, "Iterate"};
+
+		std::vector<int32> StdArray;
+		AddResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				StdArray.clear();
+				for (int32 Index = 0; Index < InNumElements; ++Index)
+				{
+					StdArray.push_back(Index);
+				}
+			}
+		});
+		IterateResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				for (int32 Value : StdArray)
+				{
+					Sum += Value;
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+
+		TArray<int32> EngineArray;
+		AddResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				EngineArray.Reset();
+				for (int32 Index = 0; Index < InNumElements; ++Index)
+				{
+					EngineArray.Add(Index);
+				}
+			}
+		});
+		IterateResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				for (int32 Value : EngineArray)
+				{
+					Sum += Value;
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+
+		OutResults.Add(AddResult);
+		OutResults.Add(IterateResult);
+	}
+
+	/**
+	 * @brief 매 프레임 만들어지는 작은 배열(GetComponents 등)을 힙 배열과 인라인 배열로 비교
+	 */
+	void RunInlineArrayWorkload(int32 InNumElements, int32 InRepeatCount, const FString& InSuffix,
+	                            TArray<FBenchmarkResult>& OutResults)
+	{
+		constexpr int32 NumSmallElements = 4;
+		const int32 NumArrays = InNumElements * InRepeatCount / NumSmallElements;
+
+		FBenchmarkResult Result{"TArray vs TInlineAllocator<8>, 4 elements" + InSuffix, "CreateFill"};
+
+		Result.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 ArrayIndex = 0; ArrayIndex < NumArrays; ++ArrayIndex)
+			{
+				TArray<int32> SmallArray;
+				for (int32 Index = 0; Index < NumSmallElements; ++Index)
+				{
+					SmallArray.Add(ArrayIndex + Index);
+				}
+				Sum += SmallArray.Num();
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+
+		Result.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 ArrayIndex = 0; ArrayIndex < NumArrays; ++ArrayIndex)
+			{
+				TArray<int32, TInlineAllocator<8>> SmallArray;
+				for (int32 Index = 0; Index < NumSmallElements; ++Index)
+				{
+					SmallArray.Add(ArrayIndex + Index);
+				}
+				Sum += SmallArray.Num();
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+
+		OutResults.Add(Result);
+	}
+
+	/**
+	 * @brief Level Actor 목록처럼 임의 순서로 제거되는 경우를 TArray와 TSparseArray로 비교
+	 * TArray는 값 검색 후 당기기, TSparseArray는 보관해 둔 인덱스로 제거한다
+	 */
+	void RunSparseArrayWorkload(int32 InNumElements, const FString& InSuffix, TArray<FBenchmarkResult>& OutResults)
+	{
+		FBenchmarkResult RemoveResult{"TArray vs TSparseArray" + InSuffix, "RemoveRandom"};
+		FBenchmarkResult IterateResult{"TArray vs TSparseArray, 25% holes" + InSuffix, "Iterate"};
+
+		TArray<int32> RemoveOrder;
+		RemoveOrder.Reserve(InNumElements);
+		for (int32 Index = 0; Index < InNumElements; ++Index)
+		{
+			RemoveOrder.Add(Index);
+		}
+		std::shuffle(RemoveOrder.begin(), RemoveOrder.end(), std::mt19937(0x47544C));
+
+		const int32 RepeatCount = max(1, GetRepeatCount(InNumElements) / 64);
+
+		// 제거
+		RemoveResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+			{
+				TArray<int32> Array;
+				Array.Reserve(InNumElements);
+				for (int32 Index = 0; Index < InNumElements; ++Index)
+				{
+					Array.Add(Index);
+				}
+				for (int32 Value : RemoveOrder)
+				{
+					Array.RemoveSingle(Value);
+				}
+			}
+		});
+
+		RemoveResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+			{
+				TSparseArray<int32> SparseArray;
+				SparseArray.Reserve(InNumElements);
+				for (int32 Index = 0; Index < InNumElements; ++Index)
+				{
+					SparseArray.Add(Index);
+				}
+				for (int32 Index : RemoveOrder)
+				{
+					SparseArray.RemoveAt(Index);
+				}
+			}
+		});
+
+		// 4개 중 1개가 제거된 상태에서의 순회
+		TArray<int32> Array;
+		TSparseArray<int32> SparseArray;
+		for (int32 Index = 0; Index < InNumElements; ++Index)
+		{
+			SparseArray.Add(Index);
+			if (Index % 4 != 0)
+			{
+				Array.Add(Index);
+			}
+		}
+		for (int32 Index = 0; Index < InNumElements; Index += 4)
+		{
+			SparseArray.RemoveAt(Index);
+		}
+
+		const int32 IterateRepeatCount = GetRepeatCount(InNumElements);
+		IterateResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 Repeat = 0; Repeat < IterateRepeatCount; ++Repeat)
+			{
+				for (int32 Value : Array)
+				{
+					Sum += Value;
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+		IterateResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 Repeat = 0; Repeat < IterateRepeatCount; ++Repeat)
+			{
+				for (int32 Value : SparseArray)
+				{
+					Sum += Value;
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+
+		OutResults.Add(RemoveResult);
+		OutResults.Add(IterateResult);
+	}
+
+	/**
+	 * @brief 오브젝트 이름 비교 / 조회를 FString과 FName으로 비교
+	 */
+	void RunNameWorkload(int32 InNumElements, int32 InRepeatCount, const FString& InSuffix,
+	                     TArray<FBenchmarkResult>& OutResults)
+	{
+		const FString Workload = "FString vs FName" + InSuffix;
+		FBenchmarkResult ConstructResult{Workload, "Construct"};
+		FBenchmarkResult CompareResult{Workload, "Compare"};
+		FBenchmarkResult FindResult{Workload, "MapFind"};
+
+		// 씬 Actor 이름과 같은 형태의 문자열 (실행마다 같은 이름을 사용하므로 FName 테이블이 계속 커지지 않음)
+		TArray<FString> Strings;
+		Strings.Reserve(InNumElements);
+		for (int32 Index = 0; Index < InNumElements; ++Index)
+		{
+			Strings.Add("StaticMeshActor_" + std::to_string(Index));
+		}
+
+		TArray<FString> StringCopies;
+		TArray<FName> Names;
+		const int32 ConstructRepeatCount = max(1, InRepeatCount / 8);
+
+		ConstructResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Repeat = 0; Repeat < ConstructRepeatCount; ++Repeat)
+			{
+				StringCopies.Reset();
+				for (const FString& String : Strings)
+				{
+					StringCopies.Add(String);
+				}
+			}
+		});
+		ConstructResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Repeat = 0; Repeat < ConstructRepeatCount; ++Repeat)
+			{
+				Names.Reset();
+				for (const FString& String : Strings)
+				{
+					Names.Add(FName(String));
+				}
+			}
+		});
+
+		// 인접한 원소끼리 비교 (같은 접두사를 가진 서로 다른 이름)
+		CompareResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Count = 0;
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				for (int32 Index = 1; Index < InNumElements; ++Index)
+				{
+					Count += StringCopies[Index] == StringCopies[Index - 1] ? 1 : 0;
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Count;
+		});
+		CompareResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Count = 0;
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				for (int32 Index = 1; Index < InNumElements; ++Index)
+				{
+					Count += Names[Index] == Names[Index - 1] ? 1 : 0;
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Count;
+		});
+
+		TMap<FString, int32> StringMap;
+		TMap<FName, int32> NameMap;
+		for (int32 Index = 0; Index < InNumElements; ++Index)
+		{
+			StringMap.Add(StringCopies[Index], Index);
+			NameMap.Add(Names[Index], Index);
+		}
+
+		FindResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				for (const FString& String : StringCopies)
+				{
+					if (const int32* Value = StringMap.Find(String))
+					{
+						Sum += *Value;
+					}
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+		FindResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				for (const FName& Name : Names)
+				{
+					if (const int32* Value = NameMap.Find(Name))
+					{
+						Sum += *Value;
+					}
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+
+		OutResults.Add(ConstructResult);
+		OutResults.Add(CompareResult);
+		OutResults.Add(FindResult);
+	}
+
+	/**
+	 * @brief 참조 카운트 갱신 비용을 ThreadSafe(기준)와 NotThreadSafe 모드로 비교
+	 */
+	template <ESPMode Mode>
+	void RunSharedPtrOperations(int32 InNumElements, int32 InRepeatCount, double& OutMakeMilliseconds,
+	                            double& OutCopyMilliseconds)
+	{
+		TArray<TSharedPtr<FVector, Mode>> Pointers;
+		Pointers.Reserve(InNumElements);
+
+		OutMakeMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Repeat = 0; Repeat < max(1, InRepeatCount / 8); ++Repeat)
+			{
+				Pointers.Reset();
+				for (int32 Index = 0; Index < InNumElements; ++Index)
+				{
+					Pointers.Add(MakeShared<FVector, Mode>(static_cast<float>(Index), 0.0f, 0.0f));
+				}
+			}
+		});
+
+		OutCopyMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			uint64 Sum = 0;
+			for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+			{
+				for (const TSharedPtr<FVector, Mode>& Pointer : Pointers)
+				{
+					TSharedPtr<FVector, Mode> Copy = Pointer;
+					Sum += static_cast<uint64>(Copy->X);
+				}
+			}
+			GCoreBenchmarkSink = GCoreBenchmarkSink + Sum;
+		});
+	}
+
+	void RunSharedPtrWorkload(int32 InNumElements, int32 InRepeatCount, const FString& InSuffix,
+	                          TArray<FBenchmarkResult>& OutResults)
+	{
+		const FString Workload = "TSharedPtr ThreadSafe vs NotThreadSafe" + InSuffix;
+		FBenchmarkResult MakeResult{Workload, "MakeShared"};
+		FBenchmarkResult CopyResult{Workload, "CopyRelease"};
+
+		RunSharedPtrOperations<ESPMode::ThreadSafe>(InNumElements, InRepeatCount, MakeResult.BaselineMilliseconds,
+		                                            CopyResult.BaselineMilliseconds);
+		RunSharedPtrOperations<ESPMode::NotThreadSafe>(InNumElements, InRepeatCount, MakeResult.EngineMilliseconds,
+		                                               CopyResult.EngineMilliseconds);
+
+		OutResults.Add(MakeResult);
+		OutResults.Add(CopyResult);
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunCoreBenchmarks(int32 InNumElements)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumElements <= 1)
+	{
+		return Results;
+	}
+
+	const int32 RepeatCount = GetRepeatCount(InNumElements);
+	const FString Suffix = " x" + std::to_string(InNumElements);
+
+	RunArrayWorkload(InNumElements, RepeatCount, Suffix, Results);
+	RunInlineArrayWorkload(InNumElements, RepeatCount, Suffix, Results);
+	RunSparseArrayWorkload(InNumElements, Suffix, Results);
+	RunNameWorkload(InNumElements, RepeatCount, Suffix, Results);
+	RunSharedPtrWorkload(InNumElements, RepeatCount, Suffix, Results);
+
+	return Results;
+}
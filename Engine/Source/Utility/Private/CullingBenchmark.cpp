@@ -0,0 +1,194 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Global/MatrixMath.h"
+#include "Physics/Public/Frustum.h"
+
+#include <random>
+
+namespace
+{
+	volatile int32 GCullingBenchmarkSink = 0;
+
+	/**
+	 * @brief AABB 수가 적을 때도 측정값이 의미 있도록 맞추는 총 판정 횟수
+	 */
+	constexpr int32 NumCullingOperations = 2000000;
+
+	/**
+	 * @brief FViewportClient와 같은 방식의 원근 뷰 (원점 근처에서 +X 방향을 약간 비스듬히 바라봄)
+	 * @return Projection * View (열 벡터 규약)
+	 */
+	FMatrix MakeViewProjection()
+	{
+		const FVector ViewLocation(-200.0f, 50.0f, 80.0f);
+		FVector Forward(0.9f, 0.3f, -0.2f);
+		Forward.Normalize();
+		FVector Right = FVector(0.0f, 0.0f, 1.0f).Cross(Forward);
+		Right.Normalize();
+		const FVector Up = Forward.Cross(Right);
+
+		FMatrix ViewMatrix = FMatrix::Identity();
+		const FVector Axes[3] = {Right, Up, Forward};
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			ViewMatrix.Data[Row][0] = Axes[Row].X;
+			ViewMatrix.Data[Row][1] = Axes[Row].Y;
+			ViewMatrix.Data[Row][2] = Axes[Row].Z;
+			ViewMatrix.Data[Row][3] = -Axes[Row].Dot(ViewLocation);
+		}
+
+		const FMatrix ProjectionMatrix = FMatrix::MatrixPerspectiveFovLH(FVector::GetDegreeToRadian(90.0f), 16.0f / 9.0f,
+		                                                                 1.0f, 2000.0f);
+		return ProjectionMatrix * ViewMatrix;
+	}
+
+	/**
+	 * @brief 점을 클립 공간으로 옮겨 D3D 클립 조건으로 판정한다
+	 * @param OutMargin 가장 가까운 경계까지의 여유 (W 기준으로 정규화, 경계 근처의 반올림 차이를 거르는 데 사용)
+	 */
+	bool IsInsideClipVolume(const FMatrix& InViewProjection, const FVector& InPoint, float& OutMargin)
+	{
+		float Clip[4];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			const float* M = InViewProjection.Data[Row];
+			Clip[Row] = M[0] * InPoint.X + M[1] * InPoint.Y + M[2] * InPoint.Z + M[3];
+		}
+
+		const float W = Clip[3];
+		const float Scale = max(std::abs(W), 1.0f);
+		OutMargin = min(min(W - std::abs(Clip[0]), W - std::abs(Clip[1])), min(Clip[2], W - Clip[2])) / Scale;
+		return OutMargin >= 0.0f;
+	}
+
+	/**
+	 * @brief 절두체 주변 공간에 흩어진 다양한 크기의 AABB (일부는 절두체 밖, 일부는 경계에 걸침)
+	 */
+	void MakeBounds(int32 InNumBounds, TArray<FAABB>& OutBounds)
+	{
+		std::mt19937 Random(0x435547);
+		std::uniform_real_distribution<float> Location(-2500.0f, 2500.0f);
+		std::uniform_real_distribution<float> Extent(0.5f, 60.0f);
+
+		OutBounds.Empty(InNumBounds);
+		for (int32 Index = 0; Index < InNumBounds; ++Index)
+		{
+			const FVector Center(Location(Random), Location(Random), Location(Random) * 0.2f);
+			const FVector HalfSize(Extent(Random), Extent(Random), Extent(Random));
+			OutBounds.Add(FAABB(Center - HalfSize, Center + HalfSize));
+		}
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunCullingBenchmarks(int32 InNumBounds, TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumBounds <= 0)
+	{
+		return Results;
+	}
+
+	const FMatrix ViewProjection = MakeViewProjection();
+	const FFrustum Frustum(ViewProjection);
+
+	// 평면 추출: 점 판정이 클립 좌표 판정과 같아야 함 (경계에 매우 가까운 점은 제외)
+	{
+		std::mt19937 Random(0x505453);
+		std::uniform_real_distribution<float> Location(-2500.0f, 2500.0f);
+
+		int32 NumPlaneMismatches = 0;
+		for (int32 Index = 0; Index < InNumBounds; ++Index)
+		{
+			const FVector Point(Location(Random), Location(Random), Location(Random) * 0.2f);
+
+			float Margin = 0.0f;
+			const bool bExpected = IsInsideClipVolume(ViewProjection, Point, Margin);
+			if (std::abs(Margin) > 1e-4f && Frustum.IntersectsPoint(Point) != bExpected)
+			{
+				++NumPlaneMismatches;
+			}
+		}
+
+		CheckCount("FrustumPlanes", NumPlaneMismatches, "points disagree with clip test", OutMismatches);
+	}
+
+	TArray<FAABB> Bounds;
+	MakeBounds(InNumBounds, Bounds);
+
+	FCullingBoundsBatch Batch;
+	Batch.Reserve(InNumBounds);
+	for (const FAABB& Box : Bounds)
+	{
+		Batch.Add(Box);
+	}
+
+	TArray<uint8> Visibility;
+	const int32 NumVisible = Batch.Cull(Frustum, Visibility);
+
+	// 일괄 판정은 단건 판정과 같아야 하고, 컬링된 AABB는 꼭짓점이 하나도 클립 공간 안에 있으면 안 됨
+	int32 NumBatchMismatches = 0;
+	int32 NumFalseCulls = 0;
+	for (int32 Index = 0; Index < InNumBounds; ++Index)
+	{
+		if (Frustum.IntersectsAABB(Bounds[Index]) != (Visibility[Index] != 0))
+		{
+			++NumBatchMismatches;
+		}
+
+		if (!Visibility[Index])
+		{
+			const FAABB& Box = Bounds[Index];
+			for (int32 Corner = 0; Corner < 8; ++Corner)
+			{
+				const FVector Point((Corner & 1) ? Box.Max.X : Box.Min.X, (Corner & 2) ? Box.Max.Y : Box.Min.Y,
+				                    (Corner & 4) ? Box.Max.Z : Box.Min.Z);
+				float Margin = 0.0f;
+				if (IsInsideClipVolume(ViewProjection, Point, Margin) && Margin > 1e-4f)
+				{
+					++NumFalseCulls;
+					break;
+				}
+			}
+		}
+	}
+
+	CheckCount("BatchCull", NumBatchMismatches, "results differ from IntersectsAABB", OutMismatches);
+	CheckCount("BatchCull", NumFalseCulls, "culled boxes have a visible corner", OutMismatches);
+
+	const int32 NumIterations = max(NumCullingOperations / InNumBounds, 1);
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	const FString Workload = "Frustum AABB vs SoA SSE x" + std::to_string(InNumBounds) + " (" +
+		std::to_string(NumVisible) + " visible)";
+#else
+	const FString Workload = "Frustum AABB vs SoA Scalar x" + std::to_string(InNumBounds) + " (" +
+		std::to_string(NumVisible) + " visible)";
+#endif
+
+	FBenchmarkResult Result{Workload, "CullAABB"};
+	Result.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		int32 Sum = 0;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (const FAABB& Box : Bounds)
+			{
+				Sum += Frustum.IntersectsAABB(Box);
+			}
+		}
+		GCullingBenchmarkSink = GCullingBenchmarkSink + Sum;
+	}) / NumIterations;
+	Result.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		int32 Sum = 0;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Sum += Batch.Cull(Frustum, Visibility);
+		}
+		GCullingBenchmarkSink = GCullingBenchmarkSink + Sum;
+	}) / NumIterations;
+	Results.Add(Result);
+
+	return Results;
+}
@@ -0,0 +1,418 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Runtime/Core/Public/Name.h"
+#include "Runtime/Renderer/Public/DrawPacket.h"
+#include "Runtime/Renderer/Public/RenderCommand.h"
+
+#include <random>
+
+namespace
+{
+	volatile int64 GDrawPacketBenchmarkSink = 0;
+
+	constexpr int32 NumDrawPacketOperations = 1000000;
+
+	// 실행 순서 검증용 기록 (nullptr이면 기록하지 않음)
+	TArray<int32>* GExecutionOrder = nullptr;
+	int64 GExecutionSum = 0;
+
+	void ExecuteDraw(int32 InProxyIndex, const FMatrix& InViewMatrix)
+	{
+		GExecutionSum += InProxyIndex + static_cast<int64>(InViewMatrix.Data[3][0]);
+		if (GExecutionOrder)
+		{
+			GExecutionOrder->Add(InProxyIndex);
+		}
+	}
+
+	/**
+	 * @brief 기존 FRHIDrawIndexedPrimitivesCommand와 같은 모양의 가상 드로우 Command (행렬을 Command마다 복사)
+	 */
+	class FBenchmarkDrawCommand :
+		public IRHICommand
+	{
+	public:
+		FBenchmarkDrawCommand(uint64 InSortingKey, int32 InProxyIndex, const FMatrix& InViewMatrix,
+		                      const FMatrix& InProjMatrix)
+			: ProxyIndex(InProxyIndex), ViewMatrix(InViewMatrix), ProjMatrix(InProjMatrix)
+		{
+			SetSortingKey(InSortingKey);
+		}
+
+		void Execute() override { ExecuteDraw(ProxyIndex, ViewMatrix); }
+		ERHICommandType GetCommandType() const override { return ERHICommandType::DrawIndexedPrimitives; }
+
+	private:
+		int32 ProxyIndex;
+		FMatrix ViewMatrix;
+		FMatrix ProjMatrix;
+	};
+
+	void ExecuteBenchmarkPacket(const FDrawPacketContext& InContext, const FDrawPacket& InPacket)
+	{
+		ExecuteDraw(InPacket.SceneProxy.ProxyIndex, InContext.Views[InPacket.ViewIndex].ViewMatrix);
+	}
+
+	constexpr FDrawPacketFunction BenchmarkPacketFunctions[] = {
+		&ExecuteBenchmarkPacket,
+		&ExecuteBenchmarkPacket,
+		&ExecuteBenchmarkPacket,
+	};
+	static_assert(std::size(BenchmarkPacketFunctions) == static_cast<size_t>(EDrawPacketType::Num));
+
+	/**
+	 * @brief 기존 RadixSortDrawCommands와 같은 포인터 기반 8비트 LSD Radix Sort (키를 포인터로 따라가 읽음)
+	 */
+	void RadixSortCommandPointers(TArray<IRHICommand*>& InOutCommands, TArray<IRHICommand*>& InScratch)
+	{
+		const int32 Count = InOutCommands.Num();
+		InScratch.SetNum(Count);
+		IRHICommand** Source = InOutCommands.GetData();
+		IRHICommand** Dest = InScratch.GetData();
+
+		for (int32 Shift = 0; Shift < 64; Shift += 8)
+		{
+			int32 Offsets[256] = {};
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				++Offsets[(Source[Index]->GetSortingKey() >> Shift) & 0xFF];
+			}
+
+			int32 Total = 0;
+			for (int32& Offset : Offsets)
+			{
+				const int32 DigitCount = Offset;
+				Offset = Total;
+				Total += DigitCount;
+			}
+
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				Dest[Offsets[(Source[Index]->GetSortingKey() >> Shift) & 0xFF]++] = Source[Index];
+			}
+
+			std::swap(Source, Dest);
+		}
+	}
+
+	/**
+	 * @brief 드로우 한 프레임 분량의 입력 (머티리얼 / 메시 ID가 섞인 정렬 키, 뷰는 하나)
+	 */
+	struct FDrawInput
+	{
+		TArray<uint64> SortKeys;
+		FMatrix ViewMatrix = FMatrix::Identity();
+		FMatrix ProjMatrix = FMatrix::Identity();
+	};
+
+	void MakeDrawInput(int32 InNumDraws, FDrawInput& OutInput)
+	{
+		std::mt19937 Random(0x445257);
+		std::uniform_int_distribution<int32> Material(1, 64);
+		std::uniform_int_distribution<int32> Mesh(0, 31);
+
+		const float Depth = 100.0f;
+		uint32 DepthInt;
+		memcpy(&DepthInt, &Depth, sizeof(DepthInt));
+
+		OutInput.SortKeys.Empty(InNumDraws);
+		for (int32 Index = 0; Index < InNumDraws; ++Index)
+		{
+			OutInput.SortKeys.Add(CreateSortingKey(DepthInt, static_cast<uint16>(Material(Random)),
+			                                       static_cast<uint8>(Mesh(Random)), 128));
+		}
+		OutInput.ViewMatrix.Data[3][0] = 1.0f;
+	}
+
+	/**
+	 * @brief 기존 방식의 한 프레임: Command마다 new, 포인터 정렬, 가상 호출 실행, delete
+	 */
+	struct FVirtualCommandFrame
+	{
+		TArray<IRHICommand*> Commands;
+		TArray<IRHICommand*> Scratch;
+
+		void Enqueue(const FDrawInput& InInput)
+		{
+			for (int32 Index = 0; Index < InInput.SortKeys.Num(); ++Index)
+			{
+				Commands.Add(new FBenchmarkDrawCommand(InInput.SortKeys[Index], Index, InInput.ViewMatrix,
+				                                       InInput.ProjMatrix));
+			}
+		}
+
+		void Sort() { RadixSortCommandPointers(Commands, Scratch); }
+
+		void Execute()
+		{
+			for (IRHICommand* Command : Commands)
+			{
+				Command->Execute();
+				delete Command;
+			}
+			Commands.Reset();
+		}
+	};
+
+	/**
+	 * @brief 패킷 방식의 한 프레임: 패킷 배열에 값으로 추가, 패킷 정렬, 함수 테이블로 실행, Reset
+	 */
+	struct FDrawPacketFrame
+	{
+		FDrawPacketBuffer Packets;
+
+		void Enqueue(const FDrawInput& InInput)
+		{
+			for (int32 Index = 0; Index < InInput.SortKeys.Num(); ++Index)
+			{
+				Packets.AddSceneProxy(InInput.SortKeys[Index], nullptr, Index, 0,
+				                      Packets.AddView(InInput.ViewMatrix, InInput.ProjMatrix));
+			}
+		}
+
+		void Sort() { Packets.Sort(); }
+
+		void Execute()
+		{
+			Packets.Execute(BenchmarkPacketFunctions, nullptr);
+			Packets.Reset();
+		}
+	};
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunDrawPacketBenchmarks(int32 InNumDraws, TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumDraws <= 0)
+	{
+		return Results;
+	}
+
+	FDrawInput Input;
+	MakeDrawInput(InNumDraws, Input);
+
+	FVirtualCommandFrame VirtualFrame;
+	FDrawPacketFrame PacketFrame;
+
+	// 두 방식 모두 안정 정렬이므로 실행 순서가 키 기준 안정 정렬 결과와 같아야 함
+	{
+		TArray<int32> ExpectedOrder;
+		ExpectedOrder.SetNum(InNumDraws);
+		for (int32 Index = 0; Index < InNumDraws; ++Index)
+		{
+			ExpectedOrder[Index] = Index;
+		}
+		std::stable_sort(ExpectedOrder.begin(), ExpectedOrder.end(), [&Input](int32 InA, int32 InB)
+		{
+			return Input.SortKeys[InA] < Input.SortKeys[InB];
+		});
+
+		TArray<int32> VirtualOrder;
+		GExecutionOrder = &VirtualOrder;
+		VirtualFrame.Enqueue(Input);
+		VirtualFrame.Sort();
+		VirtualFrame.Execute();
+
+		TArray<int32> PacketOrder;
+		GExecutionOrder = &PacketOrder;
+		PacketFrame.Enqueue(Input);
+		PacketFrame.Sort();
+		PacketFrame.Execute();
+		GExecutionOrder = nullptr;
+
+		Check(VirtualOrder == ExpectedOrder, "VirtualCommands", "execution order differs from a stable sort by key",
+		      OutMismatches);
+		Check(PacketOrder == ExpectedOrder, "DrawPackets", "execution order differs from a stable sort by key",
+		      OutMismatches);
+	}
+
+	const int32 NumIterations = max(NumDrawPacketOperations / InNumDraws, 1);
+	const FString Workload = "Draw x" + std::to_string(InNumDraws) + " (" + std::to_string(sizeof(FDrawPacket)) +
+		"B packet / " + std::to_string(sizeof(FBenchmarkDrawCommand)) + "B command)";
+
+	FBenchmarkResult Enqueue{Workload, "Enqueue"};
+	FBenchmarkResult Sort{Workload, "Sort"};
+	FBenchmarkResult Execute{Workload, "Execute"};
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Enqueue.BaselineMilliseconds += FBenchmark::MeasureMilliseconds([&] { VirtualFrame.Enqueue(Input); });
+		Sort.BaselineMilliseconds += FBenchmark::MeasureMilliseconds([&] { VirtualFrame.Sort(); });
+		Execute.BaselineMilliseconds += FBenchmark::MeasureMilliseconds([&] { VirtualFrame.Execute(); });
+
+		Enqueue.EngineMilliseconds += FBenchmark::MeasureMilliseconds([&] { PacketFrame.Enqueue(Input); });
+		Sort.EngineMilliseconds += FBenchmark::MeasureMilliseconds([&] { PacketFrame.Sort(); });
+		Execute.EngineMilliseconds += FBenchmark::MeasureMilliseconds([&] { PacketFrame.Execute(); });
+	}
+	GDrawPacketBenchmarkSink = GDrawPacketBenchmarkSink + GExecutionSum;
+
+	FBenchmarkResult Total{Workload, "Total"};
+	for (FBenchmarkResult* Result : {&Enqueue, &Sort, &Execute})
+	{
+		Result->BaselineMilliseconds /= NumIterations;
+		Result->EngineMilliseconds /= NumIterations;
+		Total.BaselineMilliseconds += Result->BaselineMilliseconds;
+		Total.EngineMilliseconds += Result->EngineMilliseconds;
+		Results.Add(*Result);
+	}
+	Results.Add(Total);
+
+	return Results;
+}
+
+namespace
+{
+	/**
+	 * @brief 정렬 방식 하나 (이름과 FDrawPacketBuffer::SortPackets 옵션)
+	 */
+	struct FRadixSortVariant
+	{
+		const char* Name;
+		FDrawPacketSortOptions Options;
+	};
+
+	TArray<FRadixSortVariant> GetRadixSortVariants()
+	{
+		return {
+			{"Radix8 all passes", {8, false, 1}},
+			{"Radix8 skip", {8, true, 1}},
+			{"Radix11 skip", {11, true, 1}},
+			{"Radix8 parallel", {8, true, 0}},
+			{"Radix11 parallel", {11, true, 0}},
+		};
+	}
+
+	/**
+	 * @brief 정렬 입력 패킷 (ProxyIndex에 원래 위치를 기록해 안정성을 확인)
+	 * @param bInDrawKeys true면 드로우처럼 머티리얼 / 메시 비트만 바뀌는 키, false면 64비트 전체가 무작위인 키
+	 */
+	void MakeSortPackets(int32 InNumPackets, bool bInDrawKeys, TArray<FDrawPacket>& OutPackets)
+	{
+		std::mt19937_64 Random(0x534F5254 + InNumPackets);
+		std::uniform_int_distribution<int32> Material(1, 4096);
+		std::uniform_int_distribution<int32> Mesh(0, 255);
+
+		const float Depth = 100.0f;
+		uint32 DepthInt;
+		memcpy(&DepthInt, &Depth, sizeof(DepthInt));
+
+		OutPackets.SetNum(InNumPackets);
+		for (int32 Index = 0; Index < InNumPackets; ++Index)
+		{
+			FDrawPacket& Packet = OutPackets[Index];
+			Packet.SortKey = bInDrawKeys
+				                 ? CreateSortingKey(DepthInt, static_cast<uint16>(Material(Random)),
+				                                    static_cast<uint8>(Mesh(Random)), 128)
+				                 : Random();
+			Packet.SceneProxy.Scene = nullptr;
+			Packet.SceneProxy.ProxyIndex = Index;
+			Packet.Type = EDrawPacketType::SceneProxy;
+			Packet.ViewIndex = 0;
+		}
+	}
+
+	void StableSortPackets(TArray<FDrawPacket>& InOutPackets)
+	{
+		std::stable_sort(InOutPackets.begin(), InOutPackets.end(), [](const FDrawPacket& InA, const FDrawPacket& InB)
+		{
+			return InA.SortKey < InB.SortKey;
+		});
+	}
+
+	bool IsSameOrder(const TArray<FDrawPacket>& InA, const TArray<FDrawPacket>& InB)
+	{
+		if (InA.Num() != InB.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < InA.Num(); ++Index)
+		{
+			if (InA[Index].SortKey != InB[Index].SortKey ||
+				InA[Index].SceneProxy.ProxyIndex != InB[Index].SceneProxy.ProxyIndex)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunRadixSortBenchmarks(int32 InMaxPackets, TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+	const TArray<FRadixSortVariant> Variants = GetRadixSortVariants();
+
+	TArray<FDrawPacket> Input;
+	TArray<FDrawPacket> Expected;
+	TArray<FDrawPacket> Packets;
+	FDrawPacketSortScratch Scratch;
+
+	// 검증: 이전 고정 크기 임시 버퍼(65536)를 넘는 크기와 병렬 구간이 고르게 나뉘지 않는 크기를 포함
+	for (const int32 NumPackets : {2, 1000, 65536, 65537, 100003, 262144})
+	{
+		for (const bool bDrawKeys : {true, false})
+		{
+			MakeSortPackets(NumPackets, bDrawKeys, Input);
+			Expected = Input;
+			StableSortPackets(Expected);
+
+			for (const FRadixSortVariant& Variant : Variants)
+			{
+				Packets = Input;
+				FDrawPacketBuffer::SortPackets(Packets, Scratch, Variant.Options);
+				Check(IsSameOrder(Packets, Expected), Variant.Name, std::to_string(NumPackets) +
+				      (bDrawKeys ? " draw keys" : " random keys") + " differ from std::stable_sort", OutMismatches);
+			}
+
+			// 명시적인 작업 수 (패킷 수가 작업 수로 나누어떨어지지 않는 경우)
+			Packets = Input;
+			FDrawPacketBuffer::SortPackets(Packets, Scratch, {11, true, 3});
+			Check(IsSameOrder(Packets, Expected), "Radix11 x3 tasks", std::to_string(NumPackets) +
+			      (bDrawKeys ? " draw keys" : " random keys") + " differ from std::stable_sort", OutMismatches);
+		}
+	}
+
+	for (int32 NumPackets = 1000; NumPackets <= InMaxPackets; NumPackets *= 10)
+	{
+		const int32 NumIterations = max(NumDrawPacketOperations / NumPackets, 3);
+
+		for (const bool bDrawKeys : {true, false})
+		{
+			MakeSortPackets(NumPackets, bDrawKeys, Input);
+			const FString Workload = "Sort x" + std::to_string(NumPackets) +
+				(bDrawKeys ? " draw keys" : " random keys");
+
+			double StableSortMilliseconds = 0.0;
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				Packets = Input;
+				StableSortMilliseconds += FBenchmark::MeasureMilliseconds([&] { StableSortPackets(Packets); });
+			}
+			StableSortMilliseconds /= NumIterations;
+
+			for (const FRadixSortVariant& Variant : Variants)
+			{
+				FBenchmarkResult Result{Workload, Variant.Name};
+				Result.BaselineMilliseconds = StableSortMilliseconds;
+				for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+				{
+					Packets = Input;
+					Result.EngineMilliseconds += FBenchmark::MeasureMilliseconds([&]
+					{
+						FDrawPacketBuffer::SortPackets(Packets, Scratch, Variant.Options);
+					});
+				}
+				Result.EngineMilliseconds /= NumIterations;
+				Results.Add(Result);
+			}
+		}
+
+		if (NumPackets > InMaxPackets / 10)
+		{
+			break;
+		}
+	}
+
+	return Results;
+}
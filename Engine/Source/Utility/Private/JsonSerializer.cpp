@@ -6,6 +6,63 @@
 
 using json::JSON;
 
+BEGIN_PROPERTY_TABLE(FPrimitiveMetadata)
+	PROPERTY_FLAGS(ID, EPropertyFlags::NoTextExport)
+	PROPERTY(Location)
+	PROPERTY(Rotation)
+	PROPERTY(Scale)
+	PROPERTY(Type)
+	PROPERTY(ObjStaticMeshAsset)
+END_PROPERTY_TABLE()
+
+BEGIN_PROPERTY_TABLE(FCameraMetadata)
+	PROPERTY(Location)
+	PROPERTY(Rotation)
+	PROPERTY(FOV)
+	PROPERTY(NearClip)
+	PROPERTY(FarClip)
+END_PROPERTY_TABLE()
+
+namespace
+{
+	/**
+	 * @brief 숫자 JSON 값을 float로 변환
+	 * 정수로 기록된 값도 허용한다
+	 */
+	float JsonToFloat(const JSON& InJsonData)
+	{
+		if (InJsonData.JSONType() == JSON::Class::Integral)
+		{
+			return static_cast<float>(InJsonData.ToInt());
+		}
+
+		return static_cast<float>(InJsonData.ToFloat());
+	}
+
+	JSON FloatArrayToJson(const float* InValues, int32 InCount)
+	{
+		JSON ArrayJson = JSON::Make(JSON::Class::Array);
+		for (int32 i = 0; i < InCount; ++i)
+		{
+			ArrayJson.append(InValues[i]);
+		}
+		return ArrayJson;
+	}
+
+	void JsonToFloatArray(const JSON& InJsonData, float* OutValues, int32 InCount)
+	{
+		if (InJsonData.JSONType() != JSON::Class::Array || InJsonData.size() != InCount)
+		{
+			return;
+		}
+
+		for (int32 i = 0; i < InCount; ++i)
+		{
+			OutValues[i] = JsonToFloat(InJsonData.at(i));
+		}
+	}
+}
+
 /**
  * @brief FVector를 JSON으로 변환
  */
@@ -70,21 +127,121 @@ EPrimitiveType FJsonSerializer::StringToPrimitiveType(const FString& InTypeStrin
 }
 
 /**
- * @brief FPrimitiveMetadata를 JSON으로 변환
+ * @brief 프로퍼티 테이블을 순회하며 객체를 JSON Object에 기록
+ * Enum은 문자열 표현이 타입마다 다르므로 호출 측에서 처리하며, 빈 문자열은 기록하지 않는다
  */
-JSON FJsonSerializer::PrimitiveMetadataToJson(const FPrimitiveMetadata& InPrimitive)
+void FJsonSerializer::PropertiesToJson(const FPropertyTable& InTable, const void* InObject, JSON& OutJson)
 {
-	JSON PrimitiveJson;
-	PrimitiveJson["Location"] = VectorToJson(InPrimitive.Location);
-	PrimitiveJson["Rotation"] = VectorToJson(InPrimitive.Rotation);
-	PrimitiveJson["Scale"] = VectorToJson(InPrimitive.Scale);
-	PrimitiveJson["Type"] = PrimitiveTypeToWideString(InPrimitive.Type);
+	for (const FProperty& Property : InTable.GetProperties())
+	{
+		if (HasPropertyFlag(Property.Flags, EPropertyFlags::Transient) ||
+			HasPropertyFlag(Property.Flags, EPropertyFlags::NoTextExport))
+		{
+			continue;
+		}
+
+		switch (Property.Type)
+		{
+		case EPropertyType::Bool:
+			OutJson[Property.Name] = Property.GetValue<bool>(InObject);
+			break;
+		case EPropertyType::UInt8:
+			OutJson[Property.Name] = static_cast<int32>(Property.GetValue<uint8>(InObject));
+			break;
+		case EPropertyType::Int32:
+			OutJson[Property.Name] = Property.GetValue<int32>(InObject);
+			break;
+		case EPropertyType::UInt32:
+			OutJson[Property.Name] = Property.GetValue<uint32>(InObject);
+			break;
+		case EPropertyType::Float:
+			OutJson[Property.Name] = Property.GetValue<float>(InObject);
+			break;
+		case EPropertyType::Vector:
+			OutJson[Property.Name] = VectorToJson(Property.GetValue<FVector>(InObject));
+			break;
+		case EPropertyType::Vector2:
+			OutJson[Property.Name] = FloatArrayToJson(&Property.GetValue<FVector2>(InObject).X, 2);
+			break;
+		case EPropertyType::Vector4:
+			OutJson[Property.Name] = FloatArrayToJson(&Property.GetValue<FVector4>(InObject).X, 4);
+			break;
+		case EPropertyType::String:
+			if (!Property.GetValue<FString>(InObject).IsEmpty())
+			{
+				OutJson[Property.Name] = Property.GetValue<FString>(InObject);
+			}
+			break;
+		case EPropertyType::Enum:
+			break;
+		}
+	}
+}
 
-	if (InPrimitive.Type == EPrimitiveType::StaticMeshComp)
+/**
+ * @brief JSON Object에서 프로퍼티 테이블에 해당하는 값을 읽어 객체에 채움
+ * JSON에 없는 키는 객체의 기본값을 유지한다
+ */
+void FJsonSerializer::JsonToProperties(const JSON& InJsonData, const FPropertyTable& InTable, void* OutObject)
+{
+	if (InJsonData.JSONType() != JSON::Class::Object)
 	{
-		PrimitiveJson["ObjStaticMeshAsset"] = InPrimitive.ObjStaticMeshAsset;
+		return;
 	}
 
+	for (const FProperty& Property : InTable.GetProperties())
+	{
+		if (HasPropertyFlag(Property.Flags, EPropertyFlags::Transient) ||
+			HasPropertyFlag(Property.Flags, EPropertyFlags::NoTextExport) ||
+			!InJsonData.hasKey(Property.Name))
+		{
+			continue;
+		}
+
+		const JSON& ValueJson = InJsonData.at(Property.Name);
+		switch (Property.Type)
+		{
+		case EPropertyType::Bool:
+			Property.GetValue<bool>(OutObject) = ValueJson.ToBool();
+			break;
+		case EPropertyType::UInt8:
+			Property.GetValue<uint8>(OutObject) = static_cast<uint8>(ValueJson.ToInt());
+			break;
+		case EPropertyType::Int32:
+			Property.GetValue<int32>(OutObject) = static_cast<int32>(ValueJson.ToInt());
+			break;
+		case EPropertyType::UInt32:
+			Property.GetValue<uint32>(OutObject) = static_cast<uint32>(ValueJson.ToInt());
+			break;
+		case EPropertyType::Float:
+			Property.GetValue<float>(OutObject) = JsonToFloat(ValueJson);
+			break;
+		case EPropertyType::Vector:
+			Property.GetValue<FVector>(OutObject) = JsonToVector(ValueJson);
+			break;
+		case EPropertyType::Vector2:
+			JsonToFloatArray(ValueJson, &Property.GetValue<FVector2>(OutObject).X, 2);
+			break;
+		case EPropertyType::Vector4:
+			JsonToFloatArray(ValueJson, &Property.GetValue<FVector4>(OutObject).X, 4);
+			break;
+		case EPropertyType::String:
+			Property.GetValue<FString>(OutObject) = ValueJson.ToString();
+			break;
+		case EPropertyType::Enum:
+			break;
+		}
+	}
+}
+
+/**
+ * @brief FPrimitiveMetadata를 JSON으로 변환
+ */
+JSON FJsonSerializer::PrimitiveMetadataToJson(const FPrimitiveMetadata& InPrimitive)
+{
+	JSON PrimitiveJson;
+	PropertiesToJson(FPrimitiveMetadata::StaticPropertyTable(), &InPrimitive, PrimitiveJson);
+	PrimitiveJson["Type"] = PrimitiveTypeToWideString(InPrimitive.Type);
 	return PrimitiveJson;
 }
 
@@ -100,22 +257,12 @@ FPrimitiveMetadata FJsonSerializer::JsonToPrimitive(const JSON& InJsonData, uint
 	{
 		if (InJsonData.JSONType() == JSON::Class::Object)
 		{
-			const JSON& LocationJson = InJsonData.at("Location");
-			const JSON& RotationJson = InJsonData.at("Rotation");
-			const JSON& ScaleJson = InJsonData.at("Scale");
-			const JSON& TypeJson = InJsonData.at("Type");
-			PrimitiveMeta.Location = JsonToVector(LocationJson);
-			PrimitiveMeta.Rotation = JsonToVector(RotationJson);
-			PrimitiveMeta.Scale = JsonToVector(ScaleJson);
-			PrimitiveMeta.Type = StringToPrimitiveType(TypeJson.ToString());
-
-			if (PrimitiveMeta.Type == EPrimitiveType::StaticMeshComp && InJsonData.hasKey("ObjStaticMeshAsset"))
+			JsonToProperties(InJsonData, FPrimitiveMetadata::StaticPropertyTable(), &PrimitiveMeta);
+
+			if (InJsonData.hasKey("Type"))
 			{
-				PrimitiveMeta.ObjStaticMeshAsset = InJsonData.at("ObjStaticMeshAsset").ToString();
+				PrimitiveMeta.Type = StringToPrimitiveType(InJsonData.at("Type").ToString());
 			}
-
-			UE_LOG("LevelSerializer: JsonToPrimitive: ID: %d | Scale: (%.3f, %.3f, %.3f)",
-			       InID, PrimitiveMeta.Scale.X, PrimitiveMeta.Scale.Y, PrimitiveMeta.Scale.Z);
 		}
 	}
 	catch (const exception&)
@@ -132,11 +279,7 @@ FPrimitiveMetadata FJsonSerializer::JsonToPrimitive(const JSON& InJsonData, uint
 JSON FJsonSerializer::CameraMetadataToJson(const FCameraMetadata& InCamera)
 {
 	JSON CameraJson;
-	CameraJson["Location"] = VectorToJson(InCamera.Location);
-	CameraJson["Rotation"] = VectorToJson(InCamera.Rotation);
-	CameraJson["FOV"] = InCamera.FOV;
-	CameraJson["NearClip"] = InCamera.NearClip;
-	CameraJson["FarClip"] = InCamera.FarClip;
+	PropertiesToJson(FCameraMetadata::StaticPropertyTable(), &InCamera, CameraJson);
 	return CameraJson;
 }
 
@@ -149,29 +292,7 @@ FCameraMetadata FJsonSerializer::JsonToCameraMetadata(const JSON& InJsonData)
 
 	try
 	{
-		if (InJsonData.JSONType() == JSON::Class::Object)
-		{
-			if (InJsonData.hasKey("Location"))
-			{
-				CameraMeta.Location = JsonToVector(InJsonData.at("Location"));
-			}
-			if (InJsonData.hasKey("Rotation"))
-			{
-				CameraMeta.Rotation = JsonToVector(InJsonData.at("Rotation"));
-			}
-			if (InJsonData.hasKey("FOV"))
-			{
-				CameraMeta.FOV = static_cast<float>(InJsonData.at("FOV").ToFloat());
-			}
-			if (InJsonData.hasKey("NearClip"))
-			{
-				CameraMeta.NearClip = static_cast<float>(InJsonData.at("NearClip").ToFloat());
-			}
-			if (InJsonData.hasKey("FarClip"))
-			{
-				CameraMeta.FarClip = static_cast<float>(InJsonData.at("FarClip").ToFloat());
-			}
-		}
+		JsonToProperties(InJsonData, FCameraMetadata::StaticPropertyTable(), &CameraMeta);
 	}
 	catch (const exception&)
 	{
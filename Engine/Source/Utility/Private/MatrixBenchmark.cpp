@@ -0,0 +1,239 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Global/MatrixMath.h"
+
+#include <random>
+
+namespace
+{
+	volatile float GMatrixBenchmarkSink = 0.0f;
+
+	/**
+	 * @brief 행렬 하나로 측정값이 흔들리지 않도록 전체 입력을 여러 번 반복하는 횟수
+	 */
+	constexpr int32 NumMatrixOperations = 1000000;
+
+	/**
+	 * @brief 크기가 큰 성분(원근 투영 등)에서도 의미 있도록 상대 오차와 절대 오차 중 큰 쪽을 허용한다
+	 */
+	float GetMatrixError(const FMatrix& InExpected, const FMatrix& InActual)
+	{
+		float MaxError = 0.0f;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				const float Expected = InExpected.Data[Row][Column];
+				const float Difference = std::abs(Expected - InActual.Data[Row][Column]);
+				MaxError = max(MaxError, Difference / max(1.0f, std::abs(Expected)));
+			}
+		}
+		return MaxError;
+	}
+
+	float GetVectorError(const FVector4& InExpected, const FVector4& InActual)
+	{
+		const float Expected[4] = {InExpected.X, InExpected.Y, InExpected.Z, InExpected.W};
+		const float Actual[4] = {InActual.X, InActual.Y, InActual.Z, InActual.W};
+
+		float MaxError = 0.0f;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			MaxError = max(MaxError, std::abs(Expected[Index] - Actual[Index]) / max(1.0f, std::abs(Expected[Index])));
+		}
+		return MaxError;
+	}
+
+	/**
+	 * @brief 에디터에서 실제로 다루는 형태의 입력 생성
+	 * 짝수 번째는 S * R * T 모델 행렬, 홀수 번째는 View * Projection 행렬이다
+	 */
+	void MakeInputs(int32 InNumMatrices, TArray<FMatrix>& OutMatrices, TArray<FMatrix>& OutAffineMatrices,
+	                TArray<FVector4>& OutVectors)
+	{
+		std::mt19937 Random(0x47544C);
+		std::uniform_real_distribution<float> Location(-1000.0f, 1000.0f);
+		std::uniform_real_distribution<float> Rotation(-PI, PI);
+		std::uniform_real_distribution<float> Scale(0.1f, 10.0f);
+
+		OutMatrices.Reserve(InNumMatrices);
+		OutAffineMatrices.Reserve(InNumMatrices);
+		OutVectors.Reserve(InNumMatrices);
+
+		for (int32 Index = 0; Index < InNumMatrices; ++Index)
+		{
+			const FMatrix Model = FMatrix::GetModelMatrix(FVector(Location(Random), Location(Random), Location(Random)),
+			                                              FVector(Rotation(Random), Rotation(Random), Rotation(Random)),
+			                                              FVector(Scale(Random), Scale(Random), Scale(Random)));
+			OutAffineMatrices.Add(Model);
+
+			if (Index % 2 == 0)
+			{
+				OutMatrices.Add(Model);
+			}
+			else
+			{
+				const FVector Eye(Location(Random), Location(Random), Location(Random));
+				const FMatrix View = FMatrix::MatrixLookAtLH(Eye, FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f));
+				const FMatrix Projection = FMatrix::MatrixPerspectiveFovLH(PI / 3.0f, 16.0f / 9.0f, 1.0f, 10000.0f);
+				OutMatrices.Add(View * Projection);
+			}
+
+			OutVectors.Add(FVector4(Location(Random), Location(Random), Location(Random), 1.0f));
+		}
+	}
+
+	/**
+	 * @brief 스칼라 구현을 기준으로 선택된 구현의 결과를 대조하는 함수
+	 * Multiply / Transpose / Transform은 누적 순서가 같으므로 사실상 0이어야 하고,
+	 * 역행렬은 알고리즘이 달라 반올림 오차만큼의 차이를 허용한다
+	 */
+	void ValidateKernels(const TArray<FMatrix>& InMatrices, const TArray<FMatrix>& InAffineMatrices,
+	                     const TArray<FVector4>& InVectors, TArray<FString>& OutMismatches)
+	{
+		float MultiplyError = 0.0f;
+		float TransposeError = 0.0f;
+		float InverseError = 0.0f;
+		float InverseAffineError = 0.0f;
+		float TransformError = 0.0f;
+
+		for (int32 Index = 0; Index < InMatrices.Num(); ++Index)
+		{
+			const FMatrix& Matrix = InMatrices[Index];
+			const FMatrix& Affine = InAffineMatrices[Index];
+			const FMatrix& Other = InAffineMatrices[(Index + 1) % InAffineMatrices.Num()];
+
+			FMatrix Expected;
+			FMatrix Actual;
+
+			MatrixMath::Scalar::Multiply(Expected, Matrix, Other);
+			MatrixMath::Multiply(Actual, Matrix, Other);
+			MultiplyError = max(MultiplyError, GetMatrixError(Expected, Actual));
+
+			MatrixMath::Scalar::Transpose(Expected, Matrix);
+			MatrixMath::Transpose(Actual, Matrix);
+			TransposeError = max(TransposeError, GetMatrixError(Expected, Actual));
+
+			MatrixMath::Scalar::Inverse(Expected, Matrix);
+			MatrixMath::Inverse(Actual, Matrix);
+			InverseError = max(InverseError, GetMatrixError(Expected, Actual));
+
+			MatrixMath::Scalar::Inverse(Expected, Affine);
+			MatrixMath::InverseAffine(Actual, Affine);
+			InverseAffineError = max(InverseAffineError, GetMatrixError(Expected, Actual));
+
+			const FVector4 ExpectedVector = MatrixMath::Scalar::TransformVector4(InVectors[Index], Matrix);
+			const FVector4 ActualVector = MatrixMath::TransformVector4(InVectors[Index], Matrix);
+			TransformError = max(TransformError, GetVectorError(ExpectedVector, ActualVector));
+		}
+
+		FBenchmark::CheckTolerance("Multiply", MultiplyError, 1e-6f, OutMismatches);
+		FBenchmark::CheckTolerance("Transpose", TransposeError, 0.0f, OutMismatches);
+		FBenchmark::CheckTolerance("Inverse", InverseError, 1e-3f, OutMismatches);
+		FBenchmark::CheckTolerance("InverseAffine", InverseAffineError, 1e-3f, OutMismatches);
+		FBenchmark::CheckTolerance("TransformVector4", TransformError, 1e-6f, OutMismatches);
+	}
+
+	/**
+	 * @brief 행렬 배열 전체에 연산 하나를 NumMatrixOperations번 적용하는 시간을 재는 함수
+	 */
+	template <typename OperationType>
+	double MeasureMatrixOperation(const TArray<FMatrix>& InMatrices, OperationType InOperation)
+	{
+		const int32 NumMatrices = InMatrices.Num();
+		return FBenchmark::MeasureMilliseconds([&]
+		{
+			FMatrix Result;
+			float Sum = 0.0f;
+			for (int32 Operation = 0; Operation < NumMatrixOperations; ++Operation)
+			{
+				InOperation(Result, InMatrices[Operation % NumMatrices], InMatrices[(Operation + 1) % NumMatrices]);
+				Sum += Result.Data[Operation & 3][(Operation >> 2) & 3];
+			}
+			GMatrixBenchmarkSink = GMatrixBenchmarkSink + Sum;
+		});
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunMatrixBenchmarks(int32 InNumMatrices, TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumMatrices <= 1)
+	{
+		return Results;
+	}
+
+	TArray<FMatrix> Matrices;
+	TArray<FMatrix> AffineMatrices;
+	TArray<FVector4> Vectors;
+	MakeInputs(InNumMatrices, Matrices, AffineMatrices, Vectors);
+
+	ValidateKernels(Matrices, AffineMatrices, Vectors, OutMismatches);
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	const FString Workload = "FMatrix Scalar vs SSE x" + std::to_string(InNumMatrices);
+#else
+	const FString Workload = "FMatrix Scalar vs Scalar x" + std::to_string(InNumMatrices);
+#endif
+
+	FBenchmarkResult MultiplyResult{Workload, "Multiply"};
+	MultiplyResult.BaselineMilliseconds = MeasureMatrixOperation(Matrices, [](FMatrix& Out, const FMatrix& A, const FMatrix& B)
+	{
+		MatrixMath::Scalar::Multiply(Out, A, B);
+	});
+	MultiplyResult.EngineMilliseconds = MeasureMatrixOperation(Matrices, [](FMatrix& Out, const FMatrix& A, const FMatrix& B)
+	{
+		MatrixMath::Multiply(Out, A, B);
+	});
+	Results.Add(MultiplyResult);
+
+	FBenchmarkResult TransposeResult{Workload, "Transpose"};
+	TransposeResult.BaselineMilliseconds = MeasureMatrixOperation(Matrices, [](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		MatrixMath::Scalar::Transpose(Out, A);
+	});
+	TransposeResult.EngineMilliseconds = MeasureMatrixOperation(Matrices, [](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		MatrixMath::Transpose(Out, A);
+	});
+	Results.Add(TransposeResult);
+
+	FBenchmarkResult InverseResult{Workload, "Inverse"};
+	InverseResult.BaselineMilliseconds = MeasureMatrixOperation(Matrices, [](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		MatrixMath::Scalar::Inverse(Out, A);
+	});
+	InverseResult.EngineMilliseconds = MeasureMatrixOperation(Matrices, [](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		MatrixMath::Inverse(Out, A);
+	});
+	Results.Add(InverseResult);
+
+	// 아핀 역행렬의 기준은 기존에 모델 행렬에도 쓰이던 일반 역행렬
+	FBenchmarkResult InverseAffineResult{Workload, "InverseAffine"};
+	InverseAffineResult.BaselineMilliseconds = MeasureMatrixOperation(AffineMatrices, [](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		MatrixMath::Scalar::Inverse(Out, A);
+	});
+	InverseAffineResult.EngineMilliseconds = MeasureMatrixOperation(AffineMatrices, [](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		MatrixMath::InverseAffine(Out, A);
+	});
+	Results.Add(InverseAffineResult);
+
+	FBenchmarkResult TransformResult{Workload, "Transform"};
+	TransformResult.BaselineMilliseconds = MeasureMatrixOperation(Matrices, [&Vectors](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		const FVector4 Vector = MatrixMath::Scalar::TransformVector4(Vectors[0], A);
+		Out.Data[0][0] = Vector.X;
+	});
+	TransformResult.EngineMilliseconds = MeasureMatrixOperation(Matrices, [&Vectors](FMatrix& Out, const FMatrix& A, const FMatrix&)
+	{
+		const FVector4 Vector = MatrixMath::TransformVector4(Vectors[0], A);
+		Out.Data[0][0] = Vector.X;
+	});
+	Results.Add(TransformResult);
+
+	return Results;
+}
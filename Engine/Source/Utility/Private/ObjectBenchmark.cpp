@@ -0,0 +1,52 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Runtime/Core/Public/ObjectIterator.h"
+
+namespace
+{
+	/**
+	 * @brief 최적화로 측정 대상 연산이 제거되지 않도록 결과를 누적하는 변수
+	 */
+	volatile uint64 GObjectBenchmarkSink = 0;
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunObjectIteratorBenchmarks()
+{
+	TArray<FBenchmarkResult> Results;
+
+	// 씬 규모의 오브젝트 수에서도 측정 시간이 충분하도록 약 백만 번 순회
+	const int32 NumObjects = max(1, static_cast<int32>(GUObjectArray.Num()));
+	const int32 RepeatCount = max(1, 1000000 / NumObjects);
+
+	FBenchmarkResult Result{"GUObjectArray vs TObjectIterator<UObject> x" + std::to_string(NumObjects), "Iterate"};
+
+	Result.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		uint64 Count = 0;
+		for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+		{
+			for (int32 Index = 0; Index < GUObjectArray.Num(); ++Index)
+			{
+				Count += GUObjectArray[Index] ? 1 : 0;
+			}
+		}
+		GObjectBenchmarkSink = GObjectBenchmarkSink + Count;
+	});
+
+	Result.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		uint64 Count = 0;
+		for (int32 Repeat = 0; Repeat < RepeatCount; ++Repeat)
+		{
+			for (TObjectIterator<UObject> It; It; ++It)
+			{
+				++Count;
+			}
+		}
+		GObjectBenchmarkSink = GObjectBenchmarkSink + Count;
+	});
+
+	Results.Add(Result);
+	return Results;
+}
@@ -0,0 +1,243 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Runtime/Renderer/Public/SoftwareOcclusion.h"
+
+#include <random>
+
+namespace
+{
+	volatile int32 GOcclusionBenchmarkSink = 0;
+
+	constexpr int32 NumRasterizeIterations = 20;
+
+	/**
+	 * @brief 원점에서 +X 방향을 바라보는 원근 뷰 (Y가 오른쪽, Z가 위)
+	 * @return Projection * View (열 벡터 규약)
+	 */
+	FMatrix MakeViewProjection(float InFovDegrees, float InAspectRatio)
+	{
+		FMatrix ViewMatrix = FMatrix::Identity();
+		const FVector Axes[3] = {FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f), FVector(1.0f, 0.0f, 0.0f)};
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			ViewMatrix.Data[Row][0] = Axes[Row].X;
+			ViewMatrix.Data[Row][1] = Axes[Row].Y;
+			ViewMatrix.Data[Row][2] = Axes[Row].Z;
+			ViewMatrix.Data[Row][3] = 0.0f;
+		}
+
+		return FMatrix::MatrixPerspectiveFovLH(FVector::GetDegreeToRadian(InFovDegrees), InAspectRatio, 1.0f, 1000.0f) *
+			ViewMatrix;
+	}
+
+	/**
+	 * @brief 클립 좌표로 옮긴 점의 Z / W (D3D 깊이)
+	 */
+	float GetClipDepth(const FMatrix& InViewProjection, const FVector& InPoint)
+	{
+		float Clip[4];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			const float* M = InViewProjection.Data[Row];
+			Clip[Row] = M[0] * InPoint.X + M[1] * InPoint.Y + M[2] * InPoint.Z + M[3];
+		}
+		return Clip[2] / Clip[3];
+	}
+
+	/**
+	 * @brief 카메라 앞쪽의 건물처럼 큰 상자 (일부는 화면 가장자리에 걸침)
+	 */
+	void MakeOccluders(int32 InNumOccluders, TArray<FAABB>& OutOccluders)
+	{
+		std::mt19937 Random(0x4F4343);
+		std::uniform_real_distribution<float> Distance(15.0f, 60.0f);
+		std::uniform_real_distribution<float> Side(-40.0f, 40.0f);
+		std::uniform_real_distribution<float> HalfWidth(2.0f, 10.0f);
+		std::uniform_real_distribution<float> Height(5.0f, 30.0f);
+
+		OutOccluders.Empty(InNumOccluders);
+		for (int32 Index = 0; Index < InNumOccluders; ++Index)
+		{
+			const FVector Center(Distance(Random), Side(Random), -10.0f);
+			const FVector HalfSize(HalfWidth(Random), HalfWidth(Random), 0.0f);
+			OutOccluders.Add(FAABB(Center - HalfSize, Center + HalfSize + FVector(0.0f, 0.0f, Height(Random))));
+		}
+	}
+
+	/**
+	 * @brief 가림체 사이와 뒤쪽에 흩어진 작은 상자
+	 */
+	void MakeOccludees(int32 InNumOccludees, TArray<FAABB>& OutOccludees)
+	{
+		std::mt19937 Random(0x4F4545);
+		std::uniform_real_distribution<float> Distance(5.0f, 400.0f);
+		std::uniform_real_distribution<float> Side(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> Extent(0.5f, 6.0f);
+
+		OutOccludees.Empty(InNumOccludees);
+		for (int32 Index = 0; Index < InNumOccludees; ++Index)
+		{
+			const float X = Distance(Random);
+			const FVector Center(X, Side(Random) * X * 0.9f, -10.0f + (Side(Random) + 1.0f) * X * 0.3f);
+			const FVector HalfSize(Extent(Random), Extent(Random), Extent(Random));
+			OutOccludees.Add(FAABB(Center - HalfSize, Center + HalfSize));
+		}
+	}
+
+	void AddOccluderBoxes(FSoftwareOcclusionBuffer& InBuffer, const FMatrix& InViewProjection,
+	                      const TArray<FAABB>& InOccluders)
+	{
+		InBuffer.BeginFrame(InViewProjection);
+		for (const FAABB& Occluder : InOccluders)
+		{
+			InBuffer.AddOccluderBox(Occluder);
+		}
+	}
+
+	/**
+	 * @brief 정해진 배치에서 래스터화 깊이와 판정 결과를 확인하는 함수
+	 * 화면 가운데를 가리는 벽 하나를 두고, 벽 뒤 / 앞 / 옆으로 삐져나온 상자 / 근평면에 걸친 상자를 판정한다
+	 */
+	void ValidateScriptedCases(const FMatrix& InViewProjection, TArray<FString>& OutMismatches)
+	{
+		FSoftwareOcclusionBuffer Buffer;
+		Buffer.BeginFrame(InViewProjection);
+
+		// X = 20에 선 넓은 벽 (앞면이 카메라를 향함)
+		const FAABB Wall(FVector(20.0f, -10.0f, -6.0f), FVector(21.0f, 10.0f, 6.0f));
+		if (!FBenchmark::Check(Buffer.AddOccluderBox(Wall) > 0, "Scripted", "wall produced no triangles", OutMismatches))
+		{
+			return;
+		}
+		Buffer.Rasterize();
+
+		const int32 CenterX = Buffer.GetWidth() / 2;
+		const int32 CenterY = Buffer.GetHeight() / 2;
+		const float ExpectedDepth = GetClipDepth(InViewProjection, FVector(20.0f, 0.0f, 0.0f));
+		FBenchmark::CheckTolerance("Scripted: wall depth", std::abs(Buffer.GetDepth(CenterX, CenterY) - ExpectedDepth),
+		                           1e-5f, OutMismatches);
+		FBenchmark::Check(Buffer.GetDepth(0, 0) == 1.0f, "Scripted", "pixel outside the wall was written", OutMismatches);
+
+		struct FCase
+		{
+			const char* Name;
+			FAABB Bounds;
+			bool bExpectedOccluded;
+		};
+
+		const FCase Cases[] = {
+			{"behind wall", FAABB(FVector(40.0f, -2.0f, -2.0f), FVector(42.0f, 2.0f, 2.0f)), true},
+			{"in front of wall", FAABB(FVector(10.0f, -1.0f, -1.0f), FVector(12.0f, 1.0f, 1.0f)), false},
+			{"touching wall", FAABB(FVector(21.0f, -1.0f, -1.0f), FVector(23.0f, 1.0f, 1.0f)), false},
+			{"sticking out sideways", FAABB(FVector(40.0f, 15.0f, -1.0f), FVector(42.0f, 25.0f, 1.0f)), false},
+			{"crossing near plane", FAABB(FVector(-1.0f, -1.0f, -1.0f), FVector(30.0f, 1.0f, 1.0f)), false},
+			{"behind camera", FAABB(FVector(-30.0f, -1.0f, -1.0f), FVector(-28.0f, 1.0f, 1.0f)), false},
+		};
+
+		for (const FCase& Case : Cases)
+		{
+			FBenchmark::Check(Buffer.IsOccluded(Case.Bounds) == Case.bExpectedOccluded, "Scripted",
+			                  FString("box ") + Case.Name + (Case.bExpectedOccluded ? " should be occluded" : " should be visible"),
+			                  OutMismatches);
+		}
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunOcclusionBenchmarks(int32 InNumOccluders, int32 InNumOccludees,
+                                                            TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+
+	const FMatrix ViewProjection = MakeViewProjection(90.0f, 16.0f / 9.0f);
+	ValidateScriptedCases(ViewProjection, OutMismatches);
+
+	TArray<FAABB> Occluders;
+	TArray<FAABB> Occludees;
+	MakeOccluders(max(InNumOccluders, 1), Occluders);
+	MakeOccludees(max(InNumOccludees, 1), Occludees);
+
+	// SIMD / 띠 병렬 래스터화는 픽셀별 스칼라 래스터화와 깊이가 같아야 함
+	FSoftwareOcclusionBuffer ReferenceBuffer;
+	AddOccluderBoxes(ReferenceBuffer, ViewProjection, Occluders);
+	ReferenceBuffer.RasterizeReference();
+
+	FSoftwareOcclusionBuffer Buffer;
+	AddOccluderBoxes(Buffer, ViewProjection, Occluders);
+	Buffer.Rasterize();
+
+	int32 NumDepthMismatches = 0;
+	for (int32 Y = 0; Y < Buffer.GetHeight(); ++Y)
+	{
+		for (int32 X = 0; X < Buffer.GetWidth(); ++X)
+		{
+			NumDepthMismatches += Buffer.GetDepth(X, Y) != ReferenceBuffer.GetDepth(X, Y);
+		}
+	}
+	CheckCount("Rasterize", NumDepthMismatches, "pixels differ from scalar reference", OutMismatches);
+
+	// HiZ 판정은 최고 해상도 판정보다 보수적이어야 함 (HiZ가 가렸다면 픽셀 판정도 가림)
+	TArray<uint8> Visibility;
+	const int32 NumOccluded = Buffer.TestOccludees(Occludees, Visibility);
+	int32 NumReferenceOccluded = 0;
+	int32 NumFalseOcclusions = 0;
+	for (int32 Index = 0; Index < Occludees.Num(); ++Index)
+	{
+		const bool bReferenceOccluded = Buffer.IsOccludedReference(Occludees[Index]);
+		NumReferenceOccluded += bReferenceOccluded;
+		if (!Visibility[Index] && !bReferenceOccluded)
+		{
+			++NumFalseOcclusions;
+		}
+	}
+	CheckCount("HiZ", NumFalseOcclusions, "boxes occluded without full-resolution support", OutMismatches);
+
+	const FString Resolution = std::to_string(Buffer.GetWidth()) + "x" + std::to_string(Buffer.GetHeight());
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	const FString RasterizeWorkload = "Occluders " + Resolution + " SSE x" + std::to_string(Buffer.GetNumTriangles()) +
+		" tris";
+#else
+	const FString RasterizeWorkload = "Occluders " + Resolution + " Scalar x" +
+		std::to_string(Buffer.GetNumTriangles()) + " tris";
+#endif
+
+	FBenchmarkResult RasterizeResult{RasterizeWorkload, "Rasterize"};
+	RasterizeResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		for (int32 Iteration = 0; Iteration < NumRasterizeIterations; ++Iteration)
+		{
+			AddOccluderBoxes(ReferenceBuffer, ViewProjection, Occluders);
+			ReferenceBuffer.RasterizeReference();
+		}
+	}) / NumRasterizeIterations;
+	RasterizeResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		for (int32 Iteration = 0; Iteration < NumRasterizeIterations; ++Iteration)
+		{
+			AddOccluderBoxes(Buffer, ViewProjection, Occluders);
+			Buffer.Rasterize();
+		}
+	}) / NumRasterizeIterations;
+	Results.Add(RasterizeResult);
+
+	const FString TestWorkload = "Occludees x" + std::to_string(Occludees.Num()) + " (" +
+		std::to_string(NumOccluded) + " HiZ / " + std::to_string(NumReferenceOccluded) + " full-res occluded)";
+	FBenchmarkResult TestResult{TestWorkload, "Test"};
+	TestResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		int32 Sum = 0;
+		for (const FAABB& Occludee : Occludees)
+		{
+			Sum += Buffer.IsOccludedReference(Occludee);
+		}
+		GOcclusionBenchmarkSink = GOcclusionBenchmarkSink + Sum;
+	});
+	TestResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		GOcclusionBenchmarkSink = GOcclusionBenchmarkSink + Buffer.TestOccludees(Occludees, Visibility);
+	});
+	Results.Add(TestResult);
+
+	return Results;
+}
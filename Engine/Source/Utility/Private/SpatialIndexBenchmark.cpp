@@ -0,0 +1,461 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Physics/Public/DynamicAABBTree.h"
+#include "Utility/Public/JsonSerializer.h"
+#include "Utility/Public/Metadata.h"
+
+#include <random>
+
+namespace
+{
+	volatile int32 GSpatialBenchmarkSink = 0;
+
+	/**
+	 * @brief 질의 종류마다 측정하는 질의 수
+	 */
+	constexpr int32 NumQueriesPerKind = 256;
+
+	/**
+	 * @brief 씬 파일의 프리미티브에 쓰는 로컬 범위 (메시를 읽지 않으므로 단위 상자로 대신함)
+	 */
+	constexpr float SceneLocalHalfSize = 0.5f;
+
+	constexpr float RayLength = 10000.0f;
+
+	bool Overlaps(const FAABB& InA, const FAABB& InB)
+	{
+		return InA.Min.X <= InB.Max.X && InA.Max.X >= InB.Min.X &&
+			InA.Min.Y <= InB.Max.Y && InA.Max.Y >= InB.Min.Y &&
+			InA.Min.Z <= InB.Max.Z && InA.Max.Z >= InB.Min.Z;
+	}
+
+	bool Overlaps(const FBoundingSphere& InSphere, const FAABB& InBox)
+	{
+		const float DX = max(max(InBox.Min.X - InSphere.Center.X, 0.0f), InSphere.Center.X - InBox.Max.X);
+		const float DY = max(max(InBox.Min.Y - InSphere.Center.Y, 0.0f), InSphere.Center.Y - InBox.Max.Y);
+		const float DZ = max(max(InBox.Min.Z - InSphere.Center.Z, 0.0f), InSphere.Center.Z - InBox.Max.Z);
+		return DX * DX + DY * DY + DZ * DZ <= InSphere.Radius * InSphere.Radius;
+	}
+
+	/**
+	 * @brief InLocation에서 InTarget을 바라보는 원근 뷰
+	 * @return Projection * View (열 벡터 규약)
+	 */
+	FMatrix MakeViewProjection(const FVector& InLocation, const FVector& InTarget, float InFovDegrees, float InFarZ)
+	{
+		FVector Forward = InTarget - InLocation;
+		Forward.Normalize();
+		const FVector WorldUp = std::abs(Forward.Z) > 0.99f ? FVector(1.0f, 0.0f, 0.0f) : FVector(0.0f, 0.0f, 1.0f);
+		FVector Right = WorldUp.Cross(Forward);
+		Right.Normalize();
+		const FVector Up = Forward.Cross(Right);
+
+		FMatrix ViewMatrix = FMatrix::Identity();
+		const FVector Axes[3] = {Right, Up, Forward};
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			ViewMatrix.Data[Row][0] = Axes[Row].X;
+			ViewMatrix.Data[Row][1] = Axes[Row].Y;
+			ViewMatrix.Data[Row][2] = Axes[Row].Z;
+			ViewMatrix.Data[Row][3] = -Axes[Row].Dot(InLocation);
+		}
+
+		return FMatrix::MatrixPerspectiveFovLH(FVector::GetDegreeToRadian(InFovDegrees), 16.0f / 9.0f, 0.1f, InFarZ) *
+			ViewMatrix;
+	}
+
+	/**
+	 * @brief 벤치마크 한 세트의 입력 (프리미티브 범위와 질의 목록)
+	 */
+	struct FSpatialWorkload
+	{
+		FString Name;
+		TArray<FAABB> Bounds;
+		FAABB WorldBounds;
+
+		TArray<FFrustum> Frustums;
+		TArray<FAABB> Boxes;
+		TArray<FBoundingSphere> Spheres;
+		TArray<TPair<FVector, FVector>> Rays;
+	};
+
+	/**
+	 * @brief DefaultPUBG_mini.scene의 프리미티브 위치 / 스케일로 월드 AABB를 만드는 함수
+	 * @return 씬 파일을 읽지 못하면 false
+	 */
+	bool LoadSceneBounds(TArray<FAABB>& OutBounds)
+	{
+		FLevelMetadata Metadata;
+		const FString ScenePath = (FPaths::GetContentPath() / "Scene" / "DefaultPUBG_mini.scene").string();
+		if (!FJsonSerializer::LoadLevelFromFile(Metadata, ScenePath))
+		{
+			return false;
+		}
+
+		OutBounds.Empty(static_cast<int32>(Metadata.Primitives.Num()));
+		for (const auto& Pair : Metadata.Primitives)
+		{
+			const FPrimitiveMetadata& Primitive = Pair.second;
+			const FVector HalfSize(std::abs(Primitive.Scale.X) * SceneLocalHalfSize,
+			                       std::abs(Primitive.Scale.Y) * SceneLocalHalfSize,
+			                       std::abs(Primitive.Scale.Z) * SceneLocalHalfSize);
+			OutBounds.Add(FAABB(Primitive.Location - HalfSize, Primitive.Location + HalfSize));
+		}
+
+		return !OutBounds.IsEmpty();
+	}
+
+	/**
+	 * @brief 넓은 평면 위에 흩어진 크기가 다양한 프리미티브 (오픈 월드 배치를 흉내냄)
+	 */
+	void MakeSyntheticBounds(int32 InNumBounds, TArray<FAABB>& OutBounds)
+	{
+		std::mt19937 Random(0x535041);
+		const float HalfWorldSize = std::sqrt(static_cast<float>(InNumBounds)) * 2.0f;
+		std::uniform_real_distribution<float> Location(-HalfWorldSize, HalfWorldSize);
+		std::uniform_real_distribution<float> Height(0.0f, 20.0f);
+		std::uniform_real_distribution<float> Extent(0.5f, 3.0f);
+
+		OutBounds.Empty(InNumBounds);
+		for (int32 Index = 0; Index < InNumBounds; ++Index)
+		{
+			const FVector Center(Location(Random), Location(Random), Height(Random));
+			const FVector HalfSize(Extent(Random), Extent(Random), Extent(Random));
+			OutBounds.Add(FAABB(Center - HalfSize, Center + HalfSize));
+		}
+	}
+
+	/**
+	 * @brief 월드 범위 안팎의 카메라 / 영역 / 광선을 무작위로 만드는 함수
+	 * 절두체는 월드 크기에 비례하는 Far 평면을 써서 일부만 보이도록 한다
+	 */
+	void MakeQueries(FSpatialWorkload& InOutWorkload)
+	{
+		FAABB& World = InOutWorkload.WorldBounds;
+		World = InOutWorkload.Bounds[0];
+		for (const FAABB& Box : InOutWorkload.Bounds)
+		{
+			World.Min = FVector(min(World.Min.X, Box.Min.X), min(World.Min.Y, Box.Min.Y), min(World.Min.Z, Box.Min.Z));
+			World.Max = FVector(max(World.Max.X, Box.Max.X), max(World.Max.Y, Box.Max.Y), max(World.Max.Z, Box.Max.Z));
+		}
+
+		const FVector WorldSize = World.Max - World.Min;
+		const float WorldLength = max(WorldSize.X, WorldSize.Y);
+
+		std::mt19937 Random(0x515259);
+		std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+		auto RandomPoint = [&](float InPadding)
+		{
+			return FVector(World.Min.X - InPadding + (WorldSize.X + 2.0f * InPadding) * Unit(Random),
+			               World.Min.Y - InPadding + (WorldSize.Y + 2.0f * InPadding) * Unit(Random),
+			               World.Min.Z + WorldSize.Z * Unit(Random));
+		};
+
+		for (int32 Query = 0; Query < NumQueriesPerKind; ++Query)
+		{
+			// 카메라는 월드 위쪽에서 월드 안의 한 점을 내려다봄
+			FVector CameraLocation = RandomPoint(WorldLength * 0.1f);
+			CameraLocation.Z = World.Max.Z + WorldLength * 0.05f * (1.0f + Unit(Random));
+			InOutWorkload.Frustums.Add(FFrustum(MakeViewProjection(CameraLocation, RandomPoint(0.0f), 60.0f,
+			                                                       WorldLength * 0.25f)));
+
+			const FVector BoxCenter = RandomPoint(0.0f);
+			const FVector BoxHalfSize(WorldLength * 0.02f, WorldLength * 0.02f, WorldSize.Z);
+			InOutWorkload.Boxes.Add(FAABB(BoxCenter - BoxHalfSize, BoxCenter + BoxHalfSize));
+
+			FBoundingSphere Sphere;
+			Sphere.Center = RandomPoint(0.0f);
+			Sphere.Radius = WorldLength * 0.03f;
+			InOutWorkload.Spheres.Add(Sphere);
+
+			// 피킹처럼 위쪽에서 비스듬히 월드 안으로 쏘는 광선
+			FVector RayOrigin = RandomPoint(0.0f);
+			RayOrigin.Z = World.Max.Z + WorldLength * 0.1f;
+			FVector RayDirection = RandomPoint(0.0f) - RayOrigin;
+			RayDirection.Normalize();
+			InOutWorkload.Rays.Add({RayOrigin, RayDirection});
+		}
+	}
+
+	FVector GetInvDirection(const FVector& InDirection)
+	{
+		constexpr float LargeValue = 1e30f;
+		return FVector(InDirection.X != 0.0f ? 1.0f / InDirection.X : LargeValue,
+		               InDirection.Y != 0.0f ? 1.0f / InDirection.Y : LargeValue,
+		               InDirection.Z != 0.0f ? 1.0f / InDirection.Z : LargeValue);
+	}
+
+	/**
+	 * @brief 질의 하나를 전체 순회와 트리로 각각 수행하는 함수 묶음
+	 * 트리 결과는 Fat AABB 후보를 실제 범위로 다시 판정하므로 전체 순회와 같은 집합이어야 한다
+	 */
+	struct FQueryKind
+	{
+		FString Operation;
+		std::function<void(int32, TArray<int32>&)> Linear;
+		std::function<void(int32, TArray<int32>&)> Tree;
+	};
+
+	void RunWorkload(FSpatialWorkload& InWorkload, TArray<FBenchmarkResult>& OutResults, TArray<FString>& OutMismatches)
+	{
+		const TArray<FAABB>& Bounds = InWorkload.Bounds;
+		const int32 NumBounds = Bounds.Num();
+
+		FDynamicAABBTree Tree;
+		TArray<int32> ProxyIds;
+		ProxyIds.Reserve(NumBounds);
+		const double BuildMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Index = 0; Index < NumBounds; ++Index)
+			{
+				ProxyIds.Add(Tree.CreateProxy(Bounds[Index], reinterpret_cast<void*>(static_cast<intptr_t>(Index))));
+			}
+		});
+
+		auto GetIndex = [&Tree](int32 InProxyId)
+		{
+			return static_cast<int32>(reinterpret_cast<intptr_t>(Tree.GetUserData(InProxyId)));
+		};
+
+		const TArray<FQueryKind> Kinds = {
+			{
+				"Frustum",
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					const FFrustum& Frustum = InWorkload.Frustums[InQuery];
+					for (int32 Index = 0; Index < NumBounds; ++Index)
+					{
+						if (Frustum.IntersectsAABB(Bounds[Index]))
+						{
+							OutHits.Add(Index);
+						}
+					}
+				},
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					const FFrustum& Frustum = InWorkload.Frustums[InQuery];
+					Tree.QueryFrustum(Frustum, [&](int32 InProxyId)
+					{
+						const int32 Index = GetIndex(InProxyId);
+						if (Frustum.IntersectsAABB(Bounds[Index]))
+						{
+							OutHits.Add(Index);
+						}
+						return true;
+					});
+				}
+			},
+			{
+				"AABB",
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					for (int32 Index = 0; Index < NumBounds; ++Index)
+					{
+						if (Overlaps(InWorkload.Boxes[InQuery], Bounds[Index]))
+						{
+							OutHits.Add(Index);
+						}
+					}
+				},
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					Tree.QueryAABB(InWorkload.Boxes[InQuery], [&](int32 InProxyId)
+					{
+						const int32 Index = GetIndex(InProxyId);
+						if (Overlaps(InWorkload.Boxes[InQuery], Bounds[Index]))
+						{
+							OutHits.Add(Index);
+						}
+						return true;
+					});
+				}
+			},
+			{
+				"Sphere",
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					for (int32 Index = 0; Index < NumBounds; ++Index)
+					{
+						if (Overlaps(InWorkload.Spheres[InQuery], Bounds[Index]))
+						{
+							OutHits.Add(Index);
+						}
+					}
+				},
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					Tree.QuerySphere(InWorkload.Spheres[InQuery], [&](int32 InProxyId)
+					{
+						const int32 Index = GetIndex(InProxyId);
+						if (Overlaps(InWorkload.Spheres[InQuery], Bounds[Index]))
+						{
+							OutHits.Add(Index);
+						}
+						return true;
+					});
+				}
+			},
+			{
+				"Ray",
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					const FVector& Origin = InWorkload.Rays[InQuery].first;
+					const FVector InvDirection = GetInvDirection(InWorkload.Rays[InQuery].second);
+					for (int32 Index = 0; Index < NumBounds; ++Index)
+					{
+						float Distance = 0.0f;
+						if (FDynamicAABBTree::IntersectsRay(Origin, InvDirection, RayLength, Bounds[Index].Min,
+						                                    Bounds[Index].Max, Distance))
+						{
+							OutHits.Add(Index);
+						}
+					}
+				},
+				[&](int32 InQuery, TArray<int32>& OutHits)
+				{
+					const FVector& Origin = InWorkload.Rays[InQuery].first;
+					const FVector& Direction = InWorkload.Rays[InQuery].second;
+					const FVector InvDirection = GetInvDirection(Direction);
+					Tree.RayCast(Origin, Direction, RayLength, [&](int32 InProxyId, float)
+					{
+						const int32 Index = GetIndex(InProxyId);
+						float Distance = 0.0f;
+						if (FDynamicAABBTree::IntersectsRay(Origin, InvDirection, RayLength, Bounds[Index].Min,
+						                                    Bounds[Index].Max, Distance))
+						{
+							OutHits.Add(Index);
+						}
+						return true;
+					});
+				}
+			},
+		};
+
+		auto ValidateQueries = [&](const FString& InStage)
+		{
+			TArray<int32> LinearHits;
+			TArray<int32> TreeHits;
+			for (const FQueryKind& Kind : Kinds)
+			{
+				int32 NumDifferent = 0;
+				for (int32 Query = 0; Query < NumQueriesPerKind; ++Query)
+				{
+					LinearHits.Reset();
+					TreeHits.Reset();
+					Kind.Linear(Query, LinearHits);
+					Kind.Tree(Query, TreeHits);
+					std::sort(TreeHits.begin(), TreeHits.end());
+					NumDifferent += LinearHits != TreeHits;
+				}
+
+				FBenchmark::CheckCount(InWorkload.Name + " " + InStage + " " + Kind.Operation, NumDifferent,
+				                       "queries differ from linear scan", OutMismatches);
+			}
+
+			FBenchmark::Check(Tree.Validate(), InWorkload.Name + " " + InStage, "tree structure is invalid",
+			                  OutMismatches);
+		};
+
+		ValidateQueries("Build");
+
+		const FString Workload = InWorkload.Name + " x" + std::to_string(NumBounds) + " (height " +
+			std::to_string(Tree.GetHeight()) + ", " + std::to_string(NumQueriesPerKind) + " queries)";
+
+		TArray<int32> Hits;
+		for (const FQueryKind& Kind : Kinds)
+		{
+			FBenchmarkResult Result{Workload, Kind.Operation};
+			Result.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+			{
+				int32 Sum = 0;
+				for (int32 Query = 0; Query < NumQueriesPerKind; ++Query)
+				{
+					Hits.Reset();
+					Kind.Linear(Query, Hits);
+					Sum += Hits.Num();
+				}
+				GSpatialBenchmarkSink = GSpatialBenchmarkSink + Sum;
+			});
+			Result.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+			{
+				int32 Sum = 0;
+				for (int32 Query = 0; Query < NumQueriesPerKind; ++Query)
+				{
+					Hits.Reset();
+					Kind.Tree(Query, Hits);
+					Sum += Hits.Num();
+				}
+				GSpatialBenchmarkSink = GSpatialBenchmarkSink + Sum;
+			});
+			OutResults.Add(Result);
+		}
+
+		// 프레임마다 일부가 조금씩 움직이는 상황: 대부분 Fat AABB 안에 머물러 트리를 건드리지 않음
+		std::mt19937 Random(0x4D4F56);
+		std::uniform_int_distribution<int32> Pick(0, NumBounds - 1);
+		std::uniform_real_distribution<float> Step(-0.05f, 0.05f);
+		const int32 NumMovesPerFrame = max(NumBounds / 10, 1);
+		constexpr int32 NumFrames = 16;
+
+		int32 NumReinserted = 0;
+		FBenchmarkResult MoveResult{Workload, "Move"};
+		MoveResult.BaselineMilliseconds = BuildMilliseconds;
+		MoveResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+		{
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				for (int32 Move = 0; Move < NumMovesPerFrame; ++Move)
+				{
+					const int32 Index = Pick(Random);
+					const FVector Offset(Step(Random), Step(Random), Step(Random));
+					InWorkload.Bounds[Index] = FAABB(Bounds[Index].Min + Offset, Bounds[Index].Max + Offset);
+					NumReinserted += Tree.MoveProxy(ProxyIds[Index], Bounds[Index]);
+				}
+			}
+		}) / NumFrames;
+		MoveResult.Operation = "Move " + std::to_string(NumMovesPerFrame) + "/frame (" +
+			std::to_string(NumReinserted * 100 / (NumMovesPerFrame * NumFrames)) + "% reinserted)";
+		OutResults.Add(MoveResult);
+
+		// 제거 후 다시 추가
+		for (int32 Index = 0; Index < NumBounds; Index += 3)
+		{
+			Tree.DestroyProxy(ProxyIds[Index]);
+		}
+		for (int32 Index = 0; Index < NumBounds; Index += 3)
+		{
+			ProxyIds[Index] = Tree.CreateProxy(Bounds[Index], reinterpret_cast<void*>(static_cast<intptr_t>(Index)));
+		}
+
+		ValidateQueries("Update");
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunSpatialIndexBenchmarks(int32 InNumSyntheticBounds, TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+
+	FSpatialWorkload SceneWorkload;
+	SceneWorkload.Name = "DefaultPUBG_mini";
+	if (LoadSceneBounds(SceneWorkload.Bounds))
+	{
+		MakeQueries(SceneWorkload);
+		RunWorkload(SceneWorkload, Results, OutMismatches);
+	}
+	else
+	{
+		Check(false, "DefaultPUBG_mini.scene", "could not be loaded", OutMismatches);
+	}
+
+	if (InNumSyntheticBounds > 0)
+	{
+		FSpatialWorkload SyntheticWorkload;
+		SyntheticWorkload.Name = "Synthetic";
+		MakeSyntheticBounds(InNumSyntheticBounds, SyntheticWorkload.Bounds);
+		MakeQueries(SyntheticWorkload);
+		RunWorkload(SyntheticWorkload, Results, OutMismatches);
+	}
+
+	return Results;
+}
@@ -0,0 +1,683 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Runtime/RHI/Public/RHIPipelineState.h"
+
+#include <random>
+
+namespace
+{
+	volatile int64 GStateCacheBenchmarkSink = 0;
+
+	constexpr int32 NumStateCacheOperations = 1000000;
+
+	/**
+	 * @brief 측정용 가짜 D3D11 객체 포인터 (역참조하지 않으므로 값만 서로 다르면 됨)
+	 */
+	template <typename T>
+	T* MakeHandle(uint32 InKind, uint32 InIndex)
+	{
+		return reinterpret_cast<T*>((static_cast<uintptr_t>(InKind) << 24 | (InIndex + 1)) << 4);
+	}
+
+	constexpr uint8 NumStages = static_cast<uint8>(ERHIShaderStage::Num);
+
+	/**
+	 * @brief 기록 백엔드가 유지하는 "디바이스에 실제로 바인딩된" 상태
+	 */
+	struct FRecordedState
+	{
+		ID3D11VertexShader* VertexShader = nullptr;
+		ID3D11PixelShader* PixelShader = nullptr;
+		ID3D11InputLayout* InputLayout = nullptr;
+		D3D11_PRIMITIVE_TOPOLOGY Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+		ID3D11Buffer* VertexBuffer = nullptr;
+		uint32 VertexStride = 0;
+		uint32 VertexOffset = 0;
+		ID3D11Buffer* IndexBuffer = nullptr;
+		DXGI_FORMAT IndexFormat = DXGI_FORMAT_UNKNOWN;
+		uint32 IndexOffset = 0;
+		ID3D11RasterizerState* RasterizerState = nullptr;
+		ID3D11DepthStencilState* DepthStencilState = nullptr;
+		uint32 StencilRef = 0;
+		ID3D11BlendState* BlendState = nullptr;
+		float BlendFactor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+		uint32 SampleMask = 0xFFFFFFFF;
+		ID3D11ShaderResourceView* ShaderResources[NumStages][FRHIStateCache::MaxShaderResources] = {};
+		ID3D11SamplerState* Samplers[NumStages][FRHIStateCache::MaxSamplers] = {};
+		ID3D11Buffer* ConstantBuffers[NumStages][FRHIStateCache::MaxConstantBuffers] = {};
+
+		bool operator==(const FRecordedState& InOther) const = default;
+	};
+
+	/**
+	 * @brief 전달받은 바인딩을 D3D11 대신 상태 구조체에 적용하고 호출 수를 세는 백엔드
+	 */
+	class FRecordingStateBackend :
+		public IRHIStateBackend
+	{
+	public:
+		void SetVertexShader(ID3D11VertexShader* InShader) override
+		{
+			State.VertexShader = InShader;
+			++NumCalls;
+		}
+
+		void SetPixelShader(ID3D11PixelShader* InShader) override
+		{
+			State.PixelShader = InShader;
+			++NumCalls;
+		}
+
+		void SetInputLayout(ID3D11InputLayout* InInputLayout) override
+		{
+			State.InputLayout = InInputLayout;
+			++NumCalls;
+		}
+
+		void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) override
+		{
+			State.Topology = InTopology;
+			++NumCalls;
+		}
+
+		void SetVertexBuffer(uint32 InSlot, ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset) override
+		{
+			State.VertexBuffer = InBuffer;
+			State.VertexStride = InStride;
+			State.VertexOffset = InOffset;
+			++NumCalls;
+		}
+
+		void SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset) override
+		{
+			State.IndexBuffer = InBuffer;
+			State.IndexFormat = InFormat;
+			State.IndexOffset = InOffset;
+			++NumCalls;
+		}
+
+		void SetRasterizerState(ID3D11RasterizerState* InState) override
+		{
+			State.RasterizerState = InState;
+			++NumCalls;
+		}
+
+		void SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef) override
+		{
+			State.DepthStencilState = InState;
+			State.StencilRef = InStencilRef;
+			++NumCalls;
+		}
+
+		void SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask) override
+		{
+			State.BlendState = InState;
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				State.BlendFactor[Index] = InBlendFactor ? InBlendFactor[Index] : 1.0f;
+			}
+			State.SampleMask = InSampleMask;
+			++NumCalls;
+		}
+
+		void SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView) override
+		{
+			State.ShaderResources[static_cast<uint8>(InStage)][InSlot] = InView;
+			++NumCalls;
+		}
+
+		void SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler) override
+		{
+			State.Samplers[static_cast<uint8>(InStage)][InSlot] = InSampler;
+			++NumCalls;
+		}
+
+		void SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer) override
+		{
+			State.ConstantBuffers[static_cast<uint8>(InStage)][InSlot] = InBuffer;
+			++NumCalls;
+		}
+
+		FRecordedState State;
+		int64 NumCalls = 0;
+	};
+
+	/**
+	 * @brief 캐시 없이 모든 바인딩을 백엔드로 전달하는 기존 방식 (FRHIStateCache와 같은 함수 이름)
+	 */
+	struct FDirectStateSink
+	{
+		IRHIStateBackend* Backend;
+
+		void SetVertexShader(ID3D11VertexShader* InShader) { Backend->SetVertexShader(InShader); }
+		void SetPixelShader(ID3D11PixelShader* InShader) { Backend->SetPixelShader(InShader); }
+		void SetInputLayout(ID3D11InputLayout* InInputLayout) { Backend->SetInputLayout(InInputLayout); }
+		void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) { Backend->SetPrimitiveTopology(InTopology); }
+
+		void SetVertexBuffer(ID3D11Buffer* InBuffer, uint32 InStride)
+		{
+			Backend->SetVertexBuffer(0, InBuffer, InStride, 0);
+		}
+
+		void SetIndexBuffer(ID3D11Buffer* InBuffer) { Backend->SetIndexBuffer(InBuffer, DXGI_FORMAT_R32_UINT, 0); }
+		void SetRasterizerState(ID3D11RasterizerState* InState) { Backend->SetRasterizerState(InState); }
+
+		void SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef)
+		{
+			Backend->SetDepthStencilState(InState, InStencilRef);
+		}
+
+		void SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask)
+		{
+			Backend->SetBlendState(InState, InBlendFactor, InSampleMask);
+		}
+
+		void SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView)
+		{
+			Backend->SetShaderResource(InStage, InSlot, InView);
+		}
+
+		void SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler)
+		{
+			Backend->SetSampler(InStage, InSlot, InSampler);
+		}
+
+		void SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer)
+		{
+			Backend->SetConstantBuffer(InStage, InSlot, InBuffer);
+		}
+	};
+
+	/**
+	 * @brief 한 프레임의 BasePass 입력 (드로우 패킷 정렬 후 순서)
+	 * @param ActorIndices / MeshIndices 프리미티브마다의 소유 Actor와 메시
+	 * @param MeshSectionCounts 메시마다의 섹션 수 (섹션 i는 머티리얼 슬롯 i, 컴포넌트 머티리얼은 슬롯 0)
+	 */
+	struct FStateCacheInput
+	{
+		TArray<int32> ActorIndices;
+		TArray<int32> MeshIndices;
+		TArray<int32> MeshSectionCounts;
+	};
+
+	/**
+	 * @param InNumMeshes 서로 다른 메시 수 (작을수록 같은 메시를 공유하는 인스턴스가 많음)
+	 * @param InPrimitivesPerActor Actor 하나가 가진 프리미티브 수
+	 */
+	void MakeStateCacheInput(int32 InNumPrimitives, int32 InNumMeshes, int32 InPrimitivesPerActor,
+	                         FStateCacheInput& OutInput)
+	{
+		std::mt19937 Random(0x535441);
+		std::uniform_int_distribution<int32> Mesh(0, InNumMeshes - 1);
+		std::uniform_int_distribution<int32> Sections(1, 3);
+
+		OutInput.MeshSectionCounts.SetNum(InNumMeshes);
+		for (int32& SectionCount : OutInput.MeshSectionCounts)
+		{
+			SectionCount = Sections(Random);
+		}
+
+		OutInput.ActorIndices.SetNum(InNumPrimitives);
+		OutInput.MeshIndices.SetNum(InNumPrimitives);
+		for (int32 Index = 0; Index < InNumPrimitives; ++Index)
+		{
+			OutInput.ActorIndices[Index] = Index / InPrimitivesPerActor;
+			OutInput.MeshIndices[Index] = InNumMeshes == InNumPrimitives ? Index : Mesh(Random);
+		}
+	}
+
+	/**
+	 * @brief 엔진의 BasePass / ExecuteSceneProxyPacket과 같은 순서로 바인딩을 요청하는 함수
+	 * 상태 Command(프리미티브마다 깊이, Actor마다 블렌드)가 먼저 실행되고, 드로우는 메시 순으로 정렬되어 실행된다
+	 * @param InOnDraw 드로우 직전마다 호출 (바인딩된 상태 확인용)
+	 */
+	template <typename SinkType, typename DrawFuncType>
+	void EmitBasePassFrame(SinkType& InSink, const FStateCacheInput& InInput, TArray<int32>& InOutDrawOrder,
+	                       const DrawFuncType& InOnDraw)
+	{
+		ID3D11DepthStencilState* DepthLessEqual = MakeHandle<ID3D11DepthStencilState>(1, 0);
+		ID3D11BlendState* BlendDisabled = MakeHandle<ID3D11BlendState>(2, 0);
+		ID3D11RasterizerState* RasterizerLit = MakeHandle<ID3D11RasterizerState>(3, 0);
+		ID3D11VertexShader* VertexShader = MakeHandle<ID3D11VertexShader>(4, 0);
+		ID3D11PixelShader* PixelShader = MakeHandle<ID3D11PixelShader>(5, 0);
+		ID3D11InputLayout* InputLayout = MakeHandle<ID3D11InputLayout>(6, 0);
+		ID3D11SamplerState* DefaultSampler = MakeHandle<ID3D11SamplerState>(7, 0);
+		ID3D11Buffer* MatrixBuffer = MakeHandle<ID3D11Buffer>(8, 0);
+		ID3D11Buffer* PixelBuffer = MakeHandle<ID3D11Buffer>(8, 4);
+
+		const int32 NumPrimitives = InInput.MeshIndices.Num();
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			if (Index > 0 && InInput.ActorIndices[Index] != InInput.ActorIndices[Index - 1])
+			{
+				InSink.SetBlendState(BlendDisabled, nullptr, 0xFFFFFFFF);
+			}
+			InSink.SetDepthStencilState(DepthLessEqual, 1);
+		}
+		InSink.SetBlendState(BlendDisabled, nullptr, 0xFFFFFFFF);
+
+		for (const int32 Index : InOutDrawOrder)
+		{
+			const int32 MeshIndex = InInput.MeshIndices[Index];
+
+			// BindStaticMeshShader
+			InSink.SetVertexShader(VertexShader);
+			InSink.SetPixelShader(PixelShader);
+			InSink.SetInputLayout(InputLayout);
+			InSink.SetSampler(ERHIShaderStage::Pixel, 0, DefaultSampler);
+
+			// UpdateConstantBuffers
+			InSink.SetConstantBuffer(ERHIShaderStage::Vertex, 0, MatrixBuffer);
+			InSink.SetConstantBuffer(ERHIShaderStage::Pixel, 0, MatrixBuffer);
+
+			InSink.SetVertexBuffer(MakeHandle<ID3D11Buffer>(10, MeshIndex), 48);
+			InSink.SetIndexBuffer(MakeHandle<ID3D11Buffer>(11, MeshIndex));
+			InSink.SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+			InSink.SetRasterizerState(RasterizerLit);
+			InSink.SetBlendState(BlendDisabled, nullptr, 0xFFFFFFFF);
+
+			// BindSectionMaterial
+			for (int32 Section = 0; Section < InInput.MeshSectionCounts[MeshIndex]; ++Section)
+			{
+				InSink.SetShaderResource(ERHIShaderStage::Pixel, 0,
+				                         MakeHandle<ID3D11ShaderResourceView>(9 + Section, MeshIndex));
+				InSink.SetConstantBuffer(ERHIShaderStage::Pixel, 4, PixelBuffer);
+				InOnDraw();
+			}
+		}
+	}
+
+	/**
+	 * @brief 드로우 패킷 정렬처럼 메시 순으로 정렬된 실행 순서 (같은 메시는 원래 순서 유지)
+	 */
+	void MakeDrawOrder(const FStateCacheInput& InInput, TArray<int32>& OutDrawOrder)
+	{
+		OutDrawOrder.SetNum(InInput.MeshIndices.Num());
+		for (int32 Index = 0; Index < OutDrawOrder.Num(); ++Index)
+		{
+			OutDrawOrder[Index] = Index;
+		}
+		std::stable_sort(OutDrawOrder.begin(), OutDrawOrder.end(), [&InInput](int32 InA, int32 InB)
+		{
+			return InInput.MeshIndices[InA] < InInput.MeshIndices[InB];
+		});
+	}
+
+	/**
+	 * @brief 캐시를 거친 결과가 모든 드로우 시점에 캐시 없이 적용한 상태와 같은지 확인하는 함수
+	 * 두 번째 프레임은 외부 코드가 Context를 바꾼 상황을 흉내 내기 위해 백엔드 상태를 흐트러뜨린 뒤 Invalidate로 시작한다
+	 */
+	void ValidateStateCache(const FString& InWorkload, const FStateCacheInput& InInput, TArray<int32>& InDrawOrder,
+	                        TArray<FString>& OutMismatches)
+	{
+		FRecordingStateBackend DirectBackend;
+		FDirectStateSink DirectSink{&DirectBackend};
+		TArray<FRecordedState> ExpectedStates;
+		EmitBasePassFrame(DirectSink, InInput, InDrawOrder, [&] { ExpectedStates.Add(DirectBackend.State); });
+
+		FRecordingStateBackend CachedBackend;
+		FRHIStateCache StateCache;
+		StateCache.SetBackend(&CachedBackend);
+
+		for (int32 Frame = 0; Frame < 2; ++Frame)
+		{
+			if (Frame > 0)
+			{
+				CachedBackend.State = FRecordedState();
+				CachedBackend.State.VertexShader = MakeHandle<ID3D11VertexShader>(99, 0);
+				CachedBackend.State.ShaderResources[static_cast<uint8>(ERHIShaderStage::Pixel)][0] = nullptr;
+				StateCache.Invalidate();
+			}
+			StateCache.ResetStats();
+
+			int32 DrawIndex = 0;
+			bool bMatches = true;
+			EmitBasePassFrame(StateCache, InInput, InDrawOrder, [&]
+			{
+				bMatches = bMatches && CachedBackend.State == ExpectedStates[DrawIndex];
+				++DrawIndex;
+			});
+
+			FBenchmark::Check(bMatches, InWorkload, "frame " + std::to_string(Frame) +
+			                  " bound state differs from unfiltered binds at a draw", OutMismatches);
+
+			const FRHIStateCacheStats& Stats = StateCache.GetStats();
+			FBenchmark::Check(static_cast<int64>(Stats.GetTotalSubmitted()) + Stats.GetTotalFiltered() ==
+			                  DirectBackend.NumCalls, InWorkload, "submitted + filtered does not match requested binds",
+			                  OutMismatches);
+		}
+	}
+
+	/**
+	 * @brief 드로우 하나가 요청하는 셰이더 / 래스터 / 블렌드 / 깊이 조합 (기존 방식은 드로우마다 이 값으로 상태를 찾음)
+	 * @param bSetDepth false면 깊이 상태는 패스가 설정한 값을 따름
+	 */
+	struct FPipelineStateRequest
+	{
+		EViewMode RasterMode;
+		bool bEnableBlending;
+		bool bSetDepth;
+		EComparisonFunc DepthFunction;
+	};
+
+	/**
+	 * @brief 기존 드로우 경로가 사용하던 디바이스 쪽 자료 (경로 키 셰이더 캐시, 모드별 상태 맵)
+	 */
+	struct FPipelineStateSource
+	{
+		struct FShaderObjects
+		{
+			ID3D11VertexShader* VertexShader;
+			ID3D11PixelShader* PixelShader;
+			ID3D11InputLayout* InputLayout;
+		};
+
+		TMap<FString, FShaderObjects> ShaderCache;
+		TMap<EViewMode, ID3D11RasterizerState*> RasterizerStates;
+		TMap<EComparisonFunc, ID3D11DepthStencilState*> DepthStencilStates;
+		ID3D11BlendState* BlendStateEnabled = MakeHandle<ID3D11BlendState>(2, 1);
+		ID3D11BlendState* BlendStateDisabled = MakeHandle<ID3D11BlendState>(2, 0);
+
+		FPipelineStateSource()
+		{
+			ShaderCache.Add("StaticMeshShader.hlsl", {
+				                MakeHandle<ID3D11VertexShader>(4, 0), MakeHandle<ID3D11PixelShader>(5, 0),
+				                MakeHandle<ID3D11InputLayout>(6, 0)
+			                });
+			ShaderCache.Add("Primitive.hlsl", {
+				                MakeHandle<ID3D11VertexShader>(4, 1), MakeHandle<ID3D11PixelShader>(5, 1),
+				                MakeHandle<ID3D11InputLayout>(6, 1)
+			                });
+			RasterizerStates[EViewMode::Lit] = MakeHandle<ID3D11RasterizerState>(3, 0);
+			RasterizerStates[EViewMode::Unlit] = MakeHandle<ID3D11RasterizerState>(3, 1);
+			RasterizerStates[EViewMode::WireFrame] = MakeHandle<ID3D11RasterizerState>(3, 2);
+			DepthStencilStates[EComparisonFunc::LessEqual] = MakeHandle<ID3D11DepthStencilState>(1, 0);
+			DepthStencilStates[EComparisonFunc::Always] = MakeHandle<ID3D11DepthStencilState>(1, 1);
+		}
+
+		/**
+		 * @brief 기존 드로우 경로: 입력 레이아웃 기술을 만들고 경로 문자열로 셰이더를 찾은 뒤, 모드별 상태를 맵에서 찾아 바인딩
+		 */
+		void BindByLookup(const FPipelineStateRequest& InRequest, FRHIStateCache& InStateCache)
+		{
+			TArray<D3D11_INPUT_ELEMENT_DESC> LayoutDesc = {
+				{"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+				{"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0},
+				{"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 28, D3D11_INPUT_PER_VERTEX_DATA, 0},
+				{"NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 36, D3D11_INPUT_PER_VERTEX_DATA, 0},
+			};
+			GStateCacheBenchmarkSink = GStateCacheBenchmarkSink + LayoutDesc.Num();
+
+			if (const FShaderObjects* Shader = ShaderCache.Find("StaticMeshShader.hlsl"))
+			{
+				InStateCache.SetVertexShader(Shader->VertexShader);
+				InStateCache.SetPixelShader(Shader->PixelShader);
+				InStateCache.SetInputLayout(Shader->InputLayout);
+			}
+
+			if (ID3D11DepthStencilState** DepthState = InRequest.bSetDepth
+				                                           ? DepthStencilStates.Find(InRequest.DepthFunction)
+				                                           : nullptr)
+			{
+				InStateCache.SetDepthStencilState(*DepthState, 1);
+			}
+
+			if (InRequest.bEnableBlending)
+			{
+				const float BlendFactor[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+				InStateCache.SetBlendState(BlendStateEnabled, BlendFactor, 0xFFFFFFFF);
+			}
+			else
+			{
+				InStateCache.SetBlendState(BlendStateDisabled, nullptr, 0xFFFFFFFF);
+			}
+
+			if (ID3D11RasterizerState** RasterizerState = RasterizerStates.Find(InRequest.RasterMode))
+			{
+				InStateCache.SetRasterizerState(*RasterizerState);
+			}
+		}
+
+		/**
+		 * @brief FRHIDevice::FindOrAddPipelineState와 같이 요청을 상태 객체 조합으로 바꿔 등록하는 함수
+		 */
+		FRHIPipelineStateHandle Register(const FPipelineStateRequest& InRequest, FRHIPipelineStateRegistry& InRegistry)
+		{
+			const FShaderObjects& Shader = *ShaderCache.Find("StaticMeshShader.hlsl");
+
+			FRHIPipelineStateDesc Desc;
+			Desc.VertexShader = Shader.VertexShader;
+			Desc.PixelShader = Shader.PixelShader;
+			Desc.InputLayout = Shader.InputLayout;
+			Desc.RasterizerState = *RasterizerStates.Find(InRequest.RasterMode);
+			Desc.BlendState = InRequest.bEnableBlending ? BlendStateEnabled : BlendStateDisabled;
+			if (InRequest.bEnableBlending)
+			{
+				for (float& Factor : Desc.BlendFactor)
+				{
+					Factor = 0.0f;
+				}
+			}
+			if (InRequest.bSetDepth)
+			{
+				Desc.DepthStencilState = *DepthStencilStates.Find(InRequest.DepthFunction);
+				Desc.StencilRef = 1;
+			}
+			return InRegistry.FindOrAdd(Desc);
+		}
+	};
+
+	/**
+	 * @brief 등록 결과와 드로우마다의 바인딩 상태가 기존 방식과 같은지 확인하는 함수
+	 * 같은 요청은 같은 핸들, 다른 요청은 다른 핸들이어야 하며, 다시 등록해도 항목 수가 늘지 않아야 한다
+	 */
+	void ValidatePipelineStates(const FString& InWorkload, FPipelineStateSource& InSource,
+	                            const TArray<FPipelineStateRequest>& InRequests,
+	                            const TArray<FRHIPipelineStateHandle>& InHandles, const TArray<int32>& InDrawRequests,
+	                            TArray<FString>& OutMismatches)
+	{
+		FRHIPipelineStateRegistry Registry;
+		for (int32 Pass = 0; Pass < 2; ++Pass)
+		{
+			for (int32 Index = 0; Index < InRequests.Num(); ++Index)
+			{
+				if (!FBenchmark::Check(InSource.Register(InRequests[Index], Registry) == InHandles[Index], InWorkload,
+				                       "registering the same request returned a different handle", OutMismatches))
+				{
+					return;
+				}
+			}
+		}
+		if (!FBenchmark::Check(Registry.Num() == InRequests.Num(), InWorkload, "registry holds " +
+		                       std::to_string(Registry.Num()) + " states for " + std::to_string(InRequests.Num()) +
+		                       " distinct requests", OutMismatches))
+		{
+			return;
+		}
+
+		FRecordingStateBackend LookupBackend;
+		FRHIStateCache LookupCache;
+		LookupCache.SetBackend(&LookupBackend);
+		FRecordingStateBackend HandleBackend;
+		FRHIStateCache HandleCache;
+		HandleCache.SetBackend(&HandleBackend);
+
+		for (const int32 Request : InDrawRequests)
+		{
+			InSource.BindByLookup(InRequests[Request], LookupCache);
+			Registry.Apply(InHandles[Request], HandleCache);
+			if (!FBenchmark::Check(LookupBackend.State == HandleBackend.State, InWorkload,
+			                       "bound state differs from the lookup path at a draw", OutMismatches))
+			{
+				return;
+			}
+		}
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunStateCacheBenchmarks(int32 InNumPrimitives,
+                                                             TArray<FRHIStateCacheStats>& OutStats,
+                                                             TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumPrimitives <= 0)
+	{
+		return Results;
+	}
+
+	struct FWorkload
+	{
+		const char* Name;
+		int32 NumMeshes;
+		int32 PrimitivesPerActor;
+	};
+
+	// 인스턴스가 많은 씬 / 메시와 Actor가 모두 다른 씬 (캐시가 얻을 것이 가장 적은 경우)
+	const FWorkload Workloads[] = {
+		{"Instanced", min(16, InNumPrimitives), 4},
+		{"Unique", InNumPrimitives, 1},
+	};
+
+	FStateCacheInput Input;
+	TArray<int32> DrawOrder;
+	for (const FWorkload& Workload : Workloads)
+	{
+		MakeStateCacheInput(InNumPrimitives, Workload.NumMeshes, Workload.PrimitivesPerActor, Input);
+		MakeDrawOrder(Input, DrawOrder);
+
+		const FString Name = FString(Workload.Name) + " x" + std::to_string(InNumPrimitives) + " (" +
+			std::to_string(Workload.NumMeshes) + " meshes)";
+		ValidateStateCache(Name, Input, DrawOrder, OutMismatches);
+
+		const int32 NumIterations = max(NumStateCacheOperations / InNumPrimitives, 1);
+		FBenchmarkResult Result{Name, "Frame"};
+
+		// 캐시처럼 가상 호출로 전달되도록 백엔드 포인터를 컴파일러가 추적하지 못하게 함
+		FRecordingStateBackend DirectBackend;
+		IRHIStateBackend* volatile OpaqueDirectBackend = &DirectBackend;
+		FDirectStateSink DirectSink{OpaqueDirectBackend};
+		FRecordingStateBackend CachedBackend;
+		FRHIStateCache StateCache;
+		StateCache.SetBackend(&CachedBackend);
+
+		int64 NumDraws = 0;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			Result.BaselineMilliseconds += FBenchmark::MeasureMilliseconds([&]
+			{
+				EmitBasePassFrame(DirectSink, Input, DrawOrder, [&] { ++NumDraws; });
+			});
+
+			// 엔진과 같이 프레임마다 통계를 새로 세고 캐시를 비운 뒤 시작
+			StateCache.ResetStats();
+			StateCache.Invalidate();
+			Result.EngineMilliseconds += FBenchmark::MeasureMilliseconds([&]
+			{
+				EmitBasePassFrame(StateCache, Input, DrawOrder, [&] { ++NumDraws; });
+			});
+		}
+		Result.BaselineMilliseconds /= NumIterations;
+		Result.EngineMilliseconds /= NumIterations;
+		GStateCacheBenchmarkSink = GStateCacheBenchmarkSink + NumDraws + DirectBackend.NumCalls + CachedBackend.NumCalls;
+
+		Results.Add(Result);
+		OutStats.Add(StateCache.GetStats());
+	}
+
+	return Results;
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunPipelineStateBenchmarks(int32 InNumDraws, TArray<int32>& OutNumStates,
+                                                                TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumDraws <= 0)
+	{
+		return Results;
+	}
+
+	// BasePass(모두 Lit 불투명) / 기즈모와 와이어프레임이 섞인 에디터 뷰
+	const TArray<FPipelineStateRequest> StaticMeshRequests = {
+		{EViewMode::Lit, false, false, EComparisonFunc::LessEqual},
+	};
+	const TArray<FPipelineStateRequest> MixedRequests = {
+		{EViewMode::Lit, false, false, EComparisonFunc::LessEqual},
+		{EViewMode::Unlit, true, true, EComparisonFunc::LessEqual},
+		{EViewMode::WireFrame, false, false, EComparisonFunc::LessEqual},
+		{EViewMode::Lit, true, true, EComparisonFunc::Always},
+	};
+
+	struct FWorkload
+	{
+		const char* Name;
+		const TArray<FPipelineStateRequest>* Requests;
+	};
+	const FWorkload Workloads[] = {
+		{"Static mesh", &StaticMeshRequests},
+		{"Mixed", &MixedRequests},
+	};
+
+	FPipelineStateSource Source;
+	std::mt19937 Random(0x50534F);
+	for (const FWorkload& Workload : Workloads)
+	{
+		const TArray<FPipelineStateRequest>& Requests = *Workload.Requests;
+		const FString Name = FString(Workload.Name) + " x" + std::to_string(InNumDraws) + " (" +
+			std::to_string(Requests.Num()) + " states)";
+
+		// 프록시 생성 시점의 등록
+		FRHIPipelineStateRegistry Registry;
+		TArray<FRHIPipelineStateHandle> Handles;
+		for (const FPipelineStateRequest& Request : Requests)
+		{
+			Handles.Add(Source.Register(Request, Registry));
+		}
+
+		std::uniform_int_distribution<int32> RequestIndex(0, Requests.Num() - 1);
+		TArray<int32> DrawRequests;
+		DrawRequests.SetNum(InNumDraws);
+		for (int32& Request : DrawRequests)
+		{
+			Request = RequestIndex(Random);
+		}
+
+		ValidatePipelineStates(Name, Source, Requests, Handles, DrawRequests, OutMismatches);
+
+		// 두 방식 모두 같은 상태 캐시를 거치므로 차이는 드로우마다 상태를 찾는 비용
+		FRecordingStateBackend Backend;
+		FRHIStateCache StateCache;
+		StateCache.SetBackend(&Backend);
+
+		const int32 NumIterations = max(NumStateCacheOperations / InNumDraws, 1);
+		FBenchmarkResult Result{Name, "Bind"};
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			StateCache.Invalidate();
+			Result.BaselineMilliseconds += FBenchmark::MeasureMilliseconds([&]
+			{
+				for (const int32 Request : DrawRequests)
+				{
+					Source.BindByLookup(Requests[Request], StateCache);
+				}
+			});
+
+			StateCache.Invalidate();
+			Result.EngineMilliseconds += FBenchmark::MeasureMilliseconds([&]
+			{
+				for (const int32 Request : DrawRequests)
+				{
+					Registry.Apply(Handles[Request], StateCache);
+				}
+			});
+		}
+		Result.BaselineMilliseconds /= NumIterations;
+		Result.EngineMilliseconds /= NumIterations;
+		GStateCacheBenchmarkSink = GStateCacheBenchmarkSink + Backend.NumCalls;
+
+		Results.Add(Result);
+		OutNumStates.Add(Registry.Num());
+	}
+
+	return Results;
+}
@@ -0,0 +1,380 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include "Global/MatrixMath.h"
+#include "Global/TransformBatch.h"
+#include "Physics/Public/AABB.h"
+
+#include <random>
+
+namespace
+{
+	volatile float GTransformBenchmarkSink = 0.0f;
+
+	/**
+	 * @brief 변환 수가 적을 때도 측정값이 의미 있도록 맞추는 총 변환 계산 횟수
+	 */
+	constexpr int32 NumTransformOperations = 1000000;
+
+	/**
+	 * @brief 월드 범위 비교에 사용하는 메시의 정점 수 (상자 꼭짓점 8개 + 내부 점)
+	 */
+	constexpr int32 NumBoundsVertices = 128;
+
+	/**
+	 * @brief 에디터 변환 정보 형태의 입력 (오일러 각은 도 단위)
+	 * InChainLength개마다 루트 하나와 그 아래로 한 줄로 이어진 자식들로 구성해 부모 체인이 있는 경우도 함께 측정한다
+	 * @param bInUniformScale 쿼터니언 합성(FQuatTransform)과 결과를 맞춰야 하는 경우 true
+	 */
+	void MakeInputs(int32 InNumTransforms, int32 InChainLength, bool bInUniformScale, TArray<FTransform>& OutTransforms,
+	                TArray<int32>& OutParentIndices)
+	{
+		std::mt19937 Random(0x47544C);
+		std::uniform_real_distribution<float> Location(-1000.0f, 1000.0f);
+		std::uniform_real_distribution<float> Rotation(-180.0f, 180.0f);
+		// 비균등 스케일은 깊이가 깊어질수록 전단이 누적되어 조건수가 커지므로 범위를 좁힌다
+		std::uniform_real_distribution<float> Scale(bInUniformScale ? 0.5f : 0.8f, bInUniformScale ? 2.0f : 1.25f);
+
+		OutTransforms.Empty(InNumTransforms);
+		OutParentIndices.Empty(InNumTransforms);
+
+		for (int32 Index = 0; Index < InNumTransforms; ++Index)
+		{
+			const float ScaleX = Scale(Random);
+			const FVector Scale3D = bInUniformScale ? FVector(ScaleX, ScaleX, ScaleX) :
+				                        FVector(ScaleX, Scale(Random), Scale(Random));
+			OutTransforms.Add(FTransform(FVector(Location(Random), Location(Random), Location(Random)),
+			                             FVector(Rotation(Random), Rotation(Random), Rotation(Random)), Scale3D));
+			OutParentIndices.Add(Index % InChainLength == 0 ? FTransformBatch::INDEX_NONE : Index - 1);
+		}
+	}
+
+	/**
+	 * @brief 기존 방식: 컴포넌트마다 오일러 각으로 모델 행렬을 만들고 부모 월드 행렬을 곱한다
+	 */
+	void ComputeBaseline(const TArray<FTransform>& InTransforms, const TArray<int32>& InParentIndices,
+	                     TArray<FMatrix>& OutWorldMatrices)
+	{
+		OutWorldMatrices.SetNum(InTransforms.Num());
+		for (int32 Index = 0; Index < InTransforms.Num(); ++Index)
+		{
+			const FTransform& Transform = InTransforms[Index];
+			OutWorldMatrices[Index] = FMatrix::GetModelMatrix(Transform.Location,
+			                                                  FVector::GetDegreeToRadian(Transform.Rotation),
+			                                                  Transform.Scale);
+
+			if (InParentIndices[Index] != FTransformBatch::INDEX_NONE)
+			{
+				OutWorldMatrices[Index] = OutWorldMatrices[InParentIndices[Index]] * OutWorldMatrices[Index];
+			}
+		}
+	}
+
+	/**
+	 * @brief 엔진 방식: SoA 배치에 채운 뒤 한 번에 계산한다 (ULevel::UpdateComponentTransforms와 같은 흐름)
+	 */
+	void ComputeBatch(const TArray<FQuatTransform>& InTransforms, const TArray<int32>& InParentIndices,
+	                  FTransformBatch& OutBatch)
+	{
+		OutBatch.Reset();
+		for (int32 Index = 0; Index < InTransforms.Num(); ++Index)
+		{
+			OutBatch.Add(InTransforms[Index], InParentIndices[Index]);
+		}
+		OutBatch.ComputeWorldMatrices();
+	}
+
+	/**
+	 * @brief 기존 방식의 월드 역행렬: 자신부터 루트까지 각 변환의 역행렬을 차례로 곱한다
+	 * (Root * ... * Parent * Local)^-1 = Local^-1 * Parent^-1 * ... * Root^-1
+	 */
+	void ComputeChainInverse(const TArray<FTransform>& InTransforms, const TArray<int32>& InParentIndices,
+	                         TArray<FMatrix>& OutInverseMatrices)
+	{
+		OutInverseMatrices.SetNum(InTransforms.Num());
+		for (int32 Index = 0; Index < InTransforms.Num(); ++Index)
+		{
+			FMatrix Inverse = FMatrix::Identity();
+			for (int32 Current = Index; Current != FTransformBatch::INDEX_NONE; Current = InParentIndices[Current])
+			{
+				const FTransform& Transform = InTransforms[Current];
+				Inverse = Inverse * FMatrix::GetModelMatrixInverse(Transform.Location,
+				                                                   FVector::GetDegreeToRadian(Transform.Rotation),
+				                                                   Transform.Scale);
+			}
+			OutInverseMatrices[Index] = Inverse;
+		}
+	}
+
+	/**
+	 * @brief 메시 정점 생성: 상자의 꼭짓점 8개와 그 내부의 임의의 점
+	 * 꼭짓점이 포함되어 있으므로 정점 전체를 변환한 AABB는 로컬 AABB의 8개 꼭짓점을 변환한 AABB와 같아야 한다
+	 */
+	TArray<FVector> MakeBoundsVertices()
+	{
+		std::mt19937 Random(0x414142);
+		std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+
+		const FVector Min(-3.0f, -1.0f, -2.0f);
+		const FVector Max(5.0f, 2.0f, 4.0f);
+
+		TArray<FVector> Vertices;
+		Vertices.Reserve(NumBoundsVertices);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			Vertices.Add(FVector(Corner & 1 ? Max.X : Min.X, Corner & 2 ? Max.Y : Min.Y, Corner & 4 ? Max.Z : Min.Z));
+		}
+		while (Vertices.Num() < NumBoundsVertices)
+		{
+			Vertices.Add(FVector(Min.X + (Max.X - Min.X) * Unit(Random), Min.Y + (Max.Y - Min.Y) * Unit(Random),
+			                     Min.Z + (Max.Z - Min.Z) * Unit(Random)));
+		}
+		return Vertices;
+	}
+
+	/**
+	 * @brief 렌더링과 같은 규약(열 벡터)으로 위치를 변환하는 함수
+	 */
+	FVector TransformPoint(const FMatrix& InMatrix, const FVector& InPoint)
+	{
+		return FVector(
+			InMatrix.Data[0][0] * InPoint.X + InMatrix.Data[0][1] * InPoint.Y + InMatrix.Data[0][2] * InPoint.Z + InMatrix.Data[0][3],
+			InMatrix.Data[1][0] * InPoint.X + InMatrix.Data[1][1] * InPoint.Y + InMatrix.Data[1][2] * InPoint.Z + InMatrix.Data[1][3],
+			InMatrix.Data[2][0] * InPoint.X + InMatrix.Data[2][1] * InPoint.Y + InMatrix.Data[2][2] * InPoint.Z + InMatrix.Data[2][3]);
+	}
+
+	/**
+	 * @brief 기존 방식의 월드 AABB: 정점 전체를 순회해 로컬 AABB를 구한 뒤 8개 꼭짓점을 변환한다
+	 */
+	FAABB ComputeBruteForceBounds(const TArray<FVector>& InVertices, const FMatrix& InMatrix)
+	{
+		FVector LocalMin = InVertices[0];
+		FVector LocalMax = InVertices[0];
+		for (const FVector& Vertex : InVertices)
+		{
+			LocalMin = FVector(min(LocalMin.X, Vertex.X), min(LocalMin.Y, Vertex.Y), min(LocalMin.Z, Vertex.Z));
+			LocalMax = FVector(max(LocalMax.X, Vertex.X), max(LocalMax.Y, Vertex.Y), max(LocalMax.Z, Vertex.Z));
+		}
+
+		FVector WorldMin = TransformPoint(InMatrix, LocalMin);
+		FVector WorldMax = WorldMin;
+		for (int32 Corner = 1; Corner < 8; ++Corner)
+		{
+			const FVector Point = TransformPoint(InMatrix, FVector(Corner & 1 ? LocalMax.X : LocalMin.X,
+			                                                       Corner & 2 ? LocalMax.Y : LocalMin.Y,
+			                                                       Corner & 4 ? LocalMax.Z : LocalMin.Z));
+			WorldMin = FVector(min(WorldMin.X, Point.X), min(WorldMin.Y, Point.Y), min(WorldMin.Z, Point.Z));
+			WorldMax = FVector(max(WorldMax.X, Point.X), max(WorldMax.Y, Point.Y), max(WorldMax.Z, Point.Z));
+		}
+		return FAABB(WorldMin, WorldMax);
+	}
+
+	/**
+	 * @brief 정점을 하나씩 변환한 결과와 캐시 경로(FAABB::TransformBy / TransformSphereBy)를 대조하는 함수
+	 * AABB는 정점 변환 결과와 일치해야 하고, 경계 구는 모든 변환된 정점을 포함해야 한다
+	 * @return 크기에 대한 상대 오차 중 최댓값 (구 밖으로 벗어난 거리 포함)
+	 */
+	float GetBoundsError(const TArray<FVector>& InVertices, const FAABB& InLocalBounds, const FMatrix& InMatrix)
+	{
+		const FAABB Bounds = InLocalBounds.TransformBy(InMatrix);
+		const FBoundingSphere Sphere = InLocalBounds.TransformSphereBy(InMatrix);
+
+		FVector VertexMin = TransformPoint(InMatrix, InVertices[0]);
+		FVector VertexMax = VertexMin;
+		float SphereOverflow = 0.0f;
+		for (const FVector& Vertex : InVertices)
+		{
+			const FVector Point = TransformPoint(InMatrix, Vertex);
+			VertexMin = FVector(min(VertexMin.X, Point.X), min(VertexMin.Y, Point.Y), min(VertexMin.Z, Point.Z));
+			VertexMax = FVector(max(VertexMax.X, Point.X), max(VertexMax.Y, Point.Y), max(VertexMax.Z, Point.Z));
+			SphereOverflow = max(SphereOverflow, (Point - Sphere.Center).Length() - Sphere.Radius);
+		}
+
+		const float Size = max(1.0f, (VertexMax - VertexMin).Length());
+		const float MinError = (VertexMin - Bounds.Min).Length();
+		const float MaxError = (VertexMax - Bounds.Max).Length();
+		return max(max(MinError, MaxError), SphereOverflow) / Size;
+	}
+
+	/**
+	 * @brief 이동 열은 회전 성분의 반올림 오차에 이동 거리가 곱해지므로, 성분 대신 행의 최대 크기에 대한 상대 오차를 사용한다
+	 */
+	float GetMatrixError(const FMatrix& InExpected, const FMatrix& InActual)
+	{
+		float MaxError = 0.0f;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			float RowMagnitude = 1.0f;
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				RowMagnitude = max(RowMagnitude, std::abs(InExpected.Data[Row][Column]));
+			}
+
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				const float Difference = std::abs(InExpected.Data[Row][Column] - InActual.Data[Row][Column]);
+				MaxError = max(MaxError, Difference / RowMagnitude);
+			}
+		}
+		return MaxError;
+	}
+}
+
+TArray<FBenchmarkResult> FBenchmark::RunTransformBenchmarks(int32 InNumTransforms, TArray<FString>& OutMismatches)
+{
+	TArray<FBenchmarkResult> Results;
+	if (InNumTransforms <= 0)
+	{
+		return Results;
+	}
+
+	TArray<FTransform> Transforms;
+	TArray<int32> ParentIndices;
+	MakeInputs(InNumTransforms, 4, true, Transforms, ParentIndices);
+
+	// 컴포넌트도 오일러 각을 보관하고 있으므로 쿼터니언 변환은 측정 밖에서 한 번만 수행한다
+	TArray<FQuatTransform> QuatTransforms;
+	QuatTransforms.Reserve(InNumTransforms);
+	for (const FTransform& Transform : Transforms)
+	{
+		QuatTransforms.Add(FQuatTransform(Transform));
+	}
+
+	TArray<FMatrix> BaselineMatrices;
+	FTransformBatch Batch;
+	Batch.Reserve(InNumTransforms);
+
+	// 오일러 각 행렬과 쿼터니언 행렬의 반올림 차이가 부모 체인을 따라 누적되는 정도만 허용
+	ComputeBaseline(Transforms, ParentIndices, BaselineMatrices);
+	ComputeBatch(QuatTransforms, ParentIndices, Batch);
+
+	float MaxError = 0.0f;
+	for (int32 Index = 0; Index < InNumTransforms; ++Index)
+	{
+		MaxError = max(MaxError, GetMatrixError(BaselineMatrices[Index], Batch.GetWorldMatrix(Index)));
+	}
+
+	constexpr float Tolerance = 1e-3f;
+	CheckTolerance("WorldMatrix", MaxError, Tolerance, OutMismatches);
+
+	const int32 NumIterations = max(NumTransformOperations / InNumTransforms, 1);
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	const FString Workload = "Transform AoS vs SoA SSE x" + std::to_string(InNumTransforms);
+#else
+	const FString Workload = "Transform AoS vs SoA Scalar x" + std::to_string(InNumTransforms);
+#endif
+
+	FBenchmarkResult Result{Workload, "WorldMatrix"};
+	Result.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		float Sum = 0.0f;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			ComputeBaseline(Transforms, ParentIndices, BaselineMatrices);
+			Sum += BaselineMatrices[Iteration % InNumTransforms].Data[0][3];
+		}
+		GTransformBenchmarkSink = GTransformBenchmarkSink + Sum;
+	}) / NumIterations;
+	Result.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		float Sum = 0.0f;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			ComputeBatch(QuatTransforms, ParentIndices, Batch);
+			Sum += Batch.GetWorldMatrix(Iteration % InNumTransforms).Data[0][3];
+		}
+		GTransformBenchmarkSink = GTransformBenchmarkSink + Sum;
+	}) / NumIterations;
+	Results.Add(Result);
+
+	// 월드 역행렬: 비균등 스케일과 깊은 부모 체인에서 조상 역행렬 체인과 캐시된 월드 행렬의 아핀 역행렬을 비교
+	constexpr int32 InverseChainLength = 16;
+	MakeInputs(InNumTransforms, InverseChainLength, false, Transforms, ParentIndices);
+	ComputeBaseline(Transforms, ParentIndices, BaselineMatrices);
+
+	TArray<FMatrix> ChainInverseMatrices;
+	ComputeChainInverse(Transforms, ParentIndices, ChainInverseMatrices);
+
+	TArray<FMatrix> AffineInverseMatrices;
+	AffineInverseMatrices.SetNum(InNumTransforms);
+
+	float MaxInverseError = 0.0f;
+	for (int32 Index = 0; Index < InNumTransforms; ++Index)
+	{
+		MatrixMath::InverseAffine(AffineInverseMatrices[Index], BaselineMatrices[Index]);
+		MaxInverseError = max(MaxInverseError, GetMatrixError(ChainInverseMatrices[Index], AffineInverseMatrices[Index]));
+	}
+
+	// 기준값 자체도 16단계의 float 행렬 곱이므로 양쪽의 누적 반올림 오차만큼 허용
+	constexpr float InverseTolerance = 1e-2f;
+	CheckTolerance("WorldInverse", MaxInverseError, InverseTolerance, OutMismatches);
+
+	FBenchmarkResult InverseResult{Workload, "WorldInverse"};
+	InverseResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		float Sum = 0.0f;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			ComputeChainInverse(Transforms, ParentIndices, ChainInverseMatrices);
+			Sum += ChainInverseMatrices[Iteration % InNumTransforms].Data[0][3];
+		}
+		GTransformBenchmarkSink = GTransformBenchmarkSink + Sum;
+	}) / NumIterations;
+	InverseResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		float Sum = 0.0f;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 Index = 0; Index < InNumTransforms; ++Index)
+			{
+				MatrixMath::InverseAffine(AffineInverseMatrices[Index], BaselineMatrices[Index]);
+			}
+			Sum += AffineInverseMatrices[Iteration % InNumTransforms].Data[0][3];
+		}
+		GTransformBenchmarkSink = GTransformBenchmarkSink + Sum;
+	}) / NumIterations;
+	Results.Add(InverseResult);
+
+	// 월드 범위: 메시 정점 전체를 다시 훑던 방식과 메시에 캐시된 로컬 AABB를 변환하는 방식 비교
+	const TArray<FVector> BoundsVertices = MakeBoundsVertices();
+	const FAABB LocalBounds = ComputeBruteForceBounds(BoundsVertices, FMatrix::Identity());
+
+	float MaxBoundsError = 0.0f;
+	for (int32 Index = 0; Index < InNumTransforms; ++Index)
+	{
+		MaxBoundsError = max(MaxBoundsError, GetBoundsError(BoundsVertices, LocalBounds, BaselineMatrices[Index]));
+	}
+
+	CheckTolerance("WorldBounds", MaxBoundsError, Tolerance, OutMismatches);
+
+	FBenchmarkResult BoundsResult{Workload, "WorldBounds"};
+	BoundsResult.BaselineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		float Sum = 0.0f;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 Index = 0; Index < InNumTransforms; ++Index)
+			{
+				Sum += ComputeBruteForceBounds(BoundsVertices, BaselineMatrices[Index]).Max.X;
+			}
+		}
+		GTransformBenchmarkSink = GTransformBenchmarkSink + Sum;
+	}) / NumIterations;
+	BoundsResult.EngineMilliseconds = FBenchmark::MeasureMilliseconds([&]
+	{
+		float Sum = 0.0f;
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 Index = 0; Index < InNumTransforms; ++Index)
+			{
+				Sum += LocalBounds.TransformBy(BaselineMatrices[Index]).Max.X;
+				Sum += LocalBounds.TransformSphereBy(BaselineMatrices[Index]).Radius;
+			}
+		}
+		GTransformBenchmarkSink = GTransformBenchmarkSink + Sum;
+	}) / NumIterations;
+	Results.Add(BoundsResult);
+
+	return Results;
+}
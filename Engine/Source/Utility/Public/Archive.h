@@ -26,7 +26,13 @@ public:
 	// FVertex 직렬화
 	FArchive& operator<<(FVertex& Value);
 
-	// 배열은 StaticMesh에서 직접 for문으로 처리
+	/**
+	 * @brief 메모리 구간을 그대로 읽고 쓰는 함수
+	 * 프로퍼티 테이블의 통째 복사 구간과 POD 배열 직렬화에 사용된다
+	 */
+	virtual void Serialize(void* Data, size_t Size) = 0;
+
+	void SerializeProperties(const FPropertyTable& InTable, void* InObject);
 
 	// 상태 확인
 	virtual bool IsLoading() const = 0;
@@ -51,6 +57,7 @@ public:
 	FArchive& operator<<(FVector& Value) override;
 	FArchive& operator<<(FVector2& Value) override;
 	FArchive& operator<<(FVector4& Value) override;
+	void Serialize(void* Data, size_t Size) override;
 
 	bool IsLoading() const override { return false; }
 	bool IsSaving() const override { return true; }
@@ -86,6 +93,7 @@ public:
 	FArchive& operator<<(FVector& Value) override;
 	FArchive& operator<<(FVector2& Value) override;
 	FArchive& operator<<(FVector4& Value) override;
+	void Serialize(void* Data, size_t Size) override;
 
 	bool IsLoading() const override { return true; }
 	bool IsSaving() const override { return false; }
@@ -103,6 +111,56 @@ private:
 	}
 };
 
+/**
+ * @brief 프로퍼티 테이블을 선언한 구조체 하나를 직렬화하는 함수
+ */
+template <typename T>
+void SerializeProperties(FArchive& Ar, T& Value)
+{
+	Ar.SerializeProperties(T::StaticPropertyTable(), &Value);
+}
+
+/**
+ * @brief 개수(uint32) + 원소 순서로 배열을 직렬화하는 함수
+ * 산술 타입이거나 테이블 전체가 하나의 통째 복사 구간인 구조체는 배열 전체를 한 번에 복사하고,
+ * 그 외에는 원소마다 프로퍼티 테이블을 순회한다
+ */
+template <typename T>
+void SerializeArray(FArchive& Ar, TArray<T>& Array)
+{
+	uint32 Count = static_cast<uint32>(Array.Num());
+	Ar << Count;
+
+	if (Ar.IsLoading())
+	{
+		Array.SetNum(static_cast<int32>(Count));
+	}
+
+	if (Count == 0)
+	{
+		return;
+	}
+
+	if constexpr (std::is_arithmetic_v<T>)
+	{
+		Ar.Serialize(Array.GetData(), sizeof(T) * Count);
+	}
+	else
+	{
+		const FPropertyTable& Table = T::StaticPropertyTable();
+		if (Table.IsFullyTrivial())
+		{
+			Ar.Serialize(Array.GetData(), sizeof(T) * Count);
+			return;
+		}
+
+		for (T& Element : Array)
+		{
+			Ar.SerializeProperties(Table, &Element);
+		}
+	}
+}
+
 /**
  * @brief 헬퍼 함수들
  */
@@ -0,0 +1,204 @@
+#pragma once
+
+struct FRHIStateCacheStats;
+
+/**
+ * @brief 벤치마크 결과 한 항목
+ * @param Workload 측정 조건 (컨테이너 / 키 타입 / 원소 수, 스레드 수 등)
+ * @param Operation 측정한 연산
+ * @param BaselineMilliseconds 비교 기준 구현(std 컨테이너, CRT malloc 등) 소요 시간
+ * @param EngineMilliseconds 엔진 구현 소요 시간
+ */
+struct FBenchmarkResult
+{
+	FString Workload;
+	FString Operation;
+	double BaselineMilliseconds = 0.0;
+	double EngineMilliseconds = 0.0;
+
+	double GetSpeedup() const
+	{
+		return EngineMilliseconds > 0.0 ? BaselineMilliseconds / EngineMilliseconds : 0.0;
+	}
+};
+
+/**
+ * @brief 엔진 기반 구현과 표준 구현을 같은 입력으로 비교하는 마이크로 벤치마크 모음
+ * 콘솔의 BENCH 명령으로 실행할 수 있으며, 코어 / 할당자 / 수학 벤치마크는 헤드리스 Benchmark 프로젝트로도 실행된다
+ */
+class FBenchmark
+{
+public:
+	/**
+	 * @brief TMap / TSet과 std::unordered_map / unordered_set을 정수 / 문자열 키로 비교하는 함수
+	 * @param InNumElements 워크로드당 원소 수
+	 * @return 워크로드 / 연산별 측정 결과
+	 */
+	static TArray<FBenchmarkResult> RunHashContainerBenchmarks(int32 InNumElements);
+
+	/**
+	 * @brief FMemory와 CRT malloc / free를 여러 스레드에서 동시에 할당 / 해제하며 비교하는 함수
+	 * 이전 전역 할당자는 malloc 위에 헤더와 공유 카운터를 더한 구조였으므로 CRT 결과가 그 비용의 하한이 된다
+	 * @param InNumThreads 동시에 실행할 스레드 수
+	 * @param InOperationsPerThread 스레드당 할당 / 해제 횟수
+	 * @return 스레드 수별 측정 결과
+	 */
+	static TArray<FBenchmarkResult> RunAllocatorBenchmarks(int32 InNumThreads, int32 InOperationsPerThread);
+
+	/**
+	 * @brief 코어 타입(TArray, TSparseArray, FName, TSharedPtr)의 주요 연산을 비교하는 함수
+	 * 씬 규모의 원소 수에서도 측정값이 의미 있도록 워크로드마다 연산을 약 백만 번 반복한다
+	 * 헤더 전용 코어와 Global 타입만 사용하므로 헤드리스 Benchmark 프로젝트에서도 실행된다
+	 * @param InNumElements 워크로드당 원소 수
+	 * @return 워크로드 / 연산별 측정 결과 (Baseline은 std 구현 또는 기존 방식)
+	 */
+	static TArray<FBenchmarkResult> RunCoreBenchmarks(int32 InNumElements);
+
+	/**
+	 * @brief 현재 살아있는 UObject 전체를 GUObjectArray 직접 순회와 TObjectIterator로 비교하는 함수
+	 * UObject 시스템이 필요하므로 에디터에서만 실행한다
+	 * @return 측정 결과 (원소 수는 실행 시점의 GUObjectArray 크기)
+	 */
+	static TArray<FBenchmarkResult> RunObjectIteratorBenchmarks();
+
+	/**
+	 * @brief FMatrix 커널(MatrixMath)의 스칼라 구현과 컴파일 시점에 선택된 SIMD 구현을 비교하는 함수
+	 * 측정 전에 같은 입력으로 두 구현의 결과를 대조하며, 아핀 역행렬은 일반 역행렬 결과와도 대조한다
+	 * @param InNumMatrices 연산마다 사용할 행렬 수 (모델 행렬과 View * Projection 형태를 섞어 생성)
+	 * @param OutMismatches 허용 오차를 넘은 연산과 최대 오차 (모두 일치하면 비어 있음)
+	 * @return 연산별 측정 결과 (Baseline은 스칼라 구현)
+	 */
+	static TArray<FBenchmarkResult> RunMatrixBenchmarks(int32 InNumMatrices, TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 컴포넌트별 월드 행렬 계산(오일러 각 모델 행렬 * 부모 행렬)과 FTransformBatch 일괄 계산을 비교하는 함수
+	 * 월드 역행렬은 비균등 스케일의 깊은 부모 체인에서 조상 역행렬 체인과 아핀 역행렬을 비교한다
+	 * 월드 범위는 메시 정점 전체를 순회하는 방식과 캐시된 로컬 AABB를 변환하는 방식을 비교하고, 정점별 변환 결과와 대조한다
+	 * 측정 전에 두 방식의 결과를 대조한다
+	 * @param InNumTransforms 프레임당 갱신할 변환 수 (월드 행렬은 깊이 4, 역행렬은 깊이 16의 부모 체인)
+	 * @param OutMismatches 허용 오차를 넘은 경우의 최대 오차 (일치하면 비어 있음)
+	 * @return 측정 결과 (한 프레임 분량의 갱신 시간)
+	 */
+	static TArray<FBenchmarkResult> RunTransformBenchmarks(int32 InNumTransforms, TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 프리미티브별 FFrustum::IntersectsAABB 호출과 FCullingBoundsBatch의 SIMD 일괄 판정을 비교하는 함수
+	 * 측정 전에 절두체 평면의 점 판정을 클립 좌표 판정과 대조하고, 두 AABB 판정 결과가 같은지 확인한다
+	 * @param InNumBounds 뷰 하나에서 판정할 AABB 수
+	 * @param OutMismatches 결과가 다른 경우의 개수 (일치하면 비어 있음)
+	 * @return 측정 결과 (한 뷰 분량의 판정 시간)
+	 */
+	static TArray<FBenchmarkResult> RunCullingBenchmarks(int32 InNumBounds, TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 프리미티브 전체 순회와 FDynamicAABBTree의 절두체 / AABB / 구 / 광선 질의를 비교하는 함수
+	 * DefaultPUBG_mini.scene의 배치(로컬 범위는 단위 상자)와 무작위로 흩어진 합성 배치를 각각 측정한다
+	 * 측정 전후로 두 방식의 질의 결과 집합과 트리 구조를 검증하며, 이동은 전체 재구성 시간과 비교한다
+	 * @param InNumSyntheticBounds 합성 배치의 프리미티브 수 (0이면 씬 파일만 측정)
+	 * @param OutMismatches 결과가 다르거나 트리가 잘못된 경우의 설명 (일치하면 비어 있음)
+	 * @return 측정 결과 (질의 종류별 256회 분량, 이동은 한 프레임 분량)
+	 */
+	static TArray<FBenchmarkResult> RunSpatialIndexBenchmarks(int32 InNumSyntheticBounds, TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief FSoftwareOcclusionBuffer의 래스터화와 HiZ 판정을 픽셀별 스칼라 구현과 비교하는 함수
+	 * 측정 전에 정해진 배치(벽 뒤 / 앞 / 옆 / 근평면)의 깊이와 판정 결과, 래스터화 깊이의 일치,
+	 * HiZ로 가려진 후보가 최고 해상도 판정에서도 가려지는지를 확인한다
+	 * @param InNumOccluders 상자 가림체 수
+	 * @param InNumOccludees 판정할 후보 AABB 수
+	 * @param OutMismatches 검증에 실패한 항목 (모두 통과하면 비어 있음)
+	 * @return 측정 결과 (래스터화는 한 뷰 분량, 판정은 후보 전체)
+	 */
+	static TArray<FBenchmarkResult> RunOcclusionBenchmarks(int32 InNumOccluders, int32 InNumOccludees,
+	                                                       TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief Command마다 new로 만든 가상 드로우 Command와 FDrawPacketBuffer의 POD 드로우 패킷을 비교하는 함수
+	 * 한 프레임 분량의 추가 / 정렬 키 정렬 / 실행(+ 해제)을 단계별로 측정하며, 실행은 RHI 없이 기록만 한다
+	 * 측정 전에 두 방식의 실행 순서가 키 기준 안정 정렬 결과와 같은지 확인한다
+	 * @param InNumDraws 프레임당 드로우 수
+	 * @param OutMismatches 실행 순서가 다른 방식 (일치하면 비어 있음)
+	 * @return 단계별 측정 결과 (한 프레임 분량, Baseline은 가상 Command)
+	 */
+	static TArray<FBenchmarkResult> RunDrawPacketBenchmarks(int32 InNumDraws, TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief FDrawPacketBuffer::SortPackets의 방식별(8 / 11비트 자릿수, 상수 자릿수 생략, 병렬) 정렬 시간을 std::stable_sort와 비교하는 함수
+	 * 드로우처럼 깊이 / 우선순위 비트가 고정된 키와 64비트 전체가 무작위인 키를 각각 측정한다
+	 * 측정 전에 65536개를 넘는 크기를 포함한 여러 크기에서 모든 방식의 결과가 안정 정렬 결과와 같은지 확인한다
+	 * @param InMaxPackets 측정할 최대 패킷 수 (1k부터 10배씩 늘리며 이 값 이하만 측정)
+	 * @param OutMismatches 결과가 다른 크기 / 방식 (일치하면 비어 있음)
+	 * @return 크기 / 키 분포 / 방식별 측정 결과 (정렬 1회 분량, Baseline은 std::stable_sort)
+	 */
+	static TArray<FBenchmarkResult> RunRadixSortBenchmarks(int32 InMaxPackets, TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief BasePass와 같은 순서의 바인딩을 FRHIStateCache를 거쳐 / 거치지 않고 기록 백엔드에 적용해 비교하는 함수
+	 * 메시를 공유하는 인스턴스가 많은 씬과 모든 프리미티브가 다른 씬을 각각 측정한다
+	 * 측정 전에 모든 드로우 시점의 바인딩 상태가 캐시 없이 적용한 상태와 같은지 확인한다 (Invalidate 이후 프레임 포함)
+	 * @param InNumPrimitives 프레임당 프리미티브 수
+	 * @param OutStats 워크로드마다 한 프레임의 바인딩 전달 / 생략 횟수 (반환 결과와 같은 순서)
+	 * @param OutMismatches 상태가 달라진 워크로드 (일치하면 비어 있음)
+	 * @return 워크로드별 한 프레임 측정 결과 (Baseline은 캐시 없이 모두 전달)
+	 */
+	static TArray<FBenchmarkResult> RunStateCacheBenchmarks(int32 InNumPrimitives, TArray<FRHIStateCacheStats>& OutStats,
+	                                                        TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 드로우마다 경로 문자열로 셰이더를 찾고 모드별 상태를 맵에서 찾던 바인딩과 FRHIPipelineStateRegistry 핸들 바인딩을 비교하는 함수
+	 * 모든 드로우가 같은 조합인 BasePass와 기즈모 / 와이어프레임 / 반투명이 섞인 뷰를 각각 측정한다
+	 * 측정 전에 같은 요청이 같은 핸들로 등록되는지와, 드로우마다 바인딩된 상태가 기존 방식과 같은지 확인한다
+	 * @param InNumDraws 프레임당 드로우 수
+	 * @param OutNumStates 워크로드마다 등록된 파이프라인 상태 수 (반환 결과와 같은 순서)
+	 * @param OutMismatches 등록 / 바인딩 결과가 다른 워크로드 (일치하면 비어 있음)
+	 * @return 워크로드별 한 프레임 바인딩 시간 (Baseline은 드로우마다 조회)
+	 */
+	static TArray<FBenchmarkResult> RunPipelineStateBenchmarks(int32 InNumDraws, TArray<int32>& OutNumStates,
+	                                                           TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 함수 한 번의 실행 시간을 밀리초로 재는 함수 (모든 벤치마크가 같은 시계를 사용)
+	 */
+	template <typename FuncType>
+	static double MeasureMilliseconds(FuncType InFunc)
+	{
+		const auto StartTime = std::chrono::high_resolution_clock::now();
+		InFunc();
+		const auto EndTime = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+	}
+
+	/**
+	 * @brief 측정 전 검증에서 조건이 거짓이면 "<Check>: <Description>" 형식으로 불일치를 기록하는 함수
+	 * 아래 Check 함수들은 모두 같은 형식을 쓰므로 콘솔 명령과 Test 프로젝트가 같은 메시지를 받는다
+	 * @return 통과 여부
+	 */
+	static bool Check(bool bInPassed, const FString& InCheck, const FString& InDescription,
+	                  TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 어긋난 항목 수가 0이 아니면 "<Check>: <개수> <Description>" 형식으로 기록하는 함수
+	 */
+	static bool CheckCount(const FString& InCheck, int64 InNumMismatches, const FString& InDescription,
+	                       TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 최대 오차가 허용 오차를 넘으면 "<Check>: max error <오차> (tolerance <허용 오차>)" 형식으로 기록하는 함수
+	 */
+	static bool CheckTolerance(const FString& InCheck, double InMaxError, double InTolerance,
+	                           TArray<FString>& OutMismatches);
+
+	/**
+	 * @brief 측정 결과를 "Workload Operation Baseline / Engine (xSpeedup)" 한 줄씩으로 만드는 함수
+	 * 열 너비는 결과 중 가장 긴 항목에 맞춘다
+	 */
+	static TArray<FString> FormatResults(const TArray<FBenchmarkResult>& InResults);
+
+	/**
+	 * @brief 측정 결과를 JSON / CSV 파일로 저장하는 함수
+	 * 서로 다른 빌드의 결과를 도구로 비교할 수 있도록 빌드 구성과 측정 시각을 함께 기록한다
+	 * @return 저장 성공 여부
+	 */
+	static bool SaveResultsToJson(const TArray<FBenchmarkResult>& InResults, const FString& InFilePath);
+	static bool SaveResultsToCsv(const TArray<FBenchmarkResult>& InResults, const FString& InFilePath);
+};
@@ -11,6 +11,7 @@ enum class EPrimitiveType : uint8_t;
 struct FLevelMetadata;
 struct FPrimitiveMetadata;
 struct FCameraMetadata;
+class FPropertyTable;
 
 // FontRenderer를 위한 문자 메트릭 구조체
 struct CharacterMetric
@@ -32,6 +33,8 @@ public:
 	static FVector JsonToVector(const JSON& InJsonData);
 	static FString PrimitiveTypeToWideString(EPrimitiveType InType);
 	static EPrimitiveType StringToPrimitiveType(const FString& InTypeString);
+	static void PropertiesToJson(const FPropertyTable& InTable, const void* InObject, JSON& OutJson);
+	static void JsonToProperties(const JSON& InJsonData, const FPropertyTable& InTable, void* OutObject);
 	static JSON PrimitiveMetadataToJson(const FPrimitiveMetadata& InPrimitive);
 	static FPrimitiveMetadata JsonToPrimitive(const JSON& InJsonData, uint32 InID);
 	static JSON CameraMetadataToJson(const FCameraMetadata& InCamera);
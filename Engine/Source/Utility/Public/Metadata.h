@@ -51,6 +51,8 @@ struct FPrimitiveMetadata
 	{
 		return ID == InOther.ID;
 	}
+
+	DECLARE_PROPERTY_TABLE()
 };
 
 /**
@@ -87,6 +89,8 @@ struct FCameraMetadata
 		, FarClip(InFarClip)
 	{
 	}
+
+	DECLARE_PROPERTY_TABLE()
 };
 
 /**
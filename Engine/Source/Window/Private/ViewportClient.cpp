@@ -189,12 +189,14 @@ void FViewportClient::Draw(FViewport* InViewport)
 	ViewFamily.AddView(&View);
 
 	// SceneRenderer
-	if (FSceneRenderer* SceneRenderer = FSceneRenderer::CreateSceneRenderer(ViewFamily))
+	if (!SceneRenderer)
 	{
-		SceneRenderer->Render();
-		delete SceneRenderer;
+		SceneRenderer = MakeUnique<FSceneRenderer>();
 	}
 
+	SceneRenderer->Render(ViewFamily);
+	CullingStats = SceneRenderer->GetViewVisibility().GetStats();
+
 	// UI 렌더링
 	if (auto* UISubsystem = GEngine->GetEngineSubsystem<UUISubsystem>())
 	{
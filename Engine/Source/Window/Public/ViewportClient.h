@@ -1,8 +1,10 @@
 #pragma once
 #include "Source/Global/CoreTypes.h"
 #include "Source/Global/Enum.h"
+#include "Runtime/Renderer/Public/SceneVisibility.h"
 
 class FViewport;
+class FSceneRenderer;
 
 class FViewportClient
 {
@@ -40,6 +42,9 @@ public:
 
 	bool IsOrtho() const { return ViewType != EViewType::Perspective; }
 
+	// 마지막으로 그린 프레임의 절두체 컬링 통계
+	const FViewCullingStats& GetCullingStats() const { return CullingStats; }
+
 public:
 	void Tick(float DeltaSeconds) const;
 	void Draw(FViewport* InViewport);
@@ -87,4 +92,9 @@ private:
 	// 뷰/입력 상태
 	FPoint ViewSize{0, 0};
 	FPoint LastDrag{0, 0};
+
+	// 뷰포트 전용 렌더러 (첫 Draw에서 만들고 프레임 사이에 재사용)
+	TUniquePtr<FSceneRenderer> SceneRenderer;
+
+	FViewCullingStats CullingStats;
 };
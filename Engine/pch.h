@@ -34,6 +34,7 @@
 #include "Global/Quaternion.h"
 #include "Global/Vector.h"
 #include "Global/CoreTypes.h"
+#include "Global/Transform.h"
 #include "Global/Macro.h"
 #include "Global/Function.h"
 #include "Global/Paths.h"
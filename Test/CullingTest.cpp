@@ -0,0 +1,89 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Physics/Public/Frustum.h"
+
+#include <random>
+
+TEST_CASE(Frustum, PointsInsideAndOutside)
+{
+	const FFrustum Frustum(MakeTestViewProjection());
+
+	TEST_CHECK(Frustum.IntersectsPoint(FVector(10.0f, 0.0f, 0.0f)));
+	TEST_CHECK(!Frustum.IntersectsPoint(FVector(-10.0f, 0.0f, 0.0f)));
+	TEST_CHECK(!Frustum.IntersectsPoint(FVector(0.5f, 0.0f, 0.0f)));
+	TEST_CHECK(!Frustum.IntersectsPoint(FVector(2000.0f, 0.0f, 0.0f)));
+	TEST_CHECK(!Frustum.IntersectsPoint(FVector(10.0f, 100.0f, 0.0f)));
+	TEST_CHECK(!Frustum.IntersectsPoint(FVector(10.0f, 0.0f, 100.0f)));
+}
+
+TEST_CASE(Frustum, PlanesFaceInward)
+{
+	// 절두체 안쪽 점은 모든 평면에서 Normal · P + D >= 0
+	const FFrustum Frustum(MakeTestViewProjection());
+	const FVector Inside(50.0f, 1.0f, -1.0f);
+	for (const FVector4& Plane : Frustum.Planes)
+	{
+		TEST_CHECK(Plane.X * Inside.X + Plane.Y * Inside.Y + Plane.Z * Inside.Z + Plane.W >= 0.0f);
+	}
+}
+
+TEST_CASE(Frustum, AABBCases)
+{
+	const FFrustum Frustum(MakeTestViewProjection());
+
+	TEST_CHECK(Frustum.IntersectsAABB(FAABB(FVector(9.0f, -1.0f, -1.0f), FVector(11.0f, 1.0f, 1.0f))));
+	TEST_CHECK(Frustum.IntersectsAABB(FAABB(FVector(-5.0f, -5.0f, -5.0f), FVector(5.0f, 5.0f, 5.0f))));
+	TEST_CHECK(Frustum.IntersectsAABB(FAABB(FVector(990.0f, -1.0f, -1.0f), FVector(1010.0f, 1.0f, 1.0f))));
+	TEST_CHECK(!Frustum.IntersectsAABB(FAABB(FVector(-20.0f, -1.0f, -1.0f), FVector(-10.0f, 1.0f, 1.0f))));
+	TEST_CHECK(!Frustum.IntersectsAABB(FAABB(FVector(1100.0f, -1.0f, -1.0f), FVector(1200.0f, 1.0f, 1.0f))));
+	TEST_CHECK(!Frustum.IntersectsAABB(FAABB(FVector(10.0f, 50.0f, -1.0f), FVector(12.0f, 60.0f, 1.0f))));
+}
+
+TEST_CASE(CullingBoundsBatch, CullMatchesPerBoxTest)
+{
+	const FFrustum Frustum(MakeTestViewProjection());
+
+	std::mt19937 Random(5);
+	std::uniform_real_distribution<float> Position(-300.0f, 300.0f);
+	std::uniform_real_distribution<float> Extent(0.1f, 20.0f);
+
+	// 4의 배수가 아닌 개수로 SIMD 경로와 나머지 경로를 모두 거침
+	FCullingBoundsBatch Batch;
+	TArray<FAABB> Boxes;
+	for (int32 Index = 0; Index < 1001; ++Index)
+	{
+		const FVector Center(Position(Random), Position(Random), Position(Random));
+		const FVector HalfSize(Extent(Random), Extent(Random), Extent(Random));
+		Boxes.Add(FAABB(Center - HalfSize, Center + HalfSize));
+		TEST_CHECK(Batch.Add(Boxes.Last()) == Index);
+	}
+
+	TArray<uint8> Visibility;
+	const int32 NumVisible = Batch.Cull(Frustum, Visibility);
+	TEST_REQUIRE(Visibility.Num() == Boxes.Num());
+
+	int32 NumExpectedVisible = 0;
+	int32 NumDifferent = 0;
+	for (int32 Index = 0; Index < Boxes.Num(); ++Index)
+	{
+		const bool bExpected = Frustum.IntersectsAABB(Boxes[Index]);
+		NumExpectedVisible += bExpected ? 1 : 0;
+		NumDifferent += (Visibility[Index] != 0) != bExpected ? 1 : 0;
+	}
+	TEST_CHECK(NumDifferent == 0);
+	TEST_CHECK(NumVisible == NumExpectedVisible);
+	TEST_CHECK(NumVisible > 0 && NumVisible < Boxes.Num());
+}
+
+TEST_CASE(CullingBoundsBatch, ResetClearsBounds)
+{
+	FCullingBoundsBatch Batch;
+	Batch.Add(FAABB(FVector(9.0f, -1.0f, -1.0f), FVector(11.0f, 1.0f, 1.0f)));
+	Batch.Reset();
+	TEST_CHECK(Batch.Num() == 0);
+
+	TArray<uint8> Visibility;
+	TEST_CHECK(Batch.Cull(FFrustum(MakeTestViewProjection()), Visibility) == 0);
+	TEST_CHECK(Visibility.IsEmpty());
+}
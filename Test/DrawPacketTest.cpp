@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Runtime/Renderer/Public/DrawPacket.h"
+
+#include <random>
+
+namespace
+{
+	/**
+	 * @brief 키가 자주 겹치는 패킷 배열 (ProxyIndex에 추가 순서를 기록해 안정성을 확인)
+	 * @param InKeyMask 키에 남길 비트 (상위 자릿수가 모두 같으면 건너뛰기 경로를 거침)
+	 */
+	TArray<FDrawPacket> MakePackets(int32 InCount, uint64 InKeyMask, uint32 InSeed)
+	{
+		std::mt19937_64 Random(InSeed);
+		FDrawPacketBuffer Buffer;
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			Buffer.AddSceneProxy((Random() & InKeyMask) % 4093, nullptr, Index, 0, 0);
+		}
+		return Buffer.GetPackets();
+	}
+
+	/**
+	 * @return 두 배열의 키 / 추가 순서가 모두 같으면 true
+	 */
+	bool HasSameOrder(const TArray<FDrawPacket>& InA, const TArray<FDrawPacket>& InB)
+	{
+		if (InA.Num() != InB.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < InA.Num(); ++Index)
+		{
+			if (InA[Index].SortKey != InB[Index].SortKey ||
+				InA[Index].SceneProxy.ProxyIndex != InB[Index].SceneProxy.ProxyIndex)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	TArray<FDrawPacket> MakeStableSorted(const TArray<FDrawPacket>& InPackets)
+	{
+		TArray<FDrawPacket> Result = InPackets;
+		std::stable_sort(Result.begin(), Result.end(), [](const FDrawPacket& InA, const FDrawPacket& InB)
+		{
+			return InA.SortKey < InB.SortKey;
+		});
+		return Result;
+	}
+}
+
+TEST_CASE(DrawPacket, SortKeepsInsertionOrderForEqualKeys)
+{
+	FDrawPacketBuffer Buffer;
+	Buffer.AddSceneProxy(2, nullptr, 0, 0, 0);
+	Buffer.AddSceneProxy(1, nullptr, 1, 0, 0);
+	Buffer.AddSceneProxy(2, nullptr, 2, 0, 0);
+	Buffer.AddSceneProxy(1, nullptr, 3, 0, 0);
+	Buffer.Sort();
+
+	const TArray<FDrawPacket>& Packets = Buffer.GetPackets();
+	TEST_REQUIRE(Packets.Num() == 4);
+	TEST_CHECK(Packets[0].SceneProxy.ProxyIndex == 1);
+	TEST_CHECK(Packets[1].SceneProxy.ProxyIndex == 3);
+	TEST_CHECK(Packets[2].SceneProxy.ProxyIndex == 0);
+	TEST_CHECK(Packets[3].SceneProxy.ProxyIndex == 2);
+}
+
+TEST_CASE(DrawPacket, SortMatchesStableSortForEveryOption)
+{
+	const TArray<FDrawPacket> Source = MakePackets(5000, ~0ull, 7);
+	const TArray<FDrawPacket> Expected = MakeStableSorted(Source);
+
+	FDrawPacketSortScratch Scratch;
+	for (const int32 DigitBits : {8, 11})
+	{
+		for (const bool bSkipConstantDigits : {false, true})
+		{
+			for (const int32 NumTasks : {1, 3})
+			{
+				TArray<FDrawPacket> Packets = Source;
+				FDrawPacketBuffer::SortPackets(Packets, Scratch, {DigitBits, bSkipConstantDigits, NumTasks});
+				TEST_CHECK(HasSameOrder(Packets, Expected));
+			}
+		}
+	}
+}
+
+TEST_CASE(DrawPacket, SortHandlesMoreThanSixteenBitsOfPackets)
+{
+	// 패킷 수 / 키 모두 16비트를 넘는 경우 (건너뛰지 않는 상위 자릿수 포함)
+	std::mt19937_64 Random(11);
+	FDrawPacketBuffer Buffer;
+	for (int32 Index = 0; Index < 70000; ++Index)
+	{
+		Buffer.AddSceneProxy(Random(), nullptr, Index, 0, 0);
+	}
+	const TArray<FDrawPacket> Expected = MakeStableSorted(Buffer.GetPackets());
+
+	Buffer.Sort({8, true, 0});
+	TEST_CHECK(HasSameOrder(Buffer.GetPackets(), Expected));
+}
+
+TEST_CASE(DrawPacket, SortReusesScratchAcrossCalls)
+{
+	FDrawPacketSortScratch Scratch;
+	for (uint32 Seed = 0; Seed < 3; ++Seed)
+	{
+		TArray<FDrawPacket> Packets = MakePackets(1000 + Seed * 500, 0xFF, Seed);
+		const TArray<FDrawPacket> Expected = MakeStableSorted(Packets);
+		FDrawPacketBuffer::SortPackets(Packets, Scratch);
+		TEST_CHECK(HasSameOrder(Packets, Expected));
+	}
+}
+
+TEST_CASE(DrawPacket, AddViewReusesIdenticalLastView)
+{
+	FDrawPacketBuffer Buffer;
+	const FMatrix Projection = MakeTestViewProjection();
+	const FMatrix OtherView = FMatrix::TranslationMatrix(FVector(1.0f, 0.0f, 0.0f));
+
+	TEST_CHECK(Buffer.AddView(FMatrix::Identity(), Projection) == 0);
+	TEST_CHECK(Buffer.AddView(FMatrix::Identity(), Projection) == 0);
+	TEST_CHECK(Buffer.AddView(OtherView, Projection) == 1);
+	TEST_CHECK(Buffer.AddView(FMatrix::Identity(), Projection) == 2);
+
+	Buffer.Reset();
+	TEST_CHECK(Buffer.AddView(OtherView, Projection) == 0);
+}
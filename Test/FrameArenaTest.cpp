@@ -0,0 +1,161 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Runtime/Core/Public/FrameArena.h"
+
+namespace
+{
+	/**
+	 * @brief 모든 프레임 버퍼를 재설정해 테스트가 빈 현재 버퍼에서 시작하도록 하는 함수
+	 * 아레나는 전역 싱글톤이라 다른 테스트가 남긴 할당이 있을 수 있다
+	 */
+	FFrameArena& GetResetArena()
+	{
+		FFrameArena& Arena = FFrameArena::GetInstance();
+		for (uint32 Frame = 0; Frame < FFrameArena::NumBufferedFrames; ++Frame)
+		{
+			Arena.BeginFrame();
+		}
+		return Arena;
+	}
+
+	bool IsAligned(const void* InMemory, size_t InAlignment)
+	{
+		return (reinterpret_cast<uintptr_t>(InMemory) & (InAlignment - 1)) == 0;
+	}
+
+	struct alignas(64) FCacheLineValue
+	{
+		int32 Value;
+
+		explicit FCacheLineValue(int32 InValue) : Value(InValue) {}
+	};
+}
+
+TEST_CASE(FrameArena, AllocationsHonorAlignment)
+{
+	FFrameArena& Arena = GetResetArena();
+
+	int32 NumMisaligned = 0;
+	for (size_t Alignment = 1; Alignment <= 4096; Alignment <<= 1)
+	{
+		// 홀수 크기 할당으로 커서를 어긋나게 만든 뒤 정렬 할당
+		Arena.Allocate(3, 1);
+		NumMisaligned += IsAligned(Arena.Allocate(24, Alignment), Alignment) ? 0 : 1;
+	}
+	TEST_CHECK(NumMisaligned == 0);
+
+	TEST_CHECK(IsAligned(Arena.Allocate(16), FFrameArena::DefaultAlignment));
+
+	Arena.Allocate(1, 1);
+	const FCacheLineValue* Value = Arena.New<FCacheLineValue>(42);
+	TEST_CHECK(IsAligned(Value, 64));
+	TEST_CHECK(Value->Value == 42);
+}
+
+TEST_CASE(FrameArena, BufferIsReusedAfterBufferedFrames)
+{
+	FFrameArena& Arena = GetResetArena();
+	const uint64 StartFrame = Arena.GetFrameNumber();
+
+	void* FirstFrameMemory = Arena.Allocate(256);
+	TEST_CHECK(Arena.GetUsedBytes() == 256);
+	TEST_CHECK(Arena.GetNumAllocations() == 1);
+
+	// 다음 프레임은 다른 버퍼를 쓰므로 직전 프레임의 메모리는 그대로 유효하다
+	std::memset(FirstFrameMemory, 0x5A, 256);
+	Arena.BeginFrame();
+	TEST_CHECK(Arena.GetUsedBytes() == 0);
+	TEST_CHECK(Arena.GetLastFrameUsedBytes() == 256);
+	void* SecondFrameMemory = Arena.Allocate(256);
+	TEST_CHECK(SecondFrameMemory != FirstFrameMemory);
+	TEST_CHECK(static_cast<uint8*>(FirstFrameMemory)[255] == 0x5A);
+	const size_t ReservedBytes = Arena.GetReservedBytes();
+
+	// NumBufferedFrames 프레임 뒤에는 같은 버퍼의 같은 페이지를 처음부터 다시 채운다
+	for (uint32 Frame = 1; Frame < FFrameArena::NumBufferedFrames; ++Frame)
+	{
+		Arena.BeginFrame();
+	}
+	TEST_CHECK(Arena.GetFrameNumber() == StartFrame + FFrameArena::NumBufferedFrames);
+	TEST_CHECK(Arena.GetUsedBytes() == 0);
+	TEST_CHECK(Arena.Allocate(256) == FirstFrameMemory);
+	TEST_CHECK(Arena.GetReservedBytes() == ReservedBytes);
+}
+
+TEST_CASE(FrameArena, FreeRewindsOnlyTheLastAllocation)
+{
+	FFrameArena& Arena = GetResetArena();
+
+	void* First = Arena.Allocate(64);
+	void* Second = Arena.Allocate(64);
+
+	// 마지막 할당이 아니면 무시
+	Arena.Free(First, 64);
+	TEST_CHECK(Arena.GetUsedBytes() == 128);
+
+	Arena.Free(Second, 64);
+	TEST_CHECK(Arena.GetUsedBytes() == 64);
+	TEST_CHECK(Arena.Allocate(64) == Second);
+}
+
+TEST_CASE(FrameArena, FrameLargerThanPageSpillsToNextPage)
+{
+	FFrameArena& Arena = GetResetArena();
+	const size_t HalfPage = FFrameArena::DefaultPageSize / 2;
+
+	uint8* First = static_cast<uint8*>(Arena.Allocate(HalfPage + 1));
+	const size_t ReservedAfterFirst = Arena.GetReservedBytes();
+
+	// 첫 페이지에 남은 공간보다 커서 다음 페이지로 넘어간다 (처음 쓰는 페이지라면 새로 확보)
+	uint8* Second = static_cast<uint8*>(Arena.Allocate(HalfPage + 1));
+	TEST_CHECK(Second < First || Second >= First + HalfPage + 1);
+	TEST_CHECK(Arena.GetUsedBytes() == 2 * (HalfPage + 1));
+	TEST_CHECK(Arena.GetReservedBytes() >= ReservedAfterFirst);
+	TEST_CHECK(IsAligned(Second, FFrameArena::DefaultAlignment));
+
+	std::memset(First, 1, HalfPage + 1);
+	std::memset(Second, 2, HalfPage + 1);
+	TEST_CHECK(First[HalfPage] == 1);
+	TEST_CHECK(Second[0] == 2);
+
+	// 페이지보다 큰 요청은 전용 메모리를 받고, 버퍼가 재설정될 때 반환된다
+	const size_t ReservedBeforeOversized = Arena.GetReservedBytes();
+	const size_t OversizedBytes = FFrameArena::DefaultPageSize * 2;
+	uint8* Oversized = static_cast<uint8*>(Arena.Allocate(OversizedBytes, 256));
+	TEST_CHECK(IsAligned(Oversized, 256));
+	TEST_CHECK(Arena.GetReservedBytes() >= ReservedBeforeOversized + OversizedBytes);
+	std::memset(Oversized, 3, OversizedBytes);
+
+	// 기본 페이지는 남아 있으므로 이후 할당은 현재 페이지에서 이어진다
+	uint8* AfterOversized = static_cast<uint8*>(Arena.Allocate(16));
+	TEST_CHECK(AfterOversized >= Second + HalfPage + 1);
+	TEST_CHECK(AfterOversized < Second + HalfPage + 1 + FFrameArena::DefaultAlignment);
+
+	for (uint32 Frame = 0; Frame < FFrameArena::NumBufferedFrames; ++Frame)
+	{
+		Arena.BeginFrame();
+	}
+	TEST_CHECK(Arena.GetReservedBytes() == ReservedBeforeOversized);
+	TEST_CHECK(Arena.GetHighWaterMark() >= 2 * (HalfPage + 1) + OversizedBytes);
+
+	// 재설정 후에는 확보해 둔 페이지를 다시 써서 새 페이지를 만들지 않는다
+	Arena.Allocate(HalfPage + 1);
+	Arena.Allocate(HalfPage + 1);
+	TEST_CHECK(Arena.GetReservedBytes() == ReservedBeforeOversized);
+}
+
+TEST_CASE(FrameArena, FrameArrayGrowsInsideArena)
+{
+	FFrameArena& Arena = GetResetArena();
+
+	TFrameArray<int32> Values;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Values.Add(Index);
+	}
+	TEST_CHECK(Values.Num() == 1000);
+	TEST_CHECK(Values[999] == 999);
+	TEST_CHECK(Arena.GetNumAllocations() > 0);
+	TEST_CHECK(Arena.GetUsedBytes() >= 1000 * sizeof(int32));
+}
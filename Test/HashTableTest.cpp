@@ -0,0 +1,232 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+namespace
+{
+	/**
+	 * @brief 모든 키를 같은 홈 버킷으로 보내는 해셔 (최악의 충돌)
+	 */
+	struct FConstantHasher
+	{
+		size_t operator()(int32) const { return 0; }
+	};
+
+	/**
+	 * @brief 홈 버킷을 직접 정하는 해셔
+	 * 테이블은 (Hash * 0x9E3779B97F4A7C15)의 상위 비트를 홈 버킷으로 쓰므로, 그 역원을 곱해 두면
+	 * 키의 상위 비트가 그대로 홈 버킷이 된다 (키 i << 50은 용량 2^n에서 홈 버킷 i >> (14 - n))
+	 */
+	struct FHomeBucketHasher
+	{
+		size_t operator()(uint64 InKey) const { return static_cast<size_t>(InKey * 0xF1DE83E19937733Dull); }
+	};
+
+	uint64 MakeClusteredKey(int32 InIndex)
+	{
+		return static_cast<uint64>(InIndex) << 50;
+	}
+
+	bool IsPowerOfTwo(int32 InValue)
+	{
+		return InValue > 0 && (InValue & (InValue - 1)) == 0;
+	}
+}
+
+TEST_CASE(HashTable, CollidingKeysStayFindable)
+{
+	TMap<int32, int32, FConstantHasher> Map;
+	for (int32 Key = 0; Key < 200; ++Key)
+	{
+		Map.Add(Key, Key * 10);
+	}
+	TEST_REQUIRE(Map.Num() == 200);
+
+	int32 NumMissing = 0;
+	for (int32 Key = 0; Key < 200; ++Key)
+	{
+		const int32* Value = Map.Find(Key);
+		NumMissing += Value && *Value == Key * 10 ? 0 : 1;
+	}
+	TEST_CHECK(NumMissing == 0);
+	TEST_CHECK(Map.Find(200) == nullptr);
+}
+
+TEST_CASE(HashTable, BackwardShiftDeleteKeepsClusterFindable)
+{
+	// 한 클러스터 가운데와 끝을 지워도 뒤따르는 원소가 당겨져 나머지는 계속 찾아져야 한다
+	TMap<int32, int32, FConstantHasher> Map;
+	for (int32 Key = 0; Key < 32; ++Key)
+	{
+		Map.Add(Key, Key);
+	}
+
+	for (int32 Key = 0; Key < 32; Key += 3)
+	{
+		TEST_CHECK(Map.Remove(Key) == 1);
+	}
+	TEST_CHECK(Map.Remove(0) == 0);
+	TEST_CHECK(Map.Num() == 21);
+
+	int32 NumWrong = 0;
+	for (int32 Key = 0; Key < 32; ++Key)
+	{
+		const bool bRemoved = Key % 3 == 0;
+		const int32* Value = Map.Find(Key);
+		NumWrong += bRemoved ? (Value != nullptr ? 1 : 0) : (Value && *Value == Key ? 0 : 1);
+	}
+	TEST_CHECK(NumWrong == 0);
+
+	// 지운 자리에 다시 넣어도 중복 없이 들어가야 한다
+	Map.Add(3, 300);
+	Map.Add(4, 400);
+	TEST_CHECK(Map.Num() == 22);
+	TEST_CHECK(*Map.Find(3) == 300);
+	TEST_CHECK(*Map.Find(4) == 400);
+}
+
+TEST_CASE(HashTable, ClusteredGrowthDoesNotOverflowProbeDistance)
+{
+	// 용량이 작을 때 한 구간에 몰리는 키라 재삽입 중에도 탐사 거리 한도(255)를 넘을 수 있다
+	TSet<uint64, FHomeBucketHasher> Set;
+	for (int32 Index = 0; Index < 300; ++Index)
+	{
+		Set.Add(MakeClusteredKey(Index));
+	}
+	TEST_REQUIRE(Set.Num() == 300);
+
+	int32 NumMissing = 0;
+	for (int32 Index = 0; Index < 300; ++Index)
+	{
+		NumMissing += Set.Contains(MakeClusteredKey(Index)) ? 0 : 1;
+	}
+	TEST_CHECK(NumMissing == 0);
+
+	// 원소 수에 맞춘 용량(512)으로 줄이면 한도를 넘으므로 더 큰 용량에 머물러야 한다
+	Set.Shrink();
+	TEST_CHECK(IsPowerOfTwo(Set.GetCapacity()));
+	TEST_CHECK(Set.GetCapacity() > 512);
+
+	NumMissing = 0;
+	int32 NumVisited = 0;
+	for (uint64 Key : Set)
+	{
+		NumMissing += Set.Contains(Key) ? 0 : 1;
+		++NumVisited;
+	}
+	TEST_CHECK(NumMissing == 0);
+	TEST_CHECK(NumVisited == 300);
+}
+
+TEST_CASE(HashTable, RehashZeroOnEmptyReleasesSlots)
+{
+	TSet<int32> Set;
+	Set.Rehash(0);
+	TEST_CHECK(Set.GetCapacity() == 0);
+
+	Set.Rehash(1);
+	TEST_CHECK(Set.GetCapacity() == 8);
+
+	Set.Rehash(0);
+	TEST_CHECK(Set.GetCapacity() == 0);
+	TEST_CHECK(Set.begin() == Set.end());
+
+	Set.Add(7);
+	TEST_CHECK(Set.Contains(7));
+	TEST_CHECK(Set.GetCapacity() == 8);
+}
+
+TEST_CASE(HashTable, IteratorsReacquiredAfterRehashSeeSameElements)
+{
+	TMap<int32, int32> Map;
+	for (int32 Key = 0; Key < 100; ++Key)
+	{
+		Map.Add(Key, Key * 2);
+	}
+
+	const auto It = Map.begin();
+	const int32 FirstKey = It->first;
+	Map.Rehash(1024);
+	TEST_CHECK(Map.GetCapacity() == 1024);
+
+	// 재해시 이후 기존 반복자는 무효이므로 다시 얻어 순회한다
+	TArray<int32> SeenCounts;
+	SeenCounts.SetNum(100);
+	int64 ValueSum = 0;
+	for (const auto& [Key, Value] : Map)
+	{
+		++SeenCounts[Key];
+		ValueSum += Value;
+	}
+
+	int32 NumNotOnce = 0;
+	for (int32 Count : SeenCounts)
+	{
+		NumNotOnce += Count == 1 ? 0 : 1;
+	}
+	TEST_CHECK(NumNotOnce == 0);
+	TEST_CHECK(ValueSum == 99 * 100);
+	TEST_CHECK(*Map.Find(FirstKey) == FirstKey * 2);
+
+	Map.Shrink();
+	TEST_CHECK(Map.GetCapacity() == 128);
+	TEST_CHECK(*Map.Find(FirstKey) == FirstKey * 2);
+}
+
+TEST_CASE(HashTable, IterationVisitsEverySlotPosition)
+{
+	// 8슬롯 단위로 읽는 순회가 단어 경계와 마지막 슬롯의 원소를 놓치지 않는지 여러 크기로 확인
+	for (int32 NumElements = 0; NumElements <= 70; ++NumElements)
+	{
+		TSet<int32> Set;
+		for (int32 Value = 0; Value < NumElements; ++Value)
+		{
+			Set.Add(Value * 7919);
+		}
+
+		int32 NumVisited = 0;
+		int64 Sum = 0;
+		for (int32 Value : Set)
+		{
+			++NumVisited;
+			Sum += Value;
+		}
+		TEST_CHECK(NumVisited == NumElements);
+		TEST_CHECK(Sum == 7919ll * NumElements * (NumElements - 1) / 2);
+	}
+}
+
+TEST_CASE(HashTable, StringKeysSurviveGrowthAndRemoval)
+{
+	// 키가 const FString인 원소는 옮길 때 키를 이동하므로, 재해시 / 밀어내기 / Backward Shift 이후에도 문자열이 온전해야 한다
+	TMap<FString, int32> Map;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Map.Add("StringKey_" + std::to_string(Index) + "_with_heap_storage", Index);
+	}
+	TEST_REQUIRE(Map.Num() == 1000);
+
+	for (int32 Index = 0; Index < 1000; Index += 2)
+	{
+		TEST_CHECK(Map.Remove("StringKey_" + std::to_string(Index) + "_with_heap_storage") == 1);
+	}
+	TEST_CHECK(Map.Num() == 500);
+
+	int32 NumWrong = 0;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		const int32* Value = Map.Find("StringKey_" + std::to_string(Index) + "_with_heap_storage");
+		NumWrong += Index % 2 == 0 ? (Value != nullptr ? 1 : 0) : (Value && *Value == Index ? 0 : 1);
+	}
+	TEST_CHECK(NumWrong == 0);
+
+	int32 NumMismatchedKeys = 0;
+	for (const auto& [Key, Value] : Map)
+	{
+		NumMismatchedKeys += Key == "StringKey_" + std::to_string(Value) + "_with_heap_storage" ? 0 : 1;
+	}
+	TEST_CHECK(NumMismatchedKeys == 0);
+
+	Map.Shrink();
+	TEST_CHECK(Map.Find("StringKey_999_with_heap_storage") != nullptr);
+	TEST_CHECK(Map.Find("StringKey_998_with_heap_storage") == nullptr);
+}
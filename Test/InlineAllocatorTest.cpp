@@ -0,0 +1,211 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+namespace
+{
+	constexpr int32 NumInline = 4;
+
+	/**
+	 * @brief 살아있는 인스턴스 수를 세는 비트리비얼 원소 (이동된 원본은 Value가 -1)
+	 */
+	struct FTrackedValue
+	{
+		static inline int32 NumLive = 0;
+
+		int32 Value = 0;
+
+		FTrackedValue(int32 InValue = 0) : Value(InValue) { ++NumLive; }
+		FTrackedValue(const FTrackedValue& InOther) : Value(InOther.Value) { ++NumLive; }
+
+		FTrackedValue(FTrackedValue&& InOther) noexcept : Value(InOther.Value)
+		{
+			InOther.Value = -1;
+			++NumLive;
+		}
+
+		FTrackedValue& operator=(const FTrackedValue& InOther) = default;
+
+		FTrackedValue& operator=(FTrackedValue&& InOther) noexcept
+		{
+			Value = InOther.Value;
+			InOther.Value = -1;
+			return *this;
+		}
+
+		~FTrackedValue() { --NumLive; }
+
+		bool operator==(const FTrackedValue& InOther) const { return Value == InOther.Value; }
+	};
+
+	using FInlineArray = TArray<FTrackedValue, TInlineAllocator<NumInline>>;
+
+	FInlineArray MakeArray(int32 InCount, int32 InFirstValue)
+	{
+		FInlineArray Result;
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			Result.Emplace(InFirstValue + Index);
+		}
+		return Result;
+	}
+
+	bool HasValues(const FInlineArray& InArray, int32 InCount, int32 InFirstValue)
+	{
+		if (InArray.Num() != InCount)
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			if (InArray[Index].Value != InFirstValue + Index)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @return 원소 버퍼가 배열 객체 내부에 있으면 true
+	 */
+	bool IsStoredInObject(const FInlineArray& InArray)
+	{
+		const uint8* Object = reinterpret_cast<const uint8*>(&InArray);
+		const uint8* Data = reinterpret_cast<const uint8*>(InArray.GetData());
+		return Data >= Object && Data < Object + sizeof(FInlineArray);
+	}
+}
+
+TEST_CASE(InlineAllocator, StaysInlineUpToCapacity)
+{
+	{
+		const FInlineArray Array = MakeArray(NumInline, 0);
+		TEST_CHECK(Array.ToStdVector().IsInline());
+		TEST_CHECK(IsStoredInObject(Array));
+		TEST_CHECK(Array.Max() == NumInline);
+		TEST_CHECK(HasValues(Array, NumInline, 0));
+	}
+	TEST_CHECK(FTrackedValue::NumLive == 0);
+}
+
+TEST_CASE(InlineAllocator, SpillsToHeapPastCapacity)
+{
+	{
+		FInlineArray Array = MakeArray(NumInline, 0);
+		Array.Emplace(NumInline);
+
+		TEST_CHECK(!Array.ToStdVector().IsInline());
+		TEST_CHECK(!IsStoredInObject(Array));
+		TEST_CHECK(Array.Max() >= NumInline + 1);
+		TEST_CHECK(HasValues(Array, NumInline + 1, 0));
+		TEST_CHECK(FTrackedValue::NumLive == NumInline + 1);
+	}
+	TEST_CHECK(FTrackedValue::NumLive == 0);
+}
+
+TEST_CASE(InlineAllocator, SpillingAddMayReferenceOwnElement)
+{
+	// 인라인 버퍼가 가득 찬 상태에서 자기 원소를 추가해도 옮기기 전에 값을 복사해야 함
+	FInlineArray Array = MakeArray(NumInline, 10);
+	Array.Add(Array[1]);
+	TEST_CHECK(!Array.ToStdVector().IsInline());
+	TEST_REQUIRE(Array.Num() == NumInline + 1);
+	TEST_CHECK(Array[1].Value == 11);
+	TEST_CHECK(Array.Last().Value == 11);
+}
+
+TEST_CASE(InlineAllocator, ShrinkReturnsToInlineBuffer)
+{
+	{
+		FInlineArray Array = MakeArray(NumInline * 2, 0);
+		Array.SetNum(NumInline - 1);
+		TEST_CHECK(!Array.ToStdVector().IsInline());
+
+		Array.Shrink();
+		TEST_CHECK(Array.ToStdVector().IsInline());
+		TEST_CHECK(IsStoredInObject(Array));
+		TEST_CHECK(HasValues(Array, NumInline - 1, 0));
+	}
+	TEST_CHECK(FTrackedValue::NumLive == 0);
+}
+
+TEST_CASE(InlineAllocator, CopyBetweenInlineAndHeapArrays)
+{
+	{
+		const FInlineArray InlineSource = MakeArray(2, 100);
+		const FInlineArray HeapSource = MakeArray(NumInline + 3, 200);
+
+		// 힙 쪽 배열에 인라인 배열을 복사하면 원소만 바뀌고, 반대 방향은 새로 힙으로 넘어감
+		FInlineArray HeapTarget = MakeArray(NumInline + 1, 0);
+		HeapTarget = InlineSource;
+		TEST_CHECK(HasValues(HeapTarget, 2, 100));
+
+		FInlineArray InlineTarget = MakeArray(1, 0);
+		InlineTarget = HeapSource;
+		TEST_CHECK(!InlineTarget.ToStdVector().IsInline());
+		TEST_CHECK(HasValues(InlineTarget, NumInline + 3, 200));
+
+		const FInlineArray InlineCopy(InlineSource);
+		const FInlineArray HeapCopy(HeapSource);
+		TEST_CHECK(InlineCopy.ToStdVector().IsInline());
+		TEST_CHECK(HeapCopy.GetData() != HeapSource.GetData());
+		TEST_CHECK(HasValues(HeapCopy, NumInline + 3, 200));
+
+		TEST_CHECK(HasValues(InlineSource, 2, 100));
+		TEST_CHECK(HasValues(HeapSource, NumInline + 3, 200));
+	}
+	TEST_CHECK(FTrackedValue::NumLive == 0);
+}
+
+TEST_CASE(InlineAllocator, MoveFromHeapArrayStealsBuffer)
+{
+	{
+		FInlineArray Source = MakeArray(NumInline + 2, 0);
+		const FTrackedValue* SourceData = Source.GetData();
+
+		FInlineArray InlineTarget = MakeArray(1, 50);
+		InlineTarget = std::move(Source);
+		TEST_CHECK(InlineTarget.GetData() == SourceData);
+		TEST_CHECK(HasValues(InlineTarget, NumInline + 2, 0));
+		TEST_CHECK(Source.IsEmpty());
+		TEST_CHECK(Source.ToStdVector().IsInline());
+
+		const FInlineArray Constructed(std::move(InlineTarget));
+		TEST_CHECK(Constructed.GetData() == SourceData);
+		TEST_CHECK(InlineTarget.IsEmpty());
+	}
+	TEST_CHECK(FTrackedValue::NumLive == 0);
+}
+
+TEST_CASE(InlineAllocator, MoveFromInlineArrayMovesElements)
+{
+	{
+		FInlineArray Source = MakeArray(NumInline - 1, 30);
+
+		// 힙을 쓰던 대상은 버퍼를 반환하고 인라인 원소를 하나씩 옮겨 받음
+		FInlineArray HeapTarget = MakeArray(NumInline * 2, 0);
+		HeapTarget = std::move(Source);
+		TEST_CHECK(HeapTarget.ToStdVector().IsInline());
+		TEST_CHECK(IsStoredInObject(HeapTarget));
+		TEST_CHECK(HasValues(HeapTarget, NumInline - 1, 30));
+		TEST_CHECK(Source.IsEmpty());
+		TEST_CHECK(FTrackedValue::NumLive == NumInline - 1);
+
+		const FInlineArray Constructed(std::move(HeapTarget));
+		TEST_CHECK(IsStoredInObject(Constructed));
+		TEST_CHECK(HasValues(Constructed, NumInline - 1, 30));
+	}
+	TEST_CHECK(FTrackedValue::NumLive == 0);
+}
+
+TEST_CASE(InlineAllocator, ConvertsFromDefaultAllocatorArray)
+{
+	const TArray<int32> Heap = {1, 2, 3, 4, 5, 6};
+	const TArray<int32, TInlineAllocator<NumInline>> Converted(Heap);
+	TEST_CHECK(Converted.Num() == Heap.Num());
+	TEST_CHECK(!Converted.ToStdVector().IsInline());
+	TEST_CHECK(std::equal(Converted.begin(), Converted.end(), Heap.begin()));
+
+	const TArray<int32> Back(Converted);
+	TEST_CHECK(Back == Heap);
+}
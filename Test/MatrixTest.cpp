@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Global/MatrixMath.h"
+
+#include <random>
+
+namespace
+{
+	/**
+	 * @brief 성분이 [-2, 2] 범위인 임의 행렬
+	 */
+	FMatrix MakeRandomMatrix(std::mt19937& InRandom)
+	{
+		std::uniform_real_distribution<float> Value(-2.0f, 2.0f);
+		FMatrix Result;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				Result.Data[Row][Column] = Value(InRandom);
+			}
+		}
+		return Result;
+	}
+
+	FMatrix MakeModelMatrix()
+	{
+		return FMatrix::GetModelMatrix(FVector(3.0f, -2.0f, 5.0f), FVector(0.3f, -1.1f, 2.0f),
+		                               FVector(1.5f, 0.5f, 2.0f));
+	}
+}
+
+TEST_CASE(Matrix, MultiplyByIdentityKeepsMatrix)
+{
+	std::mt19937 Random(1);
+	const FMatrix Matrix = MakeRandomMatrix(Random);
+
+	TEST_CHECK(GetMaxDifference(Matrix * FMatrix::Identity(), Matrix) == 0.0f);
+	TEST_CHECK(GetMaxDifference(FMatrix::Identity() * Matrix, Matrix) == 0.0f);
+}
+
+TEST_CASE(Matrix, TransposeTwiceKeepsMatrix)
+{
+	std::mt19937 Random(2);
+	const FMatrix Matrix = MakeRandomMatrix(Random);
+	const FMatrix Transposed = Matrix.Transpose();
+
+	TEST_CHECK(Transposed.Data[0][3] == Matrix.Data[3][0]);
+	TEST_CHECK(Transposed.Data[2][1] == Matrix.Data[1][2]);
+	TEST_CHECK(GetMaxDifference(Transposed.Transpose(), Matrix) == 0.0f);
+}
+
+TEST_CASE(Matrix, InverseTimesMatrixIsIdentity)
+{
+	const FMatrix Matrix = MakeModelMatrix();
+	TEST_CHECK(GetMaxDifference(Matrix.Inverse() * Matrix, FMatrix::Identity()) < 1e-5f);
+	TEST_CHECK(GetMaxDifference(Matrix * Matrix.Inverse(), FMatrix::Identity()) < 1e-5f);
+}
+
+TEST_CASE(Matrix, InverseAffineMatchesGeneralInverse)
+{
+	const FMatrix Matrix = MakeModelMatrix();
+	TEST_CHECK(GetMaxDifference(Matrix.InverseAffine(), Matrix.Inverse()) < 1e-5f);
+}
+
+TEST_CASE(Matrix, SingularInverseFails)
+{
+	FMatrix Singular = FMatrix::Identity();
+	Singular.Data[2][2] = 0.0f;
+
+	FMatrix Result;
+	TEST_CHECK(!MatrixMath::Scalar::Inverse(Result, Singular));
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+	TEST_CHECK(!MatrixMath::Simd::Inverse(Result, Singular));
+#endif
+}
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+TEST_CASE(Matrix, SimdMultiplyTransposeTransformMatchScalarExactly)
+{
+	std::mt19937 Random(3);
+	for (int32 Iteration = 0; Iteration < 64; ++Iteration)
+	{
+		const FMatrix A = MakeRandomMatrix(Random);
+		const FMatrix B = MakeRandomMatrix(Random);
+
+		FMatrix ScalarResult;
+		FMatrix SimdResult;
+		MatrixMath::Scalar::Multiply(ScalarResult, A, B);
+		MatrixMath::Simd::Multiply(SimdResult, A, B);
+		TEST_CHECK(GetMaxDifference(ScalarResult, SimdResult) == 0.0f);
+
+		MatrixMath::Scalar::Transpose(ScalarResult, A);
+		MatrixMath::Simd::Transpose(SimdResult, A);
+		TEST_CHECK(GetMaxDifference(ScalarResult, SimdResult) == 0.0f);
+
+		const FVector Position(A.Data[0][0], B.Data[1][1], A.Data[2][3]);
+		const FVector ScalarPosition = MatrixMath::Scalar::TransformPosition(Position, A);
+		const FVector SimdPosition = MatrixMath::Simd::TransformPosition(Position, A);
+		TEST_CHECK(ScalarPosition.X == SimdPosition.X && ScalarPosition.Y == SimdPosition.Y &&
+			ScalarPosition.Z == SimdPosition.Z);
+	}
+}
+
+TEST_CASE(Matrix, SimdMultiplyAllowsAliasedOutput)
+{
+	std::mt19937 Random(4);
+	const FMatrix A = MakeRandomMatrix(Random);
+	const FMatrix B = MakeRandomMatrix(Random);
+
+	FMatrix Expected;
+	MatrixMath::Scalar::Multiply(Expected, A, B);
+
+	FMatrix InOut = A;
+	MatrixMath::Simd::Multiply(InOut, InOut, B);
+	TEST_CHECK(GetMaxDifference(InOut, Expected) == 0.0f);
+}
+
+TEST_CASE(Matrix, SimdInverseMatchesScalarWithinRounding)
+{
+	const FMatrix Matrix = MakeModelMatrix();
+
+	FMatrix ScalarInverse;
+	FMatrix SimdInverse;
+	TEST_REQUIRE(MatrixMath::Scalar::Inverse(ScalarInverse, Matrix));
+	TEST_REQUIRE(MatrixMath::Simd::Inverse(SimdInverse, Matrix));
+	TEST_CHECK(GetMaxDifference(ScalarInverse, SimdInverse) < 1e-5f);
+
+	TEST_REQUIRE(MatrixMath::Simd::InverseAffine(SimdInverse, Matrix));
+	TEST_CHECK(GetMaxDifference(ScalarInverse, SimdInverse) < 1e-5f);
+}
+#endif
@@ -0,0 +1,110 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Runtime/Core/Public/WeakObjectPtr.h"
+
+TEST_CASE(WeakObjectPtr, ResolvesLiveObject)
+{
+	UObject* Object = new UObject();
+	const TWeakObjectPtr<UObject> Handle(Object);
+
+	TEST_CHECK(Handle.IsValid());
+	TEST_CHECK(!Handle.IsStale());
+	TEST_CHECK(Handle.Get() == Object);
+	TEST_CHECK(Handle.GetWeakHandle().GetObjectIndex() == static_cast<int32>(Object->GetInternalIndex()));
+
+	delete Object;
+}
+
+TEST_CASE(WeakObjectPtr, GoesStaleWhenObjectIsDestroyed)
+{
+	UObject* Object = new UObject();
+	const TWeakObjectPtr<UObject> Handle(Object);
+	const TWeakObjectPtr<UObject> Copy = Handle;
+	delete Object;
+
+	TEST_CHECK(!Handle.IsValid());
+	TEST_CHECK(Handle.IsStale());
+	TEST_CHECK(Handle.Get() == nullptr);
+	TEST_CHECK(!Handle);
+	TEST_CHECK(Copy.Get() == nullptr);
+}
+
+TEST_CASE(WeakObjectPtr, ReusedIndexGetsNewSerial)
+{
+	UObject* OldObject = new UObject();
+	const TWeakObjectPtr<UObject> OldHandle(OldObject);
+	const int32 OldIndex = static_cast<int32>(OldObject->GetInternalIndex());
+	delete OldObject;
+
+	// 방금 비운 슬롯이 재사용 목록의 마지막이므로 다음 객체가 같은 인덱스를 받음
+	UObject* NewObject = new UObject();
+	const TWeakObjectPtr<UObject> NewHandle(NewObject);
+	TEST_REQUIRE(static_cast<int32>(NewObject->GetInternalIndex()) == OldIndex);
+
+	TEST_CHECK(NewHandle.GetWeakHandle().GetObjectIndex() == OldHandle.GetWeakHandle().GetObjectIndex());
+	TEST_CHECK(NewHandle.GetWeakHandle().GetObjectSerialNumber() != OldHandle.GetWeakHandle().GetObjectSerialNumber());
+	TEST_CHECK(OldHandle.Get() == nullptr);
+	TEST_CHECK(OldHandle.IsStale());
+	TEST_CHECK(NewHandle.Get() == NewObject);
+	TEST_CHECK(OldHandle != NewHandle);
+
+	delete NewObject;
+}
+
+TEST_CASE(WeakObjectPtr, NullAndResetHandlesAreNotStale)
+{
+	const TWeakObjectPtr<UObject> NullHandle;
+	TEST_CHECK(!NullHandle.IsValid());
+	TEST_CHECK(!NullHandle.IsStale());
+	TEST_CHECK(NullHandle == TWeakObjectPtr<UObject>(nullptr));
+
+	UObject* Object = new UObject();
+	TWeakObjectPtr<UObject> Handle(Object);
+	Handle.Reset();
+	TEST_CHECK(!Handle.IsValid());
+	TEST_CHECK(!Handle.IsStale());
+
+	delete Object;
+}
+
+TEST_CASE(WeakObjectPtr, UnregisteredDuplicateGivesNullHandle)
+{
+	// Duplicate는 슬롯 등록 없이 인덱스까지 복사하므로 원본 슬롯을 가리키면 안 됨
+	UObject* Object = new UObject();
+	UObject* Duplicated = Object->Duplicate();
+
+	const TWeakObjectPtr<UObject> Handle(Duplicated);
+	TEST_CHECK(!Handle.IsValid());
+	TEST_CHECK(!Handle.IsStale());
+	TEST_CHECK(Handle.Get() == nullptr);
+
+	delete Duplicated;
+	TEST_CHECK(TWeakObjectPtr<UObject>(Object).Get() == Object);
+	delete Object;
+}
+
+TEST_CASE(WeakObjectPtr, HandlesSurviveArrayCleanup)
+{
+	// 정리는 배열 끝의 빈 슬롯만 잘라내므로 살아있는 객체의 핸들은 그대로 유효
+	UObject* Survivor = new UObject();
+	TArray<UObject*> Trailing;
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		Trailing.Add(new UObject());
+	}
+	const TWeakObjectPtr<UObject> SurvivorHandle(Survivor);
+	const TWeakObjectPtr<UObject> TrailingHandle(Trailing.Last());
+
+	for (UObject* Object : Trailing)
+	{
+		delete Object;
+	}
+	UObject::CleanupGUObjectArray();
+
+	TEST_CHECK(SurvivorHandle.Get() == Survivor);
+	TEST_CHECK(TrailingHandle.Get() == nullptr);
+	TEST_CHECK(TrailingHandle.IsStale());
+
+	delete Survivor;
+}
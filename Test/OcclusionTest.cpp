@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Runtime/Renderer/Public/SoftwareOcclusion.h"
+
+namespace
+{
+	/**
+	 * @brief X = 20에 선 넓은 벽 하나를 그린 버퍼 (화면 가운데를 가림)
+	 */
+	void RasterizeWall(FSoftwareOcclusionBuffer& OutBuffer, bool bInParallel = true)
+	{
+		OutBuffer.BeginFrame(MakeTestViewProjection());
+		OutBuffer.AddOccluderBox(FAABB(FVector(20.0f, -10.0f, -6.0f), FVector(21.0f, 10.0f, 6.0f)));
+		OutBuffer.Rasterize(bInParallel);
+	}
+
+	/**
+	 * @brief 클립 좌표로 옮긴 점의 Z / W (D3D 깊이)
+	 */
+	float GetClipDepth(const FMatrix& InViewProjection, const FVector& InPoint)
+	{
+		float Clip[4];
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			const float* M = InViewProjection.Data[Row];
+			Clip[Row] = M[0] * InPoint.X + M[1] * InPoint.Y + M[2] * InPoint.Z + M[3];
+		}
+		return Clip[2] / Clip[3];
+	}
+}
+
+TEST_CASE(SoftwareOcclusion, WallWritesItsDepthOnly)
+{
+	FSoftwareOcclusionBuffer Buffer;
+	RasterizeWall(Buffer);
+	TEST_REQUIRE(Buffer.GetNumTriangles() > 0);
+
+	const float ExpectedDepth = GetClipDepth(MakeTestViewProjection(), FVector(20.0f, 0.0f, 0.0f));
+	TEST_CHECK_NEAR(Buffer.GetDepth(Buffer.GetWidth() / 2, Buffer.GetHeight() / 2), ExpectedDepth, 1e-5);
+	TEST_CHECK(Buffer.GetDepth(0, 0) == 1.0f);
+}
+
+TEST_CASE(SoftwareOcclusion, BoxBehindWallIsOccluded)
+{
+	FSoftwareOcclusionBuffer Buffer;
+	RasterizeWall(Buffer);
+
+	const FAABB BehindWall(FVector(40.0f, -2.0f, -2.0f), FVector(42.0f, 2.0f, 2.0f));
+	TEST_CHECK(Buffer.IsOccluded(BehindWall));
+	TEST_CHECK(Buffer.IsOccludedReference(BehindWall));
+}
+
+TEST_CASE(SoftwareOcclusion, VisibleBoxesAreNotOccluded)
+{
+	FSoftwareOcclusionBuffer Buffer;
+	RasterizeWall(Buffer);
+
+	TEST_CHECK(!Buffer.IsOccluded(FAABB(FVector(10.0f, -1.0f, -1.0f), FVector(12.0f, 1.0f, 1.0f))));
+	TEST_CHECK(!Buffer.IsOccluded(FAABB(FVector(21.0f, -1.0f, -1.0f), FVector(23.0f, 1.0f, 1.0f))));
+	TEST_CHECK(!Buffer.IsOccluded(FAABB(FVector(40.0f, 15.0f, -1.0f), FVector(42.0f, 25.0f, 1.0f))));
+}
+
+TEST_CASE(SoftwareOcclusion, BoxesAtOrBehindNearPlaneAreNotOccluded)
+{
+	FSoftwareOcclusionBuffer Buffer;
+	RasterizeWall(Buffer);
+
+	TEST_CHECK(!Buffer.IsOccluded(FAABB(FVector(-1.0f, -1.0f, -1.0f), FVector(30.0f, 1.0f, 1.0f))));
+	TEST_CHECK(!Buffer.IsOccluded(FAABB(FVector(-30.0f, -1.0f, -1.0f), FVector(-28.0f, 1.0f, 1.0f))));
+}
+
+TEST_CASE(SoftwareOcclusion, TiledRasterizerMatchesPerPixelReference)
+{
+	FSoftwareOcclusionBuffer Tiled;
+	RasterizeWall(Tiled);
+
+	FSoftwareOcclusionBuffer Serial;
+	RasterizeWall(Serial, false);
+
+	FSoftwareOcclusionBuffer Reference;
+	Reference.BeginFrame(MakeTestViewProjection());
+	Reference.AddOccluderBox(FAABB(FVector(20.0f, -10.0f, -6.0f), FVector(21.0f, 10.0f, 6.0f)));
+	Reference.RasterizeReference();
+
+	int32 NumDifferent = 0;
+	for (int32 Y = 0; Y < Tiled.GetHeight(); ++Y)
+	{
+		for (int32 X = 0; X < Tiled.GetWidth(); ++X)
+		{
+			NumDifferent += Tiled.GetDepth(X, Y) != Reference.GetDepth(X, Y) ? 1 : 0;
+			NumDifferent += Serial.GetDepth(X, Y) != Reference.GetDepth(X, Y) ? 1 : 0;
+		}
+	}
+	TEST_CHECK(NumDifferent == 0);
+}
+
+TEST_CASE(SoftwareOcclusion, BatchTestMatchesSingleTest)
+{
+	FSoftwareOcclusionBuffer Buffer;
+	RasterizeWall(Buffer);
+
+	TArray<FAABB> Bounds;
+	for (int32 Index = 0; Index < 64; ++Index)
+	{
+		const FVector Center(25.0f + Index, static_cast<float>(Index % 16) - 8.0f, static_cast<float>(Index % 5) - 2.0f);
+		Bounds.Add(FAABB(Center - FVector(0.5f, 0.5f, 0.5f), Center + FVector(0.5f, 0.5f, 0.5f)));
+	}
+
+	TArray<uint8> Visibility;
+	const int32 NumOccluded = Buffer.TestOccludees(Bounds, Visibility);
+	TEST_REQUIRE(Visibility.Num() == Bounds.Num());
+
+	int32 NumExpectedOccluded = 0;
+	for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+	{
+		const bool bOccluded = Buffer.IsOccluded(Bounds[Index]);
+		NumExpectedOccluded += bOccluded ? 1 : 0;
+		TEST_CHECK((Visibility[Index] == 0) == bOccluded);
+	}
+	TEST_CHECK(NumOccluded == NumExpectedOccluded);
+	TEST_CHECK(NumOccluded > 0);
+}
+
+TEST_CASE(SoftwareOcclusion, BeginFrameClearsPreviousOccluders)
+{
+	FSoftwareOcclusionBuffer Buffer;
+	RasterizeWall(Buffer);
+
+	Buffer.BeginFrame(MakeTestViewProjection());
+	Buffer.Rasterize();
+	TEST_CHECK(Buffer.GetNumTriangles() == 0);
+	TEST_CHECK(!Buffer.IsOccluded(FAABB(FVector(40.0f, -2.0f, -2.0f), FVector(42.0f, 2.0f, 2.0f))));
+}
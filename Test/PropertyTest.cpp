@@ -0,0 +1,276 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Runtime/Core/Public/Object.h"
+#include "Utility/Public/Archive.h"
+
+namespace
+{
+	enum class ETestPropertyEnum : uint8
+	{
+		First,
+		Second,
+		Third
+	};
+
+	/**
+	 * @brief 프로퍼티 타입마다 멤버 하나씩을 가진 구조체
+	 * 통째 복사 구간 사이에 문자열과 Transient 멤버를 끼워 구간 분할도 함께 거친다
+	 */
+	struct FEveryPropertyType
+	{
+		DECLARE_PROPERTY_TABLE()
+
+		bool bFlag = false;
+		uint8 Byte = 0;
+		int32 Integer = 0;
+		uint32 Unsigned = 0;
+		float Scalar = 0.0f;
+		FVector Location;
+		FVector2 TextureCoord;
+		FVector4 Color;
+		ETestPropertyEnum Kind = ETestPropertyEnum::First;
+		FString Label;
+		int32 CachedValue = 0;
+		float Weight = 0.0f;
+	};
+
+	BEGIN_PROPERTY_TABLE(FEveryPropertyType)
+		PROPERTY(bFlag)
+		PROPERTY(Byte)
+		PROPERTY(Integer)
+		PROPERTY(Unsigned)
+		PROPERTY(Scalar)
+		PROPERTY(Location)
+		PROPERTY(TextureCoord)
+		PROPERTY(Color)
+		PROPERTY(Kind)
+		PROPERTY(Label)
+		PROPERTY_FLAGS(CachedValue, EPropertyFlags::Transient)
+		PROPERTY(Weight)
+	END_PROPERTY_TABLE()
+
+	FEveryPropertyType MakeSavedValue()
+	{
+		FEveryPropertyType Value;
+		Value.bFlag = true;
+		Value.Byte = 0xA5;
+		Value.Integer = -123456;
+		Value.Unsigned = 0xDEADBEEF;
+		Value.Scalar = 3.25f;
+		Value.Location = FVector(1.0f, -2.0f, 3.5f);
+		Value.TextureCoord = FVector2(0.25f, 0.75f);
+		Value.Color = FVector4(0.1f, 0.2f, 0.3f, 0.4f);
+		Value.Kind = ETestPropertyEnum::Third;
+		Value.Label = "Round Trip";
+		Value.CachedValue = 77;
+		Value.Weight = -0.5f;
+		return Value;
+	}
+
+	/**
+	 * @brief 임시 파일에 저장한 뒤 다시 읽어 온 값 (Transient 멤버는 읽기 전 값 유지)
+	 */
+	template <typename T>
+	T SaveAndLoad(T& InSaved, const char* InFileName)
+	{
+		const FString FilePath = (filesystem::temp_directory_path() / InFileName).string();
+		{
+			FBinaryWriter Writer(FilePath);
+			SerializeProperties(Writer, InSaved);
+		}
+
+		T Loaded;
+		{
+			FBinaryReader Reader(FilePath);
+			SerializeProperties(Reader, Loaded);
+		}
+
+		std::error_code ErrorCode;
+		filesystem::remove(static_cast<const std::string&>(FilePath), ErrorCode);
+		return Loaded;
+	}
+
+	UCLASS()
+	class UPropertyTestObject :
+		public UObject
+	{
+		GENERATED_BODY()
+		DECLARE_CLASS(UPropertyTestObject, UObject)
+		DECLARE_PROPERTY_TABLE()
+
+	public:
+		int32 Health = 100;
+		FString Tag;
+	};
+
+	IMPLEMENT_CLASS_WITH_PROPERTIES(UPropertyTestObject, UObject)
+
+	BEGIN_PROPERTY_TABLE(UPropertyTestObject)
+		PROPERTY(Health)
+		PROPERTY(Tag)
+	END_PROPERTY_TABLE()
+
+	UCLASS()
+	class UPropertyTestChildObject :
+		public UPropertyTestObject
+	{
+		GENERATED_BODY()
+		DECLARE_CLASS(UPropertyTestChildObject, UPropertyTestObject)
+	};
+
+	IMPLEMENT_CLASS(UPropertyTestChildObject, UPropertyTestObject)
+
+	bool IsSameVector(const FVector& InA, const FVector& InB)
+	{
+		return InA.X == InB.X && InA.Y == InB.Y && InA.Z == InB.Z;
+	}
+}
+
+TEST_CASE(PropertyTable, TableCoversEveryPropertyType)
+{
+	bool bHasType[static_cast<int32>(EPropertyType::String) + 1] = {};
+	for (const FProperty& Property : FEveryPropertyType::StaticPropertyTable().GetProperties())
+	{
+		bHasType[static_cast<int32>(Property.Type)] = true;
+	}
+
+	for (const bool bHas : bHasType)
+	{
+		TEST_CHECK(bHas);
+	}
+}
+
+TEST_CASE(PropertyTable, AdjacentTrivialPropertiesMergeIntoRuns)
+{
+	const FPropertyTable& Table = FEveryPropertyType::StaticPropertyTable();
+	const TArray<FProperty>& Properties = Table.GetProperties();
+
+	uint32 TrivialSize = 0;
+	int32 NumTrivial = 0;
+	for (const FProperty& Property : Properties)
+	{
+		if (Property.IsTriviallyCopyable() && !HasPropertyFlag(Property.Flags, EPropertyFlags::Transient))
+		{
+			TrivialSize += Property.Size;
+			++NumTrivial;
+		}
+	}
+
+	// 통째 복사 구간은 Transient를 뺀 값 프로퍼티를 빠짐없이 덮고, 이웃한 프로퍼티는 하나로 합쳐짐
+	uint32 BulkSize = 0;
+	int32 NumBulkRuns = 0;
+	int32 NumStringRuns = 0;
+	for (const FPropertyRun& Run : Table.GetSerializeRuns())
+	{
+		if (Run.IsBulkRun())
+		{
+			BulkSize += Run.Size;
+			++NumBulkRuns;
+		}
+		else
+		{
+			NumStringRuns += Properties[Run.PropertyIndex].Type == EPropertyType::String ? 1 : 0;
+		}
+	}
+
+	TEST_CHECK(BulkSize == TrivialSize);
+	TEST_CHECK(NumBulkRuns < NumTrivial);
+	TEST_CHECK(NumStringRuns == 1);
+	TEST_CHECK(Table.GetSerializeRuns().Last().Offset == offsetof(FEveryPropertyType, Weight));
+	TEST_CHECK(!Table.IsFullyTrivial());
+	TEST_CHECK(FVertex::StaticPropertyTable().IsFullyTrivial());
+}
+
+TEST_CASE(PropertySerialization, RoundTripsBoolAndIntegers)
+{
+	FEveryPropertyType Saved = MakeSavedValue();
+	const FEveryPropertyType Loaded = SaveAndLoad(Saved, "GTLPropertyTest_Integers.bin");
+
+	TEST_CHECK(Loaded.bFlag == Saved.bFlag);
+	TEST_CHECK(Loaded.Byte == Saved.Byte);
+	TEST_CHECK(Loaded.Integer == Saved.Integer);
+	TEST_CHECK(Loaded.Unsigned == Saved.Unsigned);
+}
+
+TEST_CASE(PropertySerialization, RoundTripsFloatAndVectors)
+{
+	FEveryPropertyType Saved = MakeSavedValue();
+	const FEveryPropertyType Loaded = SaveAndLoad(Saved, "GTLPropertyTest_Vectors.bin");
+
+	TEST_CHECK(Loaded.Scalar == Saved.Scalar);
+	TEST_CHECK(Loaded.Weight == Saved.Weight);
+	TEST_CHECK(IsSameVector(Loaded.Location, Saved.Location));
+	TEST_CHECK(Loaded.TextureCoord.X == Saved.TextureCoord.X && Loaded.TextureCoord.Y == Saved.TextureCoord.Y);
+	TEST_CHECK(Loaded.Color.X == Saved.Color.X && Loaded.Color.Y == Saved.Color.Y &&
+		Loaded.Color.Z == Saved.Color.Z && Loaded.Color.W == Saved.Color.W);
+}
+
+TEST_CASE(PropertySerialization, RoundTripsEnumAndString)
+{
+	FEveryPropertyType Saved = MakeSavedValue();
+	const FEveryPropertyType Loaded = SaveAndLoad(Saved, "GTLPropertyTest_EnumString.bin");
+
+	TEST_CHECK(Loaded.Kind == Saved.Kind);
+	TEST_CHECK(Loaded.Label == Saved.Label);
+
+	// 빈 문자열은 길이 0만 기록되고 이전 값 없이 읽혀야 함
+	Saved.Label.clear();
+	TEST_CHECK(SaveAndLoad(Saved, "GTLPropertyTest_EmptyString.bin").Label.empty());
+}
+
+TEST_CASE(PropertySerialization, SkipsTransientProperty)
+{
+	FEveryPropertyType Saved = MakeSavedValue();
+	const FEveryPropertyType Loaded = SaveAndLoad(Saved, "GTLPropertyTest_Transient.bin");
+
+	TEST_CHECK(Loaded.CachedValue == 0);
+	TEST_CHECK(Loaded.Weight == Saved.Weight);
+}
+
+TEST_CASE(PropertySerialization, RoundTripsFullyTrivialArray)
+{
+	TArray<FVertex> Saved;
+	for (int32 Index = 0; Index < 5; ++Index)
+	{
+		const float Value = static_cast<float>(Index);
+		Saved.Add(FVertex(FVector(Value, 1.0f, 2.0f), FVector4(0.0f, Value, 0.0f, 1.0f), FVector(0.0f, 0.0f, 1.0f),
+		                  FVector2(Value, -Value)));
+	}
+
+	const FString FilePath = (filesystem::temp_directory_path() / "GTLPropertyTest_Vertices.bin").string();
+	{
+		FBinaryWriter Writer(FilePath);
+		SerializeArray(Writer, Saved);
+	}
+
+	TArray<FVertex> Loaded;
+	{
+		FBinaryReader Reader(FilePath);
+		SerializeArray(Reader, Loaded);
+	}
+	std::error_code ErrorCode;
+	filesystem::remove(static_cast<const std::string&>(FilePath), ErrorCode);
+
+	TEST_REQUIRE(Loaded.Num() == Saved.Num());
+	for (int32 Index = 0; Index < Saved.Num(); ++Index)
+	{
+		TEST_CHECK(memcmp(&Loaded[Index], &Saved[Index], sizeof(FVertex)) == 0);
+	}
+}
+
+TEST_CASE(PropertyTable, ClassWithPropertiesRegistersTable)
+{
+	const TObjectPtr<UClass> Class = UPropertyTestObject::StaticClass();
+	TEST_CHECK(Class->GetPropertyTable() == &UPropertyTestObject::StaticPropertyTable());
+	TEST_CHECK(Class->GetSuperClass() == UObject::StaticClass());
+	TEST_CHECK(Class->GetClassSize() == sizeof(UPropertyTestObject));
+
+	// 테이블이 없는 파생 클래스는 부모 테이블을, 테이블이 없는 클래스는 nullptr을 받음
+	TEST_CHECK(UPropertyTestChildObject::StaticClass()->GetPropertyTable() == Class->GetPropertyTable());
+	TEST_CHECK(UObject::StaticClass()->GetPropertyTable() == nullptr);
+
+	UObject* Object = Class->CreateDefaultObject().Get();
+	TEST_CHECK(Object->IsA(Class));
+	delete Object;
+}
@@ -0,0 +1,272 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Runtime/RHI/Public/RHIPipelineState.h"
+
+namespace
+{
+	/**
+	 * @brief 캐시를 통과한 바인딩을 종류별로 세고 마지막 값을 기억하는 백엔드
+	 */
+	class FRecordingStateBackend :
+		public IRHIStateBackend
+	{
+	public:
+		void SetVertexShader(ID3D11VertexShader* InShader) override { Record(ERHIStateType::VertexShader); }
+		void SetPixelShader(ID3D11PixelShader* InShader) override { Record(ERHIStateType::PixelShader); }
+		void SetInputLayout(ID3D11InputLayout* InInputLayout) override { Record(ERHIStateType::InputLayout); }
+		void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY InTopology) override
+		{
+			Record(ERHIStateType::PrimitiveTopology);
+		}
+		void SetVertexBuffer(uint32 InSlot, ID3D11Buffer* InBuffer, uint32 InStride, uint32 InOffset) override
+		{
+			Record(ERHIStateType::VertexBuffer);
+		}
+		void SetIndexBuffer(ID3D11Buffer* InBuffer, DXGI_FORMAT InFormat, uint32 InOffset) override
+		{
+			Record(ERHIStateType::IndexBuffer);
+		}
+		void SetRasterizerState(ID3D11RasterizerState* InState) override { Record(ERHIStateType::RasterizerState); }
+		void SetDepthStencilState(ID3D11DepthStencilState* InState, uint32 InStencilRef) override
+		{
+			Record(ERHIStateType::DepthStencilState);
+			LastStencilRef = InStencilRef;
+		}
+		void SetBlendState(ID3D11BlendState* InState, const float InBlendFactor[4], uint32 InSampleMask) override
+		{
+			Record(ERHIStateType::BlendState);
+			memcpy(LastBlendFactor, InBlendFactor, sizeof(LastBlendFactor));
+		}
+		void SetShaderResource(ERHIShaderStage InStage, uint32 InSlot, ID3D11ShaderResourceView* InView) override
+		{
+			Record(ERHIStateType::ShaderResource);
+		}
+		void SetSampler(ERHIShaderStage InStage, uint32 InSlot, ID3D11SamplerState* InSampler) override
+		{
+			Record(ERHIStateType::Sampler);
+		}
+		void SetConstantBuffer(ERHIShaderStage InStage, uint32 InSlot, ID3D11Buffer* InBuffer) override
+		{
+			Record(ERHIStateType::ConstantBuffer);
+		}
+
+		uint32 GetNumCalls(ERHIStateType InType) const { return NumCalls[static_cast<uint8>(InType)]; }
+
+		float LastBlendFactor[4] = {};
+		uint32 LastStencilRef = 0;
+
+	private:
+		void Record(ERHIStateType InType) { ++NumCalls[static_cast<uint8>(InType)]; }
+
+		uint32 NumCalls[static_cast<uint8>(ERHIStateType::Num)] = {};
+	};
+
+	/**
+	 * @brief 역참조하지 않는 가짜 D3D 객체 주소 (캐시는 포인터 값만 비교)
+	 */
+	template <typename T>
+	T* MakeFakeObject(uintptr_t InId)
+	{
+		return reinterpret_cast<T*>(InId * 16);
+	}
+}
+
+TEST_CASE(RHIStateCache, RedundantBindsAreFiltered)
+{
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	ID3D11VertexShader* Shader = MakeFakeObject<ID3D11VertexShader>(1);
+	Cache.SetVertexShader(Shader);
+	Cache.SetVertexShader(Shader);
+	Cache.SetVertexShader(Shader);
+	Cache.SetVertexShader(MakeFakeObject<ID3D11VertexShader>(2));
+
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::VertexShader) == 2);
+	TEST_CHECK(Cache.GetStats().NumSubmitted[static_cast<uint8>(ERHIStateType::VertexShader)] == 2);
+	TEST_CHECK(Cache.GetStats().NumFiltered[static_cast<uint8>(ERHIStateType::VertexShader)] == 2);
+	TEST_CHECK(Cache.GetStats().GetTotalSubmitted() == 2);
+	TEST_CHECK(Cache.GetStats().GetTotalFiltered() == 2);
+}
+
+TEST_CASE(RHIStateCache, FirstBindOfNullIsForwarded)
+{
+	// 처음에는 바인딩 값을 모르므로 nullptr 바인딩도 전달
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	Cache.SetPixelShader(nullptr);
+	Cache.SetPixelShader(nullptr);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::PixelShader) == 1);
+}
+
+TEST_CASE(RHIStateCache, InvalidateForwardsNextBind)
+{
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	ID3D11Buffer* Buffer = MakeFakeObject<ID3D11Buffer>(3);
+	Cache.SetIndexBuffer(Buffer, DXGI_FORMAT_R32_UINT);
+	Cache.SetConstantBuffer(ERHIShaderStage::Pixel, 1, Buffer);
+	Cache.Invalidate();
+	Cache.SetIndexBuffer(Buffer, DXGI_FORMAT_R32_UINT);
+	Cache.SetConstantBuffer(ERHIShaderStage::Pixel, 1, Buffer);
+
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::IndexBuffer) == 2);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::ConstantBuffer) == 2);
+	TEST_CHECK(Cache.GetStats().GetTotalFiltered() == 0);
+}
+
+TEST_CASE(RHIStateCache, EveryFieldOfCompoundBindingIsCompared)
+{
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	ID3D11Buffer* Buffer = MakeFakeObject<ID3D11Buffer>(4);
+	Cache.SetVertexBuffer(Buffer, 32);
+	Cache.SetVertexBuffer(Buffer, 32, 0);
+	Cache.SetVertexBuffer(Buffer, 48);
+	Cache.SetVertexBuffer(Buffer, 48, 16);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::VertexBuffer) == 3);
+
+	ID3D11DepthStencilState* DepthState = MakeFakeObject<ID3D11DepthStencilState>(5);
+	Cache.SetDepthStencilState(DepthState, 0);
+	Cache.SetDepthStencilState(DepthState, 1);
+	Cache.SetDepthStencilState(DepthState, 1);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::DepthStencilState) == 2);
+	TEST_CHECK(Backend.LastStencilRef == 1);
+}
+
+TEST_CASE(RHIStateCache, SlotsAreTrackedPerStage)
+{
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	ID3D11ShaderResourceView* View = MakeFakeObject<ID3D11ShaderResourceView>(6);
+	Cache.SetShaderResource(ERHIShaderStage::Pixel, 0, View);
+	Cache.SetShaderResource(ERHIShaderStage::Vertex, 0, View);
+	Cache.SetShaderResource(ERHIShaderStage::Pixel, 1, View);
+	Cache.SetShaderResource(ERHIShaderStage::Pixel, 0, View);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::ShaderResource) == 3);
+}
+
+TEST_CASE(RHIStateCache, SlotsPastTrackedRangeAreAlwaysForwarded)
+{
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	ID3D11ShaderResourceView* View = MakeFakeObject<ID3D11ShaderResourceView>(7);
+	ID3D11SamplerState* Sampler = MakeFakeObject<ID3D11SamplerState>(8);
+	ID3D11Buffer* Buffer = MakeFakeObject<ID3D11Buffer>(9);
+	for (int32 Repeat = 0; Repeat < 2; ++Repeat)
+	{
+		Cache.SetShaderResource(ERHIShaderStage::Pixel, FRHIStateCache::MaxShaderResources, View);
+		Cache.SetSampler(ERHIShaderStage::Pixel, FRHIStateCache::MaxSamplers, Sampler);
+		Cache.SetConstantBuffer(ERHIShaderStage::Vertex, FRHIStateCache::MaxConstantBuffers, Buffer);
+	}
+
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::ShaderResource) == 2);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::Sampler) == 2);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::ConstantBuffer) == 2);
+}
+
+TEST_CASE(RHIStateCache, NullBlendFactorEqualsOnes)
+{
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	ID3D11BlendState* BlendState = MakeFakeObject<ID3D11BlendState>(10);
+	const float Ones[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+	const float Half[4] = {0.5f, 0.5f, 0.5f, 0.5f};
+
+	Cache.SetBlendState(BlendState);
+	TEST_CHECK(Backend.LastBlendFactor[0] == 1.0f && Backend.LastBlendFactor[3] == 1.0f);
+	Cache.SetBlendState(BlendState, Ones);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::BlendState) == 1);
+
+	Cache.SetBlendState(BlendState, Half);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::BlendState) == 2);
+	TEST_CHECK(Backend.LastBlendFactor[2] == 0.5f);
+}
+
+TEST_CASE(RHIStateCache, WorksWithoutBackend)
+{
+	// 백엔드가 없어도 통계만 기록하고 호출하지 않음
+	FRHIStateCache Cache;
+	Cache.SetRasterizerState(MakeFakeObject<ID3D11RasterizerState>(11));
+	Cache.SetRasterizerState(MakeFakeObject<ID3D11RasterizerState>(11));
+	TEST_CHECK(Cache.GetStats().GetTotalSubmitted() == 1);
+	TEST_CHECK(Cache.GetStats().GetTotalFiltered() == 1);
+}
+
+TEST_CASE(RHIPipelineState, FindOrAddDeduplicates)
+{
+	FRHIPipelineStateRegistry Registry;
+	FRHIPipelineStateDesc Opaque;
+	Opaque.VertexShader = MakeFakeObject<ID3D11VertexShader>(1);
+	Opaque.PixelShader = MakeFakeObject<ID3D11PixelShader>(2);
+
+	FRHIPipelineStateDesc Translucent = Opaque;
+	Translucent.BlendState = MakeFakeObject<ID3D11BlendState>(3);
+
+	const FRHIPipelineStateHandle OpaqueHandle = Registry.FindOrAdd(Opaque);
+	const FRHIPipelineStateHandle TranslucentHandle = Registry.FindOrAdd(Translucent);
+
+	TEST_CHECK(OpaqueHandle >= 1);
+	TEST_CHECK(TranslucentHandle != OpaqueHandle);
+	TEST_CHECK(Registry.FindOrAdd(Opaque) == OpaqueHandle);
+	TEST_CHECK(Registry.Num() == 2);
+	TEST_CHECK(Registry.IsValid(OpaqueHandle));
+	TEST_CHECK(!Registry.IsValid(0));
+	TEST_CHECK(Registry.Get(TranslucentHandle) == Translucent);
+}
+
+TEST_CASE(RHIPipelineState, ApplyBindsOnlyChangedStates)
+{
+	FRHIPipelineStateRegistry Registry;
+	FRHIPipelineStateDesc Opaque;
+	Opaque.VertexShader = MakeFakeObject<ID3D11VertexShader>(1);
+	Opaque.PixelShader = MakeFakeObject<ID3D11PixelShader>(2);
+	Opaque.DepthStencilState = MakeFakeObject<ID3D11DepthStencilState>(4);
+
+	FRHIPipelineStateDesc Other = Opaque;
+	Other.PixelShader = MakeFakeObject<ID3D11PixelShader>(5);
+
+	const FRHIPipelineStateHandle OpaqueHandle = Registry.FindOrAdd(Opaque);
+	const FRHIPipelineStateHandle OtherHandle = Registry.FindOrAdd(Other);
+
+	FRecordingStateBackend Backend;
+	FRHIStateCache Cache;
+	Cache.SetBackend(&Backend);
+
+	Registry.Apply(OpaqueHandle, Cache);
+	const uint32 NumFirstApply = Cache.GetStats().GetTotalSubmitted();
+	Registry.Apply(OpaqueHandle, Cache);
+	TEST_CHECK(Cache.GetStats().GetTotalSubmitted() == NumFirstApply);
+
+	Registry.Apply(OtherHandle, Cache);
+	TEST_CHECK(Cache.GetStats().GetTotalSubmitted() == NumFirstApply + 1);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::PixelShader) == 2);
+	TEST_CHECK(Backend.GetNumCalls(ERHIStateType::VertexShader) == 1);
+}
+
+TEST_CASE(RHIPipelineState, ResetInvalidatesHandles)
+{
+	FRHIPipelineStateRegistry Registry;
+	FRHIPipelineStateDesc Desc;
+	Desc.VertexShader = MakeFakeObject<ID3D11VertexShader>(1);
+
+	const FRHIPipelineStateHandle Handle = Registry.FindOrAdd(Desc);
+	Registry.Reset();
+	TEST_CHECK(!Registry.IsValid(Handle));
+	TEST_CHECK(Registry.Num() == 0);
+	TEST_CHECK(Registry.FindOrAdd(Desc) == Handle);
+}
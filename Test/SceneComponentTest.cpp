@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Physics/Public/AABB.h"
+#include "Runtime/Component/Public/PrimitiveComponent.h"
+#include "Runtime/Renderer/Public/Scene.h"
+
+// FScene 구현은 D3D11 리소스에 의존해 Test에 포함하지 않는다
+// 테스트의 컴포넌트는 FScene에 등록되지 않으므로 UPrimitiveComponent 소멸자가 호출하지 않는다
+void FScene::RemovePrimitive(UPrimitiveComponent*) {}
+
+namespace
+{
+	/**
+	 * @brief 로컬 경계가 원점 중심의 단위 상자인 프리미티브
+	 */
+	class UUnitBoxComponent : public UPrimitiveComponent
+	{
+	public:
+		bool GetLocalBounds(FAABB& OutLocalBounds) const override
+		{
+			OutLocalBounds = FAABB(FVector(-1.0f, -1.0f, -1.0f), FVector(1.0f, 1.0f, 1.0f));
+			return true;
+		}
+	};
+
+	FMatrix GetLocalMatrix(const USceneComponent& InComponent)
+	{
+		return FMatrix::GetModelMatrix(InComponent.GetRelativeLocation(),
+		                               FVector::GetDegreeToRadian(InComponent.GetRelativeRotation()),
+		                               InComponent.GetRelativeScale3D());
+	}
+}
+
+TEST_CASE(SceneComponent, MovingParentUpdatesChildWorldMatrixAndBounds)
+{
+	USceneComponent* Parent = new USceneComponent();
+	UUnitBoxComponent* Child = new UUnitBoxComponent();
+	Parent->SetRelativeScale3D(FVector(1.0f, 1.0f, 1.0f));
+	Child->SetRelativeScale3D(FVector(1.0f, 1.0f, 1.0f));
+	Child->SetRelativeLocation(FVector(0.0f, 5.0f, 0.0f));
+	Child->SetParentAttachment(Parent);
+
+	// 이동 전 값을 읽어 캐시를 채워 둔다
+	TEST_CHECK_NEAR(Child->GetWorldBounds().Min.Y, 4.0f, 1e-5);
+	TEST_CHECK(!Child->IsTransformDirty());
+
+	Parent->SetRelativeLocation(FVector(10.0f, 0.0f, 0.0f));
+	TEST_CHECK(Child->IsTransformDirty());
+
+	const FMatrix Expected = Parent->GetWorldTransformMatrix() * GetLocalMatrix(*Child);
+	TEST_CHECK(GetMaxDifference(Child->GetWorldTransformMatrix(), Expected) < 1e-5f);
+
+	const FAABB& Bounds = Child->GetWorldBounds();
+	TEST_CHECK_NEAR(Bounds.Min.X, 9.0f, 1e-5);
+	TEST_CHECK_NEAR(Bounds.Max.X, 11.0f, 1e-5);
+	TEST_CHECK_NEAR(Bounds.Min.Y, 4.0f, 1e-5);
+
+	// 부모의 회전도 자식의 월드 행렬과 역행렬에 반영된다
+	Parent->SetRelativeRotation(FVector(0.0f, 0.0f, 90.0f));
+	const FMatrix RotatedExpected = Parent->GetWorldTransformMatrix() * GetLocalMatrix(*Child);
+	TEST_CHECK(GetMaxDifference(Child->GetWorldTransformMatrix(), RotatedExpected) < 1e-5f);
+	TEST_CHECK(GetMaxDifference(Child->GetWorldTransformMatrixInverse(), RotatedExpected.InverseAffine()) < 1e-4f);
+
+	delete Child;
+	delete Parent;
+}
+
+TEST_CASE(SceneComponent, ReattachingMovesChildBetweenParents)
+{
+	USceneComponent* First = new USceneComponent();
+	USceneComponent* Second = new USceneComponent();
+	USceneComponent* Child = new USceneComponent();
+	First->SetRelativeLocation(FVector(1.0f, 0.0f, 0.0f));
+	Second->SetRelativeLocation(FVector(0.0f, 0.0f, 7.0f));
+
+	Child->SetParentAttachment(First);
+	Child->SetParentAttachment(Second);
+	Child->GetWorldTransformMatrix();
+
+	// 이전 부모의 변경은 더 이상 자식을 Dirty로 만들지 않는다
+	First->SetRelativeLocation(FVector(3.0f, 0.0f, 0.0f));
+	TEST_CHECK(!Child->IsTransformDirty());
+
+	Second->SetRelativeLocation(FVector(0.0f, 0.0f, 9.0f));
+	TEST_CHECK(Child->IsTransformDirty());
+	TEST_CHECK(GetMaxDifference(Child->GetWorldTransformMatrix(), Second->GetWorldTransformMatrix() * GetLocalMatrix(*Child)) < 1e-5f);
+
+	// 부모가 먼저 삭제되어도 자식은 남고 부모 없는 월드 행렬로 돌아간다
+	delete Second;
+	TEST_CHECK(Child->GetParentAttachment() == nullptr);
+	TEST_CHECK(GetMaxDifference(Child->GetWorldTransformMatrix(), GetLocalMatrix(*Child)) < 1e-5f);
+
+	delete Child;
+	delete First;
+}
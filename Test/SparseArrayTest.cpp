@@ -0,0 +1,163 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Runtime/Core/Public/Containers/TSparseArray.h"
+
+namespace
+{
+	/**
+	 * @brief 순회가 방문한 인덱스가 IsAllocated인 인덱스 전체와 오름차순으로 일치하는지 확인하는 함수
+	 */
+	template <typename ArrayType>
+	bool VisitsExactlyAllocatedIndices(const ArrayType& InArray)
+	{
+		TArray<int32> Expected;
+		for (int32 Index = 0; Index < InArray.GetMaxIndex(); ++Index)
+		{
+			if (InArray.IsAllocated(Index))
+			{
+				Expected.Add(Index);
+			}
+		}
+
+		TArray<int32> Visited;
+		for (auto It = InArray.begin(); It != InArray.end(); ++It)
+		{
+			// 원소 값은 자신의 인덱스로 채워 두므로 역참조한 값과 GetIndex가 같아야 한다
+			if (*It != It.GetIndex())
+			{
+				return false;
+			}
+			Visited.Add(It.GetIndex());
+		}
+
+		return Visited == Expected && Visited.Num() == InArray.Num();
+	}
+}
+
+TEST_CASE(SparseArray, RemovedSlotIsReusedWithoutMovingOthers)
+{
+	TSparseArray<int32> Array;
+	for (int32 Index = 0; Index < 10; ++Index)
+	{
+		TEST_CHECK(Array.Add(Index) == Index);
+	}
+	const int32* Last = &Array[9];
+
+	Array.RemoveAt(4);
+	TEST_CHECK(!Array.IsAllocated(4));
+	TEST_CHECK(Array.Num() == 9);
+	TEST_CHECK(&Array[9] == Last);
+
+	TEST_CHECK(Array.Add(4) == 4);
+	TEST_CHECK(Array.Num() == 10);
+	TEST_CHECK(Array.GetMaxIndex() == 10);
+	TEST_CHECK(Array.Add(10) == 10);
+}
+
+TEST_CASE(SparseArray, FreeListReusesMostRecentlyRemovedFirst)
+{
+	TSparseArray<int32> Array;
+	for (int32 Index = 0; Index < 10; ++Index)
+	{
+		Array.Add(Index);
+	}
+
+	Array.RemoveAt(3);
+	Array.RemoveAt(7);
+	Array.RemoveAt(5);
+
+	TEST_CHECK(Array.Add(5) == 5);
+	TEST_CHECK(Array.Add(7) == 7);
+	TEST_CHECK(Array.Add(3) == 3);
+	TEST_CHECK(Array.Add(10) == 10);
+
+	// 복사본은 같은 Free List 순서를 물려받는다
+	Array.RemoveAt(2);
+	Array.RemoveAt(8);
+	TSparseArray<int32> Copy = Array;
+	TEST_CHECK(Copy.Add(8) == 8);
+	TEST_CHECK(Copy.Add(2) == 2);
+	TEST_CHECK(Copy.Add(11) == 11);
+}
+
+TEST_CASE(SparseArray, IterationAfterRemovesSkipsHoles)
+{
+	// 비트맵 단어(64)와 청크(256) 경계를 여러 번 넘는 크기에서 다양한 패턴으로 제거
+	TSparseArray<int32> Array;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		Array.Add(Index);
+	}
+	TEST_CHECK(VisitsExactlyAllocatedIndices(Array));
+
+	for (int32 Index = 0; Index < 1000; Index += 4)
+	{
+		Array.RemoveAt(Index);
+	}
+	TEST_CHECK(VisitsExactlyAllocatedIndices(Array));
+
+	// 단어 하나(128 ~ 191)와 청크 끝 부근(250 ~ 329)을 통째로 비움
+	for (int32 Index = 128; Index < 330; ++Index)
+	{
+		if (Array.IsAllocated(Index) && (Index < 192 || Index >= 250))
+		{
+			Array.RemoveAt(Index);
+		}
+	}
+	TEST_CHECK(VisitsExactlyAllocatedIndices(Array));
+
+	// 마지막 원소까지 제거해도 end에서 멈춰야 한다
+	for (int32 Index = 900; Index < 1000; ++Index)
+	{
+		if (Array.IsAllocated(Index))
+		{
+			Array.RemoveAt(Index);
+		}
+	}
+	TEST_CHECK(VisitsExactlyAllocatedIndices(Array));
+
+	const TSparseArray<int32>& ConstArray = Array;
+	TEST_CHECK(VisitsExactlyAllocatedIndices(ConstArray));
+}
+
+TEST_CASE(SparseArray, RemovingCurrentElementDuringIterationIsSafe)
+{
+	TSparseArray<int32> Array;
+	for (int32 Index = 0; Index < 200; ++Index)
+	{
+		Array.Add(Index);
+	}
+
+	int32 NumVisited = 0;
+	for (auto It = Array.begin(); It != Array.end(); ++It)
+	{
+		++NumVisited;
+		if (*It % 3 == 0)
+		{
+			Array.RemoveAt(It.GetIndex());
+		}
+	}
+	TEST_CHECK(NumVisited == 200);
+	TEST_CHECK(Array.Num() == 133);
+	TEST_CHECK(VisitsExactlyAllocatedIndices(Array));
+}
+
+TEST_CASE(SparseArray, ResetAndEmptyLeaveNothingToIterate)
+{
+	TSparseArray<int32> Array;
+	for (int32 Index = 0; Index < 300; ++Index)
+	{
+		Array.Add(Index);
+	}
+
+	Array.Reset();
+	TEST_CHECK(Array.IsEmpty());
+	TEST_CHECK(Array.begin() == Array.end());
+	TEST_CHECK(Array.Add(0) == 0);
+	TEST_CHECK(VisitsExactlyAllocatedIndices(Array));
+
+	Array.Empty();
+	TEST_CHECK(Array.begin() == Array.end());
+	TEST_CHECK(Array.GetMaxIndex() == 0);
+}
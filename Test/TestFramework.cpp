@@ -0,0 +1,65 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+bool FTestContext::Check(bool bInPassed, const char* InExpression, const char* InFile, int32 InLine)
+{
+	if (!bInPassed)
+	{
+		Failures.Add(path(InFile).filename().string() + "(" + std::to_string(InLine) + "): " + InExpression);
+	}
+	return bInPassed;
+}
+
+bool FTestContext::CheckNear(double InActual, double InExpected, double InTolerance, const char* InExpression,
+                             const char* InFile, int32 InLine)
+{
+	const bool bPassed = std::abs(InActual - InExpected) <= InTolerance;
+	if (!bPassed)
+	{
+		char Buffer[128];
+		(void)snprintf(Buffer, sizeof(Buffer), " (actual %g, expected %g, tolerance %g)", InActual, InExpected,
+		               InTolerance);
+		Check(false, (FString(InExpression) + Buffer).c_str(), InFile, InLine);
+	}
+	return bPassed;
+}
+
+float GetMaxDifference(const FMatrix& InA, const FMatrix& InB)
+{
+	float MaxDifference = 0.0f;
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			MaxDifference = max(MaxDifference, std::abs(InA.Data[Row][Column] - InB.Data[Row][Column]));
+		}
+	}
+	return MaxDifference;
+}
+
+FMatrix MakeTestViewProjection(float InFovDegrees, float InAspectRatio)
+{
+	FMatrix ViewMatrix = FMatrix::Identity();
+	const FVector Axes[3] = {FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f), FVector(1.0f, 0.0f, 0.0f)};
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		ViewMatrix.Data[Row][0] = Axes[Row].X;
+		ViewMatrix.Data[Row][1] = Axes[Row].Y;
+		ViewMatrix.Data[Row][2] = Axes[Row].Z;
+		ViewMatrix.Data[Row][3] = 0.0f;
+	}
+
+	return FMatrix::MatrixPerspectiveFovLH(FVector::GetDegreeToRadian(InFovDegrees), InAspectRatio, 1.0f, 1000.0f) *
+		ViewMatrix;
+}
+
+TArray<FTestCase>& FTestRegistry::GetTestCases()
+{
+	static TArray<FTestCase> TestCases;
+	return TestCases;
+}
+
+FTestRegistry::FRegistrar::FRegistrar(const char* InSuite, const char* InName, FTestFunction InFunction)
+{
+	GetTestCases().Add({InSuite, InName, InFunction});
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @brief 실행 중인 테스트 하나의 실패 기록
+ * TEST_CHECK 계열 매크로가 이 객체에 실패한 식과 위치를 남긴다
+ */
+class FTestContext
+{
+public:
+	/**
+	 * @return 통과 여부
+	 */
+	bool Check(bool bInPassed, const char* InExpression, const char* InFile, int32 InLine);
+
+	/**
+	 * @brief |Actual - Expected| <= Tolerance 인지 확인하는 함수
+	 */
+	bool CheckNear(double InActual, double InExpected, double InTolerance, const char* InExpression,
+	               const char* InFile, int32 InLine);
+
+	const TArray<FString>& GetFailures() const { return Failures; }
+
+private:
+	TArray<FString> Failures;
+};
+
+/**
+ * @brief 두 행렬의 성분별 차이 중 가장 큰 값 (수학 커널 테스트의 공용 비교)
+ */
+float GetMaxDifference(const FMatrix& InA, const FMatrix& InB);
+
+/**
+ * @brief 원점에서 +X 방향을 바라보는 원근 뷰 (Y가 오른쪽, Z가 위, 근평면 1, 원평면 1000)
+ * @return Projection * View (열 벡터 규약, 컬링 / 가림 테스트의 공용 입력)
+ */
+FMatrix MakeTestViewProjection(float InFovDegrees = 90.0f, float InAspectRatio = 16.0f / 9.0f);
+
+using FTestFunction = void (*)(FTestContext& Context);
+
+/**
+ * @brief 등록된 테스트 하나 (Suite는 대상 서브시스템, Name은 확인하는 동작)
+ */
+struct FTestCase
+{
+	const char* Suite;
+	const char* Name;
+	FTestFunction Function;
+};
+
+/**
+ * @brief TEST_CASE로 정의한 테스트를 정적 초기화 시점에 모아 두는 목록
+ */
+class FTestRegistry
+{
+public:
+	static TArray<FTestCase>& GetTestCases();
+
+	struct FRegistrar
+	{
+		FRegistrar(const char* InSuite, const char* InName, FTestFunction InFunction);
+	};
+};
+
+/**
+ * @brief 테스트를 정의하고 등록하는 매크로
+ * 사용 예시)
+ *	TEST_CASE(SparseArray, ReusesLastRemovedSlot)
+ *	{
+ *		TSparseArray<int32> Array;
+ *		TEST_CHECK(Array.IsEmpty());
+ *	}
+ */
+#define TEST_CASE(SuiteName, TestName) \
+	static void SuiteName##_##TestName(FTestContext& Context); \
+	static FTestRegistry::FRegistrar SuiteName##_##TestName##_Registrar(#SuiteName, #TestName, &SuiteName##_##TestName); \
+	static void SuiteName##_##TestName(FTestContext& Context)
+
+// 실패해도 테스트를 계속 진행
+#define TEST_CHECK(Expression) Context.Check(static_cast<bool>(Expression), #Expression, __FILE__, __LINE__)
+#define TEST_CHECK_NEAR(Actual, Expected, Tolerance) \
+	Context.CheckNear((Actual), (Expected), (Tolerance), #Actual " ~= " #Expected, __FILE__, __LINE__)
+
+// 실패하면 테스트를 바로 끝냄 (이후 검사가 의미 없을 때)
+#define TEST_REQUIRE(Expression) \
+	do { if (!TEST_CHECK(Expression)) { return; } } while (0)
@@ -0,0 +1,108 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+#include "Global/TransformBatch.h"
+
+namespace
+{
+	const FVector TestLocation(4.0f, -3.0f, 2.0f);
+	const FVector TestRotationRadian(0.4f, -0.7f, 1.2f);
+	const FVector TestScale(2.0f, 2.0f, 2.0f);
+
+	FQuatTransform MakeTestTransform()
+	{
+		return FQuatTransform(TestLocation, FQuatTransform::MakeRotation(TestRotationRadian), TestScale);
+	}
+}
+
+TEST_CASE(Transform, ToMatrixMatchesEulerModelMatrix)
+{
+	const FMatrix Expected = FMatrix::GetModelMatrix(TestLocation, TestRotationRadian, TestScale);
+	TEST_CHECK(GetMaxDifference(MakeTestTransform().ToMatrix(), Expected) < 1e-5f);
+}
+
+TEST_CASE(Transform, ToInverseMatrixUndoesToMatrix)
+{
+	const FQuatTransform Transform = MakeTestTransform();
+	TEST_CHECK(GetMaxDifference(Transform.ToInverseMatrix() * Transform.ToMatrix(), FMatrix::Identity()) < 1e-5f);
+}
+
+TEST_CASE(Transform, CompositionMatchesMatrixProduct)
+{
+	const FQuatTransform Parent = MakeTestTransform();
+	const FQuatTransform Child(FVector(1.0f, 0.5f, -2.0f), FQuatTransform::MakeRotation(FVector(-0.2f, 0.9f, 0.1f)),
+	                           FVector(0.5f, 0.5f, 0.5f));
+
+	TEST_CHECK(GetMaxDifference((Parent * Child).ToMatrix(), Parent.ToMatrix() * Child.ToMatrix()) < 1e-4f);
+	TEST_CHECK((Parent * Parent.Inverse()).Equals(FQuatTransform::Identity()));
+}
+
+TEST_CASE(Transform, EulerDegreesRoundTrip)
+{
+	const FVector Degrees(20.0f, -35.0f, 60.0f);
+	const FVector Result = FQuatTransform::GetEulerDegrees(
+		FQuatTransform::MakeRotation(FVector::GetDegreeToRadian(Degrees)));
+
+	TEST_CHECK_NEAR(Result.X, Degrees.X, 1e-3);
+	TEST_CHECK_NEAR(Result.Y, Degrees.Y, 1e-3);
+	TEST_CHECK_NEAR(Result.Z, Degrees.Z, 1e-3);
+}
+
+TEST_CASE(TransformBatch, ChildWorldIsParentWorldTimesLocal)
+{
+	const FQuatTransform Root = MakeTestTransform();
+	const FQuatTransform Child(FVector(0.0f, 2.0f, 0.0f), FQuatTransform::MakeRotation(FVector(0.0f, 0.5f, 0.0f)),
+	                           FVector(1.0f, 1.0f, 1.0f));
+
+	FTransformBatch Batch;
+	const int32 RootIndex = Batch.Add(Root);
+	const int32 ChildIndex = Batch.Add(Child, RootIndex);
+	const int32 GrandChildIndex = Batch.Add(Child, ChildIndex);
+	Batch.ComputeWorldMatrices();
+
+	const FMatrix ChildWorld = Root.ToMatrix() * Child.ToMatrix();
+	TEST_CHECK(GetMaxDifference(Batch.GetWorldMatrix(RootIndex), Root.ToMatrix()) < 1e-5f);
+	TEST_CHECK(GetMaxDifference(Batch.GetWorldMatrix(ChildIndex), ChildWorld) < 1e-4f);
+	TEST_CHECK(GetMaxDifference(Batch.GetWorldMatrix(GrandChildIndex), ChildWorld * Child.ToMatrix()) < 1e-4f);
+}
+
+TEST_CASE(TransformBatch, ExternalParentMatrixIsApplied)
+{
+	const FMatrix ExternalParent = FMatrix::TranslationMatrix(FVector(10.0f, 0.0f, 0.0f));
+	const FQuatTransform Child = MakeTestTransform();
+
+	FTransformBatch Batch;
+	const int32 Index = Batch.Add(Child, FTransformBatch::INDEX_NONE, &ExternalParent);
+	Batch.ComputeWorldMatrices();
+
+	TEST_CHECK(GetMaxDifference(Batch.GetWorldMatrix(Index), ExternalParent * Child.ToMatrix()) < 1e-4f);
+}
+
+TEST_CASE(TransformBatch, SimdLanesMatchScalarTail)
+{
+	// 4개 단위 SIMD 경로와 나머지 스칼라 경로가 같은 로컬 행렬을 만드는지 확인 (5번째 항목은 스칼라로 계산됨)
+	FTransformBatch Batch;
+	for (int32 Index = 0; Index < 5; ++Index)
+	{
+		Batch.Add(MakeTestTransform());
+	}
+	Batch.ComputeLocalMatrices();
+
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		TEST_CHECK(GetMaxDifference(Batch.GetLocalMatrix(Index), Batch.GetLocalMatrix(4)) < 1e-5f);
+	}
+}
+
+TEST_CASE(TransformBatch, ResetKeepsBatchReusable)
+{
+	FTransformBatch Batch;
+	Batch.Add(MakeTestTransform());
+	Batch.Reset();
+	TEST_CHECK(Batch.Num() == 0);
+
+	const int32 Index = Batch.Add(FQuatTransform::Identity());
+	Batch.ComputeWorldMatrices();
+	TEST_CHECK(Index == 0);
+	TEST_CHECK(GetMaxDifference(Batch.GetWorldMatrix(0), FMatrix::Identity()) == 0.0f);
+}
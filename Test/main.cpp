@@ -0,0 +1,58 @@
+#include "pch.h"
+#include "TestFramework.h"
+
+/**
+ * @brief 등록된 테스트를 실행하는 콘솔 진입점
+ * 사용법: Test [필터 (Suite.Name 부분 일치, 생략 시 전체)]
+ * 실패한 테스트가 있으면 1을 반환하므로 빌드 후 단계나 CI에서 그대로 사용할 수 있다
+ */
+int main(int argc, char* argv[])
+{
+	const FString Filter = argc > 1 ? argv[1] : "";
+
+	// 정적 초기화 순서는 파일마다 다르므로 이름 순으로 실행
+	TArray<FTestCase> TestCases = FTestRegistry::GetTestCases();
+	std::stable_sort(TestCases.begin(), TestCases.end(), [](const FTestCase& InA, const FTestCase& InB)
+	{
+		return strcmp(InA.Suite, InB.Suite) < 0;
+	});
+
+	int32 NumRun = 0;
+	int32 NumFailed = 0;
+	for (const FTestCase& TestCase : TestCases)
+	{
+		const FString FullName = FString(TestCase.Suite) + "." + TestCase.Name;
+		if (!Filter.empty() && FullName.find(Filter) == FString::npos)
+		{
+			continue;
+		}
+
+		printf("[ RUN  ] %s\n", FullName.c_str());
+		FTestContext Context;
+		TestCase.Function(Context);
+		++NumRun;
+
+		for (const FString& Failure : Context.GetFailures())
+		{
+			printf("  %s\n", Failure.c_str());
+		}
+		if (Context.GetFailures().IsEmpty())
+		{
+			printf("[ PASS ] %s\n", FullName.c_str());
+		}
+		else
+		{
+			printf("[ FAIL ] %s\n", FullName.c_str());
+			++NumFailed;
+		}
+	}
+
+	if (NumRun == 0)
+	{
+		printf("No test matches '%s'\n", Filter.c_str());
+		return 1;
+	}
+
+	printf("%d / %d test(s) passed\n", NumRun - NumFailed, NumRun);
+	return NumFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+// Test 프로젝트 전용 pch
+// 프로젝트 폴더가 포함 경로 맨 앞에 있으므로 엔진 소스의 #include "pch.h"는 엔진 pch 대신 이 파일을 찾는다
+// windows.h / d3d11.h 없이 표준 라이브러리, 코어 템플릿, Global 타입만 포함하므로 어느 플랫폼에서나 빌드된다
+
+// Standard Library
+#include <cmath>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <functional>
+#include <filesystem>
+#include <iterator>
+#include <sstream>
+#include <queue>
+#include <mutex>
+#include <atomic>
+
+// Global 헤더가 사용하는 Win32 타입 / 매크로 (windows.h 대신 같은 정의를 직접 둔다)
+using INT = int;
+using LONG = long;
+using SIZE_T = size_t;
+
+#ifndef FORCEINLINE
+#if defined(_MSC_VER)
+#define FORCEINLINE __forceinline
+#else
+#define FORCEINLINE inline __attribute__((always_inline))
+#endif
+#endif
+
+// RHI 상태 캐시가 포인터 / 값으로만 다루는 D3D11 타입 (D3D11 호출은 테스트 대상이 아니므로 불투명 선언으로 충분)
+struct ID3D11DeviceContext;
+struct ID3D11VertexShader;
+struct ID3D11PixelShader;
+struct ID3D11InputLayout;
+struct ID3D11Buffer;
+struct ID3D11RasterizerState;
+struct ID3D11DepthStencilState;
+struct ID3D11BlendState;
+struct ID3D11ShaderResourceView;
+struct ID3D11SamplerState;
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+};
+
+enum DXGI_FORMAT
+{
+	DXGI_FORMAT_UNKNOWN = 0,
+	DXGI_FORMAT_R32_UINT = 42,
+	DXGI_FORMAT_R16_UINT = 57,
+};
+
+// Global Included
+#include "Global/Types.h"
+#include "Global/Memory.h"
+#include "Global/Constant.h"
+#include "Global/Enum.h"
+#include "Global/Matrix.h"
+#include "Global/Quaternion.h"
+#include "Global/Vector.h"
+#include "Global/CoreTypes.h"
+#include "Global/Transform.h"
+#include "Global/Macro.h"
+
+// Pointer
+#include "Source/Runtime/Core/Public/Templates/SharedPtr.h"
+#include "Source/Runtime/Core/Public/Templates/UniquePtr.h"
+
+using std::clamp;
+using std::unordered_map;
+using std::to_string;
+using std::function;
+using std::min;
+using std::max;
+using std::sort;
+using std::mutex;
+using std::lock_guard;
+using std::atomic;
+using std::streamsize;
+using std::ofstream;
+using std::ifstream;
+
+// File System
+namespace filesystem = std::filesystem;
+using filesystem::path;
+using filesystem::exists;
+using filesystem::create_directories;
+
+/**
+ * @brief 엔진 소스의 UE_LOG 매크로가 참조하는 콘솔 창 대역
+ * UE_LOG는 표준 출력에도 쓰므로 에디터 콘솔로 보내는 부분은 버린다
+ */
+class UConsoleWindow
+{
+public:
+	static UConsoleWindow& GetInstance()
+	{
+		static UConsoleWindow Instance;
+		return Instance;
+	}
+
+	template <typename... ArgsType>
+	void AddLog(const char*, ArgsType...)
+	{
+	}
+
+	template <typename... ArgsType>
+	void AddLog(ELogType, const char*, ArgsType...)
+	{
+	}
+};